@@ -0,0 +1,69 @@
+// Copyright 2024 10xEngineers
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <stdint.h>
+
+// Number of timed samples, each running BENCH_ITERATIONS rounds of the kernel
+#define BENCH_SAMPLES 101
+#define BENCH_ITERATIONS 256
+
+// Independent dependency chains interleaved by a throughput kernel
+#define BENCH_STREAMS 4
+
+// Array sweeps: every sample runs the kernel over the buffer until it has touched
+// at least BENCH_SWEEP_BYTES, with fewer samples once the buffer is past the caches
+#define BENCH_SWEEP_BYTES (1 << 20)
+#define BENCH_SWEEP_SAMPLES 11
+#define BENCH_SWEEP_LARGE_BYTES (8 << 20)
+#define BENCH_SWEEP_LARGE_SAMPLES 3
+
+// Output of bench_run(): the default text lines, or one record per benchmark
+// for scripts, as CSV (-DBENCH_FORMAT_CSV, lines starting with "BENCH,", after
+// a header line) or as JSON (-DBENCH_FORMAT_JSON, one object per line)
+#if defined(BENCH_FORMAT_CSV) && defined(BENCH_FORMAT_JSON)
+    #error "Define at most one of BENCH_FORMAT_CSV and BENCH_FORMAT_JSON."
+#endif
+
+// Kernel running the operation under test for the given number of rounds.
+// A latency kernel feeds each result into the next operation (one op per
+// round), a throughput kernel updates BENCH_STREAMS independent vectors
+// (BENCH_STREAMS ops per round).
+typedef void (*bench_kernel)(int iterations);
+
+// Makes the compiler assume the vector changed, so an operation on loop-invariant
+// operands is not hoisted and a result that is only kept alive is still computed
+#if defined(__aarch64__)
+    #define bench_opaque(v) __asm__ __volatile__("" : "+w"(v))
+#elif defined(__riscv)
+    #define bench_opaque(v) __asm__ __volatile__("" : "+vr"(v))
+#else
+    #define bench_opaque(v) __asm__ __volatile__("" : "+m"(v))
+#endif
+
+// Minimum, median and 99th percentile of one metric over the samples, per op
+struct bench_result {
+    double min;
+    double median;
+    double p99;
+};
+
+struct bench_stats {
+    struct bench_result ns;
+    struct bench_result cycles;
+    struct bench_result instret;
+    int has_counters;  // 0 when neither the CSRs nor perf_event_open are usable
+};
+
+void bench_measure(bench_kernel kernel, int ops_per_iteration, struct bench_stats *stats);
+void bench_measure_samples(bench_kernel kernel, int samples, int iterations, double ops_per_iteration,
+                           struct bench_stats *stats);
+void bench_run(const char *arch, const char *function, const char *type, int lanes,
+               const char *mode, bench_kernel kernel, int ops_per_iteration);
+void bench_unsupported(const char *arch, const char *function, const char *type, int lanes,
+                       const char *reason);
+void bench_run_sweep(const char *arch, const char *function, const char *impl, long bytes,
+                     long elements, bench_kernel kernel);
+
+#endif  // BENCHMARK_H
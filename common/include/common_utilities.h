@@ -20,5 +20,6 @@
 #define UINT64 8
 
 void print_results(void *results, int size, int type);
+void set_results_prefix(const char *test_name);
 
 #endif  // COMMON_UTILITIES_H
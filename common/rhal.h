@@ -0,0 +1,964 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_rhal_header.sh. Do not edit.
+
+#ifndef COMMON_RHAL_H_
+#define COMMON_RHAL_H_
+
+/*
+ * Header-only R-Halogen API. Every function of rhal_base.h is compiled from
+ * the same definitions as the librhal objects, but as a static always-inline
+ * function, so neighbouring operations can be fused and vsetvli hoisted out
+ * of the caller's loops. Include this header instead of rhal_base.h.
+ */
+
+#ifdef COMMON_RHAL_BASE_H_
+#error "rhal.h must be included instead of rhal_base.h, not after it."
+#endif
+
+#define RHAL_API static inline __attribute__((always_inline))
+
+#include "rhal_base.h"
+
+#include "vadd_s16_rvv.c"
+#include "vadd_s32_rvv.c"
+#include "vadd_s64_rvv.c"
+#include "vadd_s8_rvv.c"
+#include "vadd_u16_rvv.c"
+#include "vadd_u32_rvv.c"
+#include "vadd_u64_rvv.c"
+#include "vadd_u8_rvv.c"
+#include "vaddhn_s16_rvv.c"
+#include "vaddhn_s32_rvv.c"
+#include "vaddhn_s64_rvv.c"
+#include "vaddhn_u16_rvv.c"
+#include "vaddhn_u32_rvv.c"
+#include "vaddhn_u64_rvv.c"
+#include "vaddl_s16_rvv.c"
+#include "vaddl_s32_rvv.c"
+#include "vaddl_s8_rvv.c"
+#include "vaddl_u16_rvv.c"
+#include "vaddl_u32_rvv.c"
+#include "vaddl_u8_rvv.c"
+#include "vaddq_s16_rvv.c"
+#include "vaddq_s16_x2_rvv.c"
+#include "vaddq_s32_rvv.c"
+#include "vaddq_s32_x2_rvv.c"
+#include "vaddq_s64_rvv.c"
+#include "vaddq_s64_x2_rvv.c"
+#include "vaddq_s8_rvv.c"
+#include "vaddq_s8_x2_rvv.c"
+#include "vaddq_u16_rvv.c"
+#include "vaddq_u16_x2_rvv.c"
+#include "vaddq_u32_rvv.c"
+#include "vaddq_u32_x2_rvv.c"
+#include "vaddq_u64_rvv.c"
+#include "vaddq_u64_x2_rvv.c"
+#include "vaddq_u8_rvv.c"
+#include "vaddq_u8_x2_rvv.c"
+#include "vaddw_s16_rvv.c"
+#include "vaddw_s32_rvv.c"
+#include "vaddw_s8_rvv.c"
+#include "vaddw_u16_rvv.c"
+#include "vaddw_u32_rvv.c"
+#include "vaddw_u8_rvv.c"
+#include "vcombineq_s16_x2_rvv.c"
+#include "vcombineq_s32_x2_rvv.c"
+#include "vcombineq_s64_x2_rvv.c"
+#include "vcombineq_s8_x2_rvv.c"
+#include "vcombineq_u16_x2_rvv.c"
+#include "vcombineq_u32_x2_rvv.c"
+#include "vcombineq_u64_x2_rvv.c"
+#include "vcombineq_u8_x2_rvv.c"
+#include "vgetq_high_s16_x2_rvv.c"
+#include "vgetq_high_s32_x2_rvv.c"
+#include "vgetq_high_s64_x2_rvv.c"
+#include "vgetq_high_s8_x2_rvv.c"
+#include "vgetq_high_u16_x2_rvv.c"
+#include "vgetq_high_u32_x2_rvv.c"
+#include "vgetq_high_u64_x2_rvv.c"
+#include "vgetq_high_u8_x2_rvv.c"
+#include "vgetq_low_s16_x2_rvv.c"
+#include "vgetq_low_s32_x2_rvv.c"
+#include "vgetq_low_s64_x2_rvv.c"
+#include "vgetq_low_s8_x2_rvv.c"
+#include "vgetq_low_u16_x2_rvv.c"
+#include "vgetq_low_u32_x2_rvv.c"
+#include "vgetq_low_u64_x2_rvv.c"
+#include "vgetq_low_u8_x2_rvv.c"
+#include "vhadd_s16_rvv.c"
+#include "vhadd_s32_rvv.c"
+#include "vhadd_s8_rvv.c"
+#include "vhadd_u16_rvv.c"
+#include "vhadd_u32_rvv.c"
+#include "vhadd_u8_rvv.c"
+#include "vhaddq_s16_rvv.c"
+#include "vhaddq_s32_rvv.c"
+#include "vhaddq_s8_rvv.c"
+#include "vhaddq_u16_rvv.c"
+#include "vhaddq_u32_rvv.c"
+#include "vhaddq_u8_rvv.c"
+#include "vhsub_s16_rvv.c"
+#include "vhsub_s32_rvv.c"
+#include "vhsub_s8_rvv.c"
+#include "vhsub_u16_rvv.c"
+#include "vhsub_u32_rvv.c"
+#include "vhsub_u8_rvv.c"
+#include "vhsubq_s16_rvv.c"
+#include "vhsubq_s32_rvv.c"
+#include "vhsubq_s8_rvv.c"
+#include "vhsubq_u16_rvv.c"
+#include "vhsubq_u32_rvv.c"
+#include "vhsubq_u8_rvv.c"
+#include "vld1_dup_s16_rvv.c"
+#include "vld1_dup_s32_rvv.c"
+#include "vld1_dup_s64_rvv.c"
+#include "vld1_dup_s8_rvv.c"
+#include "vld1_dup_u16_rvv.c"
+#include "vld1_dup_u32_rvv.c"
+#include "vld1_dup_u64_rvv.c"
+#include "vld1_dup_u8_rvv.c"
+#include "vld1_lane_s16_rvv.c"
+#include "vld1_lane_s32_rvv.c"
+#include "vld1_lane_s64_rvv.c"
+#include "vld1_lane_s8_rvv.c"
+#include "vld1_lane_u16_rvv.c"
+#include "vld1_lane_u32_rvv.c"
+#include "vld1_lane_u64_rvv.c"
+#include "vld1_lane_u8_rvv.c"
+#include "vld1_s16_rvv.c"
+#include "vld1_s16_x2_rvv.c"
+#include "vld1_s16_x3_rvv.c"
+#include "vld1_s16_x4_rvv.c"
+#include "vld1_s32_rvv.c"
+#include "vld1_s32_x2_rvv.c"
+#include "vld1_s32_x3_rvv.c"
+#include "vld1_s32_x4_rvv.c"
+#include "vld1_s64_rvv.c"
+#include "vld1_s64_x2_rvv.c"
+#include "vld1_s64_x3_rvv.c"
+#include "vld1_s64_x4_rvv.c"
+#include "vld1_s8_rvv.c"
+#include "vld1_s8_x2_rvv.c"
+#include "vld1_s8_x3_rvv.c"
+#include "vld1_s8_x4_rvv.c"
+#include "vld1_u16_rvv.c"
+#include "vld1_u16_x2_rvv.c"
+#include "vld1_u16_x3_rvv.c"
+#include "vld1_u16_x4_rvv.c"
+#include "vld1_u32_rvv.c"
+#include "vld1_u32_x2_rvv.c"
+#include "vld1_u32_x3_rvv.c"
+#include "vld1_u32_x4_rvv.c"
+#include "vld1_u64_rvv.c"
+#include "vld1_u64_x2_rvv.c"
+#include "vld1_u64_x3_rvv.c"
+#include "vld1_u64_x4_rvv.c"
+#include "vld1_u8_rvv.c"
+#include "vld1_u8_x2_rvv.c"
+#include "vld1_u8_x3_rvv.c"
+#include "vld1_u8_x4_rvv.c"
+#include "vld1q_dup_s16_rvv.c"
+#include "vld1q_dup_s32_rvv.c"
+#include "vld1q_dup_s64_rvv.c"
+#include "vld1q_dup_s8_rvv.c"
+#include "vld1q_dup_u16_rvv.c"
+#include "vld1q_dup_u32_rvv.c"
+#include "vld1q_dup_u64_rvv.c"
+#include "vld1q_dup_u8_rvv.c"
+#include "vld1q_lane_s16_rvv.c"
+#include "vld1q_lane_s32_rvv.c"
+#include "vld1q_lane_s64_rvv.c"
+#include "vld1q_lane_s8_rvv.c"
+#include "vld1q_lane_u16_rvv.c"
+#include "vld1q_lane_u32_rvv.c"
+#include "vld1q_lane_u64_rvv.c"
+#include "vld1q_lane_u8_rvv.c"
+#include "vld1q_s16_rvv.c"
+#include "vld1q_s16_x2_rvv.c"
+#include "vld1q_s16_x3_rvv.c"
+#include "vld1q_s16_x4_rvv.c"
+#include "vld1q_s32_rvv.c"
+#include "vld1q_s32_x2_rvv.c"
+#include "vld1q_s32_x3_rvv.c"
+#include "vld1q_s32_x4_rvv.c"
+#include "vld1q_s64_rvv.c"
+#include "vld1q_s64_x2_rvv.c"
+#include "vld1q_s64_x3_rvv.c"
+#include "vld1q_s64_x4_rvv.c"
+#include "vld1q_s8_rvv.c"
+#include "vld1q_s8_x2_rvv.c"
+#include "vld1q_s8_x3_rvv.c"
+#include "vld1q_s8_x4_rvv.c"
+#include "vld1q_u16_rvv.c"
+#include "vld1q_u16_x2_rvv.c"
+#include "vld1q_u16_x3_rvv.c"
+#include "vld1q_u16_x4_rvv.c"
+#include "vld1q_u32_rvv.c"
+#include "vld1q_u32_x2_rvv.c"
+#include "vld1q_u32_x3_rvv.c"
+#include "vld1q_u32_x4_rvv.c"
+#include "vld1q_u64_rvv.c"
+#include "vld1q_u64_x2_rvv.c"
+#include "vld1q_u64_x3_rvv.c"
+#include "vld1q_u64_x4_rvv.c"
+#include "vld1q_u8_rvv.c"
+#include "vld1q_u8_x2_rvv.c"
+#include "vld1q_u8_x3_rvv.c"
+#include "vld1q_u8_x4_rvv.c"
+#include "vld2_dup_s16_rvv.c"
+#include "vld2_dup_s32_rvv.c"
+#include "vld2_dup_s64_rvv.c"
+#include "vld2_dup_s8_rvv.c"
+#include "vld2_dup_u16_rvv.c"
+#include "vld2_dup_u32_rvv.c"
+#include "vld2_dup_u64_rvv.c"
+#include "vld2_dup_u8_rvv.c"
+#include "vld2_lane_s16_rvv.c"
+#include "vld2_lane_s32_rvv.c"
+#include "vld2_lane_s64_rvv.c"
+#include "vld2_lane_s8_rvv.c"
+#include "vld2_lane_u16_rvv.c"
+#include "vld2_lane_u32_rvv.c"
+#include "vld2_lane_u64_rvv.c"
+#include "vld2_lane_u8_rvv.c"
+#include "vld2_s16_rvv.c"
+#include "vld2_s32_rvv.c"
+#include "vld2_s64_rvv.c"
+#include "vld2_s8_rvv.c"
+#include "vld2_u16_rvv.c"
+#include "vld2_u32_rvv.c"
+#include "vld2_u64_rvv.c"
+#include "vld2_u8_rvv.c"
+#include "vld2q_dup_s16_rvv.c"
+#include "vld2q_dup_s32_rvv.c"
+#include "vld2q_dup_s64_rvv.c"
+#include "vld2q_dup_s8_rvv.c"
+#include "vld2q_dup_u16_rvv.c"
+#include "vld2q_dup_u32_rvv.c"
+#include "vld2q_dup_u64_rvv.c"
+#include "vld2q_dup_u8_rvv.c"
+#include "vld2q_lane_s16_rvv.c"
+#include "vld2q_lane_s32_rvv.c"
+#include "vld2q_lane_s64_rvv.c"
+#include "vld2q_lane_s8_rvv.c"
+#include "vld2q_lane_u16_rvv.c"
+#include "vld2q_lane_u32_rvv.c"
+#include "vld2q_lane_u64_rvv.c"
+#include "vld2q_lane_u8_rvv.c"
+#include "vld2q_s16_rvv.c"
+#include "vld2q_s32_rvv.c"
+#include "vld2q_s64_rvv.c"
+#include "vld2q_s8_rvv.c"
+#include "vld2q_u16_rvv.c"
+#include "vld2q_u32_rvv.c"
+#include "vld2q_u64_rvv.c"
+#include "vld2q_u8_rvv.c"
+#include "vld3_dup_s16_rvv.c"
+#include "vld3_dup_s32_rvv.c"
+#include "vld3_dup_s64_rvv.c"
+#include "vld3_dup_s8_rvv.c"
+#include "vld3_dup_u16_rvv.c"
+#include "vld3_dup_u32_rvv.c"
+#include "vld3_dup_u64_rvv.c"
+#include "vld3_dup_u8_rvv.c"
+#include "vld3_lane_s16_rvv.c"
+#include "vld3_lane_s32_rvv.c"
+#include "vld3_lane_s64_rvv.c"
+#include "vld3_lane_s8_rvv.c"
+#include "vld3_lane_u16_rvv.c"
+#include "vld3_lane_u32_rvv.c"
+#include "vld3_lane_u64_rvv.c"
+#include "vld3_lane_u8_rvv.c"
+#include "vld3_s16_rvv.c"
+#include "vld3_s32_rvv.c"
+#include "vld3_s64_rvv.c"
+#include "vld3_s8_rvv.c"
+#include "vld3_u16_rvv.c"
+#include "vld3_u32_rvv.c"
+#include "vld3_u64_rvv.c"
+#include "vld3_u8_rvv.c"
+#include "vld3q_dup_s16_rvv.c"
+#include "vld3q_dup_s32_rvv.c"
+#include "vld3q_dup_s64_rvv.c"
+#include "vld3q_dup_s8_rvv.c"
+#include "vld3q_dup_u16_rvv.c"
+#include "vld3q_dup_u32_rvv.c"
+#include "vld3q_dup_u64_rvv.c"
+#include "vld3q_dup_u8_rvv.c"
+#include "vld3q_lane_s16_rvv.c"
+#include "vld3q_lane_s32_rvv.c"
+#include "vld3q_lane_s64_rvv.c"
+#include "vld3q_lane_s8_rvv.c"
+#include "vld3q_lane_u16_rvv.c"
+#include "vld3q_lane_u32_rvv.c"
+#include "vld3q_lane_u64_rvv.c"
+#include "vld3q_lane_u8_rvv.c"
+#include "vld3q_s16_rvv.c"
+#include "vld3q_s32_rvv.c"
+#include "vld3q_s64_rvv.c"
+#include "vld3q_s8_rvv.c"
+#include "vld3q_u16_rvv.c"
+#include "vld3q_u32_rvv.c"
+#include "vld3q_u64_rvv.c"
+#include "vld3q_u8_rvv.c"
+#include "vld4_dup_s16_rvv.c"
+#include "vld4_dup_s32_rvv.c"
+#include "vld4_dup_s64_rvv.c"
+#include "vld4_dup_s8_rvv.c"
+#include "vld4_dup_u16_rvv.c"
+#include "vld4_dup_u32_rvv.c"
+#include "vld4_dup_u64_rvv.c"
+#include "vld4_dup_u8_rvv.c"
+#include "vld4_lane_s16_rvv.c"
+#include "vld4_lane_s32_rvv.c"
+#include "vld4_lane_s64_rvv.c"
+#include "vld4_lane_s8_rvv.c"
+#include "vld4_lane_u16_rvv.c"
+#include "vld4_lane_u32_rvv.c"
+#include "vld4_lane_u64_rvv.c"
+#include "vld4_lane_u8_rvv.c"
+#include "vld4_s16_rvv.c"
+#include "vld4_s32_rvv.c"
+#include "vld4_s64_rvv.c"
+#include "vld4_s8_rvv.c"
+#include "vld4_u16_rvv.c"
+#include "vld4_u32_rvv.c"
+#include "vld4_u64_rvv.c"
+#include "vld4_u8_rvv.c"
+#include "vld4q_dup_s16_rvv.c"
+#include "vld4q_dup_s32_rvv.c"
+#include "vld4q_dup_s64_rvv.c"
+#include "vld4q_dup_s8_rvv.c"
+#include "vld4q_dup_u16_rvv.c"
+#include "vld4q_dup_u32_rvv.c"
+#include "vld4q_dup_u64_rvv.c"
+#include "vld4q_dup_u8_rvv.c"
+#include "vld4q_lane_s16_rvv.c"
+#include "vld4q_lane_s32_rvv.c"
+#include "vld4q_lane_s64_rvv.c"
+#include "vld4q_lane_s8_rvv.c"
+#include "vld4q_lane_u16_rvv.c"
+#include "vld4q_lane_u32_rvv.c"
+#include "vld4q_lane_u64_rvv.c"
+#include "vld4q_lane_u8_rvv.c"
+#include "vld4q_s16_rvv.c"
+#include "vld4q_s32_rvv.c"
+#include "vld4q_s64_rvv.c"
+#include "vld4q_s8_rvv.c"
+#include "vld4q_u16_rvv.c"
+#include "vld4q_u32_rvv.c"
+#include "vld4q_u64_rvv.c"
+#include "vld4q_u8_rvv.c"
+#include "vmla_lane_s16_rvv.c"
+#include "vmla_lane_s32_rvv.c"
+#include "vmla_lane_u16_rvv.c"
+#include "vmla_lane_u32_rvv.c"
+#include "vmla_laneq_s16_rvv.c"
+#include "vmla_laneq_s32_rvv.c"
+#include "vmla_laneq_u16_rvv.c"
+#include "vmla_laneq_u32_rvv.c"
+#include "vmla_n_s16_rvv.c"
+#include "vmla_n_s32_rvv.c"
+#include "vmla_n_u16_rvv.c"
+#include "vmla_n_u32_rvv.c"
+#include "vmla_s16_rvv.c"
+#include "vmla_s32_rvv.c"
+#include "vmla_s8_rvv.c"
+#include "vmla_u16_rvv.c"
+#include "vmla_u32_rvv.c"
+#include "vmla_u8_rvv.c"
+#include "vmlal_high_lane_s16_rvv.c"
+#include "vmlal_high_lane_s32_rvv.c"
+#include "vmlal_high_lane_u16_rvv.c"
+#include "vmlal_high_lane_u32_rvv.c"
+#include "vmlal_high_laneq_s16_rvv.c"
+#include "vmlal_high_laneq_s32_rvv.c"
+#include "vmlal_high_laneq_u16_rvv.c"
+#include "vmlal_high_laneq_u32_rvv.c"
+#include "vmlal_high_n_s16_rvv.c"
+#include "vmlal_high_n_s32_rvv.c"
+#include "vmlal_high_n_u16_rvv.c"
+#include "vmlal_high_n_u32_rvv.c"
+#include "vmlal_high_s16_rvv.c"
+#include "vmlal_high_s32_rvv.c"
+#include "vmlal_high_s8_rvv.c"
+#include "vmlal_high_u16_rvv.c"
+#include "vmlal_high_u32_rvv.c"
+#include "vmlal_high_u8_rvv.c"
+#include "vmlal_lane_s16_rvv.c"
+#include "vmlal_lane_s32_rvv.c"
+#include "vmlal_lane_u16_rvv.c"
+#include "vmlal_lane_u32_rvv.c"
+#include "vmlal_laneq_s16_rvv.c"
+#include "vmlal_laneq_s32_rvv.c"
+#include "vmlal_laneq_u16_rvv.c"
+#include "vmlal_laneq_u32_rvv.c"
+#include "vmlal_n_s16_rvv.c"
+#include "vmlal_n_s32_rvv.c"
+#include "vmlal_n_u16_rvv.c"
+#include "vmlal_n_u32_rvv.c"
+#include "vmlal_s16_rvv.c"
+#include "vmlal_s32_rvv.c"
+#include "vmlal_s8_rvv.c"
+#include "vmlal_u16_rvv.c"
+#include "vmlal_u32_rvv.c"
+#include "vmlal_u8_rvv.c"
+#include "vmlaq_lane_s16_rvv.c"
+#include "vmlaq_lane_s32_rvv.c"
+#include "vmlaq_lane_u16_rvv.c"
+#include "vmlaq_lane_u32_rvv.c"
+#include "vmlaq_laneq_s16_rvv.c"
+#include "vmlaq_laneq_s32_rvv.c"
+#include "vmlaq_laneq_u16_rvv.c"
+#include "vmlaq_laneq_u32_rvv.c"
+#include "vmlaq_n_s16_rvv.c"
+#include "vmlaq_n_s32_rvv.c"
+#include "vmlaq_n_u16_rvv.c"
+#include "vmlaq_n_u32_rvv.c"
+#include "vmlaq_s16_rvv.c"
+#include "vmlaq_s32_rvv.c"
+#include "vmlaq_s8_rvv.c"
+#include "vmlaq_u16_rvv.c"
+#include "vmlaq_u32_rvv.c"
+#include "vmlaq_u8_rvv.c"
+#include "vmls_lane_s16_rvv.c"
+#include "vmls_lane_s32_rvv.c"
+#include "vmls_lane_u16_rvv.c"
+#include "vmls_lane_u32_rvv.c"
+#include "vmls_laneq_s16_rvv.c"
+#include "vmls_laneq_s32_rvv.c"
+#include "vmls_laneq_u16_rvv.c"
+#include "vmls_laneq_u32_rvv.c"
+#include "vmls_n_s16_rvv.c"
+#include "vmls_n_s32_rvv.c"
+#include "vmls_n_u16_rvv.c"
+#include "vmls_n_u32_rvv.c"
+#include "vmls_s16_rvv.c"
+#include "vmls_s32_rvv.c"
+#include "vmls_s8_rvv.c"
+#include "vmls_u16_rvv.c"
+#include "vmls_u32_rvv.c"
+#include "vmls_u8_rvv.c"
+#include "vmlsl_high_lane_s16_rvv.c"
+#include "vmlsl_high_lane_s32_rvv.c"
+#include "vmlsl_high_lane_u16_rvv.c"
+#include "vmlsl_high_lane_u32_rvv.c"
+#include "vmlsl_high_laneq_s16_rvv.c"
+#include "vmlsl_high_laneq_s32_rvv.c"
+#include "vmlsl_high_laneq_u16_rvv.c"
+#include "vmlsl_high_laneq_u32_rvv.c"
+#include "vmlsl_high_n_s16_rvv.c"
+#include "vmlsl_high_n_s32_rvv.c"
+#include "vmlsl_high_n_u16_rvv.c"
+#include "vmlsl_high_n_u32_rvv.c"
+#include "vmlsl_high_s16_rvv.c"
+#include "vmlsl_high_s32_rvv.c"
+#include "vmlsl_high_s8_rvv.c"
+#include "vmlsl_high_u16_rvv.c"
+#include "vmlsl_high_u32_rvv.c"
+#include "vmlsl_high_u8_rvv.c"
+#include "vmlsl_lane_s16_rvv.c"
+#include "vmlsl_lane_s32_rvv.c"
+#include "vmlsl_lane_u16_rvv.c"
+#include "vmlsl_lane_u32_rvv.c"
+#include "vmlsl_laneq_s16_rvv.c"
+#include "vmlsl_laneq_s32_rvv.c"
+#include "vmlsl_laneq_u16_rvv.c"
+#include "vmlsl_laneq_u32_rvv.c"
+#include "vmlsl_n_s16_rvv.c"
+#include "vmlsl_n_s32_rvv.c"
+#include "vmlsl_n_u16_rvv.c"
+#include "vmlsl_n_u32_rvv.c"
+#include "vmlsl_s16_rvv.c"
+#include "vmlsl_s32_rvv.c"
+#include "vmlsl_s8_rvv.c"
+#include "vmlsl_u16_rvv.c"
+#include "vmlsl_u32_rvv.c"
+#include "vmlsl_u8_rvv.c"
+#include "vmlsq_lane_s16_rvv.c"
+#include "vmlsq_lane_s32_rvv.c"
+#include "vmlsq_lane_u16_rvv.c"
+#include "vmlsq_lane_u32_rvv.c"
+#include "vmlsq_laneq_s16_rvv.c"
+#include "vmlsq_laneq_s32_rvv.c"
+#include "vmlsq_laneq_u16_rvv.c"
+#include "vmlsq_laneq_u32_rvv.c"
+#include "vmlsq_n_s16_rvv.c"
+#include "vmlsq_n_s32_rvv.c"
+#include "vmlsq_n_u16_rvv.c"
+#include "vmlsq_n_u32_rvv.c"
+#include "vmlsq_s16_rvv.c"
+#include "vmlsq_s32_rvv.c"
+#include "vmlsq_s8_rvv.c"
+#include "vmlsq_u16_rvv.c"
+#include "vmlsq_u32_rvv.c"
+#include "vmlsq_u8_rvv.c"
+#include "vmul_lane_s16_rvv.c"
+#include "vmul_lane_s32_rvv.c"
+#include "vmul_lane_u16_rvv.c"
+#include "vmul_lane_u32_rvv.c"
+#include "vmul_laneq_s16_rvv.c"
+#include "vmul_laneq_s32_rvv.c"
+#include "vmul_laneq_u16_rvv.c"
+#include "vmul_laneq_u32_rvv.c"
+#include "vmul_n_s16_rvv.c"
+#include "vmul_n_s32_rvv.c"
+#include "vmul_n_u16_rvv.c"
+#include "vmul_n_u32_rvv.c"
+#include "vmul_s16_rvv.c"
+#include "vmul_s32_rvv.c"
+#include "vmul_s8_rvv.c"
+#include "vmul_u16_rvv.c"
+#include "vmul_u32_rvv.c"
+#include "vmul_u8_rvv.c"
+#include "vmull_high_lane_s16_rvv.c"
+#include "vmull_high_lane_s32_rvv.c"
+#include "vmull_high_lane_u16_rvv.c"
+#include "vmull_high_lane_u32_rvv.c"
+#include "vmull_high_laneq_s16_rvv.c"
+#include "vmull_high_laneq_s32_rvv.c"
+#include "vmull_high_laneq_u16_rvv.c"
+#include "vmull_high_laneq_u32_rvv.c"
+#include "vmull_high_n_s16_rvv.c"
+#include "vmull_high_n_s32_rvv.c"
+#include "vmull_high_n_u16_rvv.c"
+#include "vmull_high_n_u32_rvv.c"
+#include "vmull_high_s16_rvv.c"
+#include "vmull_high_s32_rvv.c"
+#include "vmull_high_s8_rvv.c"
+#include "vmull_high_u16_rvv.c"
+#include "vmull_high_u32_rvv.c"
+#include "vmull_high_u8_rvv.c"
+#include "vmull_lane_s16_rvv.c"
+#include "vmull_lane_s32_rvv.c"
+#include "vmull_lane_u16_rvv.c"
+#include "vmull_lane_u32_rvv.c"
+#include "vmull_laneq_s16_rvv.c"
+#include "vmull_laneq_s32_rvv.c"
+#include "vmull_laneq_u16_rvv.c"
+#include "vmull_laneq_u32_rvv.c"
+#include "vmull_n_s16_rvv.c"
+#include "vmull_n_s32_rvv.c"
+#include "vmull_n_u16_rvv.c"
+#include "vmull_n_u32_rvv.c"
+#include "vmull_s16_rvv.c"
+#include "vmull_s32_rvv.c"
+#include "vmull_s8_rvv.c"
+#include "vmull_u16_rvv.c"
+#include "vmull_u32_rvv.c"
+#include "vmull_u8_rvv.c"
+#include "vmulq_lane_s16_rvv.c"
+#include "vmulq_lane_s32_rvv.c"
+#include "vmulq_lane_u16_rvv.c"
+#include "vmulq_lane_u32_rvv.c"
+#include "vmulq_laneq_s16_rvv.c"
+#include "vmulq_laneq_s32_rvv.c"
+#include "vmulq_laneq_u16_rvv.c"
+#include "vmulq_laneq_u32_rvv.c"
+#include "vmulq_n_s16_rvv.c"
+#include "vmulq_n_s32_rvv.c"
+#include "vmulq_n_u16_rvv.c"
+#include "vmulq_n_u32_rvv.c"
+#include "vmulq_s16_rvv.c"
+#include "vmulq_s32_rvv.c"
+#include "vmulq_s8_rvv.c"
+#include "vmulq_u16_rvv.c"
+#include "vmulq_u32_rvv.c"
+#include "vmulq_u8_rvv.c"
+#include "vqadd_s16_rvv.c"
+#include "vqadd_s32_rvv.c"
+#include "vqadd_s64_rvv.c"
+#include "vqadd_s8_rvv.c"
+#include "vqadd_u16_rvv.c"
+#include "vqadd_u32_rvv.c"
+#include "vqadd_u64_rvv.c"
+#include "vqadd_u8_rvv.c"
+#include "vqaddq_s16_rvv.c"
+#include "vqaddq_s16_x2_rvv.c"
+#include "vqaddq_s32_rvv.c"
+#include "vqaddq_s32_x2_rvv.c"
+#include "vqaddq_s64_rvv.c"
+#include "vqaddq_s64_x2_rvv.c"
+#include "vqaddq_s8_rvv.c"
+#include "vqaddq_s8_x2_rvv.c"
+#include "vqaddq_u16_rvv.c"
+#include "vqaddq_u16_x2_rvv.c"
+#include "vqaddq_u32_rvv.c"
+#include "vqaddq_u32_x2_rvv.c"
+#include "vqaddq_u64_rvv.c"
+#include "vqaddq_u64_x2_rvv.c"
+#include "vqaddq_u8_rvv.c"
+#include "vqaddq_u8_x2_rvv.c"
+#include "vqdmlal_high_lane_s16_rvv.c"
+#include "vqdmlal_high_lane_s32_rvv.c"
+#include "vqdmlal_high_laneq_s16_rvv.c"
+#include "vqdmlal_high_laneq_s32_rvv.c"
+#include "vqdmlal_high_n_s16_rvv.c"
+#include "vqdmlal_high_n_s32_rvv.c"
+#include "vqdmlal_high_s16_rvv.c"
+#include "vqdmlal_high_s32_rvv.c"
+#include "vqdmlal_lane_s16_rvv.c"
+#include "vqdmlal_lane_s32_rvv.c"
+#include "vqdmlal_laneq_s16_rvv.c"
+#include "vqdmlal_laneq_s32_rvv.c"
+#include "vqdmlal_n_s16_rvv.c"
+#include "vqdmlal_n_s32_rvv.c"
+#include "vqdmlal_s16_rvv.c"
+#include "vqdmlal_s32_rvv.c"
+#include "vqdmlsl_high_lane_s16_rvv.c"
+#include "vqdmlsl_high_lane_s32_rvv.c"
+#include "vqdmlsl_high_laneq_s16_rvv.c"
+#include "vqdmlsl_high_laneq_s32_rvv.c"
+#include "vqdmlsl_high_n_s16_rvv.c"
+#include "vqdmlsl_high_n_s32_rvv.c"
+#include "vqdmlsl_high_s16_rvv.c"
+#include "vqdmlsl_high_s32_rvv.c"
+#include "vqdmlsl_lane_s16_rvv.c"
+#include "vqdmlsl_lane_s32_rvv.c"
+#include "vqdmlsl_laneq_s16_rvv.c"
+#include "vqdmlsl_laneq_s32_rvv.c"
+#include "vqdmlsl_n_s16_rvv.c"
+#include "vqdmlsl_n_s32_rvv.c"
+#include "vqdmlsl_s16_rvv.c"
+#include "vqdmlsl_s32_rvv.c"
+#include "vqdmulh_lane_s16_rvv.c"
+#include "vqdmulh_lane_s32_rvv.c"
+#include "vqdmulh_laneq_s16_rvv.c"
+#include "vqdmulh_laneq_s32_rvv.c"
+#include "vqdmulh_n_s16_rvv.c"
+#include "vqdmulh_n_s32_rvv.c"
+#include "vqdmulh_s16_rvv.c"
+#include "vqdmulh_s32_rvv.c"
+#include "vqdmulhq_lane_s16_rvv.c"
+#include "vqdmulhq_lane_s32_rvv.c"
+#include "vqdmulhq_laneq_s16_rvv.c"
+#include "vqdmulhq_laneq_s32_rvv.c"
+#include "vqdmulhq_n_s16_rvv.c"
+#include "vqdmulhq_n_s32_rvv.c"
+#include "vqdmulhq_s16_rvv.c"
+#include "vqdmulhq_s32_rvv.c"
+#include "vqdmull_high_lane_s16_rvv.c"
+#include "vqdmull_high_lane_s32_rvv.c"
+#include "vqdmull_high_laneq_s16_rvv.c"
+#include "vqdmull_high_laneq_s32_rvv.c"
+#include "vqdmull_high_n_s16_rvv.c"
+#include "vqdmull_high_n_s32_rvv.c"
+#include "vqdmull_high_s16_rvv.c"
+#include "vqdmull_high_s32_rvv.c"
+#include "vqdmull_lane_s16_rvv.c"
+#include "vqdmull_lane_s32_rvv.c"
+#include "vqdmull_laneq_s16_rvv.c"
+#include "vqdmull_laneq_s32_rvv.c"
+#include "vqdmull_n_s16_rvv.c"
+#include "vqdmull_n_s32_rvv.c"
+#include "vqdmull_s16_rvv.c"
+#include "vqdmull_s32_rvv.c"
+#include "vqrdmlah_lane_s16_rvv.c"
+#include "vqrdmlah_lane_s32_rvv.c"
+#include "vqrdmlah_laneq_s16_rvv.c"
+#include "vqrdmlah_laneq_s32_rvv.c"
+#include "vqrdmlah_s16_rvv.c"
+#include "vqrdmlah_s32_rvv.c"
+#include "vqrdmlahq_lane_s16_rvv.c"
+#include "vqrdmlahq_lane_s32_rvv.c"
+#include "vqrdmlahq_laneq_s16_rvv.c"
+#include "vqrdmlahq_laneq_s32_rvv.c"
+#include "vqrdmlahq_s16_rvv.c"
+#include "vqrdmlahq_s32_rvv.c"
+#include "vqrdmlsh_lane_s16_rvv.c"
+#include "vqrdmlsh_lane_s32_rvv.c"
+#include "vqrdmlsh_laneq_s16_rvv.c"
+#include "vqrdmlsh_laneq_s32_rvv.c"
+#include "vqrdmlsh_s16_rvv.c"
+#include "vqrdmlsh_s32_rvv.c"
+#include "vqrdmlshq_lane_s16_rvv.c"
+#include "vqrdmlshq_lane_s32_rvv.c"
+#include "vqrdmlshq_laneq_s16_rvv.c"
+#include "vqrdmlshq_laneq_s32_rvv.c"
+#include "vqrdmlshq_s16_rvv.c"
+#include "vqrdmlshq_s32_rvv.c"
+#include "vqrdmulh_lane_s16_rvv.c"
+#include "vqrdmulh_lane_s32_rvv.c"
+#include "vqrdmulh_laneq_s16_rvv.c"
+#include "vqrdmulh_laneq_s32_rvv.c"
+#include "vqrdmulh_n_s16_rvv.c"
+#include "vqrdmulh_n_s32_rvv.c"
+#include "vqrdmulh_s16_rvv.c"
+#include "vqrdmulh_s32_rvv.c"
+#include "vqrdmulhq_lane_s16_rvv.c"
+#include "vqrdmulhq_lane_s32_rvv.c"
+#include "vqrdmulhq_laneq_s16_rvv.c"
+#include "vqrdmulhq_laneq_s32_rvv.c"
+#include "vqrdmulhq_n_s16_rvv.c"
+#include "vqrdmulhq_n_s32_rvv.c"
+#include "vqrdmulhq_s16_rvv.c"
+#include "vqrdmulhq_s32_rvv.c"
+#include "vqsub_s16_rvv.c"
+#include "vqsub_s32_rvv.c"
+#include "vqsub_s64_rvv.c"
+#include "vqsub_s8_rvv.c"
+#include "vqsub_u16_rvv.c"
+#include "vqsub_u32_rvv.c"
+#include "vqsub_u64_rvv.c"
+#include "vqsub_u8_rvv.c"
+#include "vqsubq_s16_rvv.c"
+#include "vqsubq_s16_x2_rvv.c"
+#include "vqsubq_s32_rvv.c"
+#include "vqsubq_s32_x2_rvv.c"
+#include "vqsubq_s64_rvv.c"
+#include "vqsubq_s64_x2_rvv.c"
+#include "vqsubq_s8_rvv.c"
+#include "vqsubq_s8_x2_rvv.c"
+#include "vqsubq_u16_rvv.c"
+#include "vqsubq_u16_x2_rvv.c"
+#include "vqsubq_u32_rvv.c"
+#include "vqsubq_u32_x2_rvv.c"
+#include "vqsubq_u64_rvv.c"
+#include "vqsubq_u64_x2_rvv.c"
+#include "vqsubq_u8_rvv.c"
+#include "vqsubq_u8_x2_rvv.c"
+#include "vraddhn_s16_rvv.c"
+#include "vraddhn_s32_rvv.c"
+#include "vraddhn_s64_rvv.c"
+#include "vraddhn_u16_rvv.c"
+#include "vraddhn_u32_rvv.c"
+#include "vraddhn_u64_rvv.c"
+#include "vrhadd_s16_rvv.c"
+#include "vrhadd_s32_rvv.c"
+#include "vrhadd_s8_rvv.c"
+#include "vrhadd_u16_rvv.c"
+#include "vrhadd_u32_rvv.c"
+#include "vrhadd_u8_rvv.c"
+#include "vrhaddq_s16_rvv.c"
+#include "vrhaddq_s32_rvv.c"
+#include "vrhaddq_s8_rvv.c"
+#include "vrhaddq_u16_rvv.c"
+#include "vrhaddq_u32_rvv.c"
+#include "vrhaddq_u8_rvv.c"
+#include "vrsubhn_s16_rvv.c"
+#include "vrsubhn_s32_rvv.c"
+#include "vrsubhn_s64_rvv.c"
+#include "vrsubhn_u16_rvv.c"
+#include "vrsubhn_u32_rvv.c"
+#include "vrsubhn_u64_rvv.c"
+#include "vst1_lane_s16_rvv.c"
+#include "vst1_lane_s32_rvv.c"
+#include "vst1_lane_s64_rvv.c"
+#include "vst1_lane_s8_rvv.c"
+#include "vst1_lane_u16_rvv.c"
+#include "vst1_lane_u32_rvv.c"
+#include "vst1_lane_u64_rvv.c"
+#include "vst1_lane_u8_rvv.c"
+#include "vst1_s16_rvv.c"
+#include "vst1_s16_x2_rvv.c"
+#include "vst1_s16_x3_rvv.c"
+#include "vst1_s16_x4_rvv.c"
+#include "vst1_s32_rvv.c"
+#include "vst1_s32_x2_rvv.c"
+#include "vst1_s32_x3_rvv.c"
+#include "vst1_s32_x4_rvv.c"
+#include "vst1_s64_rvv.c"
+#include "vst1_s64_x2_rvv.c"
+#include "vst1_s64_x3_rvv.c"
+#include "vst1_s64_x4_rvv.c"
+#include "vst1_s8_rvv.c"
+#include "vst1_s8_x2_rvv.c"
+#include "vst1_s8_x3_rvv.c"
+#include "vst1_s8_x4_rvv.c"
+#include "vst1_u16_rvv.c"
+#include "vst1_u16_x2_rvv.c"
+#include "vst1_u16_x3_rvv.c"
+#include "vst1_u16_x4_rvv.c"
+#include "vst1_u32_rvv.c"
+#include "vst1_u32_x2_rvv.c"
+#include "vst1_u32_x3_rvv.c"
+#include "vst1_u32_x4_rvv.c"
+#include "vst1_u64_rvv.c"
+#include "vst1_u64_x2_rvv.c"
+#include "vst1_u64_x3_rvv.c"
+#include "vst1_u64_x4_rvv.c"
+#include "vst1_u8_rvv.c"
+#include "vst1_u8_x2_rvv.c"
+#include "vst1_u8_x3_rvv.c"
+#include "vst1_u8_x4_rvv.c"
+#include "vst1q_lane_s16_rvv.c"
+#include "vst1q_lane_s32_rvv.c"
+#include "vst1q_lane_s64_rvv.c"
+#include "vst1q_lane_s8_rvv.c"
+#include "vst1q_lane_u16_rvv.c"
+#include "vst1q_lane_u32_rvv.c"
+#include "vst1q_lane_u64_rvv.c"
+#include "vst1q_lane_u8_rvv.c"
+#include "vst1q_s16_rvv.c"
+#include "vst1q_s16_x2_rvv.c"
+#include "vst1q_s16_x3_rvv.c"
+#include "vst1q_s16_x4_rvv.c"
+#include "vst1q_s32_rvv.c"
+#include "vst1q_s32_x2_rvv.c"
+#include "vst1q_s32_x3_rvv.c"
+#include "vst1q_s32_x4_rvv.c"
+#include "vst1q_s64_rvv.c"
+#include "vst1q_s64_x2_rvv.c"
+#include "vst1q_s64_x3_rvv.c"
+#include "vst1q_s64_x4_rvv.c"
+#include "vst1q_s8_rvv.c"
+#include "vst1q_s8_x2_rvv.c"
+#include "vst1q_s8_x3_rvv.c"
+#include "vst1q_s8_x4_rvv.c"
+#include "vst1q_u16_rvv.c"
+#include "vst1q_u16_x2_rvv.c"
+#include "vst1q_u16_x3_rvv.c"
+#include "vst1q_u16_x4_rvv.c"
+#include "vst1q_u32_rvv.c"
+#include "vst1q_u32_x2_rvv.c"
+#include "vst1q_u32_x3_rvv.c"
+#include "vst1q_u32_x4_rvv.c"
+#include "vst1q_u64_rvv.c"
+#include "vst1q_u64_x2_rvv.c"
+#include "vst1q_u64_x3_rvv.c"
+#include "vst1q_u64_x4_rvv.c"
+#include "vst1q_u8_rvv.c"
+#include "vst1q_u8_x2_rvv.c"
+#include "vst1q_u8_x3_rvv.c"
+#include "vst1q_u8_x4_rvv.c"
+#include "vst2_lane_s16_rvv.c"
+#include "vst2_lane_s32_rvv.c"
+#include "vst2_lane_s64_rvv.c"
+#include "vst2_lane_s8_rvv.c"
+#include "vst2_lane_u16_rvv.c"
+#include "vst2_lane_u32_rvv.c"
+#include "vst2_lane_u64_rvv.c"
+#include "vst2_lane_u8_rvv.c"
+#include "vst2_s16_rvv.c"
+#include "vst2_s32_rvv.c"
+#include "vst2_s64_rvv.c"
+#include "vst2_s8_rvv.c"
+#include "vst2_u16_rvv.c"
+#include "vst2_u32_rvv.c"
+#include "vst2_u64_rvv.c"
+#include "vst2_u8_rvv.c"
+#include "vst2q_lane_s16_rvv.c"
+#include "vst2q_lane_s32_rvv.c"
+#include "vst2q_lane_s64_rvv.c"
+#include "vst2q_lane_s8_rvv.c"
+#include "vst2q_lane_u16_rvv.c"
+#include "vst2q_lane_u32_rvv.c"
+#include "vst2q_lane_u64_rvv.c"
+#include "vst2q_lane_u8_rvv.c"
+#include "vst2q_s16_rvv.c"
+#include "vst2q_s32_rvv.c"
+#include "vst2q_s64_rvv.c"
+#include "vst2q_s8_rvv.c"
+#include "vst2q_u16_rvv.c"
+#include "vst2q_u32_rvv.c"
+#include "vst2q_u64_rvv.c"
+#include "vst2q_u8_rvv.c"
+#include "vst3_lane_s16_rvv.c"
+#include "vst3_lane_s32_rvv.c"
+#include "vst3_lane_s64_rvv.c"
+#include "vst3_lane_s8_rvv.c"
+#include "vst3_lane_u16_rvv.c"
+#include "vst3_lane_u32_rvv.c"
+#include "vst3_lane_u64_rvv.c"
+#include "vst3_lane_u8_rvv.c"
+#include "vst3_s16_rvv.c"
+#include "vst3_s32_rvv.c"
+#include "vst3_s64_rvv.c"
+#include "vst3_s8_rvv.c"
+#include "vst3_u16_rvv.c"
+#include "vst3_u32_rvv.c"
+#include "vst3_u64_rvv.c"
+#include "vst3_u8_rvv.c"
+#include "vst3q_lane_s16_rvv.c"
+#include "vst3q_lane_s32_rvv.c"
+#include "vst3q_lane_s64_rvv.c"
+#include "vst3q_lane_s8_rvv.c"
+#include "vst3q_lane_u16_rvv.c"
+#include "vst3q_lane_u32_rvv.c"
+#include "vst3q_lane_u64_rvv.c"
+#include "vst3q_lane_u8_rvv.c"
+#include "vst3q_s16_rvv.c"
+#include "vst3q_s32_rvv.c"
+#include "vst3q_s64_rvv.c"
+#include "vst3q_s8_rvv.c"
+#include "vst3q_u16_rvv.c"
+#include "vst3q_u32_rvv.c"
+#include "vst3q_u64_rvv.c"
+#include "vst3q_u8_rvv.c"
+#include "vst4_lane_s16_rvv.c"
+#include "vst4_lane_s32_rvv.c"
+#include "vst4_lane_s64_rvv.c"
+#include "vst4_lane_s8_rvv.c"
+#include "vst4_lane_u16_rvv.c"
+#include "vst4_lane_u32_rvv.c"
+#include "vst4_lane_u64_rvv.c"
+#include "vst4_lane_u8_rvv.c"
+#include "vst4_s16_rvv.c"
+#include "vst4_s32_rvv.c"
+#include "vst4_s64_rvv.c"
+#include "vst4_s8_rvv.c"
+#include "vst4_u16_rvv.c"
+#include "vst4_u32_rvv.c"
+#include "vst4_u64_rvv.c"
+#include "vst4_u8_rvv.c"
+#include "vst4q_lane_s16_rvv.c"
+#include "vst4q_lane_s32_rvv.c"
+#include "vst4q_lane_s64_rvv.c"
+#include "vst4q_lane_s8_rvv.c"
+#include "vst4q_lane_u16_rvv.c"
+#include "vst4q_lane_u32_rvv.c"
+#include "vst4q_lane_u64_rvv.c"
+#include "vst4q_lane_u8_rvv.c"
+#include "vst4q_s16_rvv.c"
+#include "vst4q_s32_rvv.c"
+#include "vst4q_s64_rvv.c"
+#include "vst4q_s8_rvv.c"
+#include "vst4q_u16_rvv.c"
+#include "vst4q_u32_rvv.c"
+#include "vst4q_u64_rvv.c"
+#include "vst4q_u8_rvv.c"
+#include "vsub_s16_rvv.c"
+#include "vsub_s32_rvv.c"
+#include "vsub_s64_rvv.c"
+#include "vsub_s8_rvv.c"
+#include "vsub_u16_rvv.c"
+#include "vsub_u32_rvv.c"
+#include "vsub_u64_rvv.c"
+#include "vsub_u8_rvv.c"
+#include "vsubhn_s16_rvv.c"
+#include "vsubhn_s32_rvv.c"
+#include "vsubhn_s64_rvv.c"
+#include "vsubhn_u16_rvv.c"
+#include "vsubhn_u32_rvv.c"
+#include "vsubhn_u64_rvv.c"
+#include "vsubl_s16_rvv.c"
+#include "vsubl_s32_rvv.c"
+#include "vsubl_s8_rvv.c"
+#include "vsubl_u16_rvv.c"
+#include "vsubl_u32_rvv.c"
+#include "vsubl_u8_rvv.c"
+#include "vsubq_s16_rvv.c"
+#include "vsubq_s16_x2_rvv.c"
+#include "vsubq_s32_rvv.c"
+#include "vsubq_s32_x2_rvv.c"
+#include "vsubq_s64_rvv.c"
+#include "vsubq_s64_x2_rvv.c"
+#include "vsubq_s8_rvv.c"
+#include "vsubq_s8_x2_rvv.c"
+#include "vsubq_u16_rvv.c"
+#include "vsubq_u16_x2_rvv.c"
+#include "vsubq_u32_rvv.c"
+#include "vsubq_u32_x2_rvv.c"
+#include "vsubq_u64_rvv.c"
+#include "vsubq_u64_x2_rvv.c"
+#include "vsubq_u8_rvv.c"
+#include "vsubq_u8_x2_rvv.c"
+#include "vsubw_s16_rvv.c"
+#include "vsubw_s32_rvv.c"
+#include "vsubw_s8_rvv.c"
+#include "vsubw_u16_rvv.c"
+#include "vsubw_u32_rvv.c"
+#include "vsubw_u8_rvv.c"
+
+#endif  // COMMON_RHAL_H_
@@ -9,226 +9,1487 @@ extern "C" {
 
 #include <riscv_vector.h>
 
-/* Define macros for different vector length (vl) */
+/*
+ * Linkage of every R-Halogen function. It is empty for the librhal objects
+ * built from the source/ directory, and redefined by rhal.h to compile the same
+ * definitions as always-inline functions (header-only build mode).
+ */
+#ifndef RHAL_API
+#define RHAL_API
+#endif
+
+/*
+ * Since v0.12 of the RVV intrinsics specification, the fixed-point intrinsics
+ * (vaadd, vasub, vnclip, vssrl, vsmul, ...) take an explicit vxrm rounding
+ * mode operand, so their result does not depend on the vxrm CSR.
+ */
+#if defined(__riscv_v_intrinsic) && __riscv_v_intrinsic >= 12000
+#define RHAL_VXRM_INTRINSICS
+#endif
+
+/*
+ * Fixed-point rounding mode
+ *
+ * By default the rounding operations (vrhadd*, vqrdmulh*, ...) pass
+ * round-to-nearest-up to the intrinsics, and the compiler writes vxrm before
+ * them: on every call of a librhal function, once per block of calls when
+ * inlined from rhal.h. With RHAL_VXRM_BLOCK no R-Halogen function writes vxrm.
+ * The caller sets it once before a block of calls with
+ * rhal_vxrm_set(RHAL_VXRM_RNU) and restores the returned mode after it, and
+ * the operations that need another rounding mode (vhadd*, vhsub*, vqdmulh*)
+ * use a sequence that does not depend on vxrm. Before v0.12 of the intrinsics
+ * the rounding operations always use the vxrm CSR.
+ */
+#if defined(RHAL_VXRM_INTRINSICS) && !defined(RHAL_VXRM_BLOCK)
+#define RHAL_VXRM_EXPLICIT
+#endif
+
+#define RHAL_VXRM_RNU 0  /* round-to-nearest-up */
+#define RHAL_VXRM_RNE 1  /* round-to-nearest-even */
+#define RHAL_VXRM_RDN 2  /* round-down (truncate) */
+#define RHAL_VXRM_ROD 3  /* round-to-odd */
+
+/* Sets the vxrm rounding mode and returns the previous one */
+static inline unsigned long rhal_vxrm_set(unsigned long mode) {
+    unsigned long previous;
+    __asm__ __volatile__ ("csrrw %0, vxrm, %1" : "=r"(previous) : "rK"(mode));
+    return previous;
+}
+
+/*
+ * Cumulative saturation flag (Neon FPSR.QC), opt-in with RHAL_QC
+ *
+ * The saturating operations (vqadd*, vqsub*, vqdmulh*, vqrdmulh*, vqdmull*,
+ * vqdmlal*, vqdmlsl*, vqrdmlah*, vqrdmlsh*) set the sticky vxsat flag when any
+ * element saturates, as the Neon ones set QC, so they need no extra code.
+ * rhal_get_qc() reads the flag only when it is called and rhal_clear_qc()
+ * resets it. vxsat is not preserved across calls by the psABI, so only call
+ * R-Halogen functions between the two. With the header-only API, store the
+ * results before reading the flag: the read is ordered after memory accesses,
+ * not after the inlined vector operations.
+ */
+#if defined(RHAL_QC)
+static inline int rhal_get_qc(void) {
+    unsigned long vxsat;
+    __asm__ __volatile__ ("csrr %0, vxsat" : "=r"(vxsat) :: "memory");
+    return (int)(vxsat & 1);
+}
+
+static inline void rhal_clear_qc(void) {
+    __asm__ __volatile__ ("csrw vxsat, zero" ::: "memory");
+}
+#endif
+
+/*
+ * Vector-vector fixed-point instruction using the rounding mode held in vxrm.
+ * The v0.12+ intrinsics always write vxrm, so it is emitted as inline assembly
+ * with its own vsetivli. sew and lmul are the vtype strings ("e8", "m1", ...).
+ */
+#define RHAL_VXRM_AMBIENT_VV(insn, sew, lmul, vs2, vs1, vl) \
+    __extension__ ({ \
+        __typeof__(vs2) __vd; \
+        __asm__ __volatile__ ("vsetivli zero, %3, " sew ", " lmul ", ta, ma\n\t" \
+                              insn " %0, %1, %2" \
+                              : "=vr"(__vd) : "vr"(vs2), "vr"(vs1), "i"(vl) : "vl", "vtype"); \
+        __vd; \
+    })
+
+/*
+ * Narrowing fixed-point instruction with an immediate shift (vnclip.wi, ...)
+ * using the rounding mode held in vxrm. type is the narrow result type and
+ * sew and lmul are its vtype strings.
+ */
+#define RHAL_VXRM_AMBIENT_WI(type, insn, sew, lmul, vs2, imm, vl) \
+    __extension__ ({ \
+        type __vd; \
+        __asm__ __volatile__ ("vsetivli zero, %3, " sew ", " lmul ", ta, ma\n\t" \
+                              insn " %0, %1, %2" \
+                              : "=&vr"(__vd) : "vr"(vs2), "i"(imm), "i"(vl) : "vl", "vtype"); \
+        __vd; \
+    })
+
+/*
+ * Define macros for different vector length (vl)
+ *
+ * Every operation uses the default tail-agnostic, mask-agnostic policy
+ * (vsetvli ta,ma): on VLEN > 128 the elements of a result register past vl
+ * are unspecified, so they must not carry data across R-Halogen calls.
+ */
 #define VLEN_1  1
 #define VLEN_2  2
+#define VLEN_3  3
 #define VLEN_4  4
+#define VLEN_6  6
 #define VLEN_8  8
+#define VLEN_12 12
 #define VLEN_16 16
+#define VLEN_24 24
+#define VLEN_32 32
+#define VLEN_48 48
+#define VLEN_64 64
 
-/* 64-bit vector register length */
-typedef vint8m1_t int8x8_t;
-typedef vint16m1_t int16x4_t;
-typedef vint32m1_t int32x2_t;
-typedef vint64m1_t int64x1_t;
-typedef vuint8m1_t uint8x8_t;
-typedef vuint16m1_t uint16x4_t;
-typedef vuint32m1_t uint32x2_t;
-typedef vuint64m1_t uint64x1_t;
+/*
+ * Vector type size
+ *
+ * By default the vector types are sizeless RVV types, which cannot be members
+ * of structs or arrays, globals or sizeof operands. With RHAL_FIXED_VLEN and
+ * -mrvv-vector-bits=zvl the compiler fixes VLEN to the Zvl*b value of -march
+ * (__riscv_v_fixed_vlen), and the types become fixed-size vectors of a whole
+ * (LMUL=1) or half (LMUL=1/2) register. They convert implicitly to and from
+ * the sizeless types, so every RVV intrinsic still accepts them. Code built
+ * this way only runs on cores with exactly that VLEN.
+ */
+#if defined(RHAL_FIXED_VLEN)
+#if !defined(__riscv_v_fixed_vlen)
+#error "RHAL_FIXED_VLEN requires -mrvv-vector-bits=zvl and a Zvl*b extension in -march."
+#endif
+#define RHAL_VECTOR_BITS_M1  __attribute__((riscv_rvv_vector_bits(__riscv_v_fixed_vlen)))
+#define RHAL_VECTOR_BITS_MF2 __attribute__((riscv_rvv_vector_bits(__riscv_v_fixed_vlen / 2)))
+#else
+#define RHAL_VECTOR_BITS_M1
+#define RHAL_VECTOR_BITS_MF2
+#endif
+
+/*
+ * 64-bit vector register length
+ *
+ * By default a 64-bit vector occupies a whole LMUL=1 register like its 128-bit
+ * counterpart. With RHAL_FRACTIONAL_LMUL the 8/16/32-bit element types use
+ * LMUL=1/2 instead, so 64-bit and 128-bit vectors are distinct types, and
+ * widening/narrowing operations work on a single register group without
+ * vlmul_ext/vlmul_trunc. There is no LMUL=1/2 type for 64-bit elements
+ * (SEW/LMUL would exceed ELEN), so int64x1_t and uint64x1_t stay LMUL=1.
+ * RHAL_LMUL_D is the LMUL of the 8/16/32-bit types as a vtype string.
+ */
+#if defined(RHAL_FRACTIONAL_LMUL)
+typedef vint8mf2_t int8x8_t RHAL_VECTOR_BITS_MF2;
+typedef vint16mf2_t int16x4_t RHAL_VECTOR_BITS_MF2;
+typedef vint32mf2_t int32x2_t RHAL_VECTOR_BITS_MF2;
+typedef vint64m1_t int64x1_t RHAL_VECTOR_BITS_M1;
+typedef vuint8mf2_t uint8x8_t RHAL_VECTOR_BITS_MF2;
+typedef vuint16mf2_t uint16x4_t RHAL_VECTOR_BITS_MF2;
+typedef vuint32mf2_t uint32x2_t RHAL_VECTOR_BITS_MF2;
+typedef vuint64m1_t uint64x1_t RHAL_VECTOR_BITS_M1;
+#define RHAL_LMUL_D "mf2"
+#else
+typedef vint8m1_t int8x8_t RHAL_VECTOR_BITS_M1;
+typedef vint16m1_t int16x4_t RHAL_VECTOR_BITS_M1;
+typedef vint32m1_t int32x2_t RHAL_VECTOR_BITS_M1;
+typedef vint64m1_t int64x1_t RHAL_VECTOR_BITS_M1;
+typedef vuint8m1_t uint8x8_t RHAL_VECTOR_BITS_M1;
+typedef vuint16m1_t uint16x4_t RHAL_VECTOR_BITS_M1;
+typedef vuint32m1_t uint32x2_t RHAL_VECTOR_BITS_M1;
+typedef vuint64m1_t uint64x1_t RHAL_VECTOR_BITS_M1;
+#define RHAL_LMUL_D "m1"
+#endif
 
 /* 128-bit vector register length */
-typedef vint8m1_t int8x16_t;
-typedef vint16m1_t int16x8_t;
-typedef vint32m1_t int32x4_t;
-typedef vint64m1_t int64x2_t;
-typedef vuint8m1_t uint8x16_t;
-typedef vuint16m1_t uint16x8_t;
-typedef vuint32m1_t uint32x4_t;
-typedef vuint64m1_t uint64x2_t;
+typedef vint8m1_t int8x16_t RHAL_VECTOR_BITS_M1;
+typedef vint16m1_t int16x8_t RHAL_VECTOR_BITS_M1;
+typedef vint32m1_t int32x4_t RHAL_VECTOR_BITS_M1;
+typedef vint64m1_t int64x2_t RHAL_VECTOR_BITS_M1;
+typedef vuint8m1_t uint8x16_t RHAL_VECTOR_BITS_M1;
+typedef vuint16m1_t uint16x8_t RHAL_VECTOR_BITS_M1;
+typedef vuint32m1_t uint32x4_t RHAL_VECTOR_BITS_M1;
+typedef vuint64m1_t uint64x2_t RHAL_VECTOR_BITS_M1;
+
+/*
+ * Groups of two, three and four vectors
+ *
+ * The multi-vector and interleaved loads and stores (vld1q_s8_x2_rvv,
+ * vld3q_u8_rvv, ...) take and return groups of vectors. Neon's struct types (int8x16x2_t with a val[] member)
+ * cannot hold the sizeless RVV types, so the groups are RVV tuple types,
+ * accessed with __riscv_vget/__riscv_vset instead of val[]. Tuples stay
+ * sizeless with RHAL_FIXED_VLEN. RHAL_VLEN_128 is defined when VLEN is fixed
+ * to 128, where every vector of a group is a whole register of an LMUL>1
+ * register group.
+ */
+#if defined(RHAL_FIXED_VLEN) && __riscv_v_fixed_vlen == 128
+#define RHAL_VLEN_128
+#endif
+
+#if defined(RHAL_FRACTIONAL_LMUL)
+typedef vint8mf2x2_t int8x8x2_t;
+typedef vint8mf2x3_t int8x8x3_t;
+typedef vint8mf2x4_t int8x8x4_t;
+typedef vint16mf2x2_t int16x4x2_t;
+typedef vint16mf2x3_t int16x4x3_t;
+typedef vint16mf2x4_t int16x4x4_t;
+typedef vint32mf2x2_t int32x2x2_t;
+typedef vint32mf2x3_t int32x2x3_t;
+typedef vint32mf2x4_t int32x2x4_t;
+typedef vint64m1x2_t int64x1x2_t;
+typedef vint64m1x3_t int64x1x3_t;
+typedef vint64m1x4_t int64x1x4_t;
+typedef vuint8mf2x2_t uint8x8x2_t;
+typedef vuint8mf2x3_t uint8x8x3_t;
+typedef vuint8mf2x4_t uint8x8x4_t;
+typedef vuint16mf2x2_t uint16x4x2_t;
+typedef vuint16mf2x3_t uint16x4x3_t;
+typedef vuint16mf2x4_t uint16x4x4_t;
+typedef vuint32mf2x2_t uint32x2x2_t;
+typedef vuint32mf2x3_t uint32x2x3_t;
+typedef vuint32mf2x4_t uint32x2x4_t;
+typedef vuint64m1x2_t uint64x1x2_t;
+typedef vuint64m1x3_t uint64x1x3_t;
+typedef vuint64m1x4_t uint64x1x4_t;
+#else
+typedef vint8m1x2_t int8x8x2_t;
+typedef vint8m1x3_t int8x8x3_t;
+typedef vint8m1x4_t int8x8x4_t;
+typedef vint16m1x2_t int16x4x2_t;
+typedef vint16m1x3_t int16x4x3_t;
+typedef vint16m1x4_t int16x4x4_t;
+typedef vint32m1x2_t int32x2x2_t;
+typedef vint32m1x3_t int32x2x3_t;
+typedef vint32m1x4_t int32x2x4_t;
+typedef vint64m1x2_t int64x1x2_t;
+typedef vint64m1x3_t int64x1x3_t;
+typedef vint64m1x4_t int64x1x4_t;
+typedef vuint8m1x2_t uint8x8x2_t;
+typedef vuint8m1x3_t uint8x8x3_t;
+typedef vuint8m1x4_t uint8x8x4_t;
+typedef vuint16m1x2_t uint16x4x2_t;
+typedef vuint16m1x3_t uint16x4x3_t;
+typedef vuint16m1x4_t uint16x4x4_t;
+typedef vuint32m1x2_t uint32x2x2_t;
+typedef vuint32m1x3_t uint32x2x3_t;
+typedef vuint32m1x4_t uint32x2x4_t;
+typedef vuint64m1x2_t uint64x1x2_t;
+typedef vuint64m1x3_t uint64x1x3_t;
+typedef vuint64m1x4_t uint64x1x4_t;
+#endif
+
+typedef vint8m1x2_t int8x16x2_t;
+typedef vint8m1x3_t int8x16x3_t;
+typedef vint8m1x4_t int8x16x4_t;
+typedef vint16m1x2_t int16x8x2_t;
+typedef vint16m1x3_t int16x8x3_t;
+typedef vint16m1x4_t int16x8x4_t;
+typedef vint32m1x2_t int32x4x2_t;
+typedef vint32m1x3_t int32x4x3_t;
+typedef vint32m1x4_t int32x4x4_t;
+typedef vint64m1x2_t int64x2x2_t;
+typedef vint64m1x3_t int64x2x3_t;
+typedef vint64m1x4_t int64x2x4_t;
+typedef vuint8m1x2_t uint8x16x2_t;
+typedef vuint8m1x3_t uint8x16x3_t;
+typedef vuint8m1x4_t uint8x16x4_t;
+typedef vuint16m1x2_t uint16x8x2_t;
+typedef vuint16m1x3_t uint16x8x3_t;
+typedef vuint16m1x4_t uint16x8x4_t;
+typedef vuint32m1x2_t uint32x4x2_t;
+typedef vuint32m1x3_t uint32x4x3_t;
+typedef vuint32m1x4_t uint32x4x4_t;
+typedef vuint64m1x2_t uint64x2x2_t;
+typedef vuint64m1x3_t uint64x2x3_t;
+typedef vuint64m1x4_t uint64x2x4_t;
+
+/*
+ * Pairs of 128-bit vectors (VLEN >= 256)
+ *
+ * On cores with VLEN >= 256 a single LMUL=1 register holds two 128-bit
+ * vectors. The paired functions (vaddq_u8_x2_rvv, ...) process both halves
+ * with one instruction. vcombineq_*_x2_rvv packs two vectors into a pair,
+ * and vgetq_low/vgetq_high_*_x2_rvv unpack it. Only use them when
+ * rhal_paired_supported() returns nonzero, and fall back to two 128-bit
+ * operations otherwise.
+ */
+typedef vint8m1_t int8x32_t RHAL_VECTOR_BITS_M1;
+typedef vint16m1_t int16x16_t RHAL_VECTOR_BITS_M1;
+typedef vint32m1_t int32x8_t RHAL_VECTOR_BITS_M1;
+typedef vint64m1_t int64x4_t RHAL_VECTOR_BITS_M1;
+typedef vuint8m1_t uint8x32_t RHAL_VECTOR_BITS_M1;
+typedef vuint16m1_t uint16x16_t RHAL_VECTOR_BITS_M1;
+typedef vuint32m1_t uint32x8_t RHAL_VECTOR_BITS_M1;
+typedef vuint64m1_t uint64x4_t RHAL_VECTOR_BITS_M1;
+
+/* Returns nonzero if the vector registers hold a pair of 128-bit vectors */
+static inline int rhal_paired_supported(void) {
+    unsigned long vlenb;
+    __asm__ __volatile__ ("csrr %0, vlenb" : "=r"(vlenb));
+    return vlenb >= 32;
+}
 
 /* vadd */
-int8x8_t vadd_s8_rvv(int8x8_t a, int8x8_t b);
-int16x4_t vadd_s16_rvv(int16x4_t a, int16x4_t b);
-int32x2_t vadd_s32_rvv(int32x2_t a, int32x2_t b);
-int64x1_t vadd_s64_rvv(int64x1_t a, int64x1_t b);
-
-int8x16_t vaddq_s8_rvv(int8x16_t a, int8x16_t b);
-int16x8_t vaddq_s16_rvv(int16x8_t a, int16x8_t b);
-int32x4_t vaddq_s32_rvv(int32x4_t a, int32x4_t b);
-int64x2_t vaddq_s64_rvv(int64x2_t a, int64x2_t b);
-
-uint8x8_t vadd_u8_rvv(uint8x8_t a, uint8x8_t b);
-uint16x4_t vadd_u16_rvv(uint16x4_t a, uint16x4_t b);
-uint32x2_t vadd_u32_rvv(uint32x2_t a, uint32x2_t b);
-uint64x1_t vadd_u64_rvv(uint64x1_t a, uint64x1_t b);
-
-uint8x16_t vaddq_u8_rvv(uint8x16_t a, uint8x16_t b);
-uint16x8_t vaddq_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint32x4_t vaddq_u32_rvv(uint32x4_t a, uint32x4_t b);
-uint64x2_t vaddq_u64_rvv(uint64x2_t a, uint64x2_t b);
-
-int16x8_t vaddl_s8_rvv(int8x8_t a, int8x8_t b);
-int32x4_t vaddl_s16_rvv(int16x4_t a, int16x4_t b);
-int64x2_t vaddl_s32_rvv(int32x2_t a, int32x2_t b);
-
-uint16x8_t vaddl_u8_rvv(uint8x8_t a, uint8x8_t b);
-uint32x4_t vaddl_u16_rvv(uint16x4_t a, uint16x4_t b);
-uint64x2_t vaddl_u32_rvv(uint32x2_t a, uint32x2_t b);
-
-int16x8_t vaddw_s8_rvv(int16x8_t a, int8x8_t b);
-int32x4_t vaddw_s16_rvv(int32x4_t a, int16x4_t b);
-int64x2_t vaddw_s32_rvv(int64x2_t a, int32x2_t b);
-
-uint16x8_t vaddw_u8_rvv(uint16x8_t a, uint8x8_t b);
-uint32x4_t vaddw_u16_rvv(uint32x4_t a, uint16x4_t b);
-uint64x2_t vaddw_u32_rvv(uint64x2_t a, uint32x2_t b);
-
-int8x8_t vhadd_s8_rvv(int8x8_t a, int8x8_t b);
-int16x4_t vhadd_s16_rvv(int16x4_t a, int16x4_t b);
-int32x2_t vhadd_s32_rvv(int32x2_t a, int32x2_t b);
-
-int8x16_t vhaddq_s8_rvv(int8x16_t a, int8x16_t b);
-int16x8_t vhaddq_s16_rvv(int16x8_t a, int16x8_t b);
-int32x4_t vhaddq_s32_rvv(int32x4_t a, int32x4_t b);
-
-uint8x8_t vhadd_u8_rvv(uint8x8_t a, uint8x8_t b);
-uint16x4_t vhadd_u16_rvv(uint16x4_t a, uint16x4_t b);
-uint32x2_t vhadd_u32_rvv(uint32x2_t a, uint32x2_t b);
-
-uint8x16_t vhaddq_u8_rvv(uint8x16_t a, uint8x16_t b);
-uint16x8_t vhaddq_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint32x4_t vhaddq_u32_rvv(uint32x4_t a, uint32x4_t b);
-
-int8x8_t vrhadd_s8_rvv(int8x8_t a, int8x8_t b);
-int16x4_t vrhadd_s16_rvv(int16x4_t a, int16x4_t b);
-int32x2_t vrhadd_s32_rvv(int32x2_t a, int32x2_t b);
-
-int8x16_t vrhaddq_s8_rvv(int8x16_t a, int8x16_t b);
-int16x8_t vrhaddq_s16_rvv(int16x8_t a, int16x8_t b);
-int32x4_t vrhaddq_s32_rvv(int32x4_t a, int32x4_t b);
-
-uint8x8_t vrhadd_u8_rvv(uint8x8_t a, uint8x8_t b);
-uint16x4_t vrhadd_u16_rvv(uint16x4_t a, uint16x4_t b);
-uint32x2_t vrhadd_u32_rvv(uint32x2_t a, uint32x2_t b);
-
-uint8x16_t vrhaddq_u8_rvv(uint8x16_t a, uint8x16_t b);
-uint16x8_t vrhaddq_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint32x4_t vrhaddq_u32_rvv(uint32x4_t a, uint32x4_t b);
-
-int8x8_t vqadd_s8_rvv(int8x8_t a, int8x8_t b);
-int16x4_t vqadd_s16_rvv(int16x4_t a, int16x4_t b);
-int32x2_t vqadd_s32_rvv(int32x2_t a, int32x2_t b);
-int64x1_t vqadd_s64_rvv(int64x1_t a, int64x1_t b);
-
-int8x16_t vqaddq_s8_rvv(int8x16_t a, int8x16_t b);
-int16x8_t vqaddq_s16_rvv(int16x8_t a, int16x8_t b);
-int32x4_t vqaddq_s32_rvv(int32x4_t a, int32x4_t b);
-int64x2_t vqaddq_s64_rvv(int64x2_t a, int64x2_t b);
-
-uint8x8_t vqadd_u8_rvv(uint8x8_t a, uint8x8_t b);
-uint16x4_t vqadd_u16_rvv(uint16x4_t a, uint16x4_t b);
-uint32x2_t vqadd_u32_rvv(uint32x2_t a, uint32x2_t b);
-uint64x1_t vqadd_u64_rvv(uint64x1_t a, uint64x1_t b);
-
-uint8x16_t vqaddq_u8_rvv(uint8x16_t a, uint8x16_t b);
-uint16x8_t vqaddq_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint32x4_t vqaddq_u32_rvv(uint32x4_t a, uint32x4_t b);
-uint64x2_t vqaddq_u64_rvv(uint64x2_t a, uint64x2_t b);
-
-int8x8_t vaddhn_s16_rvv(int16x8_t a, int16x8_t b);
-int16x4_t vaddhn_s32_rvv(int32x4_t a, int32x4_t b);
-int32x2_t vaddhn_s64_rvv(int64x2_t a, int64x2_t b);
-
-uint8x8_t vaddhn_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint16x4_t vaddhn_u32_rvv(uint32x4_t a, uint32x4_t b);
-uint32x2_t vaddhn_u64_rvv(uint64x2_t a, uint64x2_t b);
-
-int8x8_t vraddhn_s16_rvv(int16x8_t a, int16x8_t b);
-int16x4_t vraddhn_s32_rvv(int32x4_t a, int32x4_t b);
-int32x2_t vraddhn_s64_rvv(int64x2_t a, int64x2_t b);
-
-uint8x8_t vraddhn_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint16x4_t vraddhn_u32_rvv(uint32x4_t a, uint32x4_t b);
-uint32x2_t vraddhn_u64_rvv(uint64x2_t a, uint64x2_t b);
+RHAL_API int8x8_t vadd_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int16x4_t vadd_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vadd_s32_rvv(int32x2_t a, int32x2_t b);
+RHAL_API int64x1_t vadd_s64_rvv(int64x1_t a, int64x1_t b);
+
+RHAL_API int8x16_t vaddq_s8_rvv(int8x16_t a, int8x16_t b);
+RHAL_API int16x8_t vaddq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vaddq_s32_rvv(int32x4_t a, int32x4_t b);
+RHAL_API int64x2_t vaddq_s64_rvv(int64x2_t a, int64x2_t b);
+
+RHAL_API uint8x8_t vadd_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint16x4_t vadd_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint32x2_t vadd_u32_rvv(uint32x2_t a, uint32x2_t b);
+RHAL_API uint64x1_t vadd_u64_rvv(uint64x1_t a, uint64x1_t b);
+
+RHAL_API uint8x16_t vaddq_u8_rvv(uint8x16_t a, uint8x16_t b);
+RHAL_API uint16x8_t vaddq_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint32x4_t vaddq_u32_rvv(uint32x4_t a, uint32x4_t b);
+RHAL_API uint64x2_t vaddq_u64_rvv(uint64x2_t a, uint64x2_t b);
+
+RHAL_API int16x8_t vaddl_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int32x4_t vaddl_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int64x2_t vaddl_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API uint16x8_t vaddl_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint32x4_t vaddl_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint64x2_t vaddl_u32_rvv(uint32x2_t a, uint32x2_t b);
+
+RHAL_API int16x8_t vaddw_s8_rvv(int16x8_t a, int8x8_t b);
+RHAL_API int32x4_t vaddw_s16_rvv(int32x4_t a, int16x4_t b);
+RHAL_API int64x2_t vaddw_s32_rvv(int64x2_t a, int32x2_t b);
+
+RHAL_API uint16x8_t vaddw_u8_rvv(uint16x8_t a, uint8x8_t b);
+RHAL_API uint32x4_t vaddw_u16_rvv(uint32x4_t a, uint16x4_t b);
+RHAL_API uint64x2_t vaddw_u32_rvv(uint64x2_t a, uint32x2_t b);
+
+RHAL_API int8x8_t vhadd_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int16x4_t vhadd_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vhadd_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API int8x16_t vhaddq_s8_rvv(int8x16_t a, int8x16_t b);
+RHAL_API int16x8_t vhaddq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vhaddq_s32_rvv(int32x4_t a, int32x4_t b);
+
+RHAL_API uint8x8_t vhadd_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint16x4_t vhadd_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint32x2_t vhadd_u32_rvv(uint32x2_t a, uint32x2_t b);
+
+RHAL_API uint8x16_t vhaddq_u8_rvv(uint8x16_t a, uint8x16_t b);
+RHAL_API uint16x8_t vhaddq_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint32x4_t vhaddq_u32_rvv(uint32x4_t a, uint32x4_t b);
+
+RHAL_API int8x8_t vrhadd_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int16x4_t vrhadd_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vrhadd_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API int8x16_t vrhaddq_s8_rvv(int8x16_t a, int8x16_t b);
+RHAL_API int16x8_t vrhaddq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vrhaddq_s32_rvv(int32x4_t a, int32x4_t b);
+
+RHAL_API uint8x8_t vrhadd_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint16x4_t vrhadd_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint32x2_t vrhadd_u32_rvv(uint32x2_t a, uint32x2_t b);
+
+RHAL_API uint8x16_t vrhaddq_u8_rvv(uint8x16_t a, uint8x16_t b);
+RHAL_API uint16x8_t vrhaddq_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint32x4_t vrhaddq_u32_rvv(uint32x4_t a, uint32x4_t b);
+
+RHAL_API int8x8_t vqadd_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int16x4_t vqadd_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vqadd_s32_rvv(int32x2_t a, int32x2_t b);
+RHAL_API int64x1_t vqadd_s64_rvv(int64x1_t a, int64x1_t b);
+
+RHAL_API int8x16_t vqaddq_s8_rvv(int8x16_t a, int8x16_t b);
+RHAL_API int16x8_t vqaddq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vqaddq_s32_rvv(int32x4_t a, int32x4_t b);
+RHAL_API int64x2_t vqaddq_s64_rvv(int64x2_t a, int64x2_t b);
+
+RHAL_API uint8x8_t vqadd_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint16x4_t vqadd_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint32x2_t vqadd_u32_rvv(uint32x2_t a, uint32x2_t b);
+RHAL_API uint64x1_t vqadd_u64_rvv(uint64x1_t a, uint64x1_t b);
+
+RHAL_API uint8x16_t vqaddq_u8_rvv(uint8x16_t a, uint8x16_t b);
+RHAL_API uint16x8_t vqaddq_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint32x4_t vqaddq_u32_rvv(uint32x4_t a, uint32x4_t b);
+RHAL_API uint64x2_t vqaddq_u64_rvv(uint64x2_t a, uint64x2_t b);
+
+RHAL_API int8x8_t vaddhn_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int16x4_t vaddhn_s32_rvv(int32x4_t a, int32x4_t b);
+RHAL_API int32x2_t vaddhn_s64_rvv(int64x2_t a, int64x2_t b);
+
+RHAL_API uint8x8_t vaddhn_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint16x4_t vaddhn_u32_rvv(uint32x4_t a, uint32x4_t b);
+RHAL_API uint32x2_t vaddhn_u64_rvv(uint64x2_t a, uint64x2_t b);
+
+RHAL_API int8x8_t vraddhn_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int16x4_t vraddhn_s32_rvv(int32x4_t a, int32x4_t b);
+RHAL_API int32x2_t vraddhn_s64_rvv(int64x2_t a, int64x2_t b);
+
+RHAL_API uint8x8_t vraddhn_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint16x4_t vraddhn_u32_rvv(uint32x4_t a, uint32x4_t b);
+RHAL_API uint32x2_t vraddhn_u64_rvv(uint64x2_t a, uint64x2_t b);
 
 /* vsub* */
-int8x8_t vsub_s8_rvv(int8x8_t a, int8x8_t b);
-int16x4_t vsub_s16_rvv(int16x4_t a, int16x4_t b);
-int32x2_t vsub_s32_rvv(int32x2_t a, int32x2_t b);
-int64x1_t vsub_s64_rvv(int64x1_t a, int64x1_t b);
-
-int8x16_t vsubq_s8_rvv(int8x16_t a, int8x16_t b);
-int16x8_t vsubq_s16_rvv(int16x8_t a, int16x8_t b);
-int32x4_t vsubq_s32_rvv(int32x4_t a, int32x4_t b);
-int64x2_t vsubq_s64_rvv(int64x2_t a, int64x2_t b);
-
-uint8x8_t vsub_u8_rvv(uint8x8_t a, uint8x8_t b);
-uint16x4_t vsub_u16_rvv(uint16x4_t a, uint16x4_t b);
-uint32x2_t vsub_u32_rvv(uint32x2_t a, uint32x2_t b);
-uint64x1_t vsub_u64_rvv(uint64x1_t a, uint64x1_t b);
-
-uint8x16_t vsubq_u8_rvv(uint8x16_t a, uint8x16_t b);
-uint16x8_t vsubq_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint32x4_t vsubq_u32_rvv(uint32x4_t a, uint32x4_t b);
-uint64x2_t vsubq_u64_rvv(uint64x2_t a, uint64x2_t b);
-
-int16x8_t vsubl_s8_rvv(int8x8_t a, int8x8_t b);
-int32x4_t vsubl_s16_rvv(int16x4_t a, int16x4_t b);
-int64x2_t vsubl_s32_rvv(int32x2_t a, int32x2_t b);
-
-uint16x8_t vsubl_u8_rvv(uint8x8_t a, uint8x8_t b);
-uint32x4_t vsubl_u16_rvv(uint16x4_t a, uint16x4_t b);
-uint64x2_t vsubl_u32_rvv(uint32x2_t a, uint32x2_t b);
-
-int16x8_t vsubw_s8_rvv(int16x8_t a, int8x8_t b);
-int32x4_t vsubw_s16_rvv(int32x4_t a, int16x4_t b);
-int64x2_t vsubw_s32_rvv(int64x2_t a, int32x2_t b);
-
-uint16x8_t vsubw_u8_rvv(uint16x8_t a, uint8x8_t b);
-uint32x4_t vsubw_u16_rvv(uint32x4_t a, uint16x4_t b);
-uint64x2_t vsubw_u32_rvv(uint64x2_t a, uint32x2_t b);
-
-int8x8_t vhsub_s8_rvv(int8x8_t a, int8x8_t b);
-int16x4_t vhsub_s16_rvv(int16x4_t a, int16x4_t b);
-int32x2_t vhsub_s32_rvv(int32x2_t a, int32x2_t b);
-
-int8x16_t vhsubq_s8_rvv(int8x16_t a, int8x16_t b);
-int16x8_t vhsubq_s16_rvv(int16x8_t a, int16x8_t b);
-int32x4_t vhsubq_s32_rvv(int32x4_t a, int32x4_t b);
-
-uint8x8_t vhsub_u8_rvv(uint8x8_t a, uint8x8_t b);
-uint16x4_t vhsub_u16_rvv(uint16x4_t a, uint16x4_t b);
-uint32x2_t vhsub_u32_rvv(uint32x2_t a, uint32x2_t b);
-
-uint8x16_t vhsubq_u8_rvv(uint8x16_t a, uint8x16_t b);
-uint16x8_t vhsubq_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint32x4_t vhsubq_u32_rvv(uint32x4_t a, uint32x4_t b);
-
-int8x8_t vqsub_s8_rvv(int8x8_t a, int8x8_t b);
-int16x4_t vqsub_s16_rvv(int16x4_t a, int16x4_t b);
-int32x2_t vqsub_s32_rvv(int32x2_t a, int32x2_t b);
-int64x1_t vqsub_s64_rvv(int64x1_t a, int64x1_t b);
-
-int8x16_t vqsubq_s8_rvv(int8x16_t a, int8x16_t b);
-int16x8_t vqsubq_s16_rvv(int16x8_t a, int16x8_t b);
-int32x4_t vqsubq_s32_rvv(int32x4_t a, int32x4_t b);
-int64x2_t vqsubq_s64_rvv(int64x2_t a, int64x2_t b);
-
-uint8x8_t vqsub_u8_rvv(uint8x8_t a, uint8x8_t b);
-uint16x4_t vqsub_u16_rvv(uint16x4_t a, uint16x4_t b);
-uint32x2_t vqsub_u32_rvv(uint32x2_t a, uint32x2_t b);
-uint64x1_t vqsub_u64_rvv(uint64x1_t a, uint64x1_t b);
-
-uint8x16_t vqsubq_u8_rvv(uint8x16_t a, uint8x16_t b);
-uint16x8_t vqsubq_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint32x4_t vqsubq_u32_rvv(uint32x4_t a, uint32x4_t b);
-uint64x2_t vqsubq_u64_rvv(uint64x2_t a, uint64x2_t b);
-
-int8x8_t vsubhn_s16_rvv(int16x8_t a, int16x8_t b);
-int16x4_t vsubhn_s32_rvv(int32x4_t a, int32x4_t b);
-int32x2_t vsubhn_s64_rvv(int64x2_t a, int64x2_t b);
-
-uint8x8_t vsubhn_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint16x4_t vsubhn_u32_rvv(uint32x4_t a, uint32x4_t b);
-uint32x2_t vsubhn_u64_rvv(uint64x2_t a, uint64x2_t b);
-
-int8x8_t  vrsubhn_s16_rvv(int16x8_t a, int16x8_t b);
-int16x4_t vrsubhn_s32_rvv(int32x4_t a, int32x4_t b);
-int32x2_t vrsubhn_s64_rvv(int64x2_t a, int64x2_t b);
-
-uint8x8_t  vrsubhn_u16_rvv(uint16x8_t a, uint16x8_t b);
-uint16x4_t vrsubhn_u32_rvv(uint32x4_t a, uint32x4_t b);
-uint32x2_t vrsubhn_u64_rvv(uint64x2_t a, uint64x2_t b);
+RHAL_API int8x8_t vsub_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int16x4_t vsub_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vsub_s32_rvv(int32x2_t a, int32x2_t b);
+RHAL_API int64x1_t vsub_s64_rvv(int64x1_t a, int64x1_t b);
+
+RHAL_API int8x16_t vsubq_s8_rvv(int8x16_t a, int8x16_t b);
+RHAL_API int16x8_t vsubq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vsubq_s32_rvv(int32x4_t a, int32x4_t b);
+RHAL_API int64x2_t vsubq_s64_rvv(int64x2_t a, int64x2_t b);
+
+RHAL_API uint8x8_t vsub_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint16x4_t vsub_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint32x2_t vsub_u32_rvv(uint32x2_t a, uint32x2_t b);
+RHAL_API uint64x1_t vsub_u64_rvv(uint64x1_t a, uint64x1_t b);
+
+RHAL_API uint8x16_t vsubq_u8_rvv(uint8x16_t a, uint8x16_t b);
+RHAL_API uint16x8_t vsubq_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint32x4_t vsubq_u32_rvv(uint32x4_t a, uint32x4_t b);
+RHAL_API uint64x2_t vsubq_u64_rvv(uint64x2_t a, uint64x2_t b);
+
+RHAL_API int16x8_t vsubl_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int32x4_t vsubl_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int64x2_t vsubl_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API uint16x8_t vsubl_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint32x4_t vsubl_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint64x2_t vsubl_u32_rvv(uint32x2_t a, uint32x2_t b);
+
+RHAL_API int16x8_t vsubw_s8_rvv(int16x8_t a, int8x8_t b);
+RHAL_API int32x4_t vsubw_s16_rvv(int32x4_t a, int16x4_t b);
+RHAL_API int64x2_t vsubw_s32_rvv(int64x2_t a, int32x2_t b);
+
+RHAL_API uint16x8_t vsubw_u8_rvv(uint16x8_t a, uint8x8_t b);
+RHAL_API uint32x4_t vsubw_u16_rvv(uint32x4_t a, uint16x4_t b);
+RHAL_API uint64x2_t vsubw_u32_rvv(uint64x2_t a, uint32x2_t b);
+
+RHAL_API int8x8_t vhsub_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int16x4_t vhsub_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vhsub_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API int8x16_t vhsubq_s8_rvv(int8x16_t a, int8x16_t b);
+RHAL_API int16x8_t vhsubq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vhsubq_s32_rvv(int32x4_t a, int32x4_t b);
+
+RHAL_API uint8x8_t vhsub_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint16x4_t vhsub_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint32x2_t vhsub_u32_rvv(uint32x2_t a, uint32x2_t b);
+
+RHAL_API uint8x16_t vhsubq_u8_rvv(uint8x16_t a, uint8x16_t b);
+RHAL_API uint16x8_t vhsubq_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint32x4_t vhsubq_u32_rvv(uint32x4_t a, uint32x4_t b);
+
+RHAL_API int8x8_t vqsub_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int16x4_t vqsub_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vqsub_s32_rvv(int32x2_t a, int32x2_t b);
+RHAL_API int64x1_t vqsub_s64_rvv(int64x1_t a, int64x1_t b);
+
+RHAL_API int8x16_t vqsubq_s8_rvv(int8x16_t a, int8x16_t b);
+RHAL_API int16x8_t vqsubq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vqsubq_s32_rvv(int32x4_t a, int32x4_t b);
+RHAL_API int64x2_t vqsubq_s64_rvv(int64x2_t a, int64x2_t b);
+
+RHAL_API uint8x8_t vqsub_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint16x4_t vqsub_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint32x2_t vqsub_u32_rvv(uint32x2_t a, uint32x2_t b);
+RHAL_API uint64x1_t vqsub_u64_rvv(uint64x1_t a, uint64x1_t b);
+
+RHAL_API uint8x16_t vqsubq_u8_rvv(uint8x16_t a, uint8x16_t b);
+RHAL_API uint16x8_t vqsubq_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint32x4_t vqsubq_u32_rvv(uint32x4_t a, uint32x4_t b);
+RHAL_API uint64x2_t vqsubq_u64_rvv(uint64x2_t a, uint64x2_t b);
+
+RHAL_API int8x8_t vsubhn_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int16x4_t vsubhn_s32_rvv(int32x4_t a, int32x4_t b);
+RHAL_API int32x2_t vsubhn_s64_rvv(int64x2_t a, int64x2_t b);
+
+RHAL_API uint8x8_t vsubhn_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint16x4_t vsubhn_u32_rvv(uint32x4_t a, uint32x4_t b);
+RHAL_API uint32x2_t vsubhn_u64_rvv(uint64x2_t a, uint64x2_t b);
+
+RHAL_API int8x8_t  vrsubhn_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int16x4_t vrsubhn_s32_rvv(int32x4_t a, int32x4_t b);
+RHAL_API int32x2_t vrsubhn_s64_rvv(int64x2_t a, int64x2_t b);
+
+RHAL_API uint8x8_t  vrsubhn_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint16x4_t vrsubhn_u32_rvv(uint32x4_t a, uint32x4_t b);
+RHAL_API uint32x2_t vrsubhn_u64_rvv(uint64x2_t a, uint64x2_t b);
+
+/* vmul* */
+RHAL_API int8x8_t vmul_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int16x4_t vmul_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vmul_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API int8x16_t vmulq_s8_rvv(int8x16_t a, int8x16_t b);
+RHAL_API int16x8_t vmulq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vmulq_s32_rvv(int32x4_t a, int32x4_t b);
+
+RHAL_API uint8x8_t vmul_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint16x4_t vmul_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint32x2_t vmul_u32_rvv(uint32x2_t a, uint32x2_t b);
+
+RHAL_API uint8x16_t vmulq_u8_rvv(uint8x16_t a, uint8x16_t b);
+RHAL_API uint16x8_t vmulq_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint32x4_t vmulq_u32_rvv(uint32x4_t a, uint32x4_t b);
+
+RHAL_API int16x4_t vmul_n_s16_rvv(int16x4_t a, int16_t b);
+RHAL_API int32x2_t vmul_n_s32_rvv(int32x2_t a, int32_t b);
+
+RHAL_API int16x8_t vmulq_n_s16_rvv(int16x8_t a, int16_t b);
+RHAL_API int32x4_t vmulq_n_s32_rvv(int32x4_t a, int32_t b);
+
+RHAL_API uint16x4_t vmul_n_u16_rvv(uint16x4_t a, uint16_t b);
+RHAL_API uint32x2_t vmul_n_u32_rvv(uint32x2_t a, uint32_t b);
+
+RHAL_API uint16x8_t vmulq_n_u16_rvv(uint16x8_t a, uint16_t b);
+RHAL_API uint32x4_t vmulq_n_u32_rvv(uint32x4_t a, uint32_t b);
+
+RHAL_API int16x4_t vmul_lane_s16_rvv(int16x4_t a, int16x4_t v, const int lane);
+RHAL_API int16x4_t vmul_laneq_s16_rvv(int16x4_t a, int16x8_t v, const int lane);
+RHAL_API int32x2_t vmul_lane_s32_rvv(int32x2_t a, int32x2_t v, const int lane);
+RHAL_API int32x2_t vmul_laneq_s32_rvv(int32x2_t a, int32x4_t v, const int lane);
+
+RHAL_API int16x8_t vmulq_lane_s16_rvv(int16x8_t a, int16x4_t v, const int lane);
+RHAL_API int16x8_t vmulq_laneq_s16_rvv(int16x8_t a, int16x8_t v, const int lane);
+RHAL_API int32x4_t vmulq_lane_s32_rvv(int32x4_t a, int32x2_t v, const int lane);
+RHAL_API int32x4_t vmulq_laneq_s32_rvv(int32x4_t a, int32x4_t v, const int lane);
+
+RHAL_API uint16x4_t vmul_lane_u16_rvv(uint16x4_t a, uint16x4_t v, const int lane);
+RHAL_API uint16x4_t vmul_laneq_u16_rvv(uint16x4_t a, uint16x8_t v, const int lane);
+RHAL_API uint32x2_t vmul_lane_u32_rvv(uint32x2_t a, uint32x2_t v, const int lane);
+RHAL_API uint32x2_t vmul_laneq_u32_rvv(uint32x2_t a, uint32x4_t v, const int lane);
+
+RHAL_API uint16x8_t vmulq_lane_u16_rvv(uint16x8_t a, uint16x4_t v, const int lane);
+RHAL_API uint16x8_t vmulq_laneq_u16_rvv(uint16x8_t a, uint16x8_t v, const int lane);
+RHAL_API uint32x4_t vmulq_lane_u32_rvv(uint32x4_t a, uint32x2_t v, const int lane);
+RHAL_API uint32x4_t vmulq_laneq_u32_rvv(uint32x4_t a, uint32x4_t v, const int lane);
+
+RHAL_API int8x8_t vmla_s8_rvv(int8x8_t a, int8x8_t b, int8x8_t c);
+RHAL_API int16x4_t vmla_s16_rvv(int16x4_t a, int16x4_t b, int16x4_t c);
+RHAL_API int32x2_t vmla_s32_rvv(int32x2_t a, int32x2_t b, int32x2_t c);
+
+RHAL_API int8x16_t vmlaq_s8_rvv(int8x16_t a, int8x16_t b, int8x16_t c);
+RHAL_API int16x8_t vmlaq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t c);
+RHAL_API int32x4_t vmlaq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t c);
+
+RHAL_API uint8x8_t vmla_u8_rvv(uint8x8_t a, uint8x8_t b, uint8x8_t c);
+RHAL_API uint16x4_t vmla_u16_rvv(uint16x4_t a, uint16x4_t b, uint16x4_t c);
+RHAL_API uint32x2_t vmla_u32_rvv(uint32x2_t a, uint32x2_t b, uint32x2_t c);
+
+RHAL_API uint8x16_t vmlaq_u8_rvv(uint8x16_t a, uint8x16_t b, uint8x16_t c);
+RHAL_API uint16x8_t vmlaq_u16_rvv(uint16x8_t a, uint16x8_t b, uint16x8_t c);
+RHAL_API uint32x4_t vmlaq_u32_rvv(uint32x4_t a, uint32x4_t b, uint32x4_t c);
+
+RHAL_API int16x4_t vmla_n_s16_rvv(int16x4_t a, int16x4_t b, int16_t c);
+RHAL_API int32x2_t vmla_n_s32_rvv(int32x2_t a, int32x2_t b, int32_t c);
+
+RHAL_API int16x8_t vmlaq_n_s16_rvv(int16x8_t a, int16x8_t b, int16_t c);
+RHAL_API int32x4_t vmlaq_n_s32_rvv(int32x4_t a, int32x4_t b, int32_t c);
+
+RHAL_API uint16x4_t vmla_n_u16_rvv(uint16x4_t a, uint16x4_t b, uint16_t c);
+RHAL_API uint32x2_t vmla_n_u32_rvv(uint32x2_t a, uint32x2_t b, uint32_t c);
+
+RHAL_API uint16x8_t vmlaq_n_u16_rvv(uint16x8_t a, uint16x8_t b, uint16_t c);
+RHAL_API uint32x4_t vmlaq_n_u32_rvv(uint32x4_t a, uint32x4_t b, uint32_t c);
+
+RHAL_API int16x4_t vmla_lane_s16_rvv(int16x4_t a, int16x4_t b, int16x4_t v, const int lane);
+RHAL_API int16x4_t vmla_laneq_s16_rvv(int16x4_t a, int16x4_t b, int16x8_t v, const int lane);
+RHAL_API int32x2_t vmla_lane_s32_rvv(int32x2_t a, int32x2_t b, int32x2_t v, const int lane);
+RHAL_API int32x2_t vmla_laneq_s32_rvv(int32x2_t a, int32x2_t b, int32x4_t v, const int lane);
+
+RHAL_API int16x8_t vmlaq_lane_s16_rvv(int16x8_t a, int16x8_t b, int16x4_t v, const int lane);
+RHAL_API int16x8_t vmlaq_laneq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t v, const int lane);
+RHAL_API int32x4_t vmlaq_lane_s32_rvv(int32x4_t a, int32x4_t b, int32x2_t v, const int lane);
+RHAL_API int32x4_t vmlaq_laneq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t v, const int lane);
+
+RHAL_API uint16x4_t vmla_lane_u16_rvv(uint16x4_t a, uint16x4_t b, uint16x4_t v, const int lane);
+RHAL_API uint16x4_t vmla_laneq_u16_rvv(uint16x4_t a, uint16x4_t b, uint16x8_t v, const int lane);
+RHAL_API uint32x2_t vmla_lane_u32_rvv(uint32x2_t a, uint32x2_t b, uint32x2_t v, const int lane);
+RHAL_API uint32x2_t vmla_laneq_u32_rvv(uint32x2_t a, uint32x2_t b, uint32x4_t v, const int lane);
+
+RHAL_API uint16x8_t vmlaq_lane_u16_rvv(uint16x8_t a, uint16x8_t b, uint16x4_t v, const int lane);
+RHAL_API uint16x8_t vmlaq_laneq_u16_rvv(uint16x8_t a, uint16x8_t b, uint16x8_t v, const int lane);
+RHAL_API uint32x4_t vmlaq_lane_u32_rvv(uint32x4_t a, uint32x4_t b, uint32x2_t v, const int lane);
+RHAL_API uint32x4_t vmlaq_laneq_u32_rvv(uint32x4_t a, uint32x4_t b, uint32x4_t v, const int lane);
+
+RHAL_API int8x8_t vmls_s8_rvv(int8x8_t a, int8x8_t b, int8x8_t c);
+RHAL_API int16x4_t vmls_s16_rvv(int16x4_t a, int16x4_t b, int16x4_t c);
+RHAL_API int32x2_t vmls_s32_rvv(int32x2_t a, int32x2_t b, int32x2_t c);
+
+RHAL_API int8x16_t vmlsq_s8_rvv(int8x16_t a, int8x16_t b, int8x16_t c);
+RHAL_API int16x8_t vmlsq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t c);
+RHAL_API int32x4_t vmlsq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t c);
+
+RHAL_API uint8x8_t vmls_u8_rvv(uint8x8_t a, uint8x8_t b, uint8x8_t c);
+RHAL_API uint16x4_t vmls_u16_rvv(uint16x4_t a, uint16x4_t b, uint16x4_t c);
+RHAL_API uint32x2_t vmls_u32_rvv(uint32x2_t a, uint32x2_t b, uint32x2_t c);
+
+RHAL_API uint8x16_t vmlsq_u8_rvv(uint8x16_t a, uint8x16_t b, uint8x16_t c);
+RHAL_API uint16x8_t vmlsq_u16_rvv(uint16x8_t a, uint16x8_t b, uint16x8_t c);
+RHAL_API uint32x4_t vmlsq_u32_rvv(uint32x4_t a, uint32x4_t b, uint32x4_t c);
+
+RHAL_API int16x4_t vmls_n_s16_rvv(int16x4_t a, int16x4_t b, int16_t c);
+RHAL_API int32x2_t vmls_n_s32_rvv(int32x2_t a, int32x2_t b, int32_t c);
+
+RHAL_API int16x8_t vmlsq_n_s16_rvv(int16x8_t a, int16x8_t b, int16_t c);
+RHAL_API int32x4_t vmlsq_n_s32_rvv(int32x4_t a, int32x4_t b, int32_t c);
+
+RHAL_API uint16x4_t vmls_n_u16_rvv(uint16x4_t a, uint16x4_t b, uint16_t c);
+RHAL_API uint32x2_t vmls_n_u32_rvv(uint32x2_t a, uint32x2_t b, uint32_t c);
+
+RHAL_API uint16x8_t vmlsq_n_u16_rvv(uint16x8_t a, uint16x8_t b, uint16_t c);
+RHAL_API uint32x4_t vmlsq_n_u32_rvv(uint32x4_t a, uint32x4_t b, uint32_t c);
+
+RHAL_API int16x4_t vmls_lane_s16_rvv(int16x4_t a, int16x4_t b, int16x4_t v, const int lane);
+RHAL_API int16x4_t vmls_laneq_s16_rvv(int16x4_t a, int16x4_t b, int16x8_t v, const int lane);
+RHAL_API int32x2_t vmls_lane_s32_rvv(int32x2_t a, int32x2_t b, int32x2_t v, const int lane);
+RHAL_API int32x2_t vmls_laneq_s32_rvv(int32x2_t a, int32x2_t b, int32x4_t v, const int lane);
+
+RHAL_API int16x8_t vmlsq_lane_s16_rvv(int16x8_t a, int16x8_t b, int16x4_t v, const int lane);
+RHAL_API int16x8_t vmlsq_laneq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t v, const int lane);
+RHAL_API int32x4_t vmlsq_lane_s32_rvv(int32x4_t a, int32x4_t b, int32x2_t v, const int lane);
+RHAL_API int32x4_t vmlsq_laneq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t v, const int lane);
+
+RHAL_API uint16x4_t vmls_lane_u16_rvv(uint16x4_t a, uint16x4_t b, uint16x4_t v, const int lane);
+RHAL_API uint16x4_t vmls_laneq_u16_rvv(uint16x4_t a, uint16x4_t b, uint16x8_t v, const int lane);
+RHAL_API uint32x2_t vmls_lane_u32_rvv(uint32x2_t a, uint32x2_t b, uint32x2_t v, const int lane);
+RHAL_API uint32x2_t vmls_laneq_u32_rvv(uint32x2_t a, uint32x2_t b, uint32x4_t v, const int lane);
+
+RHAL_API uint16x8_t vmlsq_lane_u16_rvv(uint16x8_t a, uint16x8_t b, uint16x4_t v, const int lane);
+RHAL_API uint16x8_t vmlsq_laneq_u16_rvv(uint16x8_t a, uint16x8_t b, uint16x8_t v, const int lane);
+RHAL_API uint32x4_t vmlsq_lane_u32_rvv(uint32x4_t a, uint32x4_t b, uint32x2_t v, const int lane);
+RHAL_API uint32x4_t vmlsq_laneq_u32_rvv(uint32x4_t a, uint32x4_t b, uint32x4_t v, const int lane);
+
+/* vmull* */
+RHAL_API int16x8_t vmull_s8_rvv(int8x8_t a, int8x8_t b);
+RHAL_API int32x4_t vmull_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int64x2_t vmull_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API int16x8_t vmull_high_s8_rvv(int8x16_t a, int8x16_t b);
+RHAL_API int32x4_t vmull_high_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int64x2_t vmull_high_s32_rvv(int32x4_t a, int32x4_t b);
+
+RHAL_API uint16x8_t vmull_u8_rvv(uint8x8_t a, uint8x8_t b);
+RHAL_API uint32x4_t vmull_u16_rvv(uint16x4_t a, uint16x4_t b);
+RHAL_API uint64x2_t vmull_u32_rvv(uint32x2_t a, uint32x2_t b);
+
+RHAL_API uint16x8_t vmull_high_u8_rvv(uint8x16_t a, uint8x16_t b);
+RHAL_API uint32x4_t vmull_high_u16_rvv(uint16x8_t a, uint16x8_t b);
+RHAL_API uint64x2_t vmull_high_u32_rvv(uint32x4_t a, uint32x4_t b);
+
+RHAL_API int32x4_t vmull_n_s16_rvv(int16x4_t a, int16_t b);
+RHAL_API int64x2_t vmull_n_s32_rvv(int32x2_t a, int32_t b);
+
+RHAL_API int32x4_t vmull_high_n_s16_rvv(int16x8_t a, int16_t b);
+RHAL_API int64x2_t vmull_high_n_s32_rvv(int32x4_t a, int32_t b);
+
+RHAL_API uint32x4_t vmull_n_u16_rvv(uint16x4_t a, uint16_t b);
+RHAL_API uint64x2_t vmull_n_u32_rvv(uint32x2_t a, uint32_t b);
+
+RHAL_API uint32x4_t vmull_high_n_u16_rvv(uint16x8_t a, uint16_t b);
+RHAL_API uint64x2_t vmull_high_n_u32_rvv(uint32x4_t a, uint32_t b);
+
+RHAL_API int32x4_t vmull_lane_s16_rvv(int16x4_t a, int16x4_t v, const int lane);
+RHAL_API int32x4_t vmull_laneq_s16_rvv(int16x4_t a, int16x8_t v, const int lane);
+RHAL_API int64x2_t vmull_lane_s32_rvv(int32x2_t a, int32x2_t v, const int lane);
+RHAL_API int64x2_t vmull_laneq_s32_rvv(int32x2_t a, int32x4_t v, const int lane);
+
+RHAL_API int32x4_t vmull_high_lane_s16_rvv(int16x8_t a, int16x4_t v, const int lane);
+RHAL_API int32x4_t vmull_high_laneq_s16_rvv(int16x8_t a, int16x8_t v, const int lane);
+RHAL_API int64x2_t vmull_high_lane_s32_rvv(int32x4_t a, int32x2_t v, const int lane);
+RHAL_API int64x2_t vmull_high_laneq_s32_rvv(int32x4_t a, int32x4_t v, const int lane);
+
+RHAL_API uint32x4_t vmull_lane_u16_rvv(uint16x4_t a, uint16x4_t v, const int lane);
+RHAL_API uint32x4_t vmull_laneq_u16_rvv(uint16x4_t a, uint16x8_t v, const int lane);
+RHAL_API uint64x2_t vmull_lane_u32_rvv(uint32x2_t a, uint32x2_t v, const int lane);
+RHAL_API uint64x2_t vmull_laneq_u32_rvv(uint32x2_t a, uint32x4_t v, const int lane);
+
+RHAL_API uint32x4_t vmull_high_lane_u16_rvv(uint16x8_t a, uint16x4_t v, const int lane);
+RHAL_API uint32x4_t vmull_high_laneq_u16_rvv(uint16x8_t a, uint16x8_t v, const int lane);
+RHAL_API uint64x2_t vmull_high_lane_u32_rvv(uint32x4_t a, uint32x2_t v, const int lane);
+RHAL_API uint64x2_t vmull_high_laneq_u32_rvv(uint32x4_t a, uint32x4_t v, const int lane);
+
+RHAL_API int16x8_t vmlal_s8_rvv(int16x8_t a, int8x8_t b, int8x8_t c);
+RHAL_API int32x4_t vmlal_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t c);
+RHAL_API int64x2_t vmlal_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t c);
+
+RHAL_API int16x8_t vmlal_high_s8_rvv(int16x8_t a, int8x16_t b, int8x16_t c);
+RHAL_API int32x4_t vmlal_high_s16_rvv(int32x4_t a, int16x8_t b, int16x8_t c);
+RHAL_API int64x2_t vmlal_high_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t c);
+
+RHAL_API uint16x8_t vmlal_u8_rvv(uint16x8_t a, uint8x8_t b, uint8x8_t c);
+RHAL_API uint32x4_t vmlal_u16_rvv(uint32x4_t a, uint16x4_t b, uint16x4_t c);
+RHAL_API uint64x2_t vmlal_u32_rvv(uint64x2_t a, uint32x2_t b, uint32x2_t c);
+
+RHAL_API uint16x8_t vmlal_high_u8_rvv(uint16x8_t a, uint8x16_t b, uint8x16_t c);
+RHAL_API uint32x4_t vmlal_high_u16_rvv(uint32x4_t a, uint16x8_t b, uint16x8_t c);
+RHAL_API uint64x2_t vmlal_high_u32_rvv(uint64x2_t a, uint32x4_t b, uint32x4_t c);
+
+RHAL_API int32x4_t vmlal_n_s16_rvv(int32x4_t a, int16x4_t b, int16_t c);
+RHAL_API int64x2_t vmlal_n_s32_rvv(int64x2_t a, int32x2_t b, int32_t c);
+
+RHAL_API int32x4_t vmlal_high_n_s16_rvv(int32x4_t a, int16x8_t b, int16_t c);
+RHAL_API int64x2_t vmlal_high_n_s32_rvv(int64x2_t a, int32x4_t b, int32_t c);
+
+RHAL_API uint32x4_t vmlal_n_u16_rvv(uint32x4_t a, uint16x4_t b, uint16_t c);
+RHAL_API uint64x2_t vmlal_n_u32_rvv(uint64x2_t a, uint32x2_t b, uint32_t c);
+
+RHAL_API uint32x4_t vmlal_high_n_u16_rvv(uint32x4_t a, uint16x8_t b, uint16_t c);
+RHAL_API uint64x2_t vmlal_high_n_u32_rvv(uint64x2_t a, uint32x4_t b, uint32_t c);
+
+RHAL_API int32x4_t vmlal_lane_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t v, const int lane);
+RHAL_API int32x4_t vmlal_laneq_s16_rvv(int32x4_t a, int16x4_t b, int16x8_t v, const int lane);
+RHAL_API int64x2_t vmlal_lane_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t v, const int lane);
+RHAL_API int64x2_t vmlal_laneq_s32_rvv(int64x2_t a, int32x2_t b, int32x4_t v, const int lane);
+
+RHAL_API int32x4_t vmlal_high_lane_s16_rvv(int32x4_t a, int16x8_t b, int16x4_t v, const int lane);
+RHAL_API int32x4_t vmlal_high_laneq_s16_rvv(int32x4_t a, int16x8_t b, int16x8_t v, const int lane);
+RHAL_API int64x2_t vmlal_high_lane_s32_rvv(int64x2_t a, int32x4_t b, int32x2_t v, const int lane);
+RHAL_API int64x2_t vmlal_high_laneq_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t v, const int lane);
+
+RHAL_API uint32x4_t vmlal_lane_u16_rvv(uint32x4_t a, uint16x4_t b, uint16x4_t v, const int lane);
+RHAL_API uint32x4_t vmlal_laneq_u16_rvv(uint32x4_t a, uint16x4_t b, uint16x8_t v, const int lane);
+RHAL_API uint64x2_t vmlal_lane_u32_rvv(uint64x2_t a, uint32x2_t b, uint32x2_t v, const int lane);
+RHAL_API uint64x2_t vmlal_laneq_u32_rvv(uint64x2_t a, uint32x2_t b, uint32x4_t v, const int lane);
+
+RHAL_API uint32x4_t vmlal_high_lane_u16_rvv(uint32x4_t a, uint16x8_t b, uint16x4_t v, const int lane);
+RHAL_API uint32x4_t vmlal_high_laneq_u16_rvv(uint32x4_t a, uint16x8_t b, uint16x8_t v, const int lane);
+RHAL_API uint64x2_t vmlal_high_lane_u32_rvv(uint64x2_t a, uint32x4_t b, uint32x2_t v, const int lane);
+RHAL_API uint64x2_t vmlal_high_laneq_u32_rvv(uint64x2_t a, uint32x4_t b, uint32x4_t v, const int lane);
+
+RHAL_API int16x8_t vmlsl_s8_rvv(int16x8_t a, int8x8_t b, int8x8_t c);
+RHAL_API int32x4_t vmlsl_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t c);
+RHAL_API int64x2_t vmlsl_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t c);
+
+RHAL_API int16x8_t vmlsl_high_s8_rvv(int16x8_t a, int8x16_t b, int8x16_t c);
+RHAL_API int32x4_t vmlsl_high_s16_rvv(int32x4_t a, int16x8_t b, int16x8_t c);
+RHAL_API int64x2_t vmlsl_high_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t c);
+
+RHAL_API uint16x8_t vmlsl_u8_rvv(uint16x8_t a, uint8x8_t b, uint8x8_t c);
+RHAL_API uint32x4_t vmlsl_u16_rvv(uint32x4_t a, uint16x4_t b, uint16x4_t c);
+RHAL_API uint64x2_t vmlsl_u32_rvv(uint64x2_t a, uint32x2_t b, uint32x2_t c);
+
+RHAL_API uint16x8_t vmlsl_high_u8_rvv(uint16x8_t a, uint8x16_t b, uint8x16_t c);
+RHAL_API uint32x4_t vmlsl_high_u16_rvv(uint32x4_t a, uint16x8_t b, uint16x8_t c);
+RHAL_API uint64x2_t vmlsl_high_u32_rvv(uint64x2_t a, uint32x4_t b, uint32x4_t c);
+
+RHAL_API int32x4_t vmlsl_n_s16_rvv(int32x4_t a, int16x4_t b, int16_t c);
+RHAL_API int64x2_t vmlsl_n_s32_rvv(int64x2_t a, int32x2_t b, int32_t c);
+
+RHAL_API int32x4_t vmlsl_high_n_s16_rvv(int32x4_t a, int16x8_t b, int16_t c);
+RHAL_API int64x2_t vmlsl_high_n_s32_rvv(int64x2_t a, int32x4_t b, int32_t c);
+
+RHAL_API uint32x4_t vmlsl_n_u16_rvv(uint32x4_t a, uint16x4_t b, uint16_t c);
+RHAL_API uint64x2_t vmlsl_n_u32_rvv(uint64x2_t a, uint32x2_t b, uint32_t c);
+
+RHAL_API uint32x4_t vmlsl_high_n_u16_rvv(uint32x4_t a, uint16x8_t b, uint16_t c);
+RHAL_API uint64x2_t vmlsl_high_n_u32_rvv(uint64x2_t a, uint32x4_t b, uint32_t c);
+
+RHAL_API int32x4_t vmlsl_lane_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t v, const int lane);
+RHAL_API int32x4_t vmlsl_laneq_s16_rvv(int32x4_t a, int16x4_t b, int16x8_t v, const int lane);
+RHAL_API int64x2_t vmlsl_lane_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t v, const int lane);
+RHAL_API int64x2_t vmlsl_laneq_s32_rvv(int64x2_t a, int32x2_t b, int32x4_t v, const int lane);
+
+RHAL_API int32x4_t vmlsl_high_lane_s16_rvv(int32x4_t a, int16x8_t b, int16x4_t v, const int lane);
+RHAL_API int32x4_t vmlsl_high_laneq_s16_rvv(int32x4_t a, int16x8_t b, int16x8_t v, const int lane);
+RHAL_API int64x2_t vmlsl_high_lane_s32_rvv(int64x2_t a, int32x4_t b, int32x2_t v, const int lane);
+RHAL_API int64x2_t vmlsl_high_laneq_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t v, const int lane);
+
+RHAL_API uint32x4_t vmlsl_lane_u16_rvv(uint32x4_t a, uint16x4_t b, uint16x4_t v, const int lane);
+RHAL_API uint32x4_t vmlsl_laneq_u16_rvv(uint32x4_t a, uint16x4_t b, uint16x8_t v, const int lane);
+RHAL_API uint64x2_t vmlsl_lane_u32_rvv(uint64x2_t a, uint32x2_t b, uint32x2_t v, const int lane);
+RHAL_API uint64x2_t vmlsl_laneq_u32_rvv(uint64x2_t a, uint32x2_t b, uint32x4_t v, const int lane);
+
+RHAL_API uint32x4_t vmlsl_high_lane_u16_rvv(uint32x4_t a, uint16x8_t b, uint16x4_t v, const int lane);
+RHAL_API uint32x4_t vmlsl_high_laneq_u16_rvv(uint32x4_t a, uint16x8_t b, uint16x8_t v, const int lane);
+RHAL_API uint64x2_t vmlsl_high_lane_u32_rvv(uint64x2_t a, uint32x4_t b, uint32x2_t v, const int lane);
+RHAL_API uint64x2_t vmlsl_high_laneq_u32_rvv(uint64x2_t a, uint32x4_t b, uint32x4_t v, const int lane);
+
+/* vqdmulh* */
+RHAL_API int16x4_t vqdmulh_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vqdmulh_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API int16x8_t vqdmulhq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vqdmulhq_s32_rvv(int32x4_t a, int32x4_t b);
+
+RHAL_API int16x4_t vqdmulh_n_s16_rvv(int16x4_t a, int16_t b);
+RHAL_API int32x2_t vqdmulh_n_s32_rvv(int32x2_t a, int32_t b);
+
+RHAL_API int16x8_t vqdmulhq_n_s16_rvv(int16x8_t a, int16_t b);
+RHAL_API int32x4_t vqdmulhq_n_s32_rvv(int32x4_t a, int32_t b);
+
+RHAL_API int16x4_t vqdmulh_lane_s16_rvv(int16x4_t a, int16x4_t v, const int lane);
+RHAL_API int16x4_t vqdmulh_laneq_s16_rvv(int16x4_t a, int16x8_t v, const int lane);
+RHAL_API int32x2_t vqdmulh_lane_s32_rvv(int32x2_t a, int32x2_t v, const int lane);
+RHAL_API int32x2_t vqdmulh_laneq_s32_rvv(int32x2_t a, int32x4_t v, const int lane);
+
+RHAL_API int16x8_t vqdmulhq_lane_s16_rvv(int16x8_t a, int16x4_t v, const int lane);
+RHAL_API int16x8_t vqdmulhq_laneq_s16_rvv(int16x8_t a, int16x8_t v, const int lane);
+RHAL_API int32x4_t vqdmulhq_lane_s32_rvv(int32x4_t a, int32x2_t v, const int lane);
+RHAL_API int32x4_t vqdmulhq_laneq_s32_rvv(int32x4_t a, int32x4_t v, const int lane);
+
+RHAL_API int16x4_t vqrdmulh_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int32x2_t vqrdmulh_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API int16x8_t vqrdmulhq_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int32x4_t vqrdmulhq_s32_rvv(int32x4_t a, int32x4_t b);
+
+RHAL_API int16x4_t vqrdmulh_n_s16_rvv(int16x4_t a, int16_t b);
+RHAL_API int32x2_t vqrdmulh_n_s32_rvv(int32x2_t a, int32_t b);
+
+RHAL_API int16x8_t vqrdmulhq_n_s16_rvv(int16x8_t a, int16_t b);
+RHAL_API int32x4_t vqrdmulhq_n_s32_rvv(int32x4_t a, int32_t b);
+
+RHAL_API int16x4_t vqrdmulh_lane_s16_rvv(int16x4_t a, int16x4_t v, const int lane);
+RHAL_API int16x4_t vqrdmulh_laneq_s16_rvv(int16x4_t a, int16x8_t v, const int lane);
+RHAL_API int32x2_t vqrdmulh_lane_s32_rvv(int32x2_t a, int32x2_t v, const int lane);
+RHAL_API int32x2_t vqrdmulh_laneq_s32_rvv(int32x2_t a, int32x4_t v, const int lane);
+
+RHAL_API int16x8_t vqrdmulhq_lane_s16_rvv(int16x8_t a, int16x4_t v, const int lane);
+RHAL_API int16x8_t vqrdmulhq_laneq_s16_rvv(int16x8_t a, int16x8_t v, const int lane);
+RHAL_API int32x4_t vqrdmulhq_lane_s32_rvv(int32x4_t a, int32x2_t v, const int lane);
+RHAL_API int32x4_t vqrdmulhq_laneq_s32_rvv(int32x4_t a, int32x4_t v, const int lane);
+
+RHAL_API int32x4_t vqdmull_s16_rvv(int16x4_t a, int16x4_t b);
+RHAL_API int64x2_t vqdmull_s32_rvv(int32x2_t a, int32x2_t b);
+
+RHAL_API int32x4_t vqdmull_high_s16_rvv(int16x8_t a, int16x8_t b);
+RHAL_API int64x2_t vqdmull_high_s32_rvv(int32x4_t a, int32x4_t b);
+
+RHAL_API int32x4_t vqdmull_n_s16_rvv(int16x4_t a, int16_t b);
+RHAL_API int64x2_t vqdmull_n_s32_rvv(int32x2_t a, int32_t b);
+
+RHAL_API int32x4_t vqdmull_high_n_s16_rvv(int16x8_t a, int16_t b);
+RHAL_API int64x2_t vqdmull_high_n_s32_rvv(int32x4_t a, int32_t b);
+
+RHAL_API int32x4_t vqdmull_lane_s16_rvv(int16x4_t a, int16x4_t v, const int lane);
+RHAL_API int32x4_t vqdmull_laneq_s16_rvv(int16x4_t a, int16x8_t v, const int lane);
+RHAL_API int64x2_t vqdmull_lane_s32_rvv(int32x2_t a, int32x2_t v, const int lane);
+RHAL_API int64x2_t vqdmull_laneq_s32_rvv(int32x2_t a, int32x4_t v, const int lane);
+
+RHAL_API int32x4_t vqdmull_high_lane_s16_rvv(int16x8_t a, int16x4_t v, const int lane);
+RHAL_API int32x4_t vqdmull_high_laneq_s16_rvv(int16x8_t a, int16x8_t v, const int lane);
+RHAL_API int64x2_t vqdmull_high_lane_s32_rvv(int32x4_t a, int32x2_t v, const int lane);
+RHAL_API int64x2_t vqdmull_high_laneq_s32_rvv(int32x4_t a, int32x4_t v, const int lane);
+
+RHAL_API int32x4_t vqdmlal_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t c);
+RHAL_API int64x2_t vqdmlal_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t c);
+
+RHAL_API int32x4_t vqdmlal_high_s16_rvv(int32x4_t a, int16x8_t b, int16x8_t c);
+RHAL_API int64x2_t vqdmlal_high_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t c);
+
+RHAL_API int32x4_t vqdmlal_n_s16_rvv(int32x4_t a, int16x4_t b, int16_t c);
+RHAL_API int64x2_t vqdmlal_n_s32_rvv(int64x2_t a, int32x2_t b, int32_t c);
+
+RHAL_API int32x4_t vqdmlal_high_n_s16_rvv(int32x4_t a, int16x8_t b, int16_t c);
+RHAL_API int64x2_t vqdmlal_high_n_s32_rvv(int64x2_t a, int32x4_t b, int32_t c);
+
+RHAL_API int32x4_t vqdmlal_lane_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t v, const int lane);
+RHAL_API int32x4_t vqdmlal_laneq_s16_rvv(int32x4_t a, int16x4_t b, int16x8_t v, const int lane);
+RHAL_API int64x2_t vqdmlal_lane_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t v, const int lane);
+RHAL_API int64x2_t vqdmlal_laneq_s32_rvv(int64x2_t a, int32x2_t b, int32x4_t v, const int lane);
+
+RHAL_API int32x4_t vqdmlal_high_lane_s16_rvv(int32x4_t a, int16x8_t b, int16x4_t v, const int lane);
+RHAL_API int32x4_t vqdmlal_high_laneq_s16_rvv(int32x4_t a, int16x8_t b, int16x8_t v, const int lane);
+RHAL_API int64x2_t vqdmlal_high_lane_s32_rvv(int64x2_t a, int32x4_t b, int32x2_t v, const int lane);
+RHAL_API int64x2_t vqdmlal_high_laneq_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t v, const int lane);
+
+RHAL_API int32x4_t vqdmlsl_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t c);
+RHAL_API int64x2_t vqdmlsl_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t c);
+
+RHAL_API int32x4_t vqdmlsl_high_s16_rvv(int32x4_t a, int16x8_t b, int16x8_t c);
+RHAL_API int64x2_t vqdmlsl_high_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t c);
+
+RHAL_API int32x4_t vqdmlsl_n_s16_rvv(int32x4_t a, int16x4_t b, int16_t c);
+RHAL_API int64x2_t vqdmlsl_n_s32_rvv(int64x2_t a, int32x2_t b, int32_t c);
+
+RHAL_API int32x4_t vqdmlsl_high_n_s16_rvv(int32x4_t a, int16x8_t b, int16_t c);
+RHAL_API int64x2_t vqdmlsl_high_n_s32_rvv(int64x2_t a, int32x4_t b, int32_t c);
+
+RHAL_API int32x4_t vqdmlsl_lane_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t v, const int lane);
+RHAL_API int32x4_t vqdmlsl_laneq_s16_rvv(int32x4_t a, int16x4_t b, int16x8_t v, const int lane);
+RHAL_API int64x2_t vqdmlsl_lane_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t v, const int lane);
+RHAL_API int64x2_t vqdmlsl_laneq_s32_rvv(int64x2_t a, int32x2_t b, int32x4_t v, const int lane);
+
+RHAL_API int32x4_t vqdmlsl_high_lane_s16_rvv(int32x4_t a, int16x8_t b, int16x4_t v, const int lane);
+RHAL_API int32x4_t vqdmlsl_high_laneq_s16_rvv(int32x4_t a, int16x8_t b, int16x8_t v, const int lane);
+RHAL_API int64x2_t vqdmlsl_high_lane_s32_rvv(int64x2_t a, int32x4_t b, int32x2_t v, const int lane);
+RHAL_API int64x2_t vqdmlsl_high_laneq_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t v, const int lane);
+
+RHAL_API int16x4_t vqrdmlah_s16_rvv(int16x4_t a, int16x4_t b, int16x4_t c);
+RHAL_API int32x2_t vqrdmlah_s32_rvv(int32x2_t a, int32x2_t b, int32x2_t c);
+
+RHAL_API int16x8_t vqrdmlahq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t c);
+RHAL_API int32x4_t vqrdmlahq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t c);
+
+RHAL_API int16x4_t vqrdmlah_lane_s16_rvv(int16x4_t a, int16x4_t b, int16x4_t v, const int lane);
+RHAL_API int16x4_t vqrdmlah_laneq_s16_rvv(int16x4_t a, int16x4_t b, int16x8_t v, const int lane);
+RHAL_API int32x2_t vqrdmlah_lane_s32_rvv(int32x2_t a, int32x2_t b, int32x2_t v, const int lane);
+RHAL_API int32x2_t vqrdmlah_laneq_s32_rvv(int32x2_t a, int32x2_t b, int32x4_t v, const int lane);
+
+RHAL_API int16x8_t vqrdmlahq_lane_s16_rvv(int16x8_t a, int16x8_t b, int16x4_t v, const int lane);
+RHAL_API int16x8_t vqrdmlahq_laneq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t v, const int lane);
+RHAL_API int32x4_t vqrdmlahq_lane_s32_rvv(int32x4_t a, int32x4_t b, int32x2_t v, const int lane);
+RHAL_API int32x4_t vqrdmlahq_laneq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t v, const int lane);
+
+RHAL_API int16x4_t vqrdmlsh_s16_rvv(int16x4_t a, int16x4_t b, int16x4_t c);
+RHAL_API int32x2_t vqrdmlsh_s32_rvv(int32x2_t a, int32x2_t b, int32x2_t c);
+
+RHAL_API int16x8_t vqrdmlshq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t c);
+RHAL_API int32x4_t vqrdmlshq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t c);
+
+RHAL_API int16x4_t vqrdmlsh_lane_s16_rvv(int16x4_t a, int16x4_t b, int16x4_t v, const int lane);
+RHAL_API int16x4_t vqrdmlsh_laneq_s16_rvv(int16x4_t a, int16x4_t b, int16x8_t v, const int lane);
+RHAL_API int32x2_t vqrdmlsh_lane_s32_rvv(int32x2_t a, int32x2_t b, int32x2_t v, const int lane);
+RHAL_API int32x2_t vqrdmlsh_laneq_s32_rvv(int32x2_t a, int32x2_t b, int32x4_t v, const int lane);
+
+RHAL_API int16x8_t vqrdmlshq_lane_s16_rvv(int16x8_t a, int16x8_t b, int16x4_t v, const int lane);
+RHAL_API int16x8_t vqrdmlshq_laneq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t v, const int lane);
+RHAL_API int32x4_t vqrdmlshq_lane_s32_rvv(int32x4_t a, int32x4_t b, int32x2_t v, const int lane);
+RHAL_API int32x4_t vqrdmlshq_laneq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t v, const int lane);
+
+/* vaddq (paired) */
+RHAL_API int8x32_t vaddq_s8_x2_rvv(int8x32_t a, int8x32_t b);
+RHAL_API int16x16_t vaddq_s16_x2_rvv(int16x16_t a, int16x16_t b);
+RHAL_API int32x8_t vaddq_s32_x2_rvv(int32x8_t a, int32x8_t b);
+RHAL_API int64x4_t vaddq_s64_x2_rvv(int64x4_t a, int64x4_t b);
+
+RHAL_API uint8x32_t vaddq_u8_x2_rvv(uint8x32_t a, uint8x32_t b);
+RHAL_API uint16x16_t vaddq_u16_x2_rvv(uint16x16_t a, uint16x16_t b);
+RHAL_API uint32x8_t vaddq_u32_x2_rvv(uint32x8_t a, uint32x8_t b);
+RHAL_API uint64x4_t vaddq_u64_x2_rvv(uint64x4_t a, uint64x4_t b);
+
+/* vsubq (paired) */
+RHAL_API int8x32_t vsubq_s8_x2_rvv(int8x32_t a, int8x32_t b);
+RHAL_API int16x16_t vsubq_s16_x2_rvv(int16x16_t a, int16x16_t b);
+RHAL_API int32x8_t vsubq_s32_x2_rvv(int32x8_t a, int32x8_t b);
+RHAL_API int64x4_t vsubq_s64_x2_rvv(int64x4_t a, int64x4_t b);
+
+RHAL_API uint8x32_t vsubq_u8_x2_rvv(uint8x32_t a, uint8x32_t b);
+RHAL_API uint16x16_t vsubq_u16_x2_rvv(uint16x16_t a, uint16x16_t b);
+RHAL_API uint32x8_t vsubq_u32_x2_rvv(uint32x8_t a, uint32x8_t b);
+RHAL_API uint64x4_t vsubq_u64_x2_rvv(uint64x4_t a, uint64x4_t b);
+
+/* vqaddq (paired) */
+RHAL_API int8x32_t vqaddq_s8_x2_rvv(int8x32_t a, int8x32_t b);
+RHAL_API int16x16_t vqaddq_s16_x2_rvv(int16x16_t a, int16x16_t b);
+RHAL_API int32x8_t vqaddq_s32_x2_rvv(int32x8_t a, int32x8_t b);
+RHAL_API int64x4_t vqaddq_s64_x2_rvv(int64x4_t a, int64x4_t b);
+
+RHAL_API uint8x32_t vqaddq_u8_x2_rvv(uint8x32_t a, uint8x32_t b);
+RHAL_API uint16x16_t vqaddq_u16_x2_rvv(uint16x16_t a, uint16x16_t b);
+RHAL_API uint32x8_t vqaddq_u32_x2_rvv(uint32x8_t a, uint32x8_t b);
+RHAL_API uint64x4_t vqaddq_u64_x2_rvv(uint64x4_t a, uint64x4_t b);
+
+/* vqsubq (paired) */
+RHAL_API int8x32_t vqsubq_s8_x2_rvv(int8x32_t a, int8x32_t b);
+RHAL_API int16x16_t vqsubq_s16_x2_rvv(int16x16_t a, int16x16_t b);
+RHAL_API int32x8_t vqsubq_s32_x2_rvv(int32x8_t a, int32x8_t b);
+RHAL_API int64x4_t vqsubq_s64_x2_rvv(int64x4_t a, int64x4_t b);
+
+RHAL_API uint8x32_t vqsubq_u8_x2_rvv(uint8x32_t a, uint8x32_t b);
+RHAL_API uint16x16_t vqsubq_u16_x2_rvv(uint16x16_t a, uint16x16_t b);
+RHAL_API uint32x8_t vqsubq_u32_x2_rvv(uint32x8_t a, uint32x8_t b);
+RHAL_API uint64x4_t vqsubq_u64_x2_rvv(uint64x4_t a, uint64x4_t b);
+
+/* vcombineq (paired) */
+RHAL_API int8x32_t vcombineq_s8_x2_rvv(int8x16_t low, int8x16_t high);
+RHAL_API int16x16_t vcombineq_s16_x2_rvv(int16x8_t low, int16x8_t high);
+RHAL_API int32x8_t vcombineq_s32_x2_rvv(int32x4_t low, int32x4_t high);
+RHAL_API int64x4_t vcombineq_s64_x2_rvv(int64x2_t low, int64x2_t high);
+
+RHAL_API uint8x32_t vcombineq_u8_x2_rvv(uint8x16_t low, uint8x16_t high);
+RHAL_API uint16x16_t vcombineq_u16_x2_rvv(uint16x8_t low, uint16x8_t high);
+RHAL_API uint32x8_t vcombineq_u32_x2_rvv(uint32x4_t low, uint32x4_t high);
+RHAL_API uint64x4_t vcombineq_u64_x2_rvv(uint64x2_t low, uint64x2_t high);
+
+/* vgetq_low (paired) */
+RHAL_API int8x16_t vgetq_low_s8_x2_rvv(int8x32_t p);
+RHAL_API int16x8_t vgetq_low_s16_x2_rvv(int16x16_t p);
+RHAL_API int32x4_t vgetq_low_s32_x2_rvv(int32x8_t p);
+RHAL_API int64x2_t vgetq_low_s64_x2_rvv(int64x4_t p);
+
+RHAL_API uint8x16_t vgetq_low_u8_x2_rvv(uint8x32_t p);
+RHAL_API uint16x8_t vgetq_low_u16_x2_rvv(uint16x16_t p);
+RHAL_API uint32x4_t vgetq_low_u32_x2_rvv(uint32x8_t p);
+RHAL_API uint64x2_t vgetq_low_u64_x2_rvv(uint64x4_t p);
+
+/* vgetq_high (paired) */
+RHAL_API int8x16_t vgetq_high_s8_x2_rvv(int8x32_t p);
+RHAL_API int16x8_t vgetq_high_s16_x2_rvv(int16x16_t p);
+RHAL_API int32x4_t vgetq_high_s32_x2_rvv(int32x8_t p);
+RHAL_API int64x2_t vgetq_high_s64_x2_rvv(int64x4_t p);
+
+RHAL_API uint8x16_t vgetq_high_u8_x2_rvv(uint8x32_t p);
+RHAL_API uint16x8_t vgetq_high_u16_x2_rvv(uint16x16_t p);
+RHAL_API uint32x4_t vgetq_high_u32_x2_rvv(uint32x8_t p);
+RHAL_API uint64x2_t vgetq_high_u64_x2_rvv(uint64x4_t p);
+
+/* vld1 */
+RHAL_API int8x8_t vld1_s8_rvv(const int8_t *ptr);
+RHAL_API int16x4_t vld1_s16_rvv(const int16_t *ptr);
+RHAL_API int32x2_t vld1_s32_rvv(const int32_t *ptr);
+RHAL_API int64x1_t vld1_s64_rvv(const int64_t *ptr);
+
+RHAL_API int8x16_t vld1q_s8_rvv(const int8_t *ptr);
+RHAL_API int16x8_t vld1q_s16_rvv(const int16_t *ptr);
+RHAL_API int32x4_t vld1q_s32_rvv(const int32_t *ptr);
+RHAL_API int64x2_t vld1q_s64_rvv(const int64_t *ptr);
+
+RHAL_API uint8x8_t vld1_u8_rvv(const uint8_t *ptr);
+RHAL_API uint16x4_t vld1_u16_rvv(const uint16_t *ptr);
+RHAL_API uint32x2_t vld1_u32_rvv(const uint32_t *ptr);
+RHAL_API uint64x1_t vld1_u64_rvv(const uint64_t *ptr);
+
+RHAL_API uint8x16_t vld1q_u8_rvv(const uint8_t *ptr);
+RHAL_API uint16x8_t vld1q_u16_rvv(const uint16_t *ptr);
+RHAL_API uint32x4_t vld1q_u32_rvv(const uint32_t *ptr);
+RHAL_API uint64x2_t vld1q_u64_rvv(const uint64_t *ptr);
+
+/* vld1_dup */
+RHAL_API int8x8_t vld1_dup_s8_rvv(const int8_t *ptr);
+RHAL_API int16x4_t vld1_dup_s16_rvv(const int16_t *ptr);
+RHAL_API int32x2_t vld1_dup_s32_rvv(const int32_t *ptr);
+RHAL_API int64x1_t vld1_dup_s64_rvv(const int64_t *ptr);
+
+RHAL_API int8x16_t vld1q_dup_s8_rvv(const int8_t *ptr);
+RHAL_API int16x8_t vld1q_dup_s16_rvv(const int16_t *ptr);
+RHAL_API int32x4_t vld1q_dup_s32_rvv(const int32_t *ptr);
+RHAL_API int64x2_t vld1q_dup_s64_rvv(const int64_t *ptr);
+
+RHAL_API uint8x8_t vld1_dup_u8_rvv(const uint8_t *ptr);
+RHAL_API uint16x4_t vld1_dup_u16_rvv(const uint16_t *ptr);
+RHAL_API uint32x2_t vld1_dup_u32_rvv(const uint32_t *ptr);
+RHAL_API uint64x1_t vld1_dup_u64_rvv(const uint64_t *ptr);
+
+RHAL_API uint8x16_t vld1q_dup_u8_rvv(const uint8_t *ptr);
+RHAL_API uint16x8_t vld1q_dup_u16_rvv(const uint16_t *ptr);
+RHAL_API uint32x4_t vld1q_dup_u32_rvv(const uint32_t *ptr);
+RHAL_API uint64x2_t vld1q_dup_u64_rvv(const uint64_t *ptr);
+
+/* vld1_lane */
+RHAL_API int8x8_t vld1_lane_s8_rvv(const int8_t *ptr, int8x8_t src, const int lane);
+RHAL_API int16x4_t vld1_lane_s16_rvv(const int16_t *ptr, int16x4_t src, const int lane);
+RHAL_API int32x2_t vld1_lane_s32_rvv(const int32_t *ptr, int32x2_t src, const int lane);
+RHAL_API int64x1_t vld1_lane_s64_rvv(const int64_t *ptr, int64x1_t src, const int lane);
+
+RHAL_API int8x16_t vld1q_lane_s8_rvv(const int8_t *ptr, int8x16_t src, const int lane);
+RHAL_API int16x8_t vld1q_lane_s16_rvv(const int16_t *ptr, int16x8_t src, const int lane);
+RHAL_API int32x4_t vld1q_lane_s32_rvv(const int32_t *ptr, int32x4_t src, const int lane);
+RHAL_API int64x2_t vld1q_lane_s64_rvv(const int64_t *ptr, int64x2_t src, const int lane);
+
+RHAL_API uint8x8_t vld1_lane_u8_rvv(const uint8_t *ptr, uint8x8_t src, const int lane);
+RHAL_API uint16x4_t vld1_lane_u16_rvv(const uint16_t *ptr, uint16x4_t src, const int lane);
+RHAL_API uint32x2_t vld1_lane_u32_rvv(const uint32_t *ptr, uint32x2_t src, const int lane);
+RHAL_API uint64x1_t vld1_lane_u64_rvv(const uint64_t *ptr, uint64x1_t src, const int lane);
+
+RHAL_API uint8x16_t vld1q_lane_u8_rvv(const uint8_t *ptr, uint8x16_t src, const int lane);
+RHAL_API uint16x8_t vld1q_lane_u16_rvv(const uint16_t *ptr, uint16x8_t src, const int lane);
+RHAL_API uint32x4_t vld1q_lane_u32_rvv(const uint32_t *ptr, uint32x4_t src, const int lane);
+RHAL_API uint64x2_t vld1q_lane_u64_rvv(const uint64_t *ptr, uint64x2_t src, const int lane);
+
+/* vld1_x2, vld1_x3, vld1_x4 */
+RHAL_API int8x8x2_t vld1_s8_x2_rvv(const int8_t *ptr);
+RHAL_API int8x8x3_t vld1_s8_x3_rvv(const int8_t *ptr);
+RHAL_API int8x8x4_t vld1_s8_x4_rvv(const int8_t *ptr);
+RHAL_API int16x4x2_t vld1_s16_x2_rvv(const int16_t *ptr);
+RHAL_API int16x4x3_t vld1_s16_x3_rvv(const int16_t *ptr);
+RHAL_API int16x4x4_t vld1_s16_x4_rvv(const int16_t *ptr);
+RHAL_API int32x2x2_t vld1_s32_x2_rvv(const int32_t *ptr);
+RHAL_API int32x2x3_t vld1_s32_x3_rvv(const int32_t *ptr);
+RHAL_API int32x2x4_t vld1_s32_x4_rvv(const int32_t *ptr);
+RHAL_API int64x1x2_t vld1_s64_x2_rvv(const int64_t *ptr);
+RHAL_API int64x1x3_t vld1_s64_x3_rvv(const int64_t *ptr);
+RHAL_API int64x1x4_t vld1_s64_x4_rvv(const int64_t *ptr);
+
+RHAL_API int8x16x2_t vld1q_s8_x2_rvv(const int8_t *ptr);
+RHAL_API int8x16x3_t vld1q_s8_x3_rvv(const int8_t *ptr);
+RHAL_API int8x16x4_t vld1q_s8_x4_rvv(const int8_t *ptr);
+RHAL_API int16x8x2_t vld1q_s16_x2_rvv(const int16_t *ptr);
+RHAL_API int16x8x3_t vld1q_s16_x3_rvv(const int16_t *ptr);
+RHAL_API int16x8x4_t vld1q_s16_x4_rvv(const int16_t *ptr);
+RHAL_API int32x4x2_t vld1q_s32_x2_rvv(const int32_t *ptr);
+RHAL_API int32x4x3_t vld1q_s32_x3_rvv(const int32_t *ptr);
+RHAL_API int32x4x4_t vld1q_s32_x4_rvv(const int32_t *ptr);
+RHAL_API int64x2x2_t vld1q_s64_x2_rvv(const int64_t *ptr);
+RHAL_API int64x2x3_t vld1q_s64_x3_rvv(const int64_t *ptr);
+RHAL_API int64x2x4_t vld1q_s64_x4_rvv(const int64_t *ptr);
+
+RHAL_API uint8x8x2_t vld1_u8_x2_rvv(const uint8_t *ptr);
+RHAL_API uint8x8x3_t vld1_u8_x3_rvv(const uint8_t *ptr);
+RHAL_API uint8x8x4_t vld1_u8_x4_rvv(const uint8_t *ptr);
+RHAL_API uint16x4x2_t vld1_u16_x2_rvv(const uint16_t *ptr);
+RHAL_API uint16x4x3_t vld1_u16_x3_rvv(const uint16_t *ptr);
+RHAL_API uint16x4x4_t vld1_u16_x4_rvv(const uint16_t *ptr);
+RHAL_API uint32x2x2_t vld1_u32_x2_rvv(const uint32_t *ptr);
+RHAL_API uint32x2x3_t vld1_u32_x3_rvv(const uint32_t *ptr);
+RHAL_API uint32x2x4_t vld1_u32_x4_rvv(const uint32_t *ptr);
+RHAL_API uint64x1x2_t vld1_u64_x2_rvv(const uint64_t *ptr);
+RHAL_API uint64x1x3_t vld1_u64_x3_rvv(const uint64_t *ptr);
+RHAL_API uint64x1x4_t vld1_u64_x4_rvv(const uint64_t *ptr);
+
+RHAL_API uint8x16x2_t vld1q_u8_x2_rvv(const uint8_t *ptr);
+RHAL_API uint8x16x3_t vld1q_u8_x3_rvv(const uint8_t *ptr);
+RHAL_API uint8x16x4_t vld1q_u8_x4_rvv(const uint8_t *ptr);
+RHAL_API uint16x8x2_t vld1q_u16_x2_rvv(const uint16_t *ptr);
+RHAL_API uint16x8x3_t vld1q_u16_x3_rvv(const uint16_t *ptr);
+RHAL_API uint16x8x4_t vld1q_u16_x4_rvv(const uint16_t *ptr);
+RHAL_API uint32x4x2_t vld1q_u32_x2_rvv(const uint32_t *ptr);
+RHAL_API uint32x4x3_t vld1q_u32_x3_rvv(const uint32_t *ptr);
+RHAL_API uint32x4x4_t vld1q_u32_x4_rvv(const uint32_t *ptr);
+RHAL_API uint64x2x2_t vld1q_u64_x2_rvv(const uint64_t *ptr);
+RHAL_API uint64x2x3_t vld1q_u64_x3_rvv(const uint64_t *ptr);
+RHAL_API uint64x2x4_t vld1q_u64_x4_rvv(const uint64_t *ptr);
+
+/* vst1 */
+RHAL_API void vst1_s8_rvv(int8_t *ptr, int8x8_t val);
+RHAL_API void vst1_s16_rvv(int16_t *ptr, int16x4_t val);
+RHAL_API void vst1_s32_rvv(int32_t *ptr, int32x2_t val);
+RHAL_API void vst1_s64_rvv(int64_t *ptr, int64x1_t val);
+
+RHAL_API void vst1q_s8_rvv(int8_t *ptr, int8x16_t val);
+RHAL_API void vst1q_s16_rvv(int16_t *ptr, int16x8_t val);
+RHAL_API void vst1q_s32_rvv(int32_t *ptr, int32x4_t val);
+RHAL_API void vst1q_s64_rvv(int64_t *ptr, int64x2_t val);
+
+RHAL_API void vst1_u8_rvv(uint8_t *ptr, uint8x8_t val);
+RHAL_API void vst1_u16_rvv(uint16_t *ptr, uint16x4_t val);
+RHAL_API void vst1_u32_rvv(uint32_t *ptr, uint32x2_t val);
+RHAL_API void vst1_u64_rvv(uint64_t *ptr, uint64x1_t val);
+
+RHAL_API void vst1q_u8_rvv(uint8_t *ptr, uint8x16_t val);
+RHAL_API void vst1q_u16_rvv(uint16_t *ptr, uint16x8_t val);
+RHAL_API void vst1q_u32_rvv(uint32_t *ptr, uint32x4_t val);
+RHAL_API void vst1q_u64_rvv(uint64_t *ptr, uint64x2_t val);
+
+/* vst1_lane */
+RHAL_API void vst1_lane_s8_rvv(int8_t *ptr, int8x8_t val, const int lane);
+RHAL_API void vst1_lane_s16_rvv(int16_t *ptr, int16x4_t val, const int lane);
+RHAL_API void vst1_lane_s32_rvv(int32_t *ptr, int32x2_t val, const int lane);
+RHAL_API void vst1_lane_s64_rvv(int64_t *ptr, int64x1_t val, const int lane);
+
+RHAL_API void vst1q_lane_s8_rvv(int8_t *ptr, int8x16_t val, const int lane);
+RHAL_API void vst1q_lane_s16_rvv(int16_t *ptr, int16x8_t val, const int lane);
+RHAL_API void vst1q_lane_s32_rvv(int32_t *ptr, int32x4_t val, const int lane);
+RHAL_API void vst1q_lane_s64_rvv(int64_t *ptr, int64x2_t val, const int lane);
+
+RHAL_API void vst1_lane_u8_rvv(uint8_t *ptr, uint8x8_t val, const int lane);
+RHAL_API void vst1_lane_u16_rvv(uint16_t *ptr, uint16x4_t val, const int lane);
+RHAL_API void vst1_lane_u32_rvv(uint32_t *ptr, uint32x2_t val, const int lane);
+RHAL_API void vst1_lane_u64_rvv(uint64_t *ptr, uint64x1_t val, const int lane);
+
+RHAL_API void vst1q_lane_u8_rvv(uint8_t *ptr, uint8x16_t val, const int lane);
+RHAL_API void vst1q_lane_u16_rvv(uint16_t *ptr, uint16x8_t val, const int lane);
+RHAL_API void vst1q_lane_u32_rvv(uint32_t *ptr, uint32x4_t val, const int lane);
+RHAL_API void vst1q_lane_u64_rvv(uint64_t *ptr, uint64x2_t val, const int lane);
+
+/* vst1_x2, vst1_x3, vst1_x4 */
+RHAL_API void vst1_s8_x2_rvv(int8_t *ptr, int8x8x2_t val);
+RHAL_API void vst1_s8_x3_rvv(int8_t *ptr, int8x8x3_t val);
+RHAL_API void vst1_s8_x4_rvv(int8_t *ptr, int8x8x4_t val);
+RHAL_API void vst1_s16_x2_rvv(int16_t *ptr, int16x4x2_t val);
+RHAL_API void vst1_s16_x3_rvv(int16_t *ptr, int16x4x3_t val);
+RHAL_API void vst1_s16_x4_rvv(int16_t *ptr, int16x4x4_t val);
+RHAL_API void vst1_s32_x2_rvv(int32_t *ptr, int32x2x2_t val);
+RHAL_API void vst1_s32_x3_rvv(int32_t *ptr, int32x2x3_t val);
+RHAL_API void vst1_s32_x4_rvv(int32_t *ptr, int32x2x4_t val);
+RHAL_API void vst1_s64_x2_rvv(int64_t *ptr, int64x1x2_t val);
+RHAL_API void vst1_s64_x3_rvv(int64_t *ptr, int64x1x3_t val);
+RHAL_API void vst1_s64_x4_rvv(int64_t *ptr, int64x1x4_t val);
+
+RHAL_API void vst1q_s8_x2_rvv(int8_t *ptr, int8x16x2_t val);
+RHAL_API void vst1q_s8_x3_rvv(int8_t *ptr, int8x16x3_t val);
+RHAL_API void vst1q_s8_x4_rvv(int8_t *ptr, int8x16x4_t val);
+RHAL_API void vst1q_s16_x2_rvv(int16_t *ptr, int16x8x2_t val);
+RHAL_API void vst1q_s16_x3_rvv(int16_t *ptr, int16x8x3_t val);
+RHAL_API void vst1q_s16_x4_rvv(int16_t *ptr, int16x8x4_t val);
+RHAL_API void vst1q_s32_x2_rvv(int32_t *ptr, int32x4x2_t val);
+RHAL_API void vst1q_s32_x3_rvv(int32_t *ptr, int32x4x3_t val);
+RHAL_API void vst1q_s32_x4_rvv(int32_t *ptr, int32x4x4_t val);
+RHAL_API void vst1q_s64_x2_rvv(int64_t *ptr, int64x2x2_t val);
+RHAL_API void vst1q_s64_x3_rvv(int64_t *ptr, int64x2x3_t val);
+RHAL_API void vst1q_s64_x4_rvv(int64_t *ptr, int64x2x4_t val);
+
+RHAL_API void vst1_u8_x2_rvv(uint8_t *ptr, uint8x8x2_t val);
+RHAL_API void vst1_u8_x3_rvv(uint8_t *ptr, uint8x8x3_t val);
+RHAL_API void vst1_u8_x4_rvv(uint8_t *ptr, uint8x8x4_t val);
+RHAL_API void vst1_u16_x2_rvv(uint16_t *ptr, uint16x4x2_t val);
+RHAL_API void vst1_u16_x3_rvv(uint16_t *ptr, uint16x4x3_t val);
+RHAL_API void vst1_u16_x4_rvv(uint16_t *ptr, uint16x4x4_t val);
+RHAL_API void vst1_u32_x2_rvv(uint32_t *ptr, uint32x2x2_t val);
+RHAL_API void vst1_u32_x3_rvv(uint32_t *ptr, uint32x2x3_t val);
+RHAL_API void vst1_u32_x4_rvv(uint32_t *ptr, uint32x2x4_t val);
+RHAL_API void vst1_u64_x2_rvv(uint64_t *ptr, uint64x1x2_t val);
+RHAL_API void vst1_u64_x3_rvv(uint64_t *ptr, uint64x1x3_t val);
+RHAL_API void vst1_u64_x4_rvv(uint64_t *ptr, uint64x1x4_t val);
+
+RHAL_API void vst1q_u8_x2_rvv(uint8_t *ptr, uint8x16x2_t val);
+RHAL_API void vst1q_u8_x3_rvv(uint8_t *ptr, uint8x16x3_t val);
+RHAL_API void vst1q_u8_x4_rvv(uint8_t *ptr, uint8x16x4_t val);
+RHAL_API void vst1q_u16_x2_rvv(uint16_t *ptr, uint16x8x2_t val);
+RHAL_API void vst1q_u16_x3_rvv(uint16_t *ptr, uint16x8x3_t val);
+RHAL_API void vst1q_u16_x4_rvv(uint16_t *ptr, uint16x8x4_t val);
+RHAL_API void vst1q_u32_x2_rvv(uint32_t *ptr, uint32x4x2_t val);
+RHAL_API void vst1q_u32_x3_rvv(uint32_t *ptr, uint32x4x3_t val);
+RHAL_API void vst1q_u32_x4_rvv(uint32_t *ptr, uint32x4x4_t val);
+RHAL_API void vst1q_u64_x2_rvv(uint64_t *ptr, uint64x2x2_t val);
+RHAL_API void vst1q_u64_x3_rvv(uint64_t *ptr, uint64x2x3_t val);
+RHAL_API void vst1q_u64_x4_rvv(uint64_t *ptr, uint64x2x4_t val);
+
+/* vld2, vld3, vld4 */
+RHAL_API int8x8x2_t vld2_s8_rvv(const int8_t *ptr);
+RHAL_API int8x8x3_t vld3_s8_rvv(const int8_t *ptr);
+RHAL_API int8x8x4_t vld4_s8_rvv(const int8_t *ptr);
+RHAL_API int16x4x2_t vld2_s16_rvv(const int16_t *ptr);
+RHAL_API int16x4x3_t vld3_s16_rvv(const int16_t *ptr);
+RHAL_API int16x4x4_t vld4_s16_rvv(const int16_t *ptr);
+RHAL_API int32x2x2_t vld2_s32_rvv(const int32_t *ptr);
+RHAL_API int32x2x3_t vld3_s32_rvv(const int32_t *ptr);
+RHAL_API int32x2x4_t vld4_s32_rvv(const int32_t *ptr);
+RHAL_API int64x1x2_t vld2_s64_rvv(const int64_t *ptr);
+RHAL_API int64x1x3_t vld3_s64_rvv(const int64_t *ptr);
+RHAL_API int64x1x4_t vld4_s64_rvv(const int64_t *ptr);
+
+RHAL_API int8x16x2_t vld2q_s8_rvv(const int8_t *ptr);
+RHAL_API int8x16x3_t vld3q_s8_rvv(const int8_t *ptr);
+RHAL_API int8x16x4_t vld4q_s8_rvv(const int8_t *ptr);
+RHAL_API int16x8x2_t vld2q_s16_rvv(const int16_t *ptr);
+RHAL_API int16x8x3_t vld3q_s16_rvv(const int16_t *ptr);
+RHAL_API int16x8x4_t vld4q_s16_rvv(const int16_t *ptr);
+RHAL_API int32x4x2_t vld2q_s32_rvv(const int32_t *ptr);
+RHAL_API int32x4x3_t vld3q_s32_rvv(const int32_t *ptr);
+RHAL_API int32x4x4_t vld4q_s32_rvv(const int32_t *ptr);
+RHAL_API int64x2x2_t vld2q_s64_rvv(const int64_t *ptr);
+RHAL_API int64x2x3_t vld3q_s64_rvv(const int64_t *ptr);
+RHAL_API int64x2x4_t vld4q_s64_rvv(const int64_t *ptr);
+
+RHAL_API uint8x8x2_t vld2_u8_rvv(const uint8_t *ptr);
+RHAL_API uint8x8x3_t vld3_u8_rvv(const uint8_t *ptr);
+RHAL_API uint8x8x4_t vld4_u8_rvv(const uint8_t *ptr);
+RHAL_API uint16x4x2_t vld2_u16_rvv(const uint16_t *ptr);
+RHAL_API uint16x4x3_t vld3_u16_rvv(const uint16_t *ptr);
+RHAL_API uint16x4x4_t vld4_u16_rvv(const uint16_t *ptr);
+RHAL_API uint32x2x2_t vld2_u32_rvv(const uint32_t *ptr);
+RHAL_API uint32x2x3_t vld3_u32_rvv(const uint32_t *ptr);
+RHAL_API uint32x2x4_t vld4_u32_rvv(const uint32_t *ptr);
+RHAL_API uint64x1x2_t vld2_u64_rvv(const uint64_t *ptr);
+RHAL_API uint64x1x3_t vld3_u64_rvv(const uint64_t *ptr);
+RHAL_API uint64x1x4_t vld4_u64_rvv(const uint64_t *ptr);
+
+RHAL_API uint8x16x2_t vld2q_u8_rvv(const uint8_t *ptr);
+RHAL_API uint8x16x3_t vld3q_u8_rvv(const uint8_t *ptr);
+RHAL_API uint8x16x4_t vld4q_u8_rvv(const uint8_t *ptr);
+RHAL_API uint16x8x2_t vld2q_u16_rvv(const uint16_t *ptr);
+RHAL_API uint16x8x3_t vld3q_u16_rvv(const uint16_t *ptr);
+RHAL_API uint16x8x4_t vld4q_u16_rvv(const uint16_t *ptr);
+RHAL_API uint32x4x2_t vld2q_u32_rvv(const uint32_t *ptr);
+RHAL_API uint32x4x3_t vld3q_u32_rvv(const uint32_t *ptr);
+RHAL_API uint32x4x4_t vld4q_u32_rvv(const uint32_t *ptr);
+RHAL_API uint64x2x2_t vld2q_u64_rvv(const uint64_t *ptr);
+RHAL_API uint64x2x3_t vld3q_u64_rvv(const uint64_t *ptr);
+RHAL_API uint64x2x4_t vld4q_u64_rvv(const uint64_t *ptr);
+
+/* vld2_dup, vld3_dup, vld4_dup */
+RHAL_API int8x8x2_t vld2_dup_s8_rvv(const int8_t *ptr);
+RHAL_API int8x8x3_t vld3_dup_s8_rvv(const int8_t *ptr);
+RHAL_API int8x8x4_t vld4_dup_s8_rvv(const int8_t *ptr);
+RHAL_API int16x4x2_t vld2_dup_s16_rvv(const int16_t *ptr);
+RHAL_API int16x4x3_t vld3_dup_s16_rvv(const int16_t *ptr);
+RHAL_API int16x4x4_t vld4_dup_s16_rvv(const int16_t *ptr);
+RHAL_API int32x2x2_t vld2_dup_s32_rvv(const int32_t *ptr);
+RHAL_API int32x2x3_t vld3_dup_s32_rvv(const int32_t *ptr);
+RHAL_API int32x2x4_t vld4_dup_s32_rvv(const int32_t *ptr);
+RHAL_API int64x1x2_t vld2_dup_s64_rvv(const int64_t *ptr);
+RHAL_API int64x1x3_t vld3_dup_s64_rvv(const int64_t *ptr);
+RHAL_API int64x1x4_t vld4_dup_s64_rvv(const int64_t *ptr);
+
+RHAL_API int8x16x2_t vld2q_dup_s8_rvv(const int8_t *ptr);
+RHAL_API int8x16x3_t vld3q_dup_s8_rvv(const int8_t *ptr);
+RHAL_API int8x16x4_t vld4q_dup_s8_rvv(const int8_t *ptr);
+RHAL_API int16x8x2_t vld2q_dup_s16_rvv(const int16_t *ptr);
+RHAL_API int16x8x3_t vld3q_dup_s16_rvv(const int16_t *ptr);
+RHAL_API int16x8x4_t vld4q_dup_s16_rvv(const int16_t *ptr);
+RHAL_API int32x4x2_t vld2q_dup_s32_rvv(const int32_t *ptr);
+RHAL_API int32x4x3_t vld3q_dup_s32_rvv(const int32_t *ptr);
+RHAL_API int32x4x4_t vld4q_dup_s32_rvv(const int32_t *ptr);
+RHAL_API int64x2x2_t vld2q_dup_s64_rvv(const int64_t *ptr);
+RHAL_API int64x2x3_t vld3q_dup_s64_rvv(const int64_t *ptr);
+RHAL_API int64x2x4_t vld4q_dup_s64_rvv(const int64_t *ptr);
+
+RHAL_API uint8x8x2_t vld2_dup_u8_rvv(const uint8_t *ptr);
+RHAL_API uint8x8x3_t vld3_dup_u8_rvv(const uint8_t *ptr);
+RHAL_API uint8x8x4_t vld4_dup_u8_rvv(const uint8_t *ptr);
+RHAL_API uint16x4x2_t vld2_dup_u16_rvv(const uint16_t *ptr);
+RHAL_API uint16x4x3_t vld3_dup_u16_rvv(const uint16_t *ptr);
+RHAL_API uint16x4x4_t vld4_dup_u16_rvv(const uint16_t *ptr);
+RHAL_API uint32x2x2_t vld2_dup_u32_rvv(const uint32_t *ptr);
+RHAL_API uint32x2x3_t vld3_dup_u32_rvv(const uint32_t *ptr);
+RHAL_API uint32x2x4_t vld4_dup_u32_rvv(const uint32_t *ptr);
+RHAL_API uint64x1x2_t vld2_dup_u64_rvv(const uint64_t *ptr);
+RHAL_API uint64x1x3_t vld3_dup_u64_rvv(const uint64_t *ptr);
+RHAL_API uint64x1x4_t vld4_dup_u64_rvv(const uint64_t *ptr);
+
+RHAL_API uint8x16x2_t vld2q_dup_u8_rvv(const uint8_t *ptr);
+RHAL_API uint8x16x3_t vld3q_dup_u8_rvv(const uint8_t *ptr);
+RHAL_API uint8x16x4_t vld4q_dup_u8_rvv(const uint8_t *ptr);
+RHAL_API uint16x8x2_t vld2q_dup_u16_rvv(const uint16_t *ptr);
+RHAL_API uint16x8x3_t vld3q_dup_u16_rvv(const uint16_t *ptr);
+RHAL_API uint16x8x4_t vld4q_dup_u16_rvv(const uint16_t *ptr);
+RHAL_API uint32x4x2_t vld2q_dup_u32_rvv(const uint32_t *ptr);
+RHAL_API uint32x4x3_t vld3q_dup_u32_rvv(const uint32_t *ptr);
+RHAL_API uint32x4x4_t vld4q_dup_u32_rvv(const uint32_t *ptr);
+RHAL_API uint64x2x2_t vld2q_dup_u64_rvv(const uint64_t *ptr);
+RHAL_API uint64x2x3_t vld3q_dup_u64_rvv(const uint64_t *ptr);
+RHAL_API uint64x2x4_t vld4q_dup_u64_rvv(const uint64_t *ptr);
+
+/* vld2_lane, vld3_lane, vld4_lane */
+RHAL_API int8x8x2_t vld2_lane_s8_rvv(const int8_t *ptr, int8x8x2_t src, const int lane);
+RHAL_API int8x8x3_t vld3_lane_s8_rvv(const int8_t *ptr, int8x8x3_t src, const int lane);
+RHAL_API int8x8x4_t vld4_lane_s8_rvv(const int8_t *ptr, int8x8x4_t src, const int lane);
+RHAL_API int16x4x2_t vld2_lane_s16_rvv(const int16_t *ptr, int16x4x2_t src, const int lane);
+RHAL_API int16x4x3_t vld3_lane_s16_rvv(const int16_t *ptr, int16x4x3_t src, const int lane);
+RHAL_API int16x4x4_t vld4_lane_s16_rvv(const int16_t *ptr, int16x4x4_t src, const int lane);
+RHAL_API int32x2x2_t vld2_lane_s32_rvv(const int32_t *ptr, int32x2x2_t src, const int lane);
+RHAL_API int32x2x3_t vld3_lane_s32_rvv(const int32_t *ptr, int32x2x3_t src, const int lane);
+RHAL_API int32x2x4_t vld4_lane_s32_rvv(const int32_t *ptr, int32x2x4_t src, const int lane);
+RHAL_API int64x1x2_t vld2_lane_s64_rvv(const int64_t *ptr, int64x1x2_t src, const int lane);
+RHAL_API int64x1x3_t vld3_lane_s64_rvv(const int64_t *ptr, int64x1x3_t src, const int lane);
+RHAL_API int64x1x4_t vld4_lane_s64_rvv(const int64_t *ptr, int64x1x4_t src, const int lane);
+
+RHAL_API int8x16x2_t vld2q_lane_s8_rvv(const int8_t *ptr, int8x16x2_t src, const int lane);
+RHAL_API int8x16x3_t vld3q_lane_s8_rvv(const int8_t *ptr, int8x16x3_t src, const int lane);
+RHAL_API int8x16x4_t vld4q_lane_s8_rvv(const int8_t *ptr, int8x16x4_t src, const int lane);
+RHAL_API int16x8x2_t vld2q_lane_s16_rvv(const int16_t *ptr, int16x8x2_t src, const int lane);
+RHAL_API int16x8x3_t vld3q_lane_s16_rvv(const int16_t *ptr, int16x8x3_t src, const int lane);
+RHAL_API int16x8x4_t vld4q_lane_s16_rvv(const int16_t *ptr, int16x8x4_t src, const int lane);
+RHAL_API int32x4x2_t vld2q_lane_s32_rvv(const int32_t *ptr, int32x4x2_t src, const int lane);
+RHAL_API int32x4x3_t vld3q_lane_s32_rvv(const int32_t *ptr, int32x4x3_t src, const int lane);
+RHAL_API int32x4x4_t vld4q_lane_s32_rvv(const int32_t *ptr, int32x4x4_t src, const int lane);
+RHAL_API int64x2x2_t vld2q_lane_s64_rvv(const int64_t *ptr, int64x2x2_t src, const int lane);
+RHAL_API int64x2x3_t vld3q_lane_s64_rvv(const int64_t *ptr, int64x2x3_t src, const int lane);
+RHAL_API int64x2x4_t vld4q_lane_s64_rvv(const int64_t *ptr, int64x2x4_t src, const int lane);
+
+RHAL_API uint8x8x2_t vld2_lane_u8_rvv(const uint8_t *ptr, uint8x8x2_t src, const int lane);
+RHAL_API uint8x8x3_t vld3_lane_u8_rvv(const uint8_t *ptr, uint8x8x3_t src, const int lane);
+RHAL_API uint8x8x4_t vld4_lane_u8_rvv(const uint8_t *ptr, uint8x8x4_t src, const int lane);
+RHAL_API uint16x4x2_t vld2_lane_u16_rvv(const uint16_t *ptr, uint16x4x2_t src, const int lane);
+RHAL_API uint16x4x3_t vld3_lane_u16_rvv(const uint16_t *ptr, uint16x4x3_t src, const int lane);
+RHAL_API uint16x4x4_t vld4_lane_u16_rvv(const uint16_t *ptr, uint16x4x4_t src, const int lane);
+RHAL_API uint32x2x2_t vld2_lane_u32_rvv(const uint32_t *ptr, uint32x2x2_t src, const int lane);
+RHAL_API uint32x2x3_t vld3_lane_u32_rvv(const uint32_t *ptr, uint32x2x3_t src, const int lane);
+RHAL_API uint32x2x4_t vld4_lane_u32_rvv(const uint32_t *ptr, uint32x2x4_t src, const int lane);
+RHAL_API uint64x1x2_t vld2_lane_u64_rvv(const uint64_t *ptr, uint64x1x2_t src, const int lane);
+RHAL_API uint64x1x3_t vld3_lane_u64_rvv(const uint64_t *ptr, uint64x1x3_t src, const int lane);
+RHAL_API uint64x1x4_t vld4_lane_u64_rvv(const uint64_t *ptr, uint64x1x4_t src, const int lane);
+
+RHAL_API uint8x16x2_t vld2q_lane_u8_rvv(const uint8_t *ptr, uint8x16x2_t src, const int lane);
+RHAL_API uint8x16x3_t vld3q_lane_u8_rvv(const uint8_t *ptr, uint8x16x3_t src, const int lane);
+RHAL_API uint8x16x4_t vld4q_lane_u8_rvv(const uint8_t *ptr, uint8x16x4_t src, const int lane);
+RHAL_API uint16x8x2_t vld2q_lane_u16_rvv(const uint16_t *ptr, uint16x8x2_t src, const int lane);
+RHAL_API uint16x8x3_t vld3q_lane_u16_rvv(const uint16_t *ptr, uint16x8x3_t src, const int lane);
+RHAL_API uint16x8x4_t vld4q_lane_u16_rvv(const uint16_t *ptr, uint16x8x4_t src, const int lane);
+RHAL_API uint32x4x2_t vld2q_lane_u32_rvv(const uint32_t *ptr, uint32x4x2_t src, const int lane);
+RHAL_API uint32x4x3_t vld3q_lane_u32_rvv(const uint32_t *ptr, uint32x4x3_t src, const int lane);
+RHAL_API uint32x4x4_t vld4q_lane_u32_rvv(const uint32_t *ptr, uint32x4x4_t src, const int lane);
+RHAL_API uint64x2x2_t vld2q_lane_u64_rvv(const uint64_t *ptr, uint64x2x2_t src, const int lane);
+RHAL_API uint64x2x3_t vld3q_lane_u64_rvv(const uint64_t *ptr, uint64x2x3_t src, const int lane);
+RHAL_API uint64x2x4_t vld4q_lane_u64_rvv(const uint64_t *ptr, uint64x2x4_t src, const int lane);
+
+/* vst2, vst3, vst4 */
+RHAL_API void vst2_s8_rvv(int8_t *ptr, int8x8x2_t val);
+RHAL_API void vst3_s8_rvv(int8_t *ptr, int8x8x3_t val);
+RHAL_API void vst4_s8_rvv(int8_t *ptr, int8x8x4_t val);
+RHAL_API void vst2_s16_rvv(int16_t *ptr, int16x4x2_t val);
+RHAL_API void vst3_s16_rvv(int16_t *ptr, int16x4x3_t val);
+RHAL_API void vst4_s16_rvv(int16_t *ptr, int16x4x4_t val);
+RHAL_API void vst2_s32_rvv(int32_t *ptr, int32x2x2_t val);
+RHAL_API void vst3_s32_rvv(int32_t *ptr, int32x2x3_t val);
+RHAL_API void vst4_s32_rvv(int32_t *ptr, int32x2x4_t val);
+RHAL_API void vst2_s64_rvv(int64_t *ptr, int64x1x2_t val);
+RHAL_API void vst3_s64_rvv(int64_t *ptr, int64x1x3_t val);
+RHAL_API void vst4_s64_rvv(int64_t *ptr, int64x1x4_t val);
+
+RHAL_API void vst2q_s8_rvv(int8_t *ptr, int8x16x2_t val);
+RHAL_API void vst3q_s8_rvv(int8_t *ptr, int8x16x3_t val);
+RHAL_API void vst4q_s8_rvv(int8_t *ptr, int8x16x4_t val);
+RHAL_API void vst2q_s16_rvv(int16_t *ptr, int16x8x2_t val);
+RHAL_API void vst3q_s16_rvv(int16_t *ptr, int16x8x3_t val);
+RHAL_API void vst4q_s16_rvv(int16_t *ptr, int16x8x4_t val);
+RHAL_API void vst2q_s32_rvv(int32_t *ptr, int32x4x2_t val);
+RHAL_API void vst3q_s32_rvv(int32_t *ptr, int32x4x3_t val);
+RHAL_API void vst4q_s32_rvv(int32_t *ptr, int32x4x4_t val);
+RHAL_API void vst2q_s64_rvv(int64_t *ptr, int64x2x2_t val);
+RHAL_API void vst3q_s64_rvv(int64_t *ptr, int64x2x3_t val);
+RHAL_API void vst4q_s64_rvv(int64_t *ptr, int64x2x4_t val);
+
+RHAL_API void vst2_u8_rvv(uint8_t *ptr, uint8x8x2_t val);
+RHAL_API void vst3_u8_rvv(uint8_t *ptr, uint8x8x3_t val);
+RHAL_API void vst4_u8_rvv(uint8_t *ptr, uint8x8x4_t val);
+RHAL_API void vst2_u16_rvv(uint16_t *ptr, uint16x4x2_t val);
+RHAL_API void vst3_u16_rvv(uint16_t *ptr, uint16x4x3_t val);
+RHAL_API void vst4_u16_rvv(uint16_t *ptr, uint16x4x4_t val);
+RHAL_API void vst2_u32_rvv(uint32_t *ptr, uint32x2x2_t val);
+RHAL_API void vst3_u32_rvv(uint32_t *ptr, uint32x2x3_t val);
+RHAL_API void vst4_u32_rvv(uint32_t *ptr, uint32x2x4_t val);
+RHAL_API void vst2_u64_rvv(uint64_t *ptr, uint64x1x2_t val);
+RHAL_API void vst3_u64_rvv(uint64_t *ptr, uint64x1x3_t val);
+RHAL_API void vst4_u64_rvv(uint64_t *ptr, uint64x1x4_t val);
+
+RHAL_API void vst2q_u8_rvv(uint8_t *ptr, uint8x16x2_t val);
+RHAL_API void vst3q_u8_rvv(uint8_t *ptr, uint8x16x3_t val);
+RHAL_API void vst4q_u8_rvv(uint8_t *ptr, uint8x16x4_t val);
+RHAL_API void vst2q_u16_rvv(uint16_t *ptr, uint16x8x2_t val);
+RHAL_API void vst3q_u16_rvv(uint16_t *ptr, uint16x8x3_t val);
+RHAL_API void vst4q_u16_rvv(uint16_t *ptr, uint16x8x4_t val);
+RHAL_API void vst2q_u32_rvv(uint32_t *ptr, uint32x4x2_t val);
+RHAL_API void vst3q_u32_rvv(uint32_t *ptr, uint32x4x3_t val);
+RHAL_API void vst4q_u32_rvv(uint32_t *ptr, uint32x4x4_t val);
+RHAL_API void vst2q_u64_rvv(uint64_t *ptr, uint64x2x2_t val);
+RHAL_API void vst3q_u64_rvv(uint64_t *ptr, uint64x2x3_t val);
+RHAL_API void vst4q_u64_rvv(uint64_t *ptr, uint64x2x4_t val);
+
+/* vst2_lane, vst3_lane, vst4_lane */
+RHAL_API void vst2_lane_s8_rvv(int8_t *ptr, int8x8x2_t val, const int lane);
+RHAL_API void vst3_lane_s8_rvv(int8_t *ptr, int8x8x3_t val, const int lane);
+RHAL_API void vst4_lane_s8_rvv(int8_t *ptr, int8x8x4_t val, const int lane);
+RHAL_API void vst2_lane_s16_rvv(int16_t *ptr, int16x4x2_t val, const int lane);
+RHAL_API void vst3_lane_s16_rvv(int16_t *ptr, int16x4x3_t val, const int lane);
+RHAL_API void vst4_lane_s16_rvv(int16_t *ptr, int16x4x4_t val, const int lane);
+RHAL_API void vst2_lane_s32_rvv(int32_t *ptr, int32x2x2_t val, const int lane);
+RHAL_API void vst3_lane_s32_rvv(int32_t *ptr, int32x2x3_t val, const int lane);
+RHAL_API void vst4_lane_s32_rvv(int32_t *ptr, int32x2x4_t val, const int lane);
+RHAL_API void vst2_lane_s64_rvv(int64_t *ptr, int64x1x2_t val, const int lane);
+RHAL_API void vst3_lane_s64_rvv(int64_t *ptr, int64x1x3_t val, const int lane);
+RHAL_API void vst4_lane_s64_rvv(int64_t *ptr, int64x1x4_t val, const int lane);
+
+RHAL_API void vst2q_lane_s8_rvv(int8_t *ptr, int8x16x2_t val, const int lane);
+RHAL_API void vst3q_lane_s8_rvv(int8_t *ptr, int8x16x3_t val, const int lane);
+RHAL_API void vst4q_lane_s8_rvv(int8_t *ptr, int8x16x4_t val, const int lane);
+RHAL_API void vst2q_lane_s16_rvv(int16_t *ptr, int16x8x2_t val, const int lane);
+RHAL_API void vst3q_lane_s16_rvv(int16_t *ptr, int16x8x3_t val, const int lane);
+RHAL_API void vst4q_lane_s16_rvv(int16_t *ptr, int16x8x4_t val, const int lane);
+RHAL_API void vst2q_lane_s32_rvv(int32_t *ptr, int32x4x2_t val, const int lane);
+RHAL_API void vst3q_lane_s32_rvv(int32_t *ptr, int32x4x3_t val, const int lane);
+RHAL_API void vst4q_lane_s32_rvv(int32_t *ptr, int32x4x4_t val, const int lane);
+RHAL_API void vst2q_lane_s64_rvv(int64_t *ptr, int64x2x2_t val, const int lane);
+RHAL_API void vst3q_lane_s64_rvv(int64_t *ptr, int64x2x3_t val, const int lane);
+RHAL_API void vst4q_lane_s64_rvv(int64_t *ptr, int64x2x4_t val, const int lane);
+
+RHAL_API void vst2_lane_u8_rvv(uint8_t *ptr, uint8x8x2_t val, const int lane);
+RHAL_API void vst3_lane_u8_rvv(uint8_t *ptr, uint8x8x3_t val, const int lane);
+RHAL_API void vst4_lane_u8_rvv(uint8_t *ptr, uint8x8x4_t val, const int lane);
+RHAL_API void vst2_lane_u16_rvv(uint16_t *ptr, uint16x4x2_t val, const int lane);
+RHAL_API void vst3_lane_u16_rvv(uint16_t *ptr, uint16x4x3_t val, const int lane);
+RHAL_API void vst4_lane_u16_rvv(uint16_t *ptr, uint16x4x4_t val, const int lane);
+RHAL_API void vst2_lane_u32_rvv(uint32_t *ptr, uint32x2x2_t val, const int lane);
+RHAL_API void vst3_lane_u32_rvv(uint32_t *ptr, uint32x2x3_t val, const int lane);
+RHAL_API void vst4_lane_u32_rvv(uint32_t *ptr, uint32x2x4_t val, const int lane);
+RHAL_API void vst2_lane_u64_rvv(uint64_t *ptr, uint64x1x2_t val, const int lane);
+RHAL_API void vst3_lane_u64_rvv(uint64_t *ptr, uint64x1x3_t val, const int lane);
+RHAL_API void vst4_lane_u64_rvv(uint64_t *ptr, uint64x1x4_t val, const int lane);
+
+RHAL_API void vst2q_lane_u8_rvv(uint8_t *ptr, uint8x16x2_t val, const int lane);
+RHAL_API void vst3q_lane_u8_rvv(uint8_t *ptr, uint8x16x3_t val, const int lane);
+RHAL_API void vst4q_lane_u8_rvv(uint8_t *ptr, uint8x16x4_t val, const int lane);
+RHAL_API void vst2q_lane_u16_rvv(uint16_t *ptr, uint16x8x2_t val, const int lane);
+RHAL_API void vst3q_lane_u16_rvv(uint16_t *ptr, uint16x8x3_t val, const int lane);
+RHAL_API void vst4q_lane_u16_rvv(uint16_t *ptr, uint16x8x4_t val, const int lane);
+RHAL_API void vst2q_lane_u32_rvv(uint32_t *ptr, uint32x4x2_t val, const int lane);
+RHAL_API void vst3q_lane_u32_rvv(uint32_t *ptr, uint32x4x3_t val, const int lane);
+RHAL_API void vst4q_lane_u32_rvv(uint32_t *ptr, uint32x4x4_t val, const int lane);
+RHAL_API void vst2q_lane_u64_rvv(uint64_t *ptr, uint64x2x2_t val, const int lane);
+RHAL_API void vst3q_lane_u64_rvv(uint64_t *ptr, uint64x2x3_t val, const int lane);
+RHAL_API void vst4q_lane_u64_rvv(uint64_t *ptr, uint64x2x4_t val, const int lane);
 
 #ifdef __cplusplus
 }
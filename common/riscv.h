@@ -949,7 +949,6 @@
 
 #endif
 
-#endif
 
 
 /**
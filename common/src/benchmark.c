@@ -0,0 +1,391 @@
+// Copyright 2024 10xEngineers
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "benchmark.h"
+
+#if defined(__linux__)
+    #include <linux/perf_event.h>
+    #include <setjmp.h>
+    #include <signal.h>
+    #include <sys/syscall.h>
+    #include <unistd.h>
+#endif
+
+#if defined(__riscv)
+    #include "riscv.h"
+#endif
+
+#define BENCH_COUNTERS_NONE 0
+#define BENCH_COUNTERS_CSR 1
+#define BENCH_COUNTERS_PERF 2
+
+static int counter_source = -1;
+
+#if defined(__linux__)
+static int perf_fd_cycles = -1;
+static int perf_fd_instret = -1;
+
+static int perf_open(uint64_t config, int group_fd) {
+    struct perf_event_attr attr;
+    memset(&attr, 0, sizeof(attr));
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof(attr);
+    attr.config = config;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+    return (int)syscall(SYS_perf_event_open, &attr, 0, -1, group_fd, 0);
+}
+
+static uint64_t perf_read(int fd) {
+    uint64_t value = 0;
+    if (read(fd, &value, sizeof(value)) != (ssize_t)sizeof(value)) {
+        return 0;
+    }
+    return value;
+}
+#endif
+
+#if defined(__riscv) && defined(__linux__)
+static sigjmp_buf csr_probe_env;
+
+static void csr_probe_handler(int sig) {
+    (void)sig;
+    siglongjmp(csr_probe_env, 1);
+}
+
+// Linux may not give user mode access to the cycle CSR (SIGILL), probe it once
+static int csr_counters_usable(void) {
+    struct sigaction action, previous;
+    volatile int usable = 0;
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = csr_probe_handler;
+    sigemptyset(&action.sa_mask);
+    if (sigaction(SIGILL, &action, &previous) != 0) {
+        return 1;
+    }
+    if (sigsetjmp(csr_probe_env, 1) == 0) {
+        (void)rdcycle();
+        (void)rdinstret();
+        usable = 1;
+    }
+    sigaction(SIGILL, &previous, NULL);
+    return usable;
+}
+#elif defined(__riscv)
+static int csr_counters_usable(void) {
+    return 1;
+}
+#endif
+
+/**
+ * @brief Selects the cycle and retired instruction counters
+ * 
+ * On RISC-V the cycle and instret CSRs are read directly when user mode may
+ * access them. Otherwise, and on Arm, the counters come from perf_event_open
+ * on Linux. Without either only the time is measured.
+ */
+static void bench_counters_init(void) {
+    if (counter_source >= 0) {
+        return;
+    }
+    counter_source = BENCH_COUNTERS_NONE;
+#if defined(__riscv)
+    if (csr_counters_usable()) {
+        counter_source = BENCH_COUNTERS_CSR;
+        return;
+    }
+#endif
+#if defined(__linux__)
+    perf_fd_cycles = perf_open(PERF_COUNT_HW_CPU_CYCLES, -1);
+    if (perf_fd_cycles >= 0) {
+        perf_fd_instret = perf_open(PERF_COUNT_HW_INSTRUCTIONS, perf_fd_cycles);
+        if (perf_fd_instret >= 0) {
+            counter_source = BENCH_COUNTERS_PERF;
+            return;
+        }
+        close(perf_fd_cycles);
+        perf_fd_cycles = -1;
+    }
+#endif
+}
+
+static void bench_counters_read(uint64_t *cycles, uint64_t *instret) {
+    *cycles = 0;
+    *instret = 0;
+#if defined(__riscv)
+    if (counter_source == BENCH_COUNTERS_CSR) {
+        *cycles = rdcycle();
+        *instret = rdinstret();
+        return;
+    }
+#endif
+#if defined(__linux__)
+    if (counter_source == BENCH_COUNTERS_PERF) {
+        *cycles = perf_read(perf_fd_cycles);
+        *instret = perf_read(perf_fd_instret);
+    }
+#endif
+}
+
+static int compare_double(const void *a, const void *b) {
+    double x = *(const double *)a;
+    double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+static void bench_summarize(double *samples, int count, struct bench_result *result) {
+    qsort(samples, count, sizeof(double), compare_double);
+    result->min = samples[0];
+    result->median = samples[count / 2];
+    result->p99 = samples[(count * 99 + 99) / 100 - 1];
+}
+
+/**
+ * @brief Function to measure a benchmark kernel with the given number of samples
+ * 
+ * Runs the kernel once to warm up the caches and branch predictors, then
+ * the given number of samples (at most BENCH_SAMPLES) of the given number of
+ * rounds each. Every sample is divided by the number of operations it ran, so
+ * the timer and counter reads are amortized over iterations * ops_per_iteration ops.
+ * 
+ * @param kernel Kernel running the operation under test
+ * @param samples Number of timed samples
+ * @param iterations Rounds of the kernel per sample
+ * @param ops_per_iteration Operations per round of the kernel
+ * @param stats Minimum, median and 99th percentile per op of time, cycles and instret
+ */
+void bench_measure_samples(bench_kernel kernel, int samples, int iterations, double ops_per_iteration,
+                           struct bench_stats *stats) {
+    static double ns[BENCH_SAMPLES];
+    static double cycles[BENCH_SAMPLES];
+    static double instret[BENCH_SAMPLES];
+    double num_ops = (double)iterations * ops_per_iteration;
+
+    if (samples > BENCH_SAMPLES) {
+        samples = BENCH_SAMPLES;
+    }
+
+    bench_counters_init();
+    kernel(iterations);
+
+    for (int s = 0; s < samples; s++) {
+        struct timespec start, end;
+        uint64_t cycles_start, instret_start, cycles_end, instret_end;
+
+        bench_counters_read(&cycles_start, &instret_start);
+        clock_gettime(CLOCK_MONOTONIC, &start);
+        kernel(iterations);
+        clock_gettime(CLOCK_MONOTONIC, &end);
+        bench_counters_read(&cycles_end, &instret_end);
+
+        ns[s] = ((end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec)) / num_ops;
+        cycles[s] = (double)(cycles_end - cycles_start) / num_ops;
+        instret[s] = (double)(instret_end - instret_start) / num_ops;
+    }
+
+    bench_summarize(ns, samples, &stats->ns);
+    bench_summarize(cycles, samples, &stats->cycles);
+    bench_summarize(instret, samples, &stats->instret);
+    stats->has_counters = counter_source != BENCH_COUNTERS_NONE;
+}
+
+/**
+ * @brief Function to measure a benchmark kernel
+ * 
+ * Measures BENCH_SAMPLES samples of BENCH_ITERATIONS rounds each with
+ * bench_measure_samples().
+ * 
+ * @param kernel Kernel running the operation under test
+ * @param ops_per_iteration Operations per round of the kernel (1 or BENCH_STREAMS)
+ * @param stats Minimum, median and 99th percentile per op of time, cycles and instret
+ */
+void bench_measure(bench_kernel kernel, int ops_per_iteration, struct bench_stats *stats) {
+    bench_measure_samples(kernel, BENCH_SAMPLES, BENCH_ITERATIONS, ops_per_iteration, stats);
+}
+
+#if defined(BENCH_FORMAT_CSV)
+static void bench_print_csv(const char *arch, const char *function, const char *type, int lanes,
+                            const char *mode, int ops_per_iteration, const struct bench_stats *stats) {
+    static int header_printed = 0;
+
+    if (!header_printed) {
+        printf("BENCH,arch,function,type,lanes,mode,samples,iterations,ops_per_iteration,"
+               "ns_min,ns_median,ns_p99,cycles_min,cycles_median,cycles_p99,"
+               "instret_min,instret_median,instret_p99\n");
+        header_printed = 1;
+    }
+    printf("BENCH,%s,%s,%s,%d,%s,%d,%d,%d,%.4f,%.4f,%.4f", arch, function, type, lanes, mode,
+           BENCH_SAMPLES, BENCH_ITERATIONS, ops_per_iteration,
+           stats->ns.min, stats->ns.median, stats->ns.p99);
+    if (stats->has_counters) {
+        printf(",%.4f,%.4f,%.4f,%.4f,%.4f,%.4f\n",
+               stats->cycles.min, stats->cycles.median, stats->cycles.p99,
+               stats->instret.min, stats->instret.median, stats->instret.p99);
+    } else {
+        // Empty fields when no cycle counters are available
+        printf(",,,,,,\n");
+    }
+}
+#elif defined(BENCH_FORMAT_JSON)
+static void bench_print_json_result(const char *name, const struct bench_result *result) {
+    printf("\"%s\":{\"min\":%.4f,\"median\":%.4f,\"p99\":%.4f}", name, result->min, result->median, result->p99);
+}
+
+static void bench_print_json(const char *arch, const char *function, const char *type, int lanes,
+                             const char *mode, int ops_per_iteration, const struct bench_stats *stats) {
+    printf("{\"arch\":\"%s\",\"function\":\"%s\",\"type\":\"%s\",\"lanes\":%d,\"mode\":\"%s\","
+           "\"samples\":%d,\"iterations\":%d,\"ops_per_iteration\":%d,",
+           arch, function, type, lanes, mode, BENCH_SAMPLES, BENCH_ITERATIONS, ops_per_iteration);
+    bench_print_json_result("ns", &stats->ns);
+    if (stats->has_counters) {
+        printf(",");
+        bench_print_json_result("cycles", &stats->cycles);
+        printf(",");
+        bench_print_json_result("instret", &stats->instret);
+        printf("}\n");
+    } else {
+        printf(",\"cycles\":null,\"instret\":null}\n");
+    }
+}
+#endif
+
+/**
+ * @brief Function to measure a benchmark kernel and print the results
+ * 
+ * By default prints the median time per op in an "<arch> vector function
+ * '<function>' took <ns> nanoseconds per op (<mode>)" line, followed by the
+ * minimum, median and 99th percentile of every metric. With BENCH_FORMAT_CSV
+ * or BENCH_FORMAT_JSON it prints one record with all of them instead, which
+ * run_tests_performance.sh reads.
+ * 
+ * @param arch Architecture name printed in the results (e.g. "RISC-V", "ARM-Neon")
+ * @param function Name of the function under test
+ * @param type Vector type of the result of the function (e.g. "int16x8_t")
+ * @param lanes Number of lanes of the result
+ * @param mode Benchmark mode, "latency" or "throughput"
+ * @param kernel Kernel running the operation under test
+ * @param ops_per_iteration Operations per round of the kernel (1 or BENCH_STREAMS)
+ */
+void bench_run(const char *arch, const char *function, const char *type, int lanes,
+               const char *mode, bench_kernel kernel, int ops_per_iteration) {
+    struct bench_stats stats;
+
+    bench_measure(kernel, ops_per_iteration, &stats);
+#if defined(BENCH_FORMAT_CSV)
+    bench_print_csv(arch, function, type, lanes, mode, ops_per_iteration, &stats);
+#elif defined(BENCH_FORMAT_JSON)
+    bench_print_json(arch, function, type, lanes, mode, ops_per_iteration, &stats);
+#else
+    (void)type;
+    (void)lanes;
+    printf("%s vector function '%s' took %.2f nanoseconds per op (%s)\n",
+           arch, function, stats.ns.median, mode);
+    printf("    %s min/median/p99: ns %.2f/%.2f/%.2f", mode,
+           stats.ns.min, stats.ns.median, stats.ns.p99);
+    if (stats.has_counters) {
+        printf(", cycles %.2f/%.2f/%.2f, instret %.2f/%.2f/%.2f\n",
+               stats.cycles.min, stats.cycles.median, stats.cycles.p99,
+               stats.instret.min, stats.instret.median, stats.instret.p99);
+    } else {
+        printf(", cycle counters unavailable\n");
+    }
+#endif
+}
+
+/**
+ * @brief Function to report a benchmark the build cannot run
+ * 
+ * Prints, instead of the results of bench_run(), that the function under test
+ * needs an architecture feature the build does not target (e.g. the Armv8.1-A
+ * vqrdmlah on an Armv8.0-A build). With BENCH_FORMAT_CSV the record starts with
+ * "UNSUPPORTED," instead of "BENCH,", so run_tests_performance.sh records no
+ * time for the test; with BENCH_FORMAT_JSON it has "unsupported" instead of the
+ * metrics.
+ * 
+ * @param arch Architecture name printed in the results (e.g. "RISC-V", "ARM-Neon")
+ * @param function Name of the function under test
+ * @param type Vector type of the result of the function (e.g. "int16x8_t")
+ * @param lanes Number of lanes of the result
+ * @param reason Feature the function needs (e.g. "Armv8.1-A RDMA")
+ */
+void bench_unsupported(const char *arch, const char *function, const char *type, int lanes,
+                       const char *reason) {
+#if defined(BENCH_FORMAT_CSV)
+    printf("UNSUPPORTED,%s,%s,%s,%d,%s\n", arch, function, type, lanes, reason);
+#elif defined(BENCH_FORMAT_JSON)
+    printf("{\"arch\":\"%s\",\"function\":\"%s\",\"type\":\"%s\",\"lanes\":%d,\"unsupported\":\"%s\"}\n",
+           arch, function, type, lanes, reason);
+#else
+    (void)type;
+    (void)lanes;
+    printf("%s vector function '%s' not benchmarked: needs %s\n", arch, function, reason);
+#endif
+}
+
+/**
+ * @brief Function to measure one buffer size of an array sweep and print the results
+ * 
+ * Runs the kernel, which processes `elements` elements touching `bytes` bytes
+ * per round, over at least BENCH_SWEEP_BYTES per sample, and prints the median
+ * bandwidth (bytes read and written per nanosecond, i.e. GB/s) and elements per
+ * cycle. With BENCH_FORMAT_CSV the results are a "SWEEP,"-tagged record after
+ * a header line, with BENCH_FORMAT_JSON one object per line.
+ * 
+ * @param arch Architecture name printed in the results (e.g. "RISC-V", "ARM-Neon")
+ * @param function Name of the function under test
+ * @param impl Implementation of the kernel (e.g. "scalar", "rvv", "neon")
+ * @param bytes Bytes read and written by one round of the kernel
+ * @param elements Elements processed by one round of the kernel
+ * @param kernel Kernel processing the buffer the given number of times
+ */
+void bench_run_sweep(const char *arch, const char *function, const char *impl, long bytes,
+                     long elements, bench_kernel kernel) {
+    struct bench_stats stats;
+    int iterations = bytes < BENCH_SWEEP_BYTES ? BENCH_SWEEP_BYTES / bytes : 1;
+    int samples = bytes <= BENCH_SWEEP_LARGE_BYTES ? BENCH_SWEEP_SAMPLES : BENCH_SWEEP_LARGE_SAMPLES;
+
+    bench_measure_samples(kernel, samples, iterations, elements, &stats);
+
+    double gb_per_s = (double)bytes / elements / stats.ns.median;
+    double elements_per_cycle = stats.has_counters && stats.cycles.median > 0 ? 1.0 / stats.cycles.median : 0.0;
+#if defined(BENCH_FORMAT_CSV)
+    static int header_printed = 0;
+
+    if (!header_printed) {
+        printf("SWEEP,arch,function,impl,bytes,elements,samples,iterations,"
+               "ns_per_element,gb_per_s,cycles_per_element,elements_per_cycle\n");
+        header_printed = 1;
+    }
+    printf("SWEEP,%s,%s,%s,%ld,%ld,%d,%d,%.4f,%.4f", arch, function, impl, bytes, elements,
+           samples, iterations, stats.ns.median, gb_per_s);
+    if (stats.has_counters) {
+        printf(",%.4f,%.4f\n", stats.cycles.median, elements_per_cycle);
+    } else {
+        printf(",,\n");
+    }
+#elif defined(BENCH_FORMAT_JSON)
+    printf("{\"sweep\":true,\"arch\":\"%s\",\"function\":\"%s\",\"impl\":\"%s\",\"bytes\":%ld,\"elements\":%ld,"
+           "\"samples\":%d,\"iterations\":%d,\"ns_per_element\":%.4f,\"gb_per_s\":%.4f,",
+           arch, function, impl, bytes, elements, samples, iterations, stats.ns.median, gb_per_s);
+    if (stats.has_counters) {
+        printf("\"cycles_per_element\":%.4f,\"elements_per_cycle\":%.4f}\n", stats.cycles.median, elements_per_cycle);
+    } else {
+        printf("\"cycles_per_element\":null,\"elements_per_cycle\":null}\n");
+    }
+#else
+    if (strcmp(impl, "scalar") == 0) {
+        printf("%s scalar reference '%s' over %ld bytes: %.2f GB/s", arch, function, bytes, gb_per_s);
+    } else {
+        printf("%s vector function '%s' (%s) over %ld bytes: %.2f GB/s", arch, function, impl, bytes, gb_per_s);
+    }
+    if (stats.has_counters) {
+        printf(", %.2f elements/cycle\n", elements_per_cycle);
+    } else {
+        printf(", cycle counters unavailable\n");
+    }
+#endif
+}
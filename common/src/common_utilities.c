@@ -2,6 +2,25 @@
 
 #include "common_utilities.h"
 
+// Test name and number of results printed for it, when printing CSV rows
+static const char *results_prefix = NULL;
+static int results_count = 0;
+
+/**
+ * @brief Function to print the results of a test as CSV rows
+ * 
+ * After this call, every line printed by print_results() is prefixed with
+ * "<test_name>,test #<n>,", numbered from 1, as in the CSV files written by
+ * run_tests_correctness.sh. This is used by the batch test driver, which
+ * runs several tests in one process.
+ * 
+ * @param test_name Name of the test, or NULL to print plain results
+ */
+void set_results_prefix(const char *test_name) {
+    results_prefix = test_name;
+    results_count = 0;
+}
+
 /**
  * @brief Function to print results of different types
  * 
@@ -15,6 +34,9 @@
  */
 void print_results(void *results, int size, int type) {
     int i;
+    if (results_prefix != NULL) {
+        printf("%s,test #%d,", results_prefix, ++results_count);
+    }
     switch (type) {
         case INT8:  // int8_t
             for (i = 0; i < size; i++) {
@@ -0,0 +1,128 @@
+# Copyright 2024 10xEngineers
+
+# Analyzes the commit log of a test run on spike (make TARGET=spike, which
+# runs spike with -l --log-commits and writes the log to spike/spike.log)
+# against the disassembly of the test (DIS_FILE, test.asm). For every
+# R-Halogen function (*_rvv) it reports the calls and, per call, the
+# retired instructions, vsetvli/vsetivli/vsetvl, LMUL changes and memory
+# operations, as CSV.
+#
+# Usage: python3 analyze_spike_log.py <spike_log> <dis_file> [function_regex]
+#   e.g. python3 analyze_spike_log.py RUN/.../spike/spike.log RUN/.../test.asm 'vaddl|vaddhn'
+
+import re
+import sys
+
+# "core   0: 3 0x0000000000010164 (0x0d0072d7) x5  0x0000000000000008 mem 0x..."
+# with --log-commits (privilege level before the pc), and
+# "core   0: 0x0000000000010164 (0x0d0072d7) vsetvli t0, zero, e8, m1, ta, ma" with -l
+COMMIT_LINE = re.compile(r'^core\s+\d+:\s+(\d)\s+0x([0-9a-f]+)\s+\(0x([0-9a-f]+)\)(.*)$')
+TRACE_LINE = re.compile(r'^core\s+\d+:\s+0x([0-9a-f]+)\s+\(0x([0-9a-f]+)\)(.*)$')
+
+# objdump --prefix-addresses: "<addr> <fn+off> <raw> <insn> <operands>"
+DIS_LINE = re.compile(r'^([0-9a-f]+)\s+<([A-Za-z0-9_.$@]+)(?:\+0x([0-9a-f]+))?>\s')
+
+OPCODE_LOAD = (0x03, 0x07)
+OPCODE_STORE = (0x23, 0x27)
+OPCODE_AMO = 0x2f
+OPCODE_OP_V = 0x57
+
+
+def load_symbols(dis_file):
+    """Map every instruction address of the disassembly to its function and whether it is the entry."""
+    symbols = {}
+    with open(dis_file, errors='replace') as f:
+        for line in f:
+            match = DIS_LINE.match(line)
+            if match:
+                symbols[int(match.group(1), 16)] = (match.group(2), match.group(3) is None)
+    return symbols
+
+
+def vset_lmul(word):
+    """LMUL field of the vtype written by a vsetvli/vsetivli, None for vsetvl or other instructions."""
+    if word & 0x7f != OPCODE_OP_V or (word >> 12) & 0x7 != 0x7:
+        return None
+    if word >> 31 == 0:
+        return (word >> 20) & 0x7   # vsetvli, zimm[10:0]
+    if (word >> 30) & 0x3 == 0x3:
+        return (word >> 20) & 0x7   # vsetivli, zimm[9:0]
+    return -1                       # vsetvl, vtype from a register
+
+
+def is_memory(word, rest, commits):
+    """Whether the instruction accessed memory: from the mem entries of the commit log, or decoded."""
+    if commits:
+        return ' mem ' in rest + ' '
+    if word & 0x3 != 0x3:
+        # Compressed loads/stores: c.lw/c.ld/c.fld (op 00, funct3 001-011), c.sw/c.sd/c.fsd (101-111),
+        # and their stack-pointer forms (op 10, funct3 001-011 and 101-111)
+        op, funct3 = word & 0x3, (word >> 13) & 0x7
+        return op in (0, 2) and funct3 not in (0, 4)
+    opcode = word & 0x7f
+    return opcode in OPCODE_LOAD or opcode in OPCODE_STORE or opcode == OPCODE_AMO
+
+
+def analyze(log_file, symbols, function_filter):
+    stats = {}
+    lmul = None
+    with open(log_file, errors='replace') as f:
+        lines = f.readlines()
+
+    # Count the commit lines when the log has them (one per retired instruction),
+    # otherwise the -l trace lines
+    commits = any(COMMIT_LINE.match(line) for line in lines)
+    for line in lines:
+        match = COMMIT_LINE.match(line) if commits else TRACE_LINE.match(line)
+        if not match:
+            continue
+        groups = match.groups()[1:] if commits else match.groups()
+        pc = int(groups[0], 16)
+        word = int(groups[1], 16)
+        rest = groups[2]
+
+        # Only the vtype of a vset matters, so a vset outside the functions still moves the LMUL
+        new_lmul = vset_lmul(word)
+        lmul_changed = new_lmul is not None and (new_lmul == -1 or new_lmul != lmul)
+        if new_lmul is not None:
+            lmul = new_lmul if new_lmul != -1 else None
+
+        symbol = symbols.get(pc)
+        if symbol is None:
+            continue
+        function, entry = symbol
+        if not function.endswith('_rvv') or not function_filter.search(function):
+            continue
+        s = stats.setdefault(function, {'calls': 0, 'instructions': 0, 'vset': 0, 'lmul_changes': 0, 'memory': 0})
+        s['calls'] += entry
+        s['instructions'] += 1
+        s['vset'] += new_lmul is not None
+        s['lmul_changes'] += lmul_changed
+        s['memory'] += is_memory(word, rest, commits)
+    return stats
+
+
+def main():
+    if len(sys.argv) not in (3, 4):
+        print('Usage: {} <spike_log> <dis_file> [function_regex]'.format(sys.argv[0]))
+        print('Reports the retired instructions, vsetvli, LMUL changes and memory operations')
+        print('per call of every R-Halogen function (*_rvv) in a spike commit log.')
+        sys.exit(1)
+    symbols = load_symbols(sys.argv[2])
+    if not symbols:
+        print('Error: No instructions found in {}'.format(sys.argv[2]))
+        sys.exit(1)
+    function_filter = re.compile(sys.argv[3] if len(sys.argv) == 4 else '')
+    stats = analyze(sys.argv[1], symbols, function_filter)
+
+    print('function,calls,instructions_per_call,vsetvli_per_call,lmul_changes_per_call,memory_ops_per_call')
+    for function in sorted(stats):
+        s = stats[function]
+        calls = max(s['calls'], 1)
+        print('{},{},{:.2f},{:.2f},{:.2f},{:.2f}'.format(
+            function, s['calls'], s['instructions'] / calls, s['vset'] / calls,
+            s['lmul_changes'] / calls, s['memory'] / calls))
+
+
+if __name__ == '__main__':
+    main()
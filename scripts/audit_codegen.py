@@ -0,0 +1,147 @@
+# Copyright 2024 10xEngineers
+
+# Reads a disassembly written with the OBJDUMP_FLAGS of the Makefile (DIS_FILE,
+# test.asm, or the library disassembly librhal.asm) and reports, for every
+# R-Halogen function (*_rvv), its static instruction count, its vsetvli,
+# vsetivli and vsetvl instructions and its stack spills (loads and stores
+# addressing the stack, and whole-register vector loads and stores), as CSV.
+#
+# With --budget, the report is compared with a checked-in budget instead, and
+# the script exits with 1 if any function has more instructions or spills than
+# its budget allows, or if the budget has fewer than half of the functions. It exits
+# with 2 while the budget has no functions at all (only the header, before one has
+# been recorded). With --update, the budget is replaced by the report.
+#
+# Usage: python3 audit_codegen.py <dis_file> [function_regex]
+#        python3 audit_codegen.py --budget <budget_csv> <dis_file> [function_regex]
+#        python3 audit_codegen.py --update <budget_csv> <dis_file> [function_regex]
+#   e.g. python3 audit_codegen.py --budget scripts/baselines/codegen_budget_riscv.csv RUN/lib/codegen/librhal.asm
+
+import re
+import sys
+
+# objdump --prefix-addresses --show-raw-insn: "<addr> <fn+off> <raw> <insn> <operands>"
+DIS_LINE = re.compile(r'^[0-9a-f]+\s+<([A-Za-z0-9_.$@]+)(?:\+0x[0-9a-f]+)?>\s+([0-9a-f]{4}|[0-9a-f]{8})\s+(\S+)\s*(.*)$')
+
+# Memory operands on the stack: "8(x2)" or "(sp)" on RISC-V, "[sp, #16]" on AArch64
+STACK_OPERAND = re.compile(r'\((x2|sp)\)|\[sp[,\]]')
+
+# Whole-register vector loads and stores (vl1re8.v, vs2r.v, ...), which GCC only
+# emits to spill vector registers
+VECTOR_SPILL = re.compile(r'^v(l\d+re\d+|s\d+r)\.v$')
+
+FIELDS = ['instructions', 'vsetvli', 'spills']
+
+# Fraction of the audited functions the budget must have. Below it (e.g. a budget with only
+# the header) nearly every function would be "new", so the check fails instead of passing silently.
+MIN_BUDGET_COVERAGE = 0.5
+
+
+def audit(dis_file, function_filter):
+    """Instruction, vset and spill counts of every *_rvv function of the disassembly."""
+    stats = {}
+    with open(dis_file, errors='replace') as f:
+        for line in f:
+            match = DIS_LINE.match(line)
+            if not match:
+                continue
+            function, _, mnemonic, operands = match.groups()
+            if not function.endswith('_rvv') or not function_filter.search(function):
+                continue
+            s = stats.setdefault(function, dict.fromkeys(FIELDS, 0))
+            s['instructions'] += 1
+            s['vsetvli'] += mnemonic.startswith('vset')
+            s['spills'] += bool(VECTOR_SPILL.match(mnemonic) or STACK_OPERAND.search(operands))
+    return stats
+
+
+def write_report(stats, out):
+    out.write('function,' + ','.join(FIELDS) + '\n')
+    for function in sorted(stats):
+        out.write('{},{}\n'.format(function, ','.join(str(stats[function][k]) for k in FIELDS)))
+
+
+def read_budget(budget_file):
+    budget = {}
+    with open(budget_file) as f:
+        header = f.readline().strip().split(',')
+        for line in f:
+            values = line.strip().split(',')
+            if len(values) == len(header):
+                budget[values[0]] = dict(zip(header[1:], (int(v) for v in values[1:])))
+    return budget
+
+
+def check(stats, budget):
+    """Prints every function that is over its budget or has none, returns the number over budget."""
+    print('function,metric,budget,current,status')
+    over = 0
+    new = 0
+    for function in sorted(stats):
+        if function not in budget:
+            print('{},all,,,new'.format(function))
+            new += 1
+            continue
+        for metric in ('instructions', 'spills'):
+            limit = budget[function].get(metric, 0)
+            current = stats[function][metric]
+            if current > limit:
+                print('{},{},{},{},OVER BUDGET'.format(function, metric, limit, current))
+                over += 1
+            elif current < limit:
+                print('{},{},{},{},under budget'.format(function, metric, limit, current))
+    missing = len(set(budget) - set(stats))
+    print('{} function(s) over budget, {} not in the budget, {} in the budget but not in the disassembly'.format(
+        over, new, missing))
+    return over
+
+
+def usage():
+    print('Usage: {} [--budget <budget_csv> | --update <budget_csv>] <dis_file> [function_regex]'.format(sys.argv[0]))
+    print('Reports the instructions, vsetvli and stack spills of every R-Halogen function (*_rvv)')
+    print('in a disassembly, or checks them against a budget (--budget), failing if it has fewer than {:g}% of'.format(
+        MIN_BUDGET_COVERAGE * 100))
+    print('the functions and with 2 if it has not been recorded yet (only the header), or records the budget (--update).')
+    sys.exit(1)
+
+
+def main():
+    args = sys.argv[1:]
+    mode = None
+    if args and args[0] in ('--budget', '--update'):
+        if len(args) < 2:
+            usage()
+        mode, budget_file = args[0], args[1]
+        args = args[2:]
+    if len(args) not in (1, 2):
+        usage()
+
+    stats = audit(args[0], re.compile(args[1] if len(args) == 2 else ''))
+    if not stats:
+        print('Error: No R-Halogen function found in {}'.format(args[0]))
+        sys.exit(1)
+
+    if mode is None:
+        write_report(stats, sys.stdout)
+    elif mode == '--update':
+        with open(budget_file, 'w') as f:
+            write_report(stats, f)
+        print('Budget {} updated with {} functions.'.format(budget_file, len(stats)))
+    else:
+        budget = read_budget(budget_file)
+        over = check(stats, budget)
+        covered = sum(1 for function in stats if function in budget)
+        if not budget:
+            print('Error: no budget has been recorded in {} yet, so the codegen cannot be checked.'.format(budget_file))
+            print('Record it from a build of the library: {} --update {} {}'.format(sys.argv[0], budget_file, args[0]))
+            sys.exit(2)
+        if covered < MIN_BUDGET_COVERAGE * len(stats):
+            print('Error: the budget {} has {} of the {} functions of {}, so the codegen cannot be checked.'.format(
+                budget_file, covered, len(stats), args[0]))
+            print('Record it from a build of the library: {} --update {} {}'.format(sys.argv[0], budget_file, args[0]))
+            sys.exit(1)
+        sys.exit(1 if over else 0)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,67 @@
+# Copyright 2024 10xEngineers
+
+#!/bin/bash
+
+# Ensure the script exits on errors or undefined variables
+set -euo pipefail
+
+# Function to display usage help
+usage() {
+    echo "Usage: $0 [dis_file]"
+    echo "Checks that every vsetvli/vsetivli of the R-Halogen functions (*_rvv) selects the"
+    echo "tail-agnostic, mask-agnostic policy (ta,ma)."
+    echo "Without dis_file, the RISC-V library and its disassembly (librhal.asm) are built first."
+    exit 1
+}
+
+# Check the number of arguments
+if [ $# -gt 1 ]; then
+    echo "Error: Invalid number of arguments."
+    usage
+fi
+
+# The library disassembly contains every function, whether a test uses it or not
+if [ $# -eq 1 ]; then
+    dis_file=$1
+else
+    make ARCH=riscv TARGET=qemu-riscv64 RHAL_LIB_DIR=RUN/lib/codegen lib
+    dis_file="RUN/lib/codegen/librhal.asm"
+fi
+
+if [ ! -f "$dis_file" ]; then
+    echo "Error: Disassembly '$dis_file' not found."
+    exit 1
+fi
+
+# The disassembly uses --prefix-addresses, so each instruction line reads
+# "<addr> <fn+off> <raw> <insn> <operands>". Print "<fn> <operands>" of every vset*vli.
+vsets=$(awk '
+    $2 ~ /^<[A-Za-z0-9_]+_rvv(\+0x[0-9a-f]+)?>$/ {
+        for (i = 3; i < NF; i++) {
+            if ($i !~ /^[0-9a-f]+$/) {
+                if ($i ~ /^vset(i)?vli$/) {
+                    fn = $2
+                    sub(/^</, "", fn)
+                    sub(/(\+0x[0-9a-f]+)?>$/, "", fn)
+                    print fn, $(i + 1)
+                }
+                break
+            }
+        }
+    }' "$dis_file")
+
+total=$(echo -n "$vsets" | grep -c . || true)
+undisturbed=$(echo -n "$vsets" | grep -vE ',ta,ma$' || true)
+
+if [ "$total" -eq 0 ]; then
+    echo "Error: No vsetvli found in the *_rvv functions of '$dis_file'."
+    exit 1
+fi
+
+if [ -n "$undisturbed" ]; then
+    echo "$undisturbed"
+    echo "$(echo "$undisturbed" | grep -c .) of $total vsetvli are not tail/mask-agnostic."
+    exit 1
+fi
+
+echo "All $total vsetvli of the R-Halogen functions are tail/mask-agnostic (ta,ma)."
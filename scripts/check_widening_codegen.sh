@@ -0,0 +1,74 @@
+# Copyright 2024 10xEngineers
+
+#!/bin/bash
+
+# Ensure the script exits on errors or undefined variables
+set -euo pipefail
+
+# Function to display usage help
+usage() {
+    echo "Usage: $0 [dis_file]"
+    echo "Checks that every vaddw/vsubw function compiles to a single wide-operand"
+    echo "vector instruction (vwadd.wv, vwaddu.wv, vwsub.wv, vwsubu.wv)."
+    echo "Without dis_file, the RISC-V library and its disassembly (librhal.asm) are built first."
+    exit 1
+}
+
+# Check the number of arguments
+if [ $# -gt 1 ]; then
+    echo "Error: Invalid number of arguments."
+    usage
+fi
+
+# The library disassembly contains every function, whether a test uses it or not
+if [ $# -eq 1 ]; then
+    dis_file=$1
+else
+    make ARCH=riscv TARGET=qemu-riscv64 RHAL_LIB_DIR=RUN/lib/codegen lib
+    dis_file="RUN/lib/codegen/librhal.asm"
+fi
+
+if [ ! -f "$dis_file" ]; then
+    echo "Error: Disassembly '$dis_file' not found."
+    exit 1
+fi
+
+functions=(
+    "vaddw_s8_rvv" "vaddw_s16_rvv" "vaddw_s32_rvv"
+    "vaddw_u8_rvv" "vaddw_u16_rvv" "vaddw_u32_rvv"
+    "vsubw_s8_rvv" "vsubw_s16_rvv" "vsubw_s32_rvv"
+    "vsubw_u8_rvv" "vsubw_u16_rvv" "vsubw_u32_rvv"
+)
+
+failures=0
+
+for fn in "${functions[@]}"; do
+    # Vector instructions of the function other than vsetvli/vsetivli. The disassembly
+    # uses --prefix-addresses, so each instruction line reads "<addr> <fn+off> <raw> <insn> ...".
+    insns=$(awk -v fn="$fn" '
+        $2 ~ ("^<" fn "(\\+0x[0-9a-f]+)?>$") {
+            for (i = 3; i <= NF; i++) {
+                if ($i !~ /^[0-9a-f]+$/) {
+                    if ($i ~ /^v/ && $i !~ /^vset/) {
+                        print $i
+                    }
+                    break
+                }
+            }
+        }' "$dis_file")
+    count=$(echo -n "$insns" | grep -c . || true)
+
+    if [ "$count" -eq 1 ] && echo "$insns" | grep -qE '^vw(add|sub)u?\.wv$'; then
+        echo "$fn: $insns"
+    else
+        echo "$fn: FAIL, expected one wide-operand instruction, got $count: $(echo $insns)"
+        failures=$((failures + 1))
+    fi
+done
+
+if [ "$failures" -ne 0 ]; then
+    echo "$failures function(s) failed the codegen check."
+    exit 1
+fi
+
+echo "All ${#functions[@]} functions compile to a single vector arithmetic instruction."
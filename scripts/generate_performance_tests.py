@@ -0,0 +1,291 @@
+# Copyright 2024 10xEngineers
+
+# Generates a performance test (RISC-V and the matching Arm Neon intrinsic)
+# for every function declared in common/rhal_base.h, as
+# tests/performance/<function>_rvv_test/<function>_rvv_test.c.
+#
+# Usage: python3 generate_performance_tests.py [function_prefix...]
+#   e.g. python3 generate_performance_tests.py vqadd vaddhn_s16
+
+import os
+import re
+import sys
+
+SCRIPT_DIR = os.path.dirname(os.path.abspath(__file__))
+REPO_DIR = os.path.dirname(SCRIPT_DIR)
+HEADER = os.path.join(REPO_DIR, 'common', 'rhal_base.h')
+TESTS_DIR = os.path.join(REPO_DIR, 'tests', 'performance')
+
+PROTOTYPE = re.compile(r'^RHAL_API\s+(\w+)\s+(\w+)_rvv\(([^)]*)\);', re.M)
+PARAMETER = re.compile(r'^(const int|\w+)\s+(\w+)$')
+VECTOR_TYPE = re.compile(r'^(u?int)(8|16|32|64)x(\d+)_t$')
+SCALAR_TYPE = re.compile(r'^u?int(8|16|32|64)_t$')
+
+# Neon functions of a later architecture version than the default Armv8-A build: (function prefixes,
+# feature macro, feature). Without the macro the Neon side reports the function as unsupported.
+NEON_FEATURES = [
+    (('vqrdmlah', 'vqrdmlsh'), '__ARM_FEATURE_QRDMX', 'Armv8.1-A RDMA'),
+]
+
+
+def neon_feature(fn):
+    for prefixes, macro, feature in NEON_FEATURES:
+        if fn.startswith(prefixes):
+            return macro, feature
+    return None
+
+
+class VectorType:
+    def __init__(self, name):
+        match = VECTOR_TYPE.match(name)
+        self.name = name
+        self.signed = match.group(1) == 'int'
+        self.bits = int(match.group(2))
+        self.lanes = int(match.group(3))
+        self.q = self.bits * self.lanes == 128
+        self.suffix = ('s' if self.signed else 'u') + str(self.bits)
+        self.elem = '{}{}_t'.format(match.group(1), self.bits)
+        self.print_type = ('' if self.signed else 'U') + 'INT' + str(self.bits)
+        # 64-bit vectors of 8, 16 and 32-bit elements are LMUL=1/2 with RHAL_FRACTIONAL_LMUL
+        self.fractional = not self.q and self.bits < 64
+        self.rvv = ('i' if self.signed else 'u') + str(self.bits)
+
+    def neon_load(self, src):
+        return 'vld1{}_{}({})'.format('q' if self.q else '', self.suffix, src)
+
+    def neon_store(self, dst, value):
+        return 'vst1{}_{}({}, {});'.format('q' if self.q else '', self.suffix, dst, value)
+
+    def rvv_load(self, src, lmul):
+        return '__riscv_vle{0}_v_{1}{2}({3}, VLEN_{4})'.format(self.bits, self.rvv, lmul, src, self.lanes)
+
+    def rvv_store(self, dst, value, lmul):
+        return '__riscv_vse{0}_v_{1}{2}({3}, {4}, VLEN_{5});'.format(self.bits, self.rvv, lmul, dst, value, self.lanes)
+
+
+class Operand:
+    """An operand after the first one: a vector, an element (the _n functions) or a lane index."""
+    def __init__(self, ctype, name, var):
+        self.ctype = ctype
+        self.name = name
+        self.vector = VectorType(ctype) if VECTOR_TYPE.match(ctype) else None
+        self.lane = ctype == 'const int'
+        # The kernels use x for the first operand, y and z for the next vectors and s for an element
+        self.var = var if self.vector else 's'
+
+    def argument(self, lane):
+        return str(lane) if self.lane else self.var
+
+
+def parse_parameters(parameters):
+    """(type, name) of each parameter, or None if one is neither a vector, an element nor a lane."""
+    params = []
+    for param in parameters.split(','):
+        match = PARAMETER.match(param.strip())
+        if not match:
+            return None
+        ctype = match.group(1)
+        if not (VECTOR_TYPE.match(ctype) or SCALAR_TYPE.match(ctype) or ctype == 'const int'):
+            return None
+        params.append((ctype, match.group(2)))
+    return params
+
+
+def rvv_lines(items, make_line, item_type, indent):
+    """RVV lines for the given items, with an RHAL_FRACTIONAL_LMUL branch when a 64-bit type needs mf2."""
+    if any(item_type(item).fractional for item in items):
+        lines = [indent + '#if defined(RHAL_FRACTIONAL_LMUL)']
+        lines += [indent + '    ' + make_line(item, 'mf2' if item_type(item).fractional else 'm1') for item in items]
+        lines += [indent + '#else']
+        lines += [indent + '    ' + make_line(item, 'm1') for item in items]
+        lines += [indent + '#endif']
+        return lines
+    return [indent + make_line(item, 'm1') for item in items]
+
+
+def kernels(fn, ret, ta, operands, arch):
+    """Latency and throughput kernels of one architecture, as C lines."""
+    neon = arch == 'neon'
+    call = fn if neon else fn + '_rvv'
+    lines = []
+    # The _lane functions take the last lane of their vector operand
+    lanes = [op.vector.lanes for op in operands if op.vector]
+    args = ''.join(', ' + op.argument(lanes[-1] - 1 if lanes else 0) for op in operands)
+
+    def loads(first):
+        pairs = [(first, ta, 'bench_a')] + [(op.var, op.vector, 'bench_' + op.name) for op in operands if op.vector]
+        if neon:
+            lines = ['    {} {} = {};'.format(t.name, var, t.neon_load(src)) for var, t, src in pairs]
+        else:
+            lines = rvv_lines(pairs, lambda p, lmul: '{} {} = {};'.format(p[1].name, p[0], p[1].rvv_load(p[2], lmul)),
+                              lambda p: p[1], '    ')
+        return lines + ['    {0} {1} = bench_{2};'.format(op.ctype, op.var, op.name)
+                        for op in operands if not op.vector and not op.lane]
+
+    def store(var):
+        if neon:
+            return ['    ' + ret.neon_store('bench_result', var)]
+        return rvv_lines([ret], lambda t, lmul: t.rvv_store('bench_result', var, lmul), lambda t: t, '    ')
+
+    impl = 'ARM Neon-specific implementation' if neon else 'RISC-V Vector-specific implementation'
+    name = '{}_{{}}_{}'.format(fn, 'neon' if neon else 'rvvector')
+    streams = ['x0', 'x1', 'x2', 'x3']
+
+    if ret.name == ta.name:
+        # The result feeds the first operand of the next call
+        lines.append('// {}, each {} depends on the previous one'.format(impl, call))
+        lines.append('void {}(int iterations) {{'.format(name.format('latency')))
+        lines += loads('x')
+        lines.append('    for (int i = 0; i < iterations; i++) {')
+        lines.append('        x = {}(x{});'.format(call, args))
+        lines.append('    }')
+        lines += store('x')
+        lines.append('}')
+        lines.append('// {}, BENCH_STREAMS independent {} per iteration'.format(impl, call))
+        lines.append('void {}(int iterations) {{'.format(name.format('throughput')))
+        lines += loads('x0')
+        lines.append('    {} x1 = x0, x2 = x0, x3 = x0;'.format(ta.name))
+        lines.append('    for (int i = 0; i < iterations; i++) {')
+        lines += ['        {0} = {1}({0}{2});'.format(x, call, args) for x in streams]
+        lines.append('    }')
+        lines += ['    bench_opaque({});'.format(x) for x in streams[1:]]
+        lines += store('x0')
+        lines.append('}')
+    else:
+        # The result type differs from the operands, so the calls cannot be chained
+        lines.append('// {}, BENCH_STREAMS independent {} per iteration'.format(impl, call))
+        lines.append('void {}(int iterations) {{'.format(name.format('throughput')))
+        lines += loads('x0')
+        lines.append('    {} x1 = x0, x2 = x0, x3 = x0;'.format(ta.name))
+        lines.append('    {} z0, z1, z2, z3;'.format(ret.name))
+        lines.append('    for (int i = 0; i < iterations; i++) {')
+        for k, x in enumerate(streams):
+            lines.append('        bench_opaque({});'.format(x))
+            lines.append('        z{} = {}({}{});'.format(k, call, x, args))
+            lines.append('        bench_opaque(z{});'.format(k))
+        lines.append('    }')
+        lines += store('z0')
+        lines.append('}')
+    return lines
+
+
+def generate(fn, ret, ta, operands):
+    chained = ret.name == ta.name
+    values_a = ', '.join(str(i + 1) for i in range(ta.lanes))
+
+    out = []
+    out.append('// Copyright 2024 10xEngineers')
+    out.append('')
+    out.append('// Generated by scripts/generate_performance_tests.py. Do not edit.')
+    out.append('')
+    out.append('#include "common_utilities.h"')
+    out.append('#include "benchmark.h"')
+    out.append('')
+    out.append('#if defined(ARM_NEON)')
+    out.append('    #include <arm_neon.h>')
+    out.append('#elif defined(RISCV_VECTOR)')
+    out.append('    #include "rhal_base.h"')
+    out.append('#else')
+    out.append('    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."')
+    out.append('#endif')
+    out.append('')
+    out.append('// Operands and result of the benchmarked {}; the kernels load them once and'.format(fn))
+    out.append('// keep the vectors in registers for all iterations')
+    out.append('{} bench_a[{}] = {{{}}};'.format(ta.elem, ta.lanes, values_a))
+    for op in operands:
+        if op.vector:
+            values = ', '.join(str(i + 1) for i in range(op.vector.lanes))
+            out.append('{} bench_{}[{}] = {{{}}};'.format(op.vector.elem, op.name, op.vector.lanes, values))
+        elif not op.lane:
+            out.append('{} bench_{} = 3;'.format(op.ctype, op.name))
+    out.append('{} bench_result[{}];'.format(ret.elem, ret.lanes))
+    out.append('')
+    if chained:
+        out.append('// Function to run the latency and throughput benchmarks with the given kernels')
+        out.append('void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {')
+        out.append('    bench_run(arch, "{}", "{}", {}, "latency", latency, 1);'.format(fn, ret.name, ret.lanes))
+    else:
+        out.append('// Function to run the throughput benchmark with the given kernel')
+        out.append('void run_benchmarks(const char *arch, void (*throughput)(int)) {')
+    out.append('    bench_run(arch, "{}", "{}", {}, "throughput", throughput, BENCH_STREAMS);'.format(
+        fn, ret.name, ret.lanes))
+    out.append('    print_results(bench_result, {}, {});'.format(ret.lanes, ret.print_type))
+    out.append('}')
+    out.append('')
+    feature = neon_feature(fn)
+    if feature:
+        out.append('#if defined(ARM_NEON) && !defined({})'.format(feature[0]))
+        out.append('// {} needs {}, which this build does not target (see ARM_MARCH)'.format(fn, feature[1]))
+        out.append('void run_tests_neon() {')
+        out.append('    bench_unsupported("ARM-Neon", "{}", "{}", {}, "{}");'.format(fn, ret.name, ret.lanes, feature[1]))
+        out.append('}')
+        out.append('')
+    for arch in ('neon', 'rvv'):
+        if arch == 'neon':
+            out.append('#elif defined(ARM_NEON)' if feature else '#if defined(ARM_NEON)')
+        else:
+            out.append('#elif defined(RISCV_VECTOR)')
+        out += kernels(fn, ret, ta, operands, arch)
+        if arch == 'neon':
+            out.append('// Function to run tests using ARM Neon instructions/intrinsics')
+            out.append('void run_tests_neon() {')
+            kernel_names = ['{}_{}_neon'.format(fn, m) for m in (('latency', 'throughput') if chained else ('throughput',))]
+            out.append('    run_benchmarks("ARM-Neon", {});'.format(', '.join(kernel_names)))
+            out.append('}')
+            out.append('')
+        else:
+            out.append('// Function to run tests using RISC-V Vector instructions/intrinsics')
+            out.append('void run_tests_rvv() {')
+            kernel_names = ['{}_{}_rvvector'.format(fn, m) for m in (('latency', 'throughput') if chained else ('throughput',))]
+            out.append('    run_benchmarks("RISC-V", {});'.format(', '.join(kernel_names)))
+            out.append('}')
+            out.append('#endif')
+    out.append('')
+    out.append('int main() {')
+    out.append('    #if defined(RISCV_VECTOR)')
+    out.append('        run_tests_rvv();')
+    out.append('    #elif defined(ARM_NEON)')
+    out.append('        run_tests_neon();')
+    out.append('    #else')
+    out.append('        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."')
+    out.append('    #endif')
+    out.append('    return 0;')
+    out.append('}')
+    return '\n'.join(out) + '\n'
+
+
+def main():
+    if any(arg in ('-h', '--help') for arg in sys.argv[1:]):
+        print('Usage: {} [function_prefix...]'.format(sys.argv[0]))
+        print('Generates tests/performance/<function>_rvv_test for every function of common/rhal_base.h,')
+        print('or for the functions starting with one of the given prefixes.')
+        sys.exit(1)
+    prefixes = sys.argv[1:]
+
+    with open(HEADER) as f:
+        prototypes = PROTOTYPE.findall(f.read())
+
+    count = 0
+    for ret, fn, parameters in prototypes:
+        # Only functions of vectors (with elements or lanes after the first vector) are benchmarked;
+        # the paired (VLEN >= 256) functions have no Neon counterpart
+        params = parse_parameters(parameters)
+        if not params or not VECTOR_TYPE.match(ret) or not VECTOR_TYPE.match(params[0][0]) or fn.endswith('_x2'):
+            continue
+        if prefixes and not any(fn.startswith(p) for p in prefixes):
+            continue
+        test = '{}_rvv_test'.format(fn)
+        os.makedirs(os.path.join(TESTS_DIR, test), exist_ok=True)
+        with open(os.path.join(TESTS_DIR, test, test + '.c'), 'w') as f:
+            operands = [Operand(ctype, name, var) for (ctype, name), var in zip(params[1:], ('y', 'z', 'w'))]
+            f.write(generate(fn, VectorType(ret), VectorType(params[0][0]), operands))
+        count += 1
+
+    if count == 0:
+        print('Error: No function of {} matched.'.format(HEADER))
+        sys.exit(1)
+    print('Generated {} performance tests in {}'.format(count, TESTS_DIR))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,65 @@
+# Copyright 2024 10xEngineers
+
+#!/bin/bash
+
+# Ensure the script exits on errors or undefined variables
+set -euo pipefail
+
+# Function to display usage help
+usage() {
+    echo "Usage: $0 [output_header]"
+    echo "Generates the header-only R-Halogen API from the files in source/."
+    echo "Default output: common/rhal.h"
+    exit 1
+}
+
+# Check the number of arguments
+if [ $# -gt 1 ]; then
+    echo "Error: Invalid number of arguments."
+    usage
+fi
+
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+REPO_DIR="$(dirname "$SCRIPT_DIR")"
+SOURCE_DIR="${REPO_DIR}/source"
+OUTPUT_HEADER="${1:-${REPO_DIR}/common/rhal.h}"
+
+# Collect the library sources in a stable order
+mapfile -t sources < <(cd "$SOURCE_DIR" && ls -1 *_rvv.c | LC_ALL=C sort)
+
+if [ ${#sources[@]} -eq 0 ]; then
+    echo "Error: No sources found in $SOURCE_DIR"
+    exit 1
+fi
+
+{
+    echo "// Copyright 2024 10xEngineers"
+    echo ""
+    echo "// Generated by scripts/generate_rhal_header.sh. Do not edit."
+    echo ""
+    echo "#ifndef COMMON_RHAL_H_"
+    echo "#define COMMON_RHAL_H_"
+    echo ""
+    echo "/*"
+    echo " * Header-only R-Halogen API. Every function of rhal_base.h is compiled from"
+    echo " * the same definitions as the librhal objects, but as a static always-inline"
+    echo " * function, so neighbouring operations can be fused and vsetvli hoisted out"
+    echo " * of the caller's loops. Include this header instead of rhal_base.h."
+    echo " */"
+    echo ""
+    echo "#ifdef COMMON_RHAL_BASE_H_"
+    echo "#error \"rhal.h must be included instead of rhal_base.h, not after it.\""
+    echo "#endif"
+    echo ""
+    echo "#define RHAL_API static inline __attribute__((always_inline))"
+    echo ""
+    echo "#include \"rhal_base.h\""
+    echo ""
+    for src in "${sources[@]}"; do
+        echo "#include \"${src}\""
+    done
+    echo ""
+    echo "#endif  // COMMON_RHAL_H_"
+} > "$OUTPUT_HEADER"
+
+echo "Generated '$OUTPUT_HEADER' from ${#sources[@]} sources."
@@ -0,0 +1,107 @@
+# Copyright 2024 10xEngineers
+
+#!/bin/bash
+
+# Ensure the script exits on errors or undefined variables
+set -euo pipefail
+
+# Function to display usage help
+usage() {
+    echo "Usage: $0 <baseline_csv> <current_csv> [tolerance_percent]"
+    echo "       $0 --update <baseline_csv> <current_csv>"
+    echo "Compares the instruction counts of run_insn_count.sh with a baseline and fails if any"
+    echo "count of a test grew by more than tolerance_percent (default 0.5), or if the baseline"
+    echo "has fewer than half of the current tests. Exits with 2 if no baseline has been recorded"
+    echo "yet (only the header)."
+    echo "With --update, the baseline is replaced by the current counts."
+    echo "Example: $0 scripts/baselines/insn_count_qemu-riscv64.csv insn_count_qemu-riscv64.csv"
+    exit 1
+}
+
+if [ $# -ge 1 ] && [ "$1" == "--update" ]; then
+    if [ $# -ne 3 ]; then
+        echo "Error: Invalid number of arguments."
+        usage
+    fi
+    cp "$3" "$2"
+    echo "Baseline $2 updated from $3."
+    exit 0
+fi
+
+if [ $# -lt 2 ] || [ $# -gt 3 ]; then
+    echo "Error: Invalid number of arguments."
+    usage
+fi
+
+BASELINE_CSV=$1
+CURRENT_CSV=$2
+TOLERANCE=${3:-0.5}
+
+# Check if the provided files exist
+for file in "$BASELINE_CSV" "$CURRENT_CSV"; do
+    if [[ ! -f "$file" ]]; then
+        echo "Error: File not found: $file"
+        exit 1
+    fi
+done
+
+# Print testname,metric,baseline,current,change(%) for every count, flagging the ones
+# that grew past the tolerance, and exit with 1 if there is any. A baseline with fewer than
+# half of the current tests would list nearly every test as new, so it fails the comparison
+# too, instead of passing silently; one with only the header has not been recorded yet, which
+# exits with 2.
+awk -F, -v tolerance="$TOLERANCE" -v baseline_csv="$BASELINE_CSV" -v current_csv="$CURRENT_CSV" -v script="$0" '
+    BEGIN {
+        print "testname,metric,baseline,current,change(%)"
+    }
+    FNR == 1 {
+        for (i = 2; i <= NF; i++) {
+            metric[i] = $i
+        }
+        columns = NF
+        next
+    }
+    NR == FNR {
+        for (i = 2; i <= NF; i++) {
+            baseline[$1, i] = $i
+        }
+        known[$1] = 1
+        baseline_tests++
+        next
+    }
+    {
+        current_tests++
+        if (!($1 in known)) {
+            printf "%s,all,,,new\n", $1
+            new_tests++
+            next
+        }
+        for (i = 2; i <= columns; i++) {
+            base = baseline[$1, i]
+            change = base > 0 ? ($i - base) * 100 / base : ($i > 0 ? 100 : 0)
+            status = ""
+            if (change > tolerance) {
+                status = ",REGRESSION"
+                regressions++
+            } else if (change < -tolerance) {
+                status = ",improved"
+            }
+            printf "%s,%s,%s,%s,%.2f%s\n", $1, metric[i], base, $i, change, status
+        }
+    }
+    END {
+        printf "%d regression(s) over %s%%, %d test(s) not in the baseline\n", regressions, tolerance, new_tests
+        covered = current_tests - new_tests
+        if (baseline_tests == 0) {
+            printf "Error: no baseline has been recorded in %s yet, so regressions cannot be checked.\n", baseline_csv
+            printf "Record it from a run of run_insn_count.sh: %s --update %s %s\n", script, baseline_csv, current_csv
+            exit 2
+        }
+        if (current_tests == 0 || covered < current_tests / 2) {
+            printf "Error: the baseline %s has %d of the %d tests of %s, so regressions cannot be checked.\n", \
+                baseline_csv, covered, current_tests, current_csv
+            printf "Record it from a run of run_insn_count.sh: %s --update %s %s\n", script, baseline_csv, current_csv
+            exit 1
+        }
+        exit regressions > 0
+    }' "$BASELINE_CSV" "$CURRENT_CSV"
@@ -0,0 +1,171 @@
+# Copyright 2024 10xEngineers
+
+# Compares the per-run times of run_tests_performance.sh <target> <runs>
+# (performance_samples_<target>.csv) with a baseline recorded the same way, and
+# exits with 1 if any test is significantly slower. A test is a regression when
+# a one-sided Mann-Whitney U test rejects "not slower" at the given significance
+# level and its median time grew by more than the given threshold, so neither
+# the run-to-run noise of a shared host nor a statistically significant but
+# negligible shift fails the check. It also fails when the baseline has fewer than
+# half of the current tests, and exits with 2 while the baseline has no tests at all
+# (only the header, before one has been recorded for the target).
+#
+# Usage: python3 performance_regression.py <baseline_csv> <current_csv> [alpha] [threshold_percent]
+#        python3 performance_regression.py --update <baseline_csv> <current_csv>
+#   e.g. python3 performance_regression.py scripts/baselines/performance_spike.csv performance_samples_spike.csv
+
+import math
+import shutil
+import sys
+
+ALPHA = 0.01
+THRESHOLD_PERCENT = 5.0
+
+# Above this many runs per side the p-value comes from the normal approximation
+EXACT_MAX_RUNS = 20
+
+# Fraction of the current tests the baseline must have. Below it (e.g. a baseline with only
+# the header) nearly every test would be "new", so the check fails instead of passing silently.
+MIN_BASELINE_COVERAGE = 0.5
+
+
+def read_samples(csv_file):
+    """Times of every test in a testname,run,time CSV, in the order the tests appear."""
+    samples = {}
+    with open(csv_file) as f:
+        f.readline()
+        for line in f:
+            values = line.strip().split(',')
+            if len(values) < 2 or values[-1] == '':
+                continue
+            samples.setdefault(values[0], []).append(float(values[-1]))
+    return samples
+
+
+def median(values):
+    ordered = sorted(values)
+    middle = len(ordered) // 2
+    return ordered[middle] if len(ordered) % 2 else (ordered[middle - 1] + ordered[middle]) / 2
+
+
+def ranks(values):
+    """Ranks starting at 1, ties getting the average of their ranks, and the tie sizes."""
+    order = sorted(range(len(values)), key=lambda i: values[i])
+    result = [0.0] * len(values)
+    ties = []
+    i = 0
+    while i < len(order):
+        j = i
+        while j + 1 < len(order) and values[order[j + 1]] == values[order[i]]:
+            j += 1
+        for k in range(i, j + 1):
+            result[order[k]] = (i + j) / 2 + 1
+        if j > i:
+            ties.append(j - i + 1)
+        i = j + 1
+    return result, ties
+
+
+def exact_p_value(u, n1, n2):
+    """P(U >= u) without ties: the number of arrangements with each U, by recursion on n1 and n2."""
+    # count[i][j][k]: arrangements of i current and j baseline samples with U = k
+    count = [[[0] * (n1 * n2 + 1) for _ in range(n2 + 1)] for _ in range(n1 + 1)]
+    for i in range(n1 + 1):
+        for j in range(n2 + 1):
+            if i == 0 or j == 0:
+                count[i][j][0] = 1
+                continue
+            for k in range(i * j + 1):
+                # The largest sample is a current one (beating all j baseline samples) or a baseline one
+                count[i][j][k] = (count[i - 1][j][k - j] if k >= j else 0) + count[i][j - 1][k]
+    total = math.comb(n1 + n2, n1)
+    return sum(count[n1][n2][math.ceil(u):]) / total
+
+
+def mann_whitney_slower(current, baseline):
+    """One-sided p-value of the current times being larger than the baseline times."""
+    n1, n2 = len(current), len(baseline)
+    rank, ties = ranks(current + baseline)
+    u = sum(rank[:n1]) - n1 * (n1 + 1) / 2
+    if not ties and n1 <= EXACT_MAX_RUNS and n2 <= EXACT_MAX_RUNS:
+        return exact_p_value(u, n1, n2)
+    n = n1 + n2
+    variance = n1 * n2 / 12 * ((n + 1) - sum(t ** 3 - t for t in ties) / (n * (n - 1)))
+    if variance == 0:
+        return 1.0
+    z = (u - n1 * n2 / 2 - 0.5) / math.sqrt(variance)
+    return 0.5 * math.erfc(z / math.sqrt(2))
+
+
+def compare(baseline, current, alpha, threshold):
+    """Prints the comparison of every test, returns the number of regressions."""
+    print('testname,baseline_median(us),current_median(us),change(%),p_value,status')
+    regressions = 0
+    new = 0
+    for test, times in current.items():
+        if test not in baseline:
+            print('{},,{:g},,,new'.format(test, median(times)))
+            new += 1
+            continue
+        base = baseline[test]
+        base_median, current_median = median(base), median(times)
+        change = (current_median - base_median) * 100 / base_median if base_median > 0 else 0.0
+        p_value = mann_whitney_slower(times, base)
+        p_faster = mann_whitney_slower(base, times)
+        status = ''
+        if p_value < alpha and change > threshold:
+            status = 'REGRESSION'
+            regressions += 1
+        elif p_faster < alpha and change < -threshold:
+            status = 'improved'
+        print('{},{:g},{:g},{:.2f},{:.4f},{}'.format(test, base_median, current_median, change, p_value, status))
+    print('{} regression(s) at p < {:g} and over {:g}%, {} test(s) not in the baseline'.format(
+        regressions, alpha, threshold, new))
+    if any(len(times) < 3 for times in current.values()) or any(len(times) < 3 for times in baseline.values()):
+        print('Warning: fewer than 3 runs of some tests, which can never be significant at p < {:g}.'.format(alpha))
+    return regressions
+
+
+def usage():
+    print('Usage: {} <baseline_csv> <current_csv> [alpha] [threshold_percent]'.format(sys.argv[0]))
+    print('       {} --update <baseline_csv> <current_csv>'.format(sys.argv[0]))
+    print('Compares the per-run times of run_tests_performance.sh <target> <runs> (performance_samples_<target>.csv)')
+    print('with a baseline and fails if any test is slower at significance alpha (default {:g}, Mann-Whitney U)'.format(ALPHA))
+    print('and by more than threshold_percent (default {:g}), or if the baseline has fewer than {:g}% of the tests.'.format(
+        THRESHOLD_PERCENT, MIN_BASELINE_COVERAGE * 100))
+    print('Exits with 2 if no baseline has been recorded yet (only the header).')
+    print('With --update, the baseline is replaced.')
+    sys.exit(1)
+
+
+def main():
+    args = sys.argv[1:]
+    if args and args[0] == '--update':
+        if len(args) != 3:
+            usage()
+        shutil.copyfile(args[2], args[1])
+        print('Baseline {} updated from {}.'.format(args[1], args[2]))
+        return
+    if len(args) < 2 or len(args) > 4:
+        usage()
+
+    baseline = read_samples(args[0])
+    current = read_samples(args[1])
+    alpha = float(args[2]) if len(args) > 2 else ALPHA
+    threshold = float(args[3]) if len(args) > 3 else THRESHOLD_PERCENT
+    regressions = compare(baseline, current, alpha, threshold)
+    covered = sum(1 for test in current if test in baseline)
+    if not baseline:
+        print('Error: no baseline has been recorded in {} yet, so regressions cannot be checked.'.format(args[0]))
+        print('Record it from the runs of a pipeline: {} --update {} {}'.format(sys.argv[0], args[0], args[1]))
+        sys.exit(2)
+    if not current or covered < MIN_BASELINE_COVERAGE * len(current):
+        print('Error: the baseline {} has {} of the {} tests of {}, so regressions cannot be checked.'.format(
+            args[0], covered, len(current), args[1]))
+        print('Record it from the runs of a pipeline: {} --update {} {}'.format(sys.argv[0], args[0], args[1]))
+        sys.exit(1)
+    sys.exit(1 if regressions else 0)
+
+
+if __name__ == '__main__':
+    main()
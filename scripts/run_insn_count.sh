@@ -0,0 +1,41 @@
+# Copyright 2024 10xEngineers
+
+#!/bin/bash
+
+# Ensure the script exits on errors or undefined variables
+set -euo pipefail
+
+# Function to display usage help
+usage() {
+    echo "Usage: $0 [output_csv]"
+    echo "Runs every performance test of the library functions under qemu-riscv64 with the"
+    echo "instruction counting TCG plugin (make insn-count) and collects the counts."
+    echo "Default output: insn_count_qemu-riscv64.csv"
+    exit 1
+}
+
+# Check the number of arguments
+if [ $# -gt 1 ]; then
+    echo "Error: Invalid number of arguments."
+    usage
+fi
+
+TARGET="qemu-riscv64"
+log_file="${1:-insn_count_${TARGET}.csv}"
+
+# Discover the performance tests of the library functions, as run_tests_performance.sh
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+mapfile -t tests < <(cd "${SCRIPT_DIR}/../tests/performance" && ls -1d *_rvv_test | grep -E '^v[a-z]+(_high)?(_n|_lane|_laneq)?_[su](8|16|32|64)_rvv_test$' | LC_ALL=C sort)
+
+# Build the RISC-V library once, in parallel, before the tests link against it
+make ARCH=riscv TARGET="${TARGET}" -j"$(nproc)" lib
+
+echo "testname,instructions,vector_instructions,vsetvli,library_instructions" > "$log_file"
+
+for test in "${tests[@]}"; do
+    make ARCH=riscv TARGET="${TARGET}" SUBD=riscv SRCS=tests/performance/"${test}"/"${test}".c insn-count
+
+    # The plugin writes a header and one row of counts
+    counts="RUN/tests/performance/${test}/riscv/${TARGET}/insn_count.csv"
+    echo "${test},$(tail -n 1 "$counts")" | tee -a "$log_file"
+done
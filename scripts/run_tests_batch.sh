@@ -0,0 +1,70 @@
+# Copyright 2024 10xEngineers
+
+#!/bin/bash
+
+# Ensure the script exits on errors or undefined variables
+set -euo pipefail
+
+# Function to display usage help
+usage() {
+    echo "Usage: $0 <target> [filter...]"
+    echo "Builds every correctness test into one batch driver ELF and runs it once."
+    echo "Only the tests whose names contain one of the filters are run (all without any)."
+    echo "Possible targets:"
+    echo "  qemu-riscv64   - Run tests on QEMU RISC-V emulator"
+    echo "  qemu-aarch64   - Run tests on QEMU ARM emulator"
+    echo "  spike          - Run tests on Spike Simulator"
+    echo "  bpif3          - Run tests on Banana Pi F3"
+    echo "  raspi4         - Run tests on Raspberry Pi 4"
+    exit 1
+}
+
+# Check if the target is provided
+if [ $# -lt 1 ]; then
+    echo "Error: No target specified."
+    usage
+fi
+
+TARGET=$1
+shift
+FILTERS="$*"
+
+driver="batch_driver"
+srcs="tests/correctness/${driver}/${driver}.c"
+
+# Define the log file for correctness results, in the format of run_tests_correctness.sh
+log_file="correctness_results_${TARGET}.csv"
+
+if [[ "$TARGET" == "qemu-riscv64" ]]; then
+    make ARCH=riscv TARGET="${TARGET}" SUBD=riscv BATCH=1 -j"$(nproc)" SRCS="${srcs}" compile
+    make ARCH=riscv TARGET="${TARGET}" SUBD=riscv BATCH=1 RUN_ARGS="${FILTERS}" SRCS="${srcs}" qemu
+    out="RUN/tests/correctness/${driver}/riscv/${TARGET}/qemu.out"
+
+elif [[ "$TARGET" == "spike" ]]; then
+    make ARCH=riscv TARGET="${TARGET}" SUBD=riscv BATCH=1 -j"$(nproc)" SRCS="${srcs}" compile
+    make PK=/home/jenkins_user/runner_dir/workspace/R-Halogen/riscv-pk/build/riscv64-unknown-elf/bin/pk ARCH=riscv TARGET="${TARGET}" SUBD=riscv BATCH=1 RUN_ARGS="${FILTERS}" SRCS="${srcs}" spike
+    out="RUN/tests/correctness/${driver}/riscv/${TARGET}/${TARGET}.out"
+
+elif [[ "$TARGET" == "bpif3" ]]; then
+    make ARCH=riscv TARGET="${TARGET}" SUBD=riscv BATCH=1 -j"$(nproc)" SRCS="${srcs}" compile
+    make ARCH=riscv TARGET="${TARGET}" SUBD=riscv BATCH=1 RUN_ARGS="${FILTERS}" SRCS="${srcs}" bpif3
+    out="RUN/tests/correctness/${driver}/riscv/${TARGET}/${TARGET}.out"
+
+elif [[ "$TARGET" == "qemu-aarch64" ]]; then
+    make ARCH=arm TARGET="${TARGET}" SUBD=arm BATCH=1 -j"$(nproc)" SRCS="${srcs}" compile
+    make ARCH=arm TARGET="${TARGET}" SUBD=arm BATCH=1 RUN_ARGS="${FILTERS}" SRCS="${srcs}" qemu
+    out="RUN/tests/correctness/${driver}/arm/${TARGET}/qemu.out"
+
+elif [[ "$TARGET" == "raspi4" ]]; then
+    make ARCH=arm TARGET="${TARGET}" SUBD=arm BATCH=1 -j"$(nproc)" SRCS="${srcs}" compile
+    make ARCH=arm TARGET="${TARGET}" SUBD=arm BATCH=1 RUN_ARGS="${FILTERS}" SRCS="${srcs}" raspi4
+    out="RUN/tests/correctness/${driver}/arm/${TARGET}/${TARGET}.out"
+
+else
+    echo "Error: Invalid target specified: $TARGET"
+    usage
+fi
+
+# The driver already prints the CSV header and rows
+cp "$out" "$log_file"
+echo "Results written to $log_file ($(tail -n +2 "$log_file" | cut -d, -f1 | sort -u | wc -l) tests)"
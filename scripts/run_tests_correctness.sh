@@ -25,157 +25,9 @@ fi
 
 TARGET=$1
 
-# Define the list of correctness tests
-tests=(
-    "vadd_s8_rvv_test"
-    "vadd_s16_rvv_test"
-    "vadd_s32_rvv_test"
-    "vadd_s64_rvv_test"
-    "vaddq_s8_rvv_test"
-    "vaddq_s16_rvv_test"
-    "vaddq_s32_rvv_test"
-    "vaddq_s64_rvv_test"
-    "vadd_u8_rvv_test"
-    "vadd_u16_rvv_test"
-    "vadd_u32_rvv_test"
-    "vadd_u64_rvv_test"
-    "vaddq_u8_rvv_test"
-    "vaddq_u16_rvv_test"
-    "vaddq_u32_rvv_test"
-    "vaddq_u64_rvv_test"
-    "vsub_s8_rvv_test"
-    "vsub_s16_rvv_test"
-    "vsub_s32_rvv_test"
-    "vsub_s64_rvv_test"
-    "vsubq_s8_rvv_test"
-    "vsubq_s16_rvv_test"
-    "vsubq_s32_rvv_test"
-    "vsubq_s64_rvv_test"
-    "vsub_u8_rvv_test"
-    "vsub_u16_rvv_test"
-    "vsub_u32_rvv_test"
-    "vsub_u64_rvv_test"
-    "vsubq_u8_rvv_test"
-    "vsubq_u16_rvv_test"
-    "vsubq_u32_rvv_test"
-    "vsubq_u64_rvv_test"
-    "vaddl_s8_rvv_test"
-    "vaddl_s16_rvv_test"
-    "vaddl_s32_rvv_test"
-    "vaddl_u8_rvv_test"
-    "vaddl_u16_rvv_test"
-    "vaddl_u32_rvv_test"
-    "vaddw_s8_rvv_test"
-    "vaddw_s16_rvv_test"
-    "vaddw_s32_rvv_test"
-    "vaddw_u8_rvv_test"
-    "vaddw_u16_rvv_test"
-    "vaddw_u32_rvv_test"
-    "vhadd_s8_rvv_test"
-    "vhadd_s16_rvv_test"
-    "vhadd_s32_rvv_test"
-    "vhaddq_s8_rvv_test"
-    "vhaddq_s16_rvv_test"
-    "vhaddq_s32_rvv_test"
-    "vhadd_u8_rvv_test"
-    "vhadd_u16_rvv_test"
-    "vhadd_u32_rvv_test"
-    "vhaddq_u8_rvv_test"
-    "vhaddq_u16_rvv_test"
-    "vhaddq_u32_rvv_test"
-    "vsubl_s8_rvv_test"
-    "vsubl_s16_rvv_test"
-    "vsubl_s32_rvv_test"
-    "vsubl_u8_rvv_test"
-    "vsubl_u16_rvv_test"
-    "vsubl_u32_rvv_test"
-    "vsubw_s8_rvv_test"
-    "vsubw_s16_rvv_test"
-    "vsubw_s32_rvv_test"
-    "vsubw_u8_rvv_test"
-    "vsubw_u16_rvv_test"
-    "vsubw_u32_rvv_test"
-    "vhsub_s8_rvv_test"
-    "vhsub_s16_rvv_test"
-    "vhsub_s32_rvv_test"
-    "vhsubq_s8_rvv_test"
-    "vhsubq_s16_rvv_test"
-    "vhsubq_s32_rvv_test"
-    "vhsub_u8_rvv_test"
-    "vhsub_u16_rvv_test"
-    "vhsub_u32_rvv_test"
-    "vhsubq_u8_rvv_test"
-    "vhsubq_u16_rvv_test"
-    "vhsubq_u32_rvv_test"
-    "vrhadd_s8_rvv_test"
-    "vrhadd_s16_rvv_test"
-    "vrhadd_s32_rvv_test"
-    "vrhaddq_s8_rvv_test"
-    "vrhaddq_s16_rvv_test"
-    "vrhaddq_s32_rvv_test"
-    "vrhadd_u8_rvv_test"
-    "vrhadd_u16_rvv_test"
-    "vrhadd_u32_rvv_test"
-    "vrhaddq_u8_rvv_test"
-    "vrhaddq_u16_rvv_test"
-    "vrhaddq_u32_rvv_test"
-    "vqadd_s8_rvv_test"
-    "vqadd_s16_rvv_test"
-    "vqadd_s32_rvv_test"
-    "vqadd_s64_rvv_test"
-    "vqaddq_s8_rvv_test"
-    "vqaddq_s16_rvv_test"
-    "vqaddq_s32_rvv_test"
-    "vqaddq_s64_rvv_test"
-    "vqadd_u8_rvv_test"
-    "vqadd_u16_rvv_test"
-    "vqadd_u32_rvv_test"
-    "vqadd_u64_rvv_test"
-    "vqaddq_u8_rvv_test"
-    "vqaddq_u16_rvv_test"
-    "vqaddq_u32_rvv_test"
-    "vqaddq_u64_rvv_test"
-    "vqsub_s8_rvv_test"
-    "vqsub_s16_rvv_test"
-    "vqsub_s32_rvv_test"
-    "vqsub_s64_rvv_test"
-    "vqsubq_s8_rvv_test"
-    "vqsubq_s16_rvv_test"
-    "vqsubq_s32_rvv_test"
-    "vqsubq_s64_rvv_test"
-    "vqsub_u8_rvv_test"
-    "vqsub_u16_rvv_test"
-    "vqsub_u32_rvv_test"
-    "vqsub_u64_rvv_test"
-    "vqsubq_u8_rvv_test"
-    "vqsubq_u16_rvv_test"
-    "vqsubq_u32_rvv_test"
-    "vqsubq_u64_rvv_test"
-    "vaddhn_s16_rvv_test"
-    "vaddhn_s32_rvv_test"
-    "vaddhn_s64_rvv_test"
-    "vaddhn_u16_rvv_test"
-    "vaddhn_u32_rvv_test"
-    "vaddhn_u64_rvv_test"
-    "vsubhn_s16_rvv_test"
-    "vsubhn_s32_rvv_test"
-    "vsubhn_s64_rvv_test"
-    "vsubhn_u16_rvv_test"
-    "vsubhn_u32_rvv_test"
-    "vsubhn_u64_rvv_test"
-    "vraddhn_s16_rvv_test"
-    "vraddhn_s32_rvv_test"
-    "vraddhn_s64_rvv_test"
-    "vraddhn_u16_rvv_test"
-    "vraddhn_u32_rvv_test"
-    "vraddhn_u64_rvv_test"
-    "vrsubhn_s16_rvv_test"
-    "vrsubhn_s32_rvv_test"
-    "vrsubhn_s64_rvv_test"
-    "vrsubhn_u16_rvv_test"
-    "vrsubhn_u32_rvv_test"
-    "vrsubhn_u64_rvv_test"
-)
+# Discover the correctness tests, every tests/correctness/<name>_rvv_test/<name>_rvv_test.c
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+mapfile -t tests < <(cd "${SCRIPT_DIR}/../tests/correctness" && ls -1d *_rvv_test | LC_ALL=C sort)
 
 # Define the log file for correctness results
 log_file="correctness_results_${TARGET}.csv"
@@ -183,6 +35,12 @@ log_file="correctness_results_${TARGET}.csv"
 # Write the header to the log file
 echo "testname,test no,result" > "$log_file"
 
+# Build the RISC-V library of the target once, in parallel, before the tests link against
+# it; every target has its own RHAL_LIB_DIR, so targets run side by side do not race
+if [[ "$TARGET" == "qemu-riscv64" || "$TARGET" == "spike" || "$TARGET" == "bpif3" ]]; then
+    make ARCH=riscv TARGET="${TARGET}" -j"$(nproc)" lib
+fi
+
 # Run correctness tests based on the target environment
 for i in "${!tests[@]}"; do
     test="${tests[$i]}"
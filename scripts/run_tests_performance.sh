@@ -7,134 +7,189 @@ set -euo pipefail
 
 # Function to display usage help
 usage() {
-    echo "Usage: $0 <target>"
+    echo "Usage: $0 <target> [runs]"
     echo "Possible targets:"
     echo "  qemu-riscv64   - Run tests on QEMU RISC-V emulator"
     echo "  qemu-aarch64   - Run tests on QEMU ARM emulator"
     echo "  spike          - Run tests on Spike Simulator"
     echo "  bpif3          - Run tests on Banana Pi F3"
     echo "  raspi4         - Run tests on Raspberry Pi 4"
+    echo "Each test is run <runs> times (default 1). Every run is written to"
+    echo "performance_samples_<target>.csv, their median to performance_results_<target>.csv."
     exit 1
 }
 
 # Check if the target is provided
-if [ $# -ne 1 ]; then
+if [ $# -lt 1 ] || [ $# -gt 2 ]; then
     echo "Error: No target specified."
     usage
 fi
 
 TARGET=$1
+RUNS=${2:-1}
 
-# Define the list of tests
-tests=(
-    "vadd_s8_rvv_test"
-    "vadd_s16_rvv_test"
-    "vadd_s32_rvv_test"
-    "vadd_s64_rvv_test"
-    "vaddq_s8_rvv_test"
-    "vaddq_s16_rvv_test"
-    "vaddq_s32_rvv_test"
-    "vaddq_s64_rvv_test"
-    "vadd_u8_rvv_test"
-    "vadd_u16_rvv_test"
-    "vadd_u32_rvv_test"
-    "vadd_u64_rvv_test"
-    "vaddq_u8_rvv_test"
-    "vaddq_u16_rvv_test"
-    "vaddq_u32_rvv_test"
-    "vaddq_u64_rvv_test"
-    "vsub_s8_rvv_test"
-    "vsub_s16_rvv_test"
-    "vsub_s32_rvv_test"
-    "vsub_s64_rvv_test"
-    "vsub_u8_rvv_test"
-    "vsub_u16_rvv_test"
-    "vsub_u32_rvv_test"
-    "vsub_u64_rvv_test"
-)
-
-# Define the log file
+if ! [[ "$RUNS" =~ ^[1-9][0-9]*$ ]]; then
+    echo "Error: Invalid number of runs: $RUNS"
+    usage
+fi
+
+# Discover the performance tests of the library functions, tests/performance/<function>_rvv_test.
+# Tests comparing build modes (qc_flag_rvv_test, tail_policy_rvv_test, ...) are run on their own.
+SCRIPT_DIR="$(cd "$(dirname "${BASH_SOURCE[0]}")" && pwd)"
+mapfile -t tests < <(cd "${SCRIPT_DIR}/../tests/performance" && ls -1d *_rvv_test | grep -E '^v[a-z]+(_high)?(_n|_lane|_laneq)?_[su](8|16|32|64)_rvv_test$' | LC_ALL=C sort)
+
+# Define the log file, and the file with the time of every run for the regression check
 log_file="performance_results_${TARGET}.csv"
+samples_file="performance_samples_${TARGET}.csv"
 
-# Clear the log file if it exists and write the header
+# Clear the log files if they exist and write the headers
 if [[ "$TARGET" == "qemu-riscv64" || "$TARGET" == "spike" || "$TARGET" == "bpif3" ]]; then
     echo "testname,RISC-V (us)" > "$log_file"
+    echo "testname,run,RISC-V (us)" > "$samples_file"
 elif [[ "$TARGET" == "qemu-aarch64" || "$TARGET" == "raspi4" ]]; then
     echo "testname,ARM (us)" > "$log_file"
+    echo "testname,run,ARM (us)" > "$samples_file"
 else
     echo "Error: Invalid target specified: $TARGET"
     usage
 fi
 
+# Every benchmark record of every run, with the test and the run in front
+records_file="performance_records_${TARGET}.csv"
+: > "$records_file"
+
+# Appends the benchmark records (BENCH_FORMAT=csv) of an output file to the records file and
+# prints the median latency per op in microseconds, or the median throughput for functions
+# whose calls cannot be chained
+bench_time() {
+    local out=$1 test=$2 run=$3 header=0
+    if [ ! -s "$records_file" ]; then
+        header=1
+    fi
+    awk -F, -v test="$test" -v run="$run" -v records="$records_file" -v header="$header" '
+        $1 != "BENCH" {
+            next
+        }
+        $2 == "arch" {
+            for (i = 2; i <= NF; i++) {
+                column[$i] = i
+            }
+            if (header) {
+                print "testname,run," substr($0, 7) >> records
+                header = 0
+            }
+            next
+        }
+        {
+            print test "," run "," substr($0, 7) >> records
+            ns = $column["ns_median"]
+            if ($column["mode"] == "latency") {
+                l += ns
+                nl++
+            } else {
+                t += ns
+                nt++
+            }
+        }
+        END {
+            if (nl) print l / nl / 1000; else if (nt) print t / nt / 1000
+        }' "$out"
+}
+
+# Build the RISC-V library of the target once, in parallel, before the tests link against
+# it; every target has its own RHAL_LIB_DIR, so targets run side by side do not race
+if [[ "$TARGET" == "qemu-riscv64" || "$TARGET" == "spike" || "$TARGET" == "bpif3" ]]; then
+    make ARCH=riscv TARGET="${TARGET}" -j"$(nproc)" lib
+fi
+
 # Run tests based on the target environment
 for test in "${tests[@]}"; do
-    if [[ "$TARGET" == "qemu-riscv64" ]]; then
-        # Run the RISC-V command
-        make ARCH=riscv TARGET="${TARGET}" SUBD=riscv SRCS=tests/performance/"${test}"/"${test}".c
+    times=()
+    for run in $(seq 1 "$RUNS"); do
+        if [[ "$TARGET" == "qemu-riscv64" ]]; then
+            # Run the RISC-V command
+            make ARCH=riscv TARGET="${TARGET}" SUBD=riscv BENCH_FORMAT=csv SRCS=tests/performance/"${test}"/"${test}".c
+
+            # Define the output files
+            riscv_out="RUN/tests/performance/${test}/riscv/${TARGET}/qemu.out"
 
-        # Define the output files
-        riscv_out="RUN/tests/performance/${test}/riscv/${TARGET}/qemu.out"
+            # Collect the time from the benchmark records of the output file
+            riscv_time=$(bench_time "$riscv_out" "${test}" "${run}")
 
-        # Collect average performance data from the output files
-        riscv_time=$(grep "RISC-V vector function" "$riscv_out" | awk '{print $6}' | awk '{count+=$1} END{print count/NR}')
+            # Write the run to the samples file
+            echo "${test},${run},${riscv_time}" >> "$samples_file"
+            times+=("${riscv_time}")
 
-        # Write the results to the log file
-        echo -e "${test},${riscv_time}" | tee -a "$log_file"
+        elif [[ "$TARGET" == "spike" ]]; then
+            # Run the RISC-V command
+            make PK=/home/jenkins_user/runner_dir/workspace/R-Halogen/riscv-pk/build/riscv64-unknown-elf/bin/pk ARCH=riscv TARGET="${TARGET}" SUBD=riscv BENCH_FORMAT=csv SRCS=tests/performance/"${test}"/"${test}".c
 
-    elif [[ "$TARGET" == "spike" ]]; then
-        # Run the RISC-V command
-        make PK=/home/jenkins_user/runner_dir/workspace/R-Halogen/riscv-pk/build/riscv64-unknown-elf/bin/pk ARCH=riscv TARGET="${TARGET}" SUBD=riscv SRCS=tests/performance/"${test}"/"${test}".c
+            # Define the output files
+            riscv_out="RUN/tests/performance/${test}/riscv/${TARGET}/${TARGET}.out"
 
-        # Define the output files
-        riscv_out="RUN/tests/performance/${test}/riscv/${TARGET}/${TARGET}.out"
+            # Collect the time from the benchmark records of the output file
+            riscv_time=$(bench_time "$riscv_out" "${test}" "${run}")
 
-        # Collect average performance data from the output files
-        riscv_time=$(grep "RISC-V vector function" "$riscv_out" | awk '{print $6}' | awk '{count+=$1} END{print count/NR}')
+            # Write the run to the samples file
+            echo "${test},${run},${riscv_time}" >> "$samples_file"
+            times+=("${riscv_time}")
 
-        # Write the results to the log file
-        echo -e "${test},${riscv_time}" | tee -a "$log_file"
+        elif [[ "$TARGET" == "qemu-aarch64" ]]; then
+            # Run the ARM command
+            make ARCH=arm TARGET="${TARGET}" SUBD=arm BENCH_FORMAT=csv SRCS=tests/performance/"${test}"/"${test}".c
 
-    elif [[ "$TARGET" == "qemu-aarch64" ]]; then
-        # Run the ARM command
-        make ARCH=arm TARGET="${TARGET}" SUBD=arm SRCS=tests/performance/"${test}"/"${test}".c
+            # Define the output files
+            arm_out="RUN/tests/performance/${test}/arm/${TARGET}/qemu.out"
 
-        # Define the output files
-        arm_out="RUN/tests/performance/${test}/arm/${TARGET}/qemu.out"
+            # Collect the time from the benchmark records of the output file
+            arm_time=$(bench_time "$arm_out" "${test}" "${run}")
 
-        # Collect average performance data from the output files
-        arm_time=$(grep "ARM-Neon vector function" "$arm_out" | awk '{print $6}' | awk '{count+=$1} END{print count/NR}')
+            # Write the run to the samples file
+            echo "${test},${run},${arm_time}" >> "$samples_file"
+            times+=("${arm_time}")
 
-        # Write the results to the log file
-        echo -e "${test},${arm_time}" | tee -a "$log_file"
+        elif [[ "$TARGET" == "raspi4" ]]; then
+            # Run the ARM command
+            make ARCH=arm TARGET="${TARGET}" SUBD=arm BENCH_FORMAT=csv SRCS=tests/performance/"${test}"/"${test}".c
 
-    elif [[ "$TARGET" == "raspi4" ]]; then
-        # Run the ARM command
-        make ARCH=arm TARGET="${TARGET}" SUBD=arm SRCS=tests/performance/"${test}"/"${test}".c
+            # Define the output file
+            arm_out="RUN/tests/performance/${test}/arm/${TARGET}/${TARGET}.out"
 
-        # Define the output file
-        arm_out="RUN/tests/performance/${test}/arm/${TARGET}/${TARGET}.out"
+            # Collect the time from the benchmark records of the output file
+            arm_time=$(bench_time "$arm_out" "${test}" "${run}")
 
-        # Collect average performance data from the output file
-        arm_time=$(grep "ARM-Neon vector function" "$arm_out" | awk '{print $6}' | awk '{count+=$1} END{print count/NR}')
+            # Write the run to the samples file
+            echo "${test},${run},${arm_time}" >> "$samples_file"
+            times+=("${arm_time}")
 
-        # Write the results to the log file
-        echo -e "${test},${arm_time}" | tee -a "$log_file"
+        elif [[ "$TARGET" == "bpif3" ]]; then
+            # Run the RISC-V command
+            make ARCH=riscv TARGET="${TARGET}" SUBD=riscv BENCH_FORMAT=csv SRCS=tests/performance/"${test}"/"${test}".c
 
-    elif [[ "$TARGET" == "bpif3" ]]; then
-        # Run the RISC-V command
-        make ARCH=riscv TARGET="${TARGET}" SUBD=riscv SRCS=tests/performance/"${test}"/"${test}".c
+            # Define the output file
+            riscv_out="RUN/tests/performance/${test}/riscv/${TARGET}/${TARGET}.out"
 
-        # Define the output file
-        riscv_out="RUN/tests/performance/${test}/riscv/${TARGET}/${TARGET}.out"
+            # Collect the time from the benchmark records of the output file
+            riscv_time=$(bench_time "$riscv_out" "${test}" "${run}")
 
-        # Collect average performance data from the output file
-        riscv_time=$(grep "RISC-V vector function" "$riscv_out" | awk '{print $6}' | awk '{count+=$1} END{print count/NR}')
+            # Write the run to the samples file
+            echo "${test},${run},${riscv_time}" >> "$samples_file"
+            times+=("${riscv_time}")
 
-        # Write the results to the log file
-        echo -e "${test},${riscv_time}" | tee -a "$log_file"
+        else
+            echo "Error: Invalid target specified: $TARGET"
+            usage
+        fi
+    done
 
-    else
-        echo "Error: Invalid target specified: $TARGET"
-        usage
+    # A function the target does not support (an UNSUPPORTED record, e.g. vqrdmlah on Armv8.0-A)
+    # has no time, which is left empty in the log file
+    if [ -z "$(printf '%s' "${times[@]}")" ]; then
+        echo "${test}," | tee -a "$log_file"
+        continue
     fi
+
+    # Write the median of the runs to the log file
+    time=$(printf '%s\n' "${times[@]}" | sort -g | awk '{t[NR] = $1} END {print (NR % 2) ? t[(NR + 1) / 2] : (t[NR / 2] + t[NR / 2 + 1]) / 2}')
+    echo -e "${test},${time}" | tee -a "$log_file"
 done
@@ -14,6 +14,10 @@
  * @param b The second input vector of type int16x4_t containing 16-bit signed integers.
  * @return int16x4_t The result of the element-wise addition, returned as an 16-bit signed integer vector.
  */
-int16x4_t vadd_s16_rvv(int16x4_t a, int16x4_t b) {
-    return __riscv_vadd_vv_i16m1(a, b, VLEN_4);
+RHAL_API int16x4_t vadd_s16_rvv(int16x4_t a, int16x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vadd_vv_i16mf2(a, b, VLEN_4);
+    #else
+        return __riscv_vadd_vv_i16m1(a, b, VLEN_4);
+    #endif
 }
@@ -14,6 +14,10 @@
  * @param b The second input vector of type int32x2_t containing 32-bit signed integers.
  * @return int32x2_t The result of the element-wise addition, returned as an 32-bit signed integer vector.
  */
-int32x2_t vadd_s32_rvv(int32x2_t a, int32x2_t b) {
-    return __riscv_vadd_vv_i32m1(a, b, VLEN_2);
+RHAL_API int32x2_t vadd_s32_rvv(int32x2_t a, int32x2_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vadd_vv_i32mf2(a, b, VLEN_2);
+    #else
+        return __riscv_vadd_vv_i32m1(a, b, VLEN_2);
+    #endif
 }
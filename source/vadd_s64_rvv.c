@@ -14,6 +14,6 @@
  * @param b The second input vector of type int64x1_t containing 64-bit signed integers.
  * @return int64x1_t The result of the element-wise addition, returned as an 64-bit signed integer vector.
  */
-int64x1_t vadd_s64_rvv(int64x1_t a, int64x1_t b) {
+RHAL_API int64x1_t vadd_s64_rvv(int64x1_t a, int64x1_t b) {
     return __riscv_vadd_vv_i64m1(a, b, VLEN_1);
 }
@@ -14,6 +14,10 @@
  * @param b The second input vector of type uint8x8_t containing 8-bit unsigned integers.
  * @return uint8x8_t The result of the element-wise addition, returned as an 8-bit unsigned integer vector.
  */
-uint8x8_t vadd_u8_rvv(uint8x8_t a, uint8x8_t b) {
-    return __riscv_vadd_vv_u8m1(a, b, VLEN_8);
+RHAL_API uint8x8_t vadd_u8_rvv(uint8x8_t a, uint8x8_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vadd_vv_u8mf2(a, b, VLEN_8);
+    #else
+        return __riscv_vadd_vv_u8m1(a, b, VLEN_8);
+    #endif
 }
@@ -16,6 +16,10 @@
  * @return int8x8_t The narrowed result of the element-wise addition, where each element is an 8-bit signed integer 
  * extracted from the most significant half of the corresponding 16-bit sum.
  */
-int8x8_t vaddhn_s16_rvv(int16x8_t a, int16x8_t b) {
-    return __riscv_vlmul_ext_v_i8mf2_i8m1(__riscv_vnsra_wx_i8mf2(__riscv_vadd_vv_i16m1(a, b, VLEN_8), 8, VLEN_8));
+RHAL_API int8x8_t vaddhn_s16_rvv(int16x8_t a, int16x8_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsra_wx_i8mf2(__riscv_vadd_vv_i16m1(a, b, VLEN_8), 8, VLEN_8);
+    #else
+        return __riscv_vlmul_ext_v_i8mf2_i8m1(__riscv_vnsra_wx_i8mf2(__riscv_vadd_vv_i16m1(a, b, VLEN_8), 8, VLEN_8));
+    #endif
 }
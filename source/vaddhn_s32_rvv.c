@@ -16,6 +16,10 @@
  * @return int16x4_t The narrowed result of the element-wise addition, where each element is an 16-bit signed integer 
  * extracted from the most significant half of the corresponding 32-bit sum.
  */
-int16x4_t vaddhn_s32_rvv(int32x4_t a, int32x4_t b) {
-    return __riscv_vlmul_ext_v_i16mf2_i16m1(__riscv_vnsra_wx_i16mf2(__riscv_vadd_vv_i32m1(a, b, VLEN_4), 16, VLEN_4));
+RHAL_API int16x4_t vaddhn_s32_rvv(int32x4_t a, int32x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsra_wx_i16mf2(__riscv_vadd_vv_i32m1(a, b, VLEN_4), 16, VLEN_4);
+    #else
+        return __riscv_vlmul_ext_v_i16mf2_i16m1(__riscv_vnsra_wx_i16mf2(__riscv_vadd_vv_i32m1(a, b, VLEN_4), 16, VLEN_4));
+    #endif
 }
@@ -16,6 +16,10 @@
  * @return uint32x2_t The narrowed result of the element-wise addition, where each element is an 32-bit unsigned integer 
  * extracted from the most significant half of the corresponding 64-bit sum.
  */
-uint32x2_t vaddhn_u64_rvv(uint64x2_t a, uint64x2_t b) {
-    return __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnsrl_wx_u32mf2(__riscv_vadd_vv_u64m1(a, b, VLEN_2), 32, VLEN_2));
+RHAL_API uint32x2_t vaddhn_u64_rvv(uint64x2_t a, uint64x2_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsrl_wx_u32mf2(__riscv_vadd_vv_u64m1(a, b, VLEN_2), 32, VLEN_2);
+    #else
+        return __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnsrl_wx_u32mf2(__riscv_vadd_vv_u64m1(a, b, VLEN_2), 32, VLEN_2));
+    #endif
 }
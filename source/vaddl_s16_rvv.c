@@ -15,6 +15,10 @@
  * @param b The second input vector of type int16x4_t containing 16-bit signed integers.
  * @return int32x4_t The result of the element-wise addition, returned as a vector of 32-bit signed integers.
  */
-int32x4_t vaddl_s16_rvv(int16x4_t a, int16x4_t b) {
-    return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwadd_vv_i32m2(a, b, VLEN_4));
+RHAL_API int32x4_t vaddl_s16_rvv(int16x4_t a, int16x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwadd_vv_i32m1(a, b, VLEN_4);
+    #else
+        return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwadd_vv_i32m2(a, b, VLEN_4));
+    #endif
 }
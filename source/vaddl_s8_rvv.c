@@ -15,6 +15,10 @@
  * @param b The second input vector of type int8x8_t containing 8-bit signed integers.
  * @return int16x8_t The result of the element-wise addition, returned as a vector of 16-bit signed integers.
  */
-int16x8_t vaddl_s8_rvv(int8x8_t a, int8x8_t b) {
-    return __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vwadd_vv_i16m2(a, b, VLEN_8));
+RHAL_API int16x8_t vaddl_s8_rvv(int8x8_t a, int8x8_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwadd_vv_i16m1(a, b, VLEN_8);
+    #else
+        return __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vwadd_vv_i16m2(a, b, VLEN_8));
+    #endif
 }
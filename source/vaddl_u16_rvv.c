@@ -15,6 +15,10 @@
  * @param b The second input vector of type uint16x4_t containing 16-bit unsigned integers.
  * @return uint32x4_t The result of the element-wise addition, returned as a vector of 32-bit unsigned integers.
  */
-uint32x4_t vaddl_u16_rvv(uint16x4_t a, uint16x4_t b) {
-    return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwaddu_vv_u32m2(a, b, VLEN_4));
+RHAL_API uint32x4_t vaddl_u16_rvv(uint16x4_t a, uint16x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwaddu_vv_u32m1(a, b, VLEN_4);
+    #else
+        return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwaddu_vv_u32m2(a, b, VLEN_4));
+    #endif
 }
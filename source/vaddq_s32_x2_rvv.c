@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Performs an element-wise addition of two pairs of 128-bit vectors of 32-bit signed integers.
+ * 
+ * This function performs the element-wise addition of `vaddq_s32` on two 128-bit vectors packed into
+ * each register (`a` and `b`, see vcombineq_s32_x2_rvv), i.e. on 8 elements with a single instruction.
+ * It requires VLEN >= 256 (rhal_paired_supported()). The result holds the sum of the low vectors
+ * in its low half and the sum of the high vectors in its high half.
+ * 
+ * @param a The first input pair of type int32x8_t containing 32-bit signed integers.
+ * @param b The second input pair of type int32x8_t containing 32-bit signed integers.
+ * @return int32x8_t The pair of results of the element-wise addition.
+ */
+RHAL_API int32x8_t vaddq_s32_x2_rvv(int32x8_t a, int32x8_t b) {
+    return __riscv_vadd_vv_i32m1(a, b, VLEN_8);
+}
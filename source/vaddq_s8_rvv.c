@@ -14,6 +14,6 @@
  * @param b The second input vector of type int8x16_t containing 8-bit signed integers.
  * @return int8x16_t The result of the element-wise addition, returned as an 8-bit signed integer vector.
  */
-int8x16_t vaddq_s8_rvv(int8x16_t a, int8x16_t b) {
+RHAL_API int8x16_t vaddq_s8_rvv(int8x16_t a, int8x16_t b) {
     return __riscv_vadd_vv_i8m1(a, b, VLEN_16);
 }
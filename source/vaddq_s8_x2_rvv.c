@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Performs an element-wise addition of two pairs of 128-bit vectors of 8-bit signed integers.
+ * 
+ * This function performs the element-wise addition of `vaddq_s8` on two 128-bit vectors packed into
+ * each register (`a` and `b`, see vcombineq_s8_x2_rvv), i.e. on 32 elements with a single instruction.
+ * It requires VLEN >= 256 (rhal_paired_supported()). The result holds the sum of the low vectors
+ * in its low half and the sum of the high vectors in its high half.
+ * 
+ * @param a The first input pair of type int8x32_t containing 8-bit signed integers.
+ * @param b The second input pair of type int8x32_t containing 8-bit signed integers.
+ * @return int8x32_t The pair of results of the element-wise addition.
+ */
+RHAL_API int8x32_t vaddq_s8_x2_rvv(int8x32_t a, int8x32_t b) {
+    return __riscv_vadd_vv_i8m1(a, b, VLEN_32);
+}
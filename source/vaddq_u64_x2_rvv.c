@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Performs an element-wise addition of two pairs of 128-bit vectors of 64-bit unsigned integers.
+ * 
+ * This function performs the element-wise addition of `vaddq_u64` on two 128-bit vectors packed into
+ * each register (`a` and `b`, see vcombineq_u64_x2_rvv), i.e. on 4 elements with a single instruction.
+ * It requires VLEN >= 256 (rhal_paired_supported()). The result holds the sum of the low vectors
+ * in its low half and the sum of the high vectors in its high half.
+ * 
+ * @param a The first input pair of type uint64x4_t containing 64-bit unsigned integers.
+ * @param b The second input pair of type uint64x4_t containing 64-bit unsigned integers.
+ * @return uint64x4_t The pair of results of the element-wise addition.
+ */
+RHAL_API uint64x4_t vaddq_u64_x2_rvv(uint64x4_t a, uint64x4_t b) {
+    return __riscv_vadd_vv_u64m1(a, b, VLEN_4);
+}
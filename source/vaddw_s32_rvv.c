@@ -17,6 +17,10 @@
  * @param b The second input vector of type int32x2_t containing 32-bit signed integers.
  * @return int64x2_t The result of the element-wise addition, returned as a vector of 64-bit signed integers.
  */
-int64x2_t vaddw_s32_rvv(int64x2_t a, int32x2_t b) {
-    return __riscv_vadd_vv_i64m1(a , __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwadd_vx_i64m2(b, 0, VLEN_2)), VLEN_2);
+RHAL_API int64x2_t vaddw_s32_rvv(int64x2_t a, int32x2_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwadd_wv_i64m1(a, b, VLEN_2);
+    #else
+        return __riscv_vwadd_wv_i64m1(a, __riscv_vlmul_trunc_v_i32m1_i32mf2(b), VLEN_2);
+    #endif
 }
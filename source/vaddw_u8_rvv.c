@@ -17,6 +17,10 @@
  * @param b The second input vector of type uint8x8_t containing 8-bit unsigned integers.
  * @return int16x8_t The result of the element-wise addition, returned as a vector of 16-bit unsigned integers.
  */
-uint16x8_t vaddw_u8_rvv(uint16x8_t a, uint8x8_t b) {
-    return __riscv_vadd_vv_u16m1(a , __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vwaddu_vx_u16m2(b, 0, VLEN_8)), VLEN_8);
+RHAL_API uint16x8_t vaddw_u8_rvv(uint16x8_t a, uint8x8_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwaddu_wv_u16m1(a, b, VLEN_8);
+    #else
+        return __riscv_vwaddu_wv_u16m1(a, __riscv_vlmul_trunc_v_u8m1_u8mf2(b), VLEN_8);
+    #endif
 }
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Packs two 128-bit vectors of 32-bit signed integers into one register.
+ * 
+ * This function places `low` in elements 0 to 3 and `high` in elements 4 to 7 of a single
+ * register by sliding `high` up by 4 elements, so that the paired `*_s32_x2_rvv` functions can process
+ * both vectors at once. It requires VLEN >= 256 (rhal_paired_supported()).
+ * 
+ * @param low The vector of type int32x4_t for the low half.
+ * @param high The vector of type int32x4_t for the high half.
+ * @return int32x8_t The pair of vectors.
+ */
+RHAL_API int32x8_t vcombineq_s32_x2_rvv(int32x4_t low, int32x4_t high) {
+    return __riscv_vslideup_vx_i32m1(low, high, 4, VLEN_8);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Packs two 128-bit vectors of 64-bit signed integers into one register.
+ * 
+ * This function places `low` in elements 0 to 1 and `high` in elements 2 to 3 of a single
+ * register by sliding `high` up by 2 elements, so that the paired `*_s64_x2_rvv` functions can process
+ * both vectors at once. It requires VLEN >= 256 (rhal_paired_supported()).
+ * 
+ * @param low The vector of type int64x2_t for the low half.
+ * @param high The vector of type int64x2_t for the high half.
+ * @return int64x4_t The pair of vectors.
+ */
+RHAL_API int64x4_t vcombineq_s64_x2_rvv(int64x2_t low, int64x2_t high) {
+    return __riscv_vslideup_vx_i64m1(low, high, 2, VLEN_4);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Packs two 128-bit vectors of 16-bit unsigned integers into one register.
+ * 
+ * This function places `low` in elements 0 to 7 and `high` in elements 8 to 15 of a single
+ * register by sliding `high` up by 8 elements, so that the paired `*_u16_x2_rvv` functions can process
+ * both vectors at once. It requires VLEN >= 256 (rhal_paired_supported()).
+ * 
+ * @param low The vector of type uint16x8_t for the low half.
+ * @param high The vector of type uint16x8_t for the high half.
+ * @return uint16x16_t The pair of vectors.
+ */
+RHAL_API uint16x16_t vcombineq_u16_x2_rvv(uint16x8_t low, uint16x8_t high) {
+    return __riscv_vslideup_vx_u16m1(low, high, 8, VLEN_16);
+}
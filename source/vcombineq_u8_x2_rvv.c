@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Packs two 128-bit vectors of 8-bit unsigned integers into one register.
+ * 
+ * This function places `low` in elements 0 to 15 and `high` in elements 16 to 31 of a single
+ * register by sliding `high` up by 16 elements, so that the paired `*_u8_x2_rvv` functions can process
+ * both vectors at once. It requires VLEN >= 256 (rhal_paired_supported()).
+ * 
+ * @param low The vector of type uint8x16_t for the low half.
+ * @param high The vector of type uint8x16_t for the high half.
+ * @return uint8x32_t The pair of vectors.
+ */
+RHAL_API uint8x32_t vcombineq_u8_x2_rvv(uint8x16_t low, uint8x16_t high) {
+    return __riscv_vslideup_vx_u8m1(low, high, 16, VLEN_32);
+}
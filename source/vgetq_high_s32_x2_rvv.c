@@ -0,0 +1,15 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the high 128-bit vector of 32-bit signed integers of a pair.
+ * 
+ * This function slides elements 4 to 7 of the pair down to elements 0 to 3.
+ * 
+ * @param p The pair of type int32x8_t.
+ * @return int32x4_t The vector in the high half of the pair.
+ */
+RHAL_API int32x4_t vgetq_high_s32_x2_rvv(int32x8_t p) {
+    return __riscv_vslidedown_vx_i32m1(p, 4, VLEN_4);
+}
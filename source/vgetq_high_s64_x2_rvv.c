@@ -0,0 +1,15 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the high 128-bit vector of 64-bit signed integers of a pair.
+ * 
+ * This function slides elements 2 to 3 of the pair down to elements 0 to 1.
+ * 
+ * @param p The pair of type int64x4_t.
+ * @return int64x2_t The vector in the high half of the pair.
+ */
+RHAL_API int64x2_t vgetq_high_s64_x2_rvv(int64x4_t p) {
+    return __riscv_vslidedown_vx_i64m1(p, 2, VLEN_2);
+}
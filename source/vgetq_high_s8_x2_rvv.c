@@ -0,0 +1,15 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the high 128-bit vector of 8-bit signed integers of a pair.
+ * 
+ * This function slides elements 16 to 31 of the pair down to elements 0 to 15.
+ * 
+ * @param p The pair of type int8x32_t.
+ * @return int8x16_t The vector in the high half of the pair.
+ */
+RHAL_API int8x16_t vgetq_high_s8_x2_rvv(int8x32_t p) {
+    return __riscv_vslidedown_vx_i8m1(p, 16, VLEN_16);
+}
@@ -0,0 +1,15 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the high 128-bit vector of 16-bit unsigned integers of a pair.
+ * 
+ * This function slides elements 8 to 15 of the pair down to elements 0 to 7.
+ * 
+ * @param p The pair of type uint16x16_t.
+ * @return uint16x8_t The vector in the high half of the pair.
+ */
+RHAL_API uint16x8_t vgetq_high_u16_x2_rvv(uint16x16_t p) {
+    return __riscv_vslidedown_vx_u16m1(p, 8, VLEN_8);
+}
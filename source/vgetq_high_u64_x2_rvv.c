@@ -0,0 +1,15 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the high 128-bit vector of 64-bit unsigned integers of a pair.
+ * 
+ * This function slides elements 2 to 3 of the pair down to elements 0 to 1.
+ * 
+ * @param p The pair of type uint64x4_t.
+ * @return uint64x2_t The vector in the high half of the pair.
+ */
+RHAL_API uint64x2_t vgetq_high_u64_x2_rvv(uint64x4_t p) {
+    return __riscv_vslidedown_vx_u64m1(p, 2, VLEN_2);
+}
@@ -0,0 +1,15 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the high 128-bit vector of 8-bit unsigned integers of a pair.
+ * 
+ * This function slides elements 16 to 31 of the pair down to elements 0 to 15.
+ * 
+ * @param p The pair of type uint8x32_t.
+ * @return uint8x16_t The vector in the high half of the pair.
+ */
+RHAL_API uint8x16_t vgetq_high_u8_x2_rvv(uint8x32_t p) {
+    return __riscv_vslidedown_vx_u8m1(p, 16, VLEN_16);
+}
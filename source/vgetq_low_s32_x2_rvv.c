@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the low 128-bit vector of 32-bit signed integers of a pair.
+ * 
+ * The low vector already occupies elements 0 to 3 of the register, and the 128-bit functions
+ * ignore the elements above them, so this function only changes the type.
+ * 
+ * @param p The pair of type int32x8_t.
+ * @return int32x4_t The vector in the low half of the pair.
+ */
+RHAL_API int32x4_t vgetq_low_s32_x2_rvv(int32x8_t p) {
+    return p;
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the low 128-bit vector of 16-bit unsigned integers of a pair.
+ * 
+ * The low vector already occupies elements 0 to 7 of the register, and the 128-bit functions
+ * ignore the elements above them, so this function only changes the type.
+ * 
+ * @param p The pair of type uint16x16_t.
+ * @return uint16x8_t The vector in the low half of the pair.
+ */
+RHAL_API uint16x8_t vgetq_low_u16_x2_rvv(uint16x16_t p) {
+    return p;
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the low 128-bit vector of 64-bit unsigned integers of a pair.
+ * 
+ * The low vector already occupies elements 0 to 1 of the register, and the 128-bit functions
+ * ignore the elements above them, so this function only changes the type.
+ * 
+ * @param p The pair of type uint64x4_t.
+ * @return uint64x2_t The vector in the low half of the pair.
+ */
+RHAL_API uint64x2_t vgetq_low_u64_x2_rvv(uint64x4_t p) {
+    return p;
+}
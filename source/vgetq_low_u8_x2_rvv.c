@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Returns the low 128-bit vector of 8-bit unsigned integers of a pair.
+ * 
+ * The low vector already occupies elements 0 to 15 of the register, and the 128-bit functions
+ * ignore the elements above them, so this function only changes the type.
+ * 
+ * @param p The pair of type uint8x32_t.
+ * @return uint8x16_t The vector in the low half of the pair.
+ */
+RHAL_API uint8x16_t vgetq_low_u8_x2_rvv(uint8x32_t p) {
+    return p;
+}
@@ -16,6 +16,14 @@
  * @param b The second input vector of type uint8x8_t containing 8-bit unsigned integers.
  * @return uint8x8_t The result of the halving addition, returned as an 8-bit unsigned integer vector.
  */
-uint8x8_t vhadd_u8_rvv(uint8x8_t a, uint8x8_t b) {
-    return __riscv_vnsrl_wx_u8m1( __riscv_vwaddu_vv_u16m2(a, b, VLEN_8), 1, VLEN_8);
+RHAL_API uint8x8_t vhadd_u8_rvv(uint8x8_t a, uint8x8_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaaddu_vv_u8mf2(a, b, __RISCV_VXRM_RDN, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaaddu_vv_u8m1(a, b, __RISCV_VXRM_RDN, VLEN_8);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsrl_wx_u8mf2( __riscv_vwaddu_vv_u16m1(a, b, VLEN_8), 1, VLEN_8);
+    #else
+        return __riscv_vnsrl_wx_u8m1( __riscv_vwaddu_vv_u16m2(a, b, VLEN_8), 1, VLEN_8);
+    #endif
 }
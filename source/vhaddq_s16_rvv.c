@@ -16,6 +16,10 @@
  * @param b The second input vector of type int16x8_t containing eight 16-bit signed integers.
  * @return int16x8_t The result of the halving addition, returned as a 128-bit vector of eight 16-bit signed integers.
  */
-int16x8_t vhaddq_s16_rvv(int16x8_t a, int16x8_t b) {
-    return __riscv_vnsra_wx_i16m1( __riscv_vwadd_vv_i32m2(a, b, VLEN_8), 1, VLEN_8);
+RHAL_API int16x8_t vhaddq_s16_rvv(int16x8_t a, int16x8_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaadd_vv_i16m1(a, b, __RISCV_VXRM_RDN, VLEN_8);
+    #else
+        return __riscv_vnsra_wx_i16m1( __riscv_vwadd_vv_i32m2(a, b, VLEN_8), 1, VLEN_8);
+    #endif
 }
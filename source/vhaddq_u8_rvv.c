@@ -16,6 +16,10 @@
  * @param b The second input vector of type uint8x16_t containing sixteen 8-bit unsigned integers.
  * @return uint8x16_t The result of the halving addition, returned as a 128-bit vector of sixteen 8-bit unsigned integers.
  */
-uint8x16_t vhaddq_u8_rvv(uint8x16_t a, uint8x16_t b) {
-    return __riscv_vnsrl_wx_u8m1( __riscv_vwaddu_vv_u16m2(a, b, VLEN_16), 1, VLEN_16);
+RHAL_API uint8x16_t vhaddq_u8_rvv(uint8x16_t a, uint8x16_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaaddu_vv_u8m1(a, b, __RISCV_VXRM_RDN, VLEN_16);
+    #else
+        return __riscv_vnsrl_wx_u8m1( __riscv_vwaddu_vv_u16m2(a, b, VLEN_16), 1, VLEN_16);
+    #endif
 }
@@ -16,6 +16,14 @@
  * @param b The second input vector of type int16x4_t containing 16-bit signed integers.
  * @return int16x4_t The result of the halving subtraction, returned as an 16-bit signed integer vector.
  */
-int16x4_t vhsub_s16_rvv(int16x4_t a, int16x4_t b) {
-    return __riscv_vnsra_wx_i16m1( __riscv_vwsub_vv_i32m2(a, b, VLEN_4), 1, VLEN_4);
+RHAL_API int16x4_t vhsub_s16_rvv(int16x4_t a, int16x4_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vasub_vv_i16mf2(a, b, __RISCV_VXRM_RDN, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vasub_vv_i16m1(a, b, __RISCV_VXRM_RDN, VLEN_4);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsra_wx_i16mf2( __riscv_vwsub_vv_i32m1(a, b, VLEN_4), 1, VLEN_4);
+    #else
+        return __riscv_vnsra_wx_i16m1( __riscv_vwsub_vv_i32m2(a, b, VLEN_4), 1, VLEN_4);
+    #endif
 }
@@ -16,6 +16,14 @@
  * @param b The second input vector of type int32x2_t containing 32-bit signed integers.
  * @return int32x2_t The result of the halving subtraction, returned as an 32-bit signed integer vector.
  */
-int32x2_t vhsub_s32_rvv(int32x2_t a, int32x2_t b) {
-    return __riscv_vnsra_wx_i32m1( __riscv_vwsub_vv_i64m2(a, b, VLEN_2), 1, VLEN_2);
+RHAL_API int32x2_t vhsub_s32_rvv(int32x2_t a, int32x2_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vasub_vv_i32mf2(a, b, __RISCV_VXRM_RDN, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vasub_vv_i32m1(a, b, __RISCV_VXRM_RDN, VLEN_2);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsra_wx_i32mf2( __riscv_vwsub_vv_i64m1(a, b, VLEN_2), 1, VLEN_2);
+    #else
+        return __riscv_vnsra_wx_i32m1( __riscv_vwsub_vv_i64m2(a, b, VLEN_2), 1, VLEN_2);
+    #endif
 }
@@ -16,6 +16,14 @@
  * @param b The second input vector of type int8x8_t containing 8-bit signed integers.
  * @return int8x8_t The result of the halving subtraction, returned as an 8-bit signed integer vector.
  */
-int8x8_t vhsub_s8_rvv(int8x8_t a, int8x8_t b) {
-    return __riscv_vnsra_wx_i8m1( __riscv_vwsub_vv_i16m2(a, b, VLEN_8), 1, VLEN_8);
+RHAL_API int8x8_t vhsub_s8_rvv(int8x8_t a, int8x8_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vasub_vv_i8mf2(a, b, __RISCV_VXRM_RDN, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vasub_vv_i8m1(a, b, __RISCV_VXRM_RDN, VLEN_8);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsra_wx_i8mf2( __riscv_vwsub_vv_i16m1(a, b, VLEN_8), 1, VLEN_8);
+    #else
+        return __riscv_vnsra_wx_i8m1( __riscv_vwsub_vv_i16m2(a, b, VLEN_8), 1, VLEN_8);
+    #endif
 }
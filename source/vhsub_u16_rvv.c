@@ -16,6 +16,14 @@
  * @param b The second input vector of type uint16x4_t containing 16-bit unsigned integers.
  * @return uint16x4_t The result of the halving subtraction, returned as an 16-bit unsigned integer vector.
  */
-uint16x4_t vhsub_u16_rvv(uint16x4_t a, uint16x4_t b) {
-    return __riscv_vnsrl_wx_u16m1( __riscv_vwsubu_vv_u32m2(a, b, VLEN_4), 1, VLEN_4);
+RHAL_API uint16x4_t vhsub_u16_rvv(uint16x4_t a, uint16x4_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vasubu_vv_u16mf2(a, b, __RISCV_VXRM_RDN, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vasubu_vv_u16m1(a, b, __RISCV_VXRM_RDN, VLEN_4);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsrl_wx_u16mf2( __riscv_vwsubu_vv_u32m1(a, b, VLEN_4), 1, VLEN_4);
+    #else
+        return __riscv_vnsrl_wx_u16m1( __riscv_vwsubu_vv_u32m2(a, b, VLEN_4), 1, VLEN_4);
+    #endif
 }
@@ -16,6 +16,14 @@
  * @param b The second input vector of type uint32x2_t containing 32-bit unsigned integers.
  * @return uint32x2_t The result of the halving subtraction, returned as an 32-bit unsigned integer vector.
  */
-uint32x2_t vhsub_u32_rvv(uint32x2_t a, uint32x2_t b) {
-    return __riscv_vnsrl_wx_u32m1( __riscv_vwsubu_vv_u64m2(a, b, VLEN_2), 1, VLEN_2);
+RHAL_API uint32x2_t vhsub_u32_rvv(uint32x2_t a, uint32x2_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vasubu_vv_u32mf2(a, b, __RISCV_VXRM_RDN, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vasubu_vv_u32m1(a, b, __RISCV_VXRM_RDN, VLEN_2);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsrl_wx_u32mf2( __riscv_vwsubu_vv_u64m1(a, b, VLEN_2), 1, VLEN_2);
+    #else
+        return __riscv_vnsrl_wx_u32m1( __riscv_vwsubu_vv_u64m2(a, b, VLEN_2), 1, VLEN_2);
+    #endif
 }
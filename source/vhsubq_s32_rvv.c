@@ -16,6 +16,10 @@
  * @param b The second input vector of type int32x4_t containing four 32-bit signed integers.
  * @return int32x4_t The result of the halving subtraction, returned as a 128-bit vector of four 32-bit signed integers.
  */
-int32x4_t vhsubq_s32_rvv(int32x4_t a, int32x4_t b) {
-    return __riscv_vnsra_wx_i32m1( __riscv_vwsub_vv_i64m2(a, b, VLEN_4), 1, VLEN_4);
+RHAL_API int32x4_t vhsubq_s32_rvv(int32x4_t a, int32x4_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vasub_vv_i32m1(a, b, __RISCV_VXRM_RDN, VLEN_4);
+    #else
+        return __riscv_vnsra_wx_i32m1( __riscv_vwsub_vv_i64m2(a, b, VLEN_4), 1, VLEN_4);
+    #endif
 }
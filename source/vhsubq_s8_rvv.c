@@ -16,6 +16,10 @@
  * @param b The second input vector of type int8x16_t containing sixteen 8-bit signed integers.
  * @return int8x16_t The result of the halving subtraction, returned as a 128-bit vector of sixteen 8-bit signed integers.
  */
-int8x16_t vhsubq_s8_rvv(int8x16_t a, int8x16_t b) {
-    return __riscv_vnsra_wx_i8m1( __riscv_vwsub_vv_i16m2(a, b, VLEN_16), 1, VLEN_16);
+RHAL_API int8x16_t vhsubq_s8_rvv(int8x16_t a, int8x16_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vasub_vv_i8m1(a, b, __RISCV_VXRM_RDN, VLEN_16);
+    #else
+        return __riscv_vnsra_wx_i8m1( __riscv_vwsub_vv_i16m2(a, b, VLEN_16), 1, VLEN_16);
+    #endif
 }
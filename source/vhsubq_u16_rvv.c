@@ -16,6 +16,10 @@
  * @param b The second input vector of type uint16x8_t containing eight 16-bit unsigned integers.
  * @return uint16x8_t The result of the halving subtraction, returned as a 128-bit vector of eight 16-bit unsigned integers.
  */
-uint16x8_t vhsubq_u16_rvv(uint16x8_t a, uint16x8_t b) {
-    return __riscv_vnsrl_wx_u16m1( __riscv_vwsubu_vv_u32m2(a, b, VLEN_8), 1, VLEN_8);
+RHAL_API uint16x8_t vhsubq_u16_rvv(uint16x8_t a, uint16x8_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vasubu_vv_u16m1(a, b, __RISCV_VXRM_RDN, VLEN_8);
+    #else
+        return __riscv_vnsrl_wx_u16m1( __riscv_vwsubu_vv_u32m2(a, b, VLEN_8), 1, VLEN_8);
+    #endif
 }
@@ -16,6 +16,10 @@
  * @param b The second input vector of type uint32x4_t containing four 32-bit unsigned integers.
  * @return uint32x4_t The result of the halving subtraction, returned as a 128-bit vector of four 32-bit unsigned integers.
  */
-uint32x4_t vhsubq_u32_rvv(uint32x4_t a, uint32x4_t b) {
-    return __riscv_vnsrl_wx_u32m1( __riscv_vwsubu_vv_u64m2(a, b, VLEN_4), 1, VLEN_4);
+RHAL_API uint32x4_t vhsubq_u32_rvv(uint32x4_t a, uint32x4_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vasubu_vv_u32m1(a, b, __RISCV_VXRM_RDN, VLEN_4);
+    #else
+        return __riscv_vnsrl_wx_u32m1( __riscv_vwsubu_vv_u64m2(a, b, VLEN_4), 1, VLEN_4);
+    #endif
 }
@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 16-bit signed integers from memory into all lanes of a 64-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 4 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1_dup_s16`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return int16x4_t A vector with the loaded element in every lane.
+ */
+RHAL_API int16x4_t vld1_dup_s16_rvv(const int16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmv_v_x_i16mf2(*ptr, VLEN_4);
+    #else
+        return __riscv_vmv_v_x_i16m1(*ptr, VLEN_4);
+    #endif
+}
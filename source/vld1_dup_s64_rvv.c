@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 64-bit signed integers from memory into all lanes of a 64-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 1 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1_dup_s64`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return int64x1_t A vector with the loaded element in every lane.
+ */
+RHAL_API int64x1_t vld1_dup_s64_rvv(const int64_t *ptr) {
+    return __riscv_vmv_v_x_i64m1(*ptr, VLEN_1);
+}
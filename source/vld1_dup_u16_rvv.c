@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 16-bit unsigned integers from memory into all lanes of a 64-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 4 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1_dup_u16`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return uint16x4_t A vector with the loaded element in every lane.
+ */
+RHAL_API uint16x4_t vld1_dup_u16_rvv(const uint16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmv_v_x_u16mf2(*ptr, VLEN_4);
+    #else
+        return __riscv_vmv_v_x_u16m1(*ptr, VLEN_4);
+    #endif
+}
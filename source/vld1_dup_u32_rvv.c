@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 32-bit unsigned integers from memory into all lanes of a 64-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 2 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1_dup_u32`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return uint32x2_t A vector with the loaded element in every lane.
+ */
+RHAL_API uint32x2_t vld1_dup_u32_rvv(const uint32_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmv_v_x_u32mf2(*ptr, VLEN_2);
+    #else
+        return __riscv_vmv_v_x_u32m1(*ptr, VLEN_2);
+    #endif
+}
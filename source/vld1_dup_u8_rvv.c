@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 8-bit unsigned integers from memory into all lanes of a 64-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 8 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1_dup_u8`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return uint8x8_t A vector with the loaded element in every lane.
+ */
+RHAL_API uint8x8_t vld1_dup_u8_rvv(const uint8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmv_v_x_u8mf2(*ptr, VLEN_8);
+    #else
+        return __riscv_vmv_v_x_u8m1(*ptr, VLEN_8);
+    #endif
+}
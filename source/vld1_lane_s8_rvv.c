@@ -0,0 +1,25 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 8-bit signed integers from memory into a lane of a 64-bit vector.
+ *
+ * This function returns `src` with element `lane` replaced by the element at `ptr`, analogous to the
+ * ARM Neon function `vld1_lane_s8`. The lane is selected with a mask comparing the element indices
+ * with `lane`, and the element merged in with `vmerge.vxm`, which keeps the default tail-agnostic policy.
+ *
+ * @param ptr Pointer to the element to load.
+ * @param src The vector of type int8x8_t to insert the element into.
+ * @param lane The lane to replace, from 0 to 7.
+ * @return int8x8_t The vector `src` with the loaded element in lane `lane`.
+ */
+RHAL_API int8x8_t vld1_lane_s8_rvv(const int8_t *ptr, int8x8_t src, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vbool16_t mask = __riscv_vmseq_vx_u8mf2_b16(__riscv_vid_v_u8mf2(VLEN_8), lane, VLEN_8);
+        return __riscv_vmerge_vxm_i8mf2(src, *ptr, mask, VLEN_8);
+    #else
+        vbool8_t mask = __riscv_vmseq_vx_u8m1_b8(__riscv_vid_v_u8m1(VLEN_8), lane, VLEN_8);
+        return __riscv_vmerge_vxm_i8m1(src, *ptr, mask, VLEN_8);
+    #endif
+}
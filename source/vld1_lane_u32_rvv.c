@@ -0,0 +1,25 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 32-bit unsigned integers from memory into a lane of a 64-bit vector.
+ *
+ * This function returns `src` with element `lane` replaced by the element at `ptr`, analogous to the
+ * ARM Neon function `vld1_lane_u32`. The lane is selected with a mask comparing the element indices
+ * with `lane`, and the element merged in with `vmerge.vxm`, which keeps the default tail-agnostic policy.
+ *
+ * @param ptr Pointer to the element to load.
+ * @param src The vector of type uint32x2_t to insert the element into.
+ * @param lane The lane to replace, from 0 to 1.
+ * @return uint32x2_t The vector `src` with the loaded element in lane `lane`.
+ */
+RHAL_API uint32x2_t vld1_lane_u32_rvv(const uint32_t *ptr, uint32x2_t src, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vbool64_t mask = __riscv_vmseq_vx_u32mf2_b64(__riscv_vid_v_u32mf2(VLEN_2), lane, VLEN_2);
+        return __riscv_vmerge_vxm_u32mf2(src, *ptr, mask, VLEN_2);
+    #else
+        vbool32_t mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vid_v_u32m1(VLEN_2), lane, VLEN_2);
+        return __riscv_vmerge_vxm_u32m1(src, *ptr, mask, VLEN_2);
+    #endif
+}
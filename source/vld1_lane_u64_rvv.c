@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 64-bit unsigned integers from memory into a lane of a 64-bit vector.
+ *
+ * This function returns `src` with element `lane` replaced by the element at `ptr`, analogous to the
+ * ARM Neon function `vld1_lane_u64`. The lane is selected with a mask comparing the element indices
+ * with `lane`, and the element merged in with `vmerge.vxm`, which keeps the default tail-agnostic policy.
+ *
+ * @param ptr Pointer to the element to load.
+ * @param src The vector of type uint64x1_t to insert the element into.
+ * @param lane The lane to replace, from 0 to 0.
+ * @return uint64x1_t The vector `src` with the loaded element in lane `lane`.
+ */
+RHAL_API uint64x1_t vld1_lane_u64_rvv(const uint64_t *ptr, uint64x1_t src, const int lane) {
+    vbool64_t mask = __riscv_vmseq_vx_u64m1_b64(__riscv_vid_v_u64m1(VLEN_1), lane, VLEN_1);
+    return __riscv_vmerge_vxm_u64m1(src, *ptr, mask, VLEN_1);
+}
@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 64-bit vector of 16-bit signed integers from memory.
+ *
+ * This function loads 4 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1_s16`.
+ *
+ * @param ptr Pointer to the 4 elements to load.
+ * @return int16x4_t The loaded vector.
+ */
+RHAL_API int16x4_t vld1_s16_rvv(const int16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vle16_v_i16mf2(ptr, VLEN_4);
+    #else
+        return __riscv_vle16_v_i16m1(ptr, VLEN_4);
+    #endif
+}
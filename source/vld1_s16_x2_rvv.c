@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 64-bit vectors of 16-bit signed integers from memory.
+ *
+ * This function loads the 8 elements at `ptr` with a single unit-stride load of LMUL=1 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1_s16_x2`.
+ * Vector i is slid down from element 4 * i of the group.
+ *
+ * @param ptr Pointer to the 8 elements to load.
+ * @return int16x4x2_t The two loaded vectors.
+ */
+RHAL_API int16x4x2_t vld1_s16_x2_rvv(const int16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint16m1_t v = __riscv_vle16_v_i16m1(ptr, VLEN_8);
+        int16x4x2_t r = __riscv_vundefined_i16mf2x2();
+        r = __riscv_vset_v_i16mf2_i16mf2x2(r, 0, __riscv_vlmul_trunc_v_i16m1_i16mf2(v));
+        r = __riscv_vset_v_i16mf2_i16mf2x2(r, 1, __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(v, 4, VLEN_8)));
+        return r;
+    #else
+        vint16m1_t v = __riscv_vle16_v_i16m1(ptr, VLEN_8);
+        int16x4x2_t r = __riscv_vundefined_i16m1x2();
+        r = __riscv_vset_v_i16m1_i16m1x2(r, 0, v);
+        r = __riscv_vset_v_i16m1_i16m1x2(r, 1, __riscv_vslidedown_vx_i16m1(v, 4, VLEN_8));
+        return r;
+    #endif
+}
@@ -0,0 +1,33 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 64-bit vectors of 16-bit signed integers from memory.
+ *
+ * This function loads the 16 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1_s16_x4`.
+ * Vector i is slid down from element 4 * i of the group.
+ *
+ * @param ptr Pointer to the 16 elements to load.
+ * @return int16x4x4_t The four loaded vectors.
+ */
+RHAL_API int16x4x4_t vld1_s16_x4_rvv(const int16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint16m2_t v = __riscv_vle16_v_i16m2(ptr, VLEN_16);
+        int16x4x4_t r = __riscv_vundefined_i16mf2x4();
+        r = __riscv_vset_v_i16mf2_i16mf2x4(r, 0, __riscv_vlmul_trunc_v_i16m2_i16mf2(v));
+        r = __riscv_vset_v_i16mf2_i16mf2x4(r, 1, __riscv_vlmul_trunc_v_i16m2_i16mf2(__riscv_vslidedown_vx_i16m2(v, 4, VLEN_16)));
+        r = __riscv_vset_v_i16mf2_i16mf2x4(r, 2, __riscv_vlmul_trunc_v_i16m2_i16mf2(__riscv_vslidedown_vx_i16m2(v, 8, VLEN_16)));
+        r = __riscv_vset_v_i16mf2_i16mf2x4(r, 3, __riscv_vlmul_trunc_v_i16m2_i16mf2(__riscv_vslidedown_vx_i16m2(v, 12, VLEN_16)));
+        return r;
+    #else
+        vint16m2_t v = __riscv_vle16_v_i16m2(ptr, VLEN_16);
+        int16x4x4_t r = __riscv_vundefined_i16m1x4();
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 0, __riscv_vlmul_trunc_v_i16m2_i16m1(v));
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 1, __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vslidedown_vx_i16m2(v, 4, VLEN_16)));
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 2, __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vslidedown_vx_i16m2(v, 8, VLEN_16)));
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 3, __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vslidedown_vx_i16m2(v, 12, VLEN_16)));
+        return r;
+    #endif
+}
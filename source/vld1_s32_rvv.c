@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 64-bit vector of 32-bit signed integers from memory.
+ *
+ * This function loads 2 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1_s32`.
+ *
+ * @param ptr Pointer to the 2 elements to load.
+ * @return int32x2_t The loaded vector.
+ */
+RHAL_API int32x2_t vld1_s32_rvv(const int32_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vle32_v_i32mf2(ptr, VLEN_2);
+    #else
+        return __riscv_vle32_v_i32m1(ptr, VLEN_2);
+    #endif
+}
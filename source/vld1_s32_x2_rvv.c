@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 64-bit vectors of 32-bit signed integers from memory.
+ *
+ * This function loads the 4 elements at `ptr` with a single unit-stride load of LMUL=1 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1_s32_x2`.
+ * Vector i is slid down from element 2 * i of the group.
+ *
+ * @param ptr Pointer to the 4 elements to load.
+ * @return int32x2x2_t The two loaded vectors.
+ */
+RHAL_API int32x2x2_t vld1_s32_x2_rvv(const int32_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint32m1_t v = __riscv_vle32_v_i32m1(ptr, VLEN_4);
+        int32x2x2_t r = __riscv_vundefined_i32mf2x2();
+        r = __riscv_vset_v_i32mf2_i32mf2x2(r, 0, __riscv_vlmul_trunc_v_i32m1_i32mf2(v));
+        r = __riscv_vset_v_i32mf2_i32mf2x2(r, 1, __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(v, 2, VLEN_4)));
+        return r;
+    #else
+        vint32m1_t v = __riscv_vle32_v_i32m1(ptr, VLEN_4);
+        int32x2x2_t r = __riscv_vundefined_i32m1x2();
+        r = __riscv_vset_v_i32m1_i32m1x2(r, 0, v);
+        r = __riscv_vset_v_i32m1_i32m1x2(r, 1, __riscv_vslidedown_vx_i32m1(v, 2, VLEN_4));
+        return r;
+    #endif
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three consecutive 64-bit vectors of 32-bit signed integers from memory.
+ *
+ * This function loads the 6 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into three vectors, analogous to the ARM Neon function `vld1_s32_x3`.
+ * Vector i is slid down from element 2 * i of the group.
+ *
+ * @param ptr Pointer to the 6 elements to load.
+ * @return int32x2x3_t The three loaded vectors.
+ */
+RHAL_API int32x2x3_t vld1_s32_x3_rvv(const int32_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint32m2_t v = __riscv_vle32_v_i32m2(ptr, VLEN_6);
+        int32x2x3_t r = __riscv_vundefined_i32mf2x3();
+        r = __riscv_vset_v_i32mf2_i32mf2x3(r, 0, __riscv_vlmul_trunc_v_i32m2_i32mf2(v));
+        r = __riscv_vset_v_i32mf2_i32mf2x3(r, 1, __riscv_vlmul_trunc_v_i32m2_i32mf2(__riscv_vslidedown_vx_i32m2(v, 2, VLEN_6)));
+        r = __riscv_vset_v_i32mf2_i32mf2x3(r, 2, __riscv_vlmul_trunc_v_i32m2_i32mf2(__riscv_vslidedown_vx_i32m2(v, 4, VLEN_6)));
+        return r;
+    #else
+        vint32m2_t v = __riscv_vle32_v_i32m2(ptr, VLEN_6);
+        int32x2x3_t r = __riscv_vundefined_i32m1x3();
+        r = __riscv_vset_v_i32m1_i32m1x3(r, 0, __riscv_vlmul_trunc_v_i32m2_i32m1(v));
+        r = __riscv_vset_v_i32m1_i32m1x3(r, 1, __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vslidedown_vx_i32m2(v, 2, VLEN_6)));
+        r = __riscv_vset_v_i32m1_i32m1x3(r, 2, __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vslidedown_vx_i32m2(v, 4, VLEN_6)));
+        return r;
+    #endif
+}
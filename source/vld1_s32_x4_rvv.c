@@ -0,0 +1,33 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 64-bit vectors of 32-bit signed integers from memory.
+ *
+ * This function loads the 8 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1_s32_x4`.
+ * Vector i is slid down from element 2 * i of the group.
+ *
+ * @param ptr Pointer to the 8 elements to load.
+ * @return int32x2x4_t The four loaded vectors.
+ */
+RHAL_API int32x2x4_t vld1_s32_x4_rvv(const int32_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint32m2_t v = __riscv_vle32_v_i32m2(ptr, VLEN_8);
+        int32x2x4_t r = __riscv_vundefined_i32mf2x4();
+        r = __riscv_vset_v_i32mf2_i32mf2x4(r, 0, __riscv_vlmul_trunc_v_i32m2_i32mf2(v));
+        r = __riscv_vset_v_i32mf2_i32mf2x4(r, 1, __riscv_vlmul_trunc_v_i32m2_i32mf2(__riscv_vslidedown_vx_i32m2(v, 2, VLEN_8)));
+        r = __riscv_vset_v_i32mf2_i32mf2x4(r, 2, __riscv_vlmul_trunc_v_i32m2_i32mf2(__riscv_vslidedown_vx_i32m2(v, 4, VLEN_8)));
+        r = __riscv_vset_v_i32mf2_i32mf2x4(r, 3, __riscv_vlmul_trunc_v_i32m2_i32mf2(__riscv_vslidedown_vx_i32m2(v, 6, VLEN_8)));
+        return r;
+    #else
+        vint32m2_t v = __riscv_vle32_v_i32m2(ptr, VLEN_8);
+        int32x2x4_t r = __riscv_vundefined_i32m1x4();
+        r = __riscv_vset_v_i32m1_i32m1x4(r, 0, __riscv_vlmul_trunc_v_i32m2_i32m1(v));
+        r = __riscv_vset_v_i32m1_i32m1x4(r, 1, __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vslidedown_vx_i32m2(v, 2, VLEN_8)));
+        r = __riscv_vset_v_i32m1_i32m1x4(r, 2, __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vslidedown_vx_i32m2(v, 4, VLEN_8)));
+        r = __riscv_vset_v_i32m1_i32m1x4(r, 3, __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vslidedown_vx_i32m2(v, 6, VLEN_8)));
+        return r;
+    #endif
+}
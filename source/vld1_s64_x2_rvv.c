@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 64-bit vectors of 64-bit signed integers from memory.
+ *
+ * This function loads the 2 elements at `ptr` with a single unit-stride load of LMUL=1 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1_s64_x2`.
+ * Vector i is slid down from element 1 * i of the group.
+ *
+ * @param ptr Pointer to the 2 elements to load.
+ * @return int64x1x2_t The two loaded vectors.
+ */
+RHAL_API int64x1x2_t vld1_s64_x2_rvv(const int64_t *ptr) {
+    vint64m1_t v = __riscv_vle64_v_i64m1(ptr, VLEN_2);
+    int64x1x2_t r = __riscv_vundefined_i64m1x2();
+    r = __riscv_vset_v_i64m1_i64m1x2(r, 0, v);
+    r = __riscv_vset_v_i64m1_i64m1x2(r, 1, __riscv_vslidedown_vx_i64m1(v, 1, VLEN_2));
+    return r;
+}
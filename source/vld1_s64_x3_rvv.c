@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three consecutive 64-bit vectors of 64-bit signed integers from memory.
+ *
+ * This function loads the 3 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into three vectors, analogous to the ARM Neon function `vld1_s64_x3`.
+ * Vector i is slid down from element 1 * i of the group.
+ *
+ * @param ptr Pointer to the 3 elements to load.
+ * @return int64x1x3_t The three loaded vectors.
+ */
+RHAL_API int64x1x3_t vld1_s64_x3_rvv(const int64_t *ptr) {
+    vint64m2_t v = __riscv_vle64_v_i64m2(ptr, VLEN_3);
+    int64x1x3_t r = __riscv_vundefined_i64m1x3();
+    r = __riscv_vset_v_i64m1_i64m1x3(r, 0, __riscv_vlmul_trunc_v_i64m2_i64m1(v));
+    r = __riscv_vset_v_i64m1_i64m1x3(r, 1, __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vslidedown_vx_i64m2(v, 1, VLEN_3)));
+    r = __riscv_vset_v_i64m1_i64m1x3(r, 2, __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vslidedown_vx_i64m2(v, 2, VLEN_3)));
+    return r;
+}
@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 64-bit vectors of 64-bit signed integers from memory.
+ *
+ * This function loads the 4 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1_s64_x4`.
+ * Vector i is slid down from element 1 * i of the group.
+ *
+ * @param ptr Pointer to the 4 elements to load.
+ * @return int64x1x4_t The four loaded vectors.
+ */
+RHAL_API int64x1x4_t vld1_s64_x4_rvv(const int64_t *ptr) {
+    vint64m2_t v = __riscv_vle64_v_i64m2(ptr, VLEN_4);
+    int64x1x4_t r = __riscv_vundefined_i64m1x4();
+    r = __riscv_vset_v_i64m1_i64m1x4(r, 0, __riscv_vlmul_trunc_v_i64m2_i64m1(v));
+    r = __riscv_vset_v_i64m1_i64m1x4(r, 1, __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vslidedown_vx_i64m2(v, 1, VLEN_4)));
+    r = __riscv_vset_v_i64m1_i64m1x4(r, 2, __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vslidedown_vx_i64m2(v, 2, VLEN_4)));
+    r = __riscv_vset_v_i64m1_i64m1x4(r, 3, __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vslidedown_vx_i64m2(v, 3, VLEN_4)));
+    return r;
+}
@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 64-bit vectors of 8-bit signed integers from memory.
+ *
+ * This function loads the 16 elements at `ptr` with a single unit-stride load of LMUL=1 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1_s8_x2`.
+ * Vector i is slid down from element 8 * i of the group.
+ *
+ * @param ptr Pointer to the 16 elements to load.
+ * @return int8x8x2_t The two loaded vectors.
+ */
+RHAL_API int8x8x2_t vld1_s8_x2_rvv(const int8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint8m1_t v = __riscv_vle8_v_i8m1(ptr, VLEN_16);
+        int8x8x2_t r = __riscv_vundefined_i8mf2x2();
+        r = __riscv_vset_v_i8mf2_i8mf2x2(r, 0, __riscv_vlmul_trunc_v_i8m1_i8mf2(v));
+        r = __riscv_vset_v_i8mf2_i8mf2x2(r, 1, __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(v, 8, VLEN_16)));
+        return r;
+    #else
+        vint8m1_t v = __riscv_vle8_v_i8m1(ptr, VLEN_16);
+        int8x8x2_t r = __riscv_vundefined_i8m1x2();
+        r = __riscv_vset_v_i8m1_i8m1x2(r, 0, v);
+        r = __riscv_vset_v_i8m1_i8m1x2(r, 1, __riscv_vslidedown_vx_i8m1(v, 8, VLEN_16));
+        return r;
+    #endif
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three consecutive 64-bit vectors of 8-bit signed integers from memory.
+ *
+ * This function loads the 24 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into three vectors, analogous to the ARM Neon function `vld1_s8_x3`.
+ * Vector i is slid down from element 8 * i of the group.
+ *
+ * @param ptr Pointer to the 24 elements to load.
+ * @return int8x8x3_t The three loaded vectors.
+ */
+RHAL_API int8x8x3_t vld1_s8_x3_rvv(const int8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint8m2_t v = __riscv_vle8_v_i8m2(ptr, VLEN_24);
+        int8x8x3_t r = __riscv_vundefined_i8mf2x3();
+        r = __riscv_vset_v_i8mf2_i8mf2x3(r, 0, __riscv_vlmul_trunc_v_i8m2_i8mf2(v));
+        r = __riscv_vset_v_i8mf2_i8mf2x3(r, 1, __riscv_vlmul_trunc_v_i8m2_i8mf2(__riscv_vslidedown_vx_i8m2(v, 8, VLEN_24)));
+        r = __riscv_vset_v_i8mf2_i8mf2x3(r, 2, __riscv_vlmul_trunc_v_i8m2_i8mf2(__riscv_vslidedown_vx_i8m2(v, 16, VLEN_24)));
+        return r;
+    #else
+        vint8m2_t v = __riscv_vle8_v_i8m2(ptr, VLEN_24);
+        int8x8x3_t r = __riscv_vundefined_i8m1x3();
+        r = __riscv_vset_v_i8m1_i8m1x3(r, 0, __riscv_vlmul_trunc_v_i8m2_i8m1(v));
+        r = __riscv_vset_v_i8m1_i8m1x3(r, 1, __riscv_vlmul_trunc_v_i8m2_i8m1(__riscv_vslidedown_vx_i8m2(v, 8, VLEN_24)));
+        r = __riscv_vset_v_i8m1_i8m1x3(r, 2, __riscv_vlmul_trunc_v_i8m2_i8m1(__riscv_vslidedown_vx_i8m2(v, 16, VLEN_24)));
+        return r;
+    #endif
+}
@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 64-bit vectors of 16-bit unsigned integers from memory.
+ *
+ * This function loads the 8 elements at `ptr` with a single unit-stride load of LMUL=1 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1_u16_x2`.
+ * Vector i is slid down from element 4 * i of the group.
+ *
+ * @param ptr Pointer to the 8 elements to load.
+ * @return uint16x4x2_t The two loaded vectors.
+ */
+RHAL_API uint16x4x2_t vld1_u16_x2_rvv(const uint16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vuint16m1_t v = __riscv_vle16_v_u16m1(ptr, VLEN_8);
+        uint16x4x2_t r = __riscv_vundefined_u16mf2x2();
+        r = __riscv_vset_v_u16mf2_u16mf2x2(r, 0, __riscv_vlmul_trunc_v_u16m1_u16mf2(v));
+        r = __riscv_vset_v_u16mf2_u16mf2x2(r, 1, __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(v, 4, VLEN_8)));
+        return r;
+    #else
+        vuint16m1_t v = __riscv_vle16_v_u16m1(ptr, VLEN_8);
+        uint16x4x2_t r = __riscv_vundefined_u16m1x2();
+        r = __riscv_vset_v_u16m1_u16m1x2(r, 0, v);
+        r = __riscv_vset_v_u16m1_u16m1x2(r, 1, __riscv_vslidedown_vx_u16m1(v, 4, VLEN_8));
+        return r;
+    #endif
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three consecutive 64-bit vectors of 16-bit unsigned integers from memory.
+ *
+ * This function loads the 12 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into three vectors, analogous to the ARM Neon function `vld1_u16_x3`.
+ * Vector i is slid down from element 4 * i of the group.
+ *
+ * @param ptr Pointer to the 12 elements to load.
+ * @return uint16x4x3_t The three loaded vectors.
+ */
+RHAL_API uint16x4x3_t vld1_u16_x3_rvv(const uint16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vuint16m2_t v = __riscv_vle16_v_u16m2(ptr, VLEN_12);
+        uint16x4x3_t r = __riscv_vundefined_u16mf2x3();
+        r = __riscv_vset_v_u16mf2_u16mf2x3(r, 0, __riscv_vlmul_trunc_v_u16m2_u16mf2(v));
+        r = __riscv_vset_v_u16mf2_u16mf2x3(r, 1, __riscv_vlmul_trunc_v_u16m2_u16mf2(__riscv_vslidedown_vx_u16m2(v, 4, VLEN_12)));
+        r = __riscv_vset_v_u16mf2_u16mf2x3(r, 2, __riscv_vlmul_trunc_v_u16m2_u16mf2(__riscv_vslidedown_vx_u16m2(v, 8, VLEN_12)));
+        return r;
+    #else
+        vuint16m2_t v = __riscv_vle16_v_u16m2(ptr, VLEN_12);
+        uint16x4x3_t r = __riscv_vundefined_u16m1x3();
+        r = __riscv_vset_v_u16m1_u16m1x3(r, 0, __riscv_vlmul_trunc_v_u16m2_u16m1(v));
+        r = __riscv_vset_v_u16m1_u16m1x3(r, 1, __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vslidedown_vx_u16m2(v, 4, VLEN_12)));
+        r = __riscv_vset_v_u16m1_u16m1x3(r, 2, __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vslidedown_vx_u16m2(v, 8, VLEN_12)));
+        return r;
+    #endif
+}
@@ -0,0 +1,33 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 64-bit vectors of 16-bit unsigned integers from memory.
+ *
+ * This function loads the 16 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1_u16_x4`.
+ * Vector i is slid down from element 4 * i of the group.
+ *
+ * @param ptr Pointer to the 16 elements to load.
+ * @return uint16x4x4_t The four loaded vectors.
+ */
+RHAL_API uint16x4x4_t vld1_u16_x4_rvv(const uint16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vuint16m2_t v = __riscv_vle16_v_u16m2(ptr, VLEN_16);
+        uint16x4x4_t r = __riscv_vundefined_u16mf2x4();
+        r = __riscv_vset_v_u16mf2_u16mf2x4(r, 0, __riscv_vlmul_trunc_v_u16m2_u16mf2(v));
+        r = __riscv_vset_v_u16mf2_u16mf2x4(r, 1, __riscv_vlmul_trunc_v_u16m2_u16mf2(__riscv_vslidedown_vx_u16m2(v, 4, VLEN_16)));
+        r = __riscv_vset_v_u16mf2_u16mf2x4(r, 2, __riscv_vlmul_trunc_v_u16m2_u16mf2(__riscv_vslidedown_vx_u16m2(v, 8, VLEN_16)));
+        r = __riscv_vset_v_u16mf2_u16mf2x4(r, 3, __riscv_vlmul_trunc_v_u16m2_u16mf2(__riscv_vslidedown_vx_u16m2(v, 12, VLEN_16)));
+        return r;
+    #else
+        vuint16m2_t v = __riscv_vle16_v_u16m2(ptr, VLEN_16);
+        uint16x4x4_t r = __riscv_vundefined_u16m1x4();
+        r = __riscv_vset_v_u16m1_u16m1x4(r, 0, __riscv_vlmul_trunc_v_u16m2_u16m1(v));
+        r = __riscv_vset_v_u16m1_u16m1x4(r, 1, __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vslidedown_vx_u16m2(v, 4, VLEN_16)));
+        r = __riscv_vset_v_u16m1_u16m1x4(r, 2, __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vslidedown_vx_u16m2(v, 8, VLEN_16)));
+        r = __riscv_vset_v_u16m1_u16m1x4(r, 3, __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vslidedown_vx_u16m2(v, 12, VLEN_16)));
+        return r;
+    #endif
+}
@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 64-bit vector of 32-bit unsigned integers from memory.
+ *
+ * This function loads 2 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1_u32`.
+ *
+ * @param ptr Pointer to the 2 elements to load.
+ * @return uint32x2_t The loaded vector.
+ */
+RHAL_API uint32x2_t vld1_u32_rvv(const uint32_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vle32_v_u32mf2(ptr, VLEN_2);
+    #else
+        return __riscv_vle32_v_u32m1(ptr, VLEN_2);
+    #endif
+}
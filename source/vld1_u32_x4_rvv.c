@@ -0,0 +1,33 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 64-bit vectors of 32-bit unsigned integers from memory.
+ *
+ * This function loads the 8 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1_u32_x4`.
+ * Vector i is slid down from element 2 * i of the group.
+ *
+ * @param ptr Pointer to the 8 elements to load.
+ * @return uint32x2x4_t The four loaded vectors.
+ */
+RHAL_API uint32x2x4_t vld1_u32_x4_rvv(const uint32_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vuint32m2_t v = __riscv_vle32_v_u32m2(ptr, VLEN_8);
+        uint32x2x4_t r = __riscv_vundefined_u32mf2x4();
+        r = __riscv_vset_v_u32mf2_u32mf2x4(r, 0, __riscv_vlmul_trunc_v_u32m2_u32mf2(v));
+        r = __riscv_vset_v_u32mf2_u32mf2x4(r, 1, __riscv_vlmul_trunc_v_u32m2_u32mf2(__riscv_vslidedown_vx_u32m2(v, 2, VLEN_8)));
+        r = __riscv_vset_v_u32mf2_u32mf2x4(r, 2, __riscv_vlmul_trunc_v_u32m2_u32mf2(__riscv_vslidedown_vx_u32m2(v, 4, VLEN_8)));
+        r = __riscv_vset_v_u32mf2_u32mf2x4(r, 3, __riscv_vlmul_trunc_v_u32m2_u32mf2(__riscv_vslidedown_vx_u32m2(v, 6, VLEN_8)));
+        return r;
+    #else
+        vuint32m2_t v = __riscv_vle32_v_u32m2(ptr, VLEN_8);
+        uint32x2x4_t r = __riscv_vundefined_u32m1x4();
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 0, __riscv_vlmul_trunc_v_u32m2_u32m1(v));
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 1, __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vslidedown_vx_u32m2(v, 2, VLEN_8)));
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 2, __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vslidedown_vx_u32m2(v, 4, VLEN_8)));
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 3, __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vslidedown_vx_u32m2(v, 6, VLEN_8)));
+        return r;
+    #endif
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 64-bit vectors of 64-bit unsigned integers from memory.
+ *
+ * This function loads the 2 elements at `ptr` with a single unit-stride load of LMUL=1 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1_u64_x2`.
+ * Vector i is slid down from element 1 * i of the group.
+ *
+ * @param ptr Pointer to the 2 elements to load.
+ * @return uint64x1x2_t The two loaded vectors.
+ */
+RHAL_API uint64x1x2_t vld1_u64_x2_rvv(const uint64_t *ptr) {
+    vuint64m1_t v = __riscv_vle64_v_u64m1(ptr, VLEN_2);
+    uint64x1x2_t r = __riscv_vundefined_u64m1x2();
+    r = __riscv_vset_v_u64m1_u64m1x2(r, 0, v);
+    r = __riscv_vset_v_u64m1_u64m1x2(r, 1, __riscv_vslidedown_vx_u64m1(v, 1, VLEN_2));
+    return r;
+}
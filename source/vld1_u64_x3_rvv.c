@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three consecutive 64-bit vectors of 64-bit unsigned integers from memory.
+ *
+ * This function loads the 3 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into three vectors, analogous to the ARM Neon function `vld1_u64_x3`.
+ * Vector i is slid down from element 1 * i of the group.
+ *
+ * @param ptr Pointer to the 3 elements to load.
+ * @return uint64x1x3_t The three loaded vectors.
+ */
+RHAL_API uint64x1x3_t vld1_u64_x3_rvv(const uint64_t *ptr) {
+    vuint64m2_t v = __riscv_vle64_v_u64m2(ptr, VLEN_3);
+    uint64x1x3_t r = __riscv_vundefined_u64m1x3();
+    r = __riscv_vset_v_u64m1_u64m1x3(r, 0, __riscv_vlmul_trunc_v_u64m2_u64m1(v));
+    r = __riscv_vset_v_u64m1_u64m1x3(r, 1, __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vslidedown_vx_u64m2(v, 1, VLEN_3)));
+    r = __riscv_vset_v_u64m1_u64m1x3(r, 2, __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vslidedown_vx_u64m2(v, 2, VLEN_3)));
+    return r;
+}
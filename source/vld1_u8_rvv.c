@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 64-bit vector of 8-bit unsigned integers from memory.
+ *
+ * This function loads 8 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1_u8`.
+ *
+ * @param ptr Pointer to the 8 elements to load.
+ * @return uint8x8_t The loaded vector.
+ */
+RHAL_API uint8x8_t vld1_u8_rvv(const uint8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vle8_v_u8mf2(ptr, VLEN_8);
+    #else
+        return __riscv_vle8_v_u8m1(ptr, VLEN_8);
+    #endif
+}
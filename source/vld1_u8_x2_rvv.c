@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 64-bit vectors of 8-bit unsigned integers from memory.
+ *
+ * This function loads the 16 elements at `ptr` with a single unit-stride load of LMUL=1 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1_u8_x2`.
+ * Vector i is slid down from element 8 * i of the group.
+ *
+ * @param ptr Pointer to the 16 elements to load.
+ * @return uint8x8x2_t The two loaded vectors.
+ */
+RHAL_API uint8x8x2_t vld1_u8_x2_rvv(const uint8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vuint8m1_t v = __riscv_vle8_v_u8m1(ptr, VLEN_16);
+        uint8x8x2_t r = __riscv_vundefined_u8mf2x2();
+        r = __riscv_vset_v_u8mf2_u8mf2x2(r, 0, __riscv_vlmul_trunc_v_u8m1_u8mf2(v));
+        r = __riscv_vset_v_u8mf2_u8mf2x2(r, 1, __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(v, 8, VLEN_16)));
+        return r;
+    #else
+        vuint8m1_t v = __riscv_vle8_v_u8m1(ptr, VLEN_16);
+        uint8x8x2_t r = __riscv_vundefined_u8m1x2();
+        r = __riscv_vset_v_u8m1_u8m1x2(r, 0, v);
+        r = __riscv_vset_v_u8m1_u8m1x2(r, 1, __riscv_vslidedown_vx_u8m1(v, 8, VLEN_16));
+        return r;
+    #endif
+}
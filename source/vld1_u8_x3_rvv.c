@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three consecutive 64-bit vectors of 8-bit unsigned integers from memory.
+ *
+ * This function loads the 24 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into three vectors, analogous to the ARM Neon function `vld1_u8_x3`.
+ * Vector i is slid down from element 8 * i of the group.
+ *
+ * @param ptr Pointer to the 24 elements to load.
+ * @return uint8x8x3_t The three loaded vectors.
+ */
+RHAL_API uint8x8x3_t vld1_u8_x3_rvv(const uint8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vuint8m2_t v = __riscv_vle8_v_u8m2(ptr, VLEN_24);
+        uint8x8x3_t r = __riscv_vundefined_u8mf2x3();
+        r = __riscv_vset_v_u8mf2_u8mf2x3(r, 0, __riscv_vlmul_trunc_v_u8m2_u8mf2(v));
+        r = __riscv_vset_v_u8mf2_u8mf2x3(r, 1, __riscv_vlmul_trunc_v_u8m2_u8mf2(__riscv_vslidedown_vx_u8m2(v, 8, VLEN_24)));
+        r = __riscv_vset_v_u8mf2_u8mf2x3(r, 2, __riscv_vlmul_trunc_v_u8m2_u8mf2(__riscv_vslidedown_vx_u8m2(v, 16, VLEN_24)));
+        return r;
+    #else
+        vuint8m2_t v = __riscv_vle8_v_u8m2(ptr, VLEN_24);
+        uint8x8x3_t r = __riscv_vundefined_u8m1x3();
+        r = __riscv_vset_v_u8m1_u8m1x3(r, 0, __riscv_vlmul_trunc_v_u8m2_u8m1(v));
+        r = __riscv_vset_v_u8m1_u8m1x3(r, 1, __riscv_vlmul_trunc_v_u8m2_u8m1(__riscv_vslidedown_vx_u8m2(v, 8, VLEN_24)));
+        r = __riscv_vset_v_u8m1_u8m1x3(r, 2, __riscv_vlmul_trunc_v_u8m2_u8m1(__riscv_vslidedown_vx_u8m2(v, 16, VLEN_24)));
+        return r;
+    #endif
+}
@@ -0,0 +1,33 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 64-bit vectors of 8-bit unsigned integers from memory.
+ *
+ * This function loads the 32 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1_u8_x4`.
+ * Vector i is slid down from element 8 * i of the group.
+ *
+ * @param ptr Pointer to the 32 elements to load.
+ * @return uint8x8x4_t The four loaded vectors.
+ */
+RHAL_API uint8x8x4_t vld1_u8_x4_rvv(const uint8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vuint8m2_t v = __riscv_vle8_v_u8m2(ptr, VLEN_32);
+        uint8x8x4_t r = __riscv_vundefined_u8mf2x4();
+        r = __riscv_vset_v_u8mf2_u8mf2x4(r, 0, __riscv_vlmul_trunc_v_u8m2_u8mf2(v));
+        r = __riscv_vset_v_u8mf2_u8mf2x4(r, 1, __riscv_vlmul_trunc_v_u8m2_u8mf2(__riscv_vslidedown_vx_u8m2(v, 8, VLEN_32)));
+        r = __riscv_vset_v_u8mf2_u8mf2x4(r, 2, __riscv_vlmul_trunc_v_u8m2_u8mf2(__riscv_vslidedown_vx_u8m2(v, 16, VLEN_32)));
+        r = __riscv_vset_v_u8mf2_u8mf2x4(r, 3, __riscv_vlmul_trunc_v_u8m2_u8mf2(__riscv_vslidedown_vx_u8m2(v, 24, VLEN_32)));
+        return r;
+    #else
+        vuint8m2_t v = __riscv_vle8_v_u8m2(ptr, VLEN_32);
+        uint8x8x4_t r = __riscv_vundefined_u8m1x4();
+        r = __riscv_vset_v_u8m1_u8m1x4(r, 0, __riscv_vlmul_trunc_v_u8m2_u8m1(v));
+        r = __riscv_vset_v_u8m1_u8m1x4(r, 1, __riscv_vlmul_trunc_v_u8m2_u8m1(__riscv_vslidedown_vx_u8m2(v, 8, VLEN_32)));
+        r = __riscv_vset_v_u8m1_u8m1x4(r, 2, __riscv_vlmul_trunc_v_u8m2_u8m1(__riscv_vslidedown_vx_u8m2(v, 16, VLEN_32)));
+        r = __riscv_vset_v_u8m1_u8m1x4(r, 3, __riscv_vlmul_trunc_v_u8m2_u8m1(__riscv_vslidedown_vx_u8m2(v, 24, VLEN_32)));
+        return r;
+    #endif
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 16-bit signed integers from memory into all lanes of a 128-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 8 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1q_dup_s16`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return int16x8_t A vector with the loaded element in every lane.
+ */
+RHAL_API int16x8_t vld1q_dup_s16_rvv(const int16_t *ptr) {
+    return __riscv_vmv_v_x_i16m1(*ptr, VLEN_8);
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 32-bit signed integers from memory into all lanes of a 128-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 4 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1q_dup_s32`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return int32x4_t A vector with the loaded element in every lane.
+ */
+RHAL_API int32x4_t vld1q_dup_s32_rvv(const int32_t *ptr) {
+    return __riscv_vmv_v_x_i32m1(*ptr, VLEN_4);
+}
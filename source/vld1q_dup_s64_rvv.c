@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 64-bit signed integers from memory into all lanes of a 128-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 2 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1q_dup_s64`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return int64x2_t A vector with the loaded element in every lane.
+ */
+RHAL_API int64x2_t vld1q_dup_s64_rvv(const int64_t *ptr) {
+    return __riscv_vmv_v_x_i64m1(*ptr, VLEN_2);
+}
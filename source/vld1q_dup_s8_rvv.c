@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 8-bit signed integers from memory into all lanes of a 128-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 16 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1q_dup_s8`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return int8x16_t A vector with the loaded element in every lane.
+ */
+RHAL_API int8x16_t vld1q_dup_s8_rvv(const int8_t *ptr) {
+    return __riscv_vmv_v_x_i8m1(*ptr, VLEN_16);
+}
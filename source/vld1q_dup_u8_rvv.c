@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 8-bit unsigned integers from memory into all lanes of a 128-bit vector.
+ *
+ * This function loads the element at `ptr` and broadcasts it to all 16 elements with a scalar-vector
+ * move, analogous to the ARM Neon function `vld1q_dup_u8`.
+ *
+ * @param ptr Pointer to the element to load.
+ * @return uint8x16_t A vector with the loaded element in every lane.
+ */
+RHAL_API uint8x16_t vld1q_dup_u8_rvv(const uint8_t *ptr) {
+    return __riscv_vmv_v_x_u8m1(*ptr, VLEN_16);
+}
@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 16-bit signed integers from memory into a lane of a 128-bit vector.
+ *
+ * This function returns `src` with element `lane` replaced by the element at `ptr`, analogous to the
+ * ARM Neon function `vld1q_lane_s16`. The lane is selected with a mask comparing the element indices
+ * with `lane`, and the element merged in with `vmerge.vxm`, which keeps the default tail-agnostic policy.
+ *
+ * @param ptr Pointer to the element to load.
+ * @param src The vector of type int16x8_t to insert the element into.
+ * @param lane The lane to replace, from 0 to 7.
+ * @return int16x8_t The vector `src` with the loaded element in lane `lane`.
+ */
+RHAL_API int16x8_t vld1q_lane_s16_rvv(const int16_t *ptr, int16x8_t src, const int lane) {
+    vbool16_t mask = __riscv_vmseq_vx_u16m1_b16(__riscv_vid_v_u16m1(VLEN_8), lane, VLEN_8);
+    return __riscv_vmerge_vxm_i16m1(src, *ptr, mask, VLEN_8);
+}
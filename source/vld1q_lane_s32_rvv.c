@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 32-bit signed integers from memory into a lane of a 128-bit vector.
+ *
+ * This function returns `src` with element `lane` replaced by the element at `ptr`, analogous to the
+ * ARM Neon function `vld1q_lane_s32`. The lane is selected with a mask comparing the element indices
+ * with `lane`, and the element merged in with `vmerge.vxm`, which keeps the default tail-agnostic policy.
+ *
+ * @param ptr Pointer to the element to load.
+ * @param src The vector of type int32x4_t to insert the element into.
+ * @param lane The lane to replace, from 0 to 3.
+ * @return int32x4_t The vector `src` with the loaded element in lane `lane`.
+ */
+RHAL_API int32x4_t vld1q_lane_s32_rvv(const int32_t *ptr, int32x4_t src, const int lane) {
+    vbool32_t mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vid_v_u32m1(VLEN_4), lane, VLEN_4);
+    return __riscv_vmerge_vxm_i32m1(src, *ptr, mask, VLEN_4);
+}
@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads one element of 8-bit signed integers from memory into a lane of a 128-bit vector.
+ *
+ * This function returns `src` with element `lane` replaced by the element at `ptr`, analogous to the
+ * ARM Neon function `vld1q_lane_s8`. The lane is selected with a mask comparing the element indices
+ * with `lane`, and the element merged in with `vmerge.vxm`, which keeps the default tail-agnostic policy.
+ *
+ * @param ptr Pointer to the element to load.
+ * @param src The vector of type int8x16_t to insert the element into.
+ * @param lane The lane to replace, from 0 to 15.
+ * @return int8x16_t The vector `src` with the loaded element in lane `lane`.
+ */
+RHAL_API int8x16_t vld1q_lane_s8_rvv(const int8_t *ptr, int8x16_t src, const int lane) {
+    vbool8_t mask = __riscv_vmseq_vx_u8m1_b8(__riscv_vid_v_u8m1(VLEN_16), lane, VLEN_16);
+    return __riscv_vmerge_vxm_i8m1(src, *ptr, mask, VLEN_16);
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 128-bit vector of 16-bit signed integers from memory.
+ *
+ * This function loads 8 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1q_s16`.
+ *
+ * @param ptr Pointer to the 8 elements to load.
+ * @return int16x8_t The loaded vector.
+ */
+RHAL_API int16x8_t vld1q_s16_rvv(const int16_t *ptr) {
+    return __riscv_vle16_v_i16m1(ptr, VLEN_8);
+}
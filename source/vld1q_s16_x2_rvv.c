@@ -0,0 +1,27 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 128-bit vectors of 16-bit signed integers from memory.
+ *
+ * This function loads the 16 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1q_s16_x2`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 8 * i.
+ *
+ * @param ptr Pointer to the 16 elements to load.
+ * @return int16x8x2_t The two loaded vectors.
+ */
+RHAL_API int16x8x2_t vld1q_s16_x2_rvv(const int16_t *ptr) {
+    vint16m2_t v = __riscv_vle16_v_i16m2(ptr, VLEN_16);
+    int16x8x2_t r = __riscv_vundefined_i16m1x2();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_i16m1_i16m1x2(r, 0, __riscv_vget_v_i16m2_i16m1(v, 0));
+        r = __riscv_vset_v_i16m1_i16m1x2(r, 1, __riscv_vget_v_i16m2_i16m1(v, 1));
+    #else
+        r = __riscv_vset_v_i16m1_i16m1x2(r, 0, __riscv_vlmul_trunc_v_i16m2_i16m1(v));
+        r = __riscv_vset_v_i16m1_i16m1x2(r, 1, __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vslidedown_vx_i16m2(v, 8, VLEN_16)));
+    #endif
+    return r;
+}
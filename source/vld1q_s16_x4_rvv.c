@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 128-bit vectors of 16-bit signed integers from memory.
+ *
+ * This function loads the 32 elements at `ptr` with a single unit-stride load of LMUL=4 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1q_s16_x4`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 8 * i.
+ *
+ * @param ptr Pointer to the 32 elements to load.
+ * @return int16x8x4_t The four loaded vectors.
+ */
+RHAL_API int16x8x4_t vld1q_s16_x4_rvv(const int16_t *ptr) {
+    vint16m4_t v = __riscv_vle16_v_i16m4(ptr, VLEN_32);
+    int16x8x4_t r = __riscv_vundefined_i16m1x4();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 0, __riscv_vget_v_i16m4_i16m1(v, 0));
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 1, __riscv_vget_v_i16m4_i16m1(v, 1));
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 2, __riscv_vget_v_i16m4_i16m1(v, 2));
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 3, __riscv_vget_v_i16m4_i16m1(v, 3));
+    #else
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 0, __riscv_vlmul_trunc_v_i16m4_i16m1(v));
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 1, __riscv_vlmul_trunc_v_i16m4_i16m1(__riscv_vslidedown_vx_i16m4(v, 8, VLEN_32)));
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 2, __riscv_vlmul_trunc_v_i16m4_i16m1(__riscv_vslidedown_vx_i16m4(v, 16, VLEN_32)));
+        r = __riscv_vset_v_i16m1_i16m1x4(r, 3, __riscv_vlmul_trunc_v_i16m4_i16m1(__riscv_vslidedown_vx_i16m4(v, 24, VLEN_32)));
+    #endif
+    return r;
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 128-bit vector of 32-bit signed integers from memory.
+ *
+ * This function loads 4 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1q_s32`.
+ *
+ * @param ptr Pointer to the 4 elements to load.
+ * @return int32x4_t The loaded vector.
+ */
+RHAL_API int32x4_t vld1q_s32_rvv(const int32_t *ptr) {
+    return __riscv_vle32_v_i32m1(ptr, VLEN_4);
+}
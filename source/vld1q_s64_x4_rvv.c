@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 128-bit vectors of 64-bit signed integers from memory.
+ *
+ * This function loads the 8 elements at `ptr` with a single unit-stride load of LMUL=4 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1q_s64_x4`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 2 * i.
+ *
+ * @param ptr Pointer to the 8 elements to load.
+ * @return int64x2x4_t The four loaded vectors.
+ */
+RHAL_API int64x2x4_t vld1q_s64_x4_rvv(const int64_t *ptr) {
+    vint64m4_t v = __riscv_vle64_v_i64m4(ptr, VLEN_8);
+    int64x2x4_t r = __riscv_vundefined_i64m1x4();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_i64m1_i64m1x4(r, 0, __riscv_vget_v_i64m4_i64m1(v, 0));
+        r = __riscv_vset_v_i64m1_i64m1x4(r, 1, __riscv_vget_v_i64m4_i64m1(v, 1));
+        r = __riscv_vset_v_i64m1_i64m1x4(r, 2, __riscv_vget_v_i64m4_i64m1(v, 2));
+        r = __riscv_vset_v_i64m1_i64m1x4(r, 3, __riscv_vget_v_i64m4_i64m1(v, 3));
+    #else
+        r = __riscv_vset_v_i64m1_i64m1x4(r, 0, __riscv_vlmul_trunc_v_i64m4_i64m1(v));
+        r = __riscv_vset_v_i64m1_i64m1x4(r, 1, __riscv_vlmul_trunc_v_i64m4_i64m1(__riscv_vslidedown_vx_i64m4(v, 2, VLEN_8)));
+        r = __riscv_vset_v_i64m1_i64m1x4(r, 2, __riscv_vlmul_trunc_v_i64m4_i64m1(__riscv_vslidedown_vx_i64m4(v, 4, VLEN_8)));
+        r = __riscv_vset_v_i64m1_i64m1x4(r, 3, __riscv_vlmul_trunc_v_i64m4_i64m1(__riscv_vslidedown_vx_i64m4(v, 6, VLEN_8)));
+    #endif
+    return r;
+}
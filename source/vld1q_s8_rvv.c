@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 128-bit vector of 8-bit signed integers from memory.
+ *
+ * This function loads 16 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1q_s8`.
+ *
+ * @param ptr Pointer to the 16 elements to load.
+ * @return int8x16_t The loaded vector.
+ */
+RHAL_API int8x16_t vld1q_s8_rvv(const int8_t *ptr) {
+    return __riscv_vle8_v_i8m1(ptr, VLEN_16);
+}
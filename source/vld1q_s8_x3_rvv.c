@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three consecutive 128-bit vectors of 8-bit signed integers from memory.
+ *
+ * This function loads the 48 elements at `ptr` with a single unit-stride load of LMUL=4 and splits
+ * them into three vectors, analogous to the ARM Neon function `vld1q_s8_x3`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 16 * i.
+ *
+ * @param ptr Pointer to the 48 elements to load.
+ * @return int8x16x3_t The three loaded vectors.
+ */
+RHAL_API int8x16x3_t vld1q_s8_x3_rvv(const int8_t *ptr) {
+    vint8m4_t v = __riscv_vle8_v_i8m4(ptr, VLEN_48);
+    int8x16x3_t r = __riscv_vundefined_i8m1x3();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_i8m1_i8m1x3(r, 0, __riscv_vget_v_i8m4_i8m1(v, 0));
+        r = __riscv_vset_v_i8m1_i8m1x3(r, 1, __riscv_vget_v_i8m4_i8m1(v, 1));
+        r = __riscv_vset_v_i8m1_i8m1x3(r, 2, __riscv_vget_v_i8m4_i8m1(v, 2));
+    #else
+        r = __riscv_vset_v_i8m1_i8m1x3(r, 0, __riscv_vlmul_trunc_v_i8m4_i8m1(v));
+        r = __riscv_vset_v_i8m1_i8m1x3(r, 1, __riscv_vlmul_trunc_v_i8m4_i8m1(__riscv_vslidedown_vx_i8m4(v, 16, VLEN_48)));
+        r = __riscv_vset_v_i8m1_i8m1x3(r, 2, __riscv_vlmul_trunc_v_i8m4_i8m1(__riscv_vslidedown_vx_i8m4(v, 32, VLEN_48)));
+    #endif
+    return r;
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 128-bit vectors of 8-bit signed integers from memory.
+ *
+ * This function loads the 64 elements at `ptr` with a single unit-stride load of LMUL=4 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1q_s8_x4`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 16 * i.
+ *
+ * @param ptr Pointer to the 64 elements to load.
+ * @return int8x16x4_t The four loaded vectors.
+ */
+RHAL_API int8x16x4_t vld1q_s8_x4_rvv(const int8_t *ptr) {
+    vint8m4_t v = __riscv_vle8_v_i8m4(ptr, VLEN_64);
+    int8x16x4_t r = __riscv_vundefined_i8m1x4();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_i8m1_i8m1x4(r, 0, __riscv_vget_v_i8m4_i8m1(v, 0));
+        r = __riscv_vset_v_i8m1_i8m1x4(r, 1, __riscv_vget_v_i8m4_i8m1(v, 1));
+        r = __riscv_vset_v_i8m1_i8m1x4(r, 2, __riscv_vget_v_i8m4_i8m1(v, 2));
+        r = __riscv_vset_v_i8m1_i8m1x4(r, 3, __riscv_vget_v_i8m4_i8m1(v, 3));
+    #else
+        r = __riscv_vset_v_i8m1_i8m1x4(r, 0, __riscv_vlmul_trunc_v_i8m4_i8m1(v));
+        r = __riscv_vset_v_i8m1_i8m1x4(r, 1, __riscv_vlmul_trunc_v_i8m4_i8m1(__riscv_vslidedown_vx_i8m4(v, 16, VLEN_64)));
+        r = __riscv_vset_v_i8m1_i8m1x4(r, 2, __riscv_vlmul_trunc_v_i8m4_i8m1(__riscv_vslidedown_vx_i8m4(v, 32, VLEN_64)));
+        r = __riscv_vset_v_i8m1_i8m1x4(r, 3, __riscv_vlmul_trunc_v_i8m4_i8m1(__riscv_vslidedown_vx_i8m4(v, 48, VLEN_64)));
+    #endif
+    return r;
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 128-bit vector of 16-bit unsigned integers from memory.
+ *
+ * This function loads 8 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1q_u16`.
+ *
+ * @param ptr Pointer to the 8 elements to load.
+ * @return uint16x8_t The loaded vector.
+ */
+RHAL_API uint16x8_t vld1q_u16_rvv(const uint16_t *ptr) {
+    return __riscv_vle16_v_u16m1(ptr, VLEN_8);
+}
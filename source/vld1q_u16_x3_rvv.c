@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three consecutive 128-bit vectors of 16-bit unsigned integers from memory.
+ *
+ * This function loads the 24 elements at `ptr` with a single unit-stride load of LMUL=4 and splits
+ * them into three vectors, analogous to the ARM Neon function `vld1q_u16_x3`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 8 * i.
+ *
+ * @param ptr Pointer to the 24 elements to load.
+ * @return uint16x8x3_t The three loaded vectors.
+ */
+RHAL_API uint16x8x3_t vld1q_u16_x3_rvv(const uint16_t *ptr) {
+    vuint16m4_t v = __riscv_vle16_v_u16m4(ptr, VLEN_24);
+    uint16x8x3_t r = __riscv_vundefined_u16m1x3();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_u16m1_u16m1x3(r, 0, __riscv_vget_v_u16m4_u16m1(v, 0));
+        r = __riscv_vset_v_u16m1_u16m1x3(r, 1, __riscv_vget_v_u16m4_u16m1(v, 1));
+        r = __riscv_vset_v_u16m1_u16m1x3(r, 2, __riscv_vget_v_u16m4_u16m1(v, 2));
+    #else
+        r = __riscv_vset_v_u16m1_u16m1x3(r, 0, __riscv_vlmul_trunc_v_u16m4_u16m1(v));
+        r = __riscv_vset_v_u16m1_u16m1x3(r, 1, __riscv_vlmul_trunc_v_u16m4_u16m1(__riscv_vslidedown_vx_u16m4(v, 8, VLEN_24)));
+        r = __riscv_vset_v_u16m1_u16m1x3(r, 2, __riscv_vlmul_trunc_v_u16m4_u16m1(__riscv_vslidedown_vx_u16m4(v, 16, VLEN_24)));
+    #endif
+    return r;
+}
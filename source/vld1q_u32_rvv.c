@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 128-bit vector of 32-bit unsigned integers from memory.
+ *
+ * This function loads 4 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1q_u32`.
+ *
+ * @param ptr Pointer to the 4 elements to load.
+ * @return uint32x4_t The loaded vector.
+ */
+RHAL_API uint32x4_t vld1q_u32_rvv(const uint32_t *ptr) {
+    return __riscv_vle32_v_u32m1(ptr, VLEN_4);
+}
@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three consecutive 128-bit vectors of 32-bit unsigned integers from memory.
+ *
+ * This function loads the 12 elements at `ptr` with a single unit-stride load of LMUL=4 and splits
+ * them into three vectors, analogous to the ARM Neon function `vld1q_u32_x3`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 4 * i.
+ *
+ * @param ptr Pointer to the 12 elements to load.
+ * @return uint32x4x3_t The three loaded vectors.
+ */
+RHAL_API uint32x4x3_t vld1q_u32_x3_rvv(const uint32_t *ptr) {
+    vuint32m4_t v = __riscv_vle32_v_u32m4(ptr, VLEN_12);
+    uint32x4x3_t r = __riscv_vundefined_u32m1x3();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_u32m1_u32m1x3(r, 0, __riscv_vget_v_u32m4_u32m1(v, 0));
+        r = __riscv_vset_v_u32m1_u32m1x3(r, 1, __riscv_vget_v_u32m4_u32m1(v, 1));
+        r = __riscv_vset_v_u32m1_u32m1x3(r, 2, __riscv_vget_v_u32m4_u32m1(v, 2));
+    #else
+        r = __riscv_vset_v_u32m1_u32m1x3(r, 0, __riscv_vlmul_trunc_v_u32m4_u32m1(v));
+        r = __riscv_vset_v_u32m1_u32m1x3(r, 1, __riscv_vlmul_trunc_v_u32m4_u32m1(__riscv_vslidedown_vx_u32m4(v, 4, VLEN_12)));
+        r = __riscv_vset_v_u32m1_u32m1x3(r, 2, __riscv_vlmul_trunc_v_u32m4_u32m1(__riscv_vslidedown_vx_u32m4(v, 8, VLEN_12)));
+    #endif
+    return r;
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four consecutive 128-bit vectors of 32-bit unsigned integers from memory.
+ *
+ * This function loads the 16 elements at `ptr` with a single unit-stride load of LMUL=4 and splits
+ * them into four vectors, analogous to the ARM Neon function `vld1q_u32_x4`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 4 * i.
+ *
+ * @param ptr Pointer to the 16 elements to load.
+ * @return uint32x4x4_t The four loaded vectors.
+ */
+RHAL_API uint32x4x4_t vld1q_u32_x4_rvv(const uint32_t *ptr) {
+    vuint32m4_t v = __riscv_vle32_v_u32m4(ptr, VLEN_16);
+    uint32x4x4_t r = __riscv_vundefined_u32m1x4();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 0, __riscv_vget_v_u32m4_u32m1(v, 0));
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 1, __riscv_vget_v_u32m4_u32m1(v, 1));
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 2, __riscv_vget_v_u32m4_u32m1(v, 2));
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 3, __riscv_vget_v_u32m4_u32m1(v, 3));
+    #else
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 0, __riscv_vlmul_trunc_v_u32m4_u32m1(v));
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 1, __riscv_vlmul_trunc_v_u32m4_u32m1(__riscv_vslidedown_vx_u32m4(v, 4, VLEN_16)));
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 2, __riscv_vlmul_trunc_v_u32m4_u32m1(__riscv_vslidedown_vx_u32m4(v, 8, VLEN_16)));
+        r = __riscv_vset_v_u32m1_u32m1x4(r, 3, __riscv_vlmul_trunc_v_u32m4_u32m1(__riscv_vslidedown_vx_u32m4(v, 12, VLEN_16)));
+    #endif
+    return r;
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads a 128-bit vector of 64-bit unsigned integers from memory.
+ *
+ * This function loads 2 consecutive elements from `ptr` with a single unit-stride vector load
+ * of fixed length, analogous to the ARM Neon function `vld1q_u64`.
+ *
+ * @param ptr Pointer to the 2 elements to load.
+ * @return uint64x2_t The loaded vector.
+ */
+RHAL_API uint64x2_t vld1q_u64_rvv(const uint64_t *ptr) {
+    return __riscv_vle64_v_u64m1(ptr, VLEN_2);
+}
@@ -0,0 +1,27 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 128-bit vectors of 64-bit unsigned integers from memory.
+ *
+ * This function loads the 4 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1q_u64_x2`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 2 * i.
+ *
+ * @param ptr Pointer to the 4 elements to load.
+ * @return uint64x2x2_t The two loaded vectors.
+ */
+RHAL_API uint64x2x2_t vld1q_u64_x2_rvv(const uint64_t *ptr) {
+    vuint64m2_t v = __riscv_vle64_v_u64m2(ptr, VLEN_4);
+    uint64x2x2_t r = __riscv_vundefined_u64m1x2();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_u64m1_u64m1x2(r, 0, __riscv_vget_v_u64m2_u64m1(v, 0));
+        r = __riscv_vset_v_u64m1_u64m1x2(r, 1, __riscv_vget_v_u64m2_u64m1(v, 1));
+    #else
+        r = __riscv_vset_v_u64m1_u64m1x2(r, 0, __riscv_vlmul_trunc_v_u64m2_u64m1(v));
+        r = __riscv_vset_v_u64m1_u64m1x2(r, 1, __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vslidedown_vx_u64m2(v, 2, VLEN_4)));
+    #endif
+    return r;
+}
@@ -0,0 +1,27 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two consecutive 128-bit vectors of 8-bit unsigned integers from memory.
+ *
+ * This function loads the 32 elements at `ptr` with a single unit-stride load of LMUL=2 and splits
+ * them into two vectors, analogous to the ARM Neon function `vld1q_u8_x2`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * down from element 16 * i.
+ *
+ * @param ptr Pointer to the 32 elements to load.
+ * @return uint8x16x2_t The two loaded vectors.
+ */
+RHAL_API uint8x16x2_t vld1q_u8_x2_rvv(const uint8_t *ptr) {
+    vuint8m2_t v = __riscv_vle8_v_u8m2(ptr, VLEN_32);
+    uint8x16x2_t r = __riscv_vundefined_u8m1x2();
+    #if defined(RHAL_VLEN_128)
+        r = __riscv_vset_v_u8m1_u8m1x2(r, 0, __riscv_vget_v_u8m2_u8m1(v, 0));
+        r = __riscv_vset_v_u8m1_u8m1x2(r, 1, __riscv_vget_v_u8m2_u8m1(v, 1));
+    #else
+        r = __riscv_vset_v_u8m1_u8m1x2(r, 0, __riscv_vlmul_trunc_v_u8m2_u8m1(v));
+        r = __riscv_vset_v_u8m1_u8m1x2(r, 1, __riscv_vlmul_trunc_v_u8m2_u8m1(__riscv_vslidedown_vx_u8m2(v, 16, VLEN_32)));
+    #endif
+    return r;
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two elements of 64-bit signed integers from memory into all lanes of two 64-bit vectors.
+ *
+ * This function loads the two consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld2_dup_s64`. It is a single strided segment load
+ * (`vlsseg2e64.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the two elements to load.
+ * @return int64x1x2_t The two vectors with their element in every lane.
+ */
+RHAL_API int64x1x2_t vld2_dup_s64_rvv(const int64_t *ptr) {
+    return __riscv_vlsseg2e64_v_i64m1x2(ptr, 0, VLEN_1);
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two elements of 16-bit unsigned integers from memory into all lanes of two 64-bit vectors.
+ *
+ * This function loads the two consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld2_dup_u16`. It is a single strided segment load
+ * (`vlsseg2e16.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the two elements to load.
+ * @return uint16x4x2_t The two vectors with their element in every lane.
+ */
+RHAL_API uint16x4x2_t vld2_dup_u16_rvv(const uint16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlsseg2e16_v_u16mf2x2(ptr, 0, VLEN_4);
+    #else
+        return __riscv_vlsseg2e16_v_u16m1x2(ptr, 0, VLEN_4);
+    #endif
+}
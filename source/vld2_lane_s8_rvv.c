@@ -0,0 +1,32 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two elements of 8-bit signed integers from memory into a lane of two 64-bit vectors.
+ *
+ * This function returns `src` with element `lane` of vector j replaced by element j at `ptr`,
+ * analogous to the ARM Neon function `vld2_lane_s8`. The elements are broadcast with a segment load
+ * with a stride of 0 and merged into `src` with a mask of the lane, which keeps the default
+ * tail-agnostic policy.
+ *
+ * @param ptr Pointer to the two elements to load.
+ * @param src The two vectors of type int8x8x2_t to insert the elements into.
+ * @param lane The lane to replace, from 0 to 7.
+ * @return int8x8x2_t The vectors `src` with the loaded elements in lane `lane`.
+ */
+RHAL_API int8x8x2_t vld2_lane_s8_rvv(const int8_t *ptr, int8x8x2_t src, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vbool16_t mask = __riscv_vmseq_vx_u8mf2_b16(__riscv_vid_v_u8mf2(VLEN_8), lane, VLEN_8);
+        int8x8x2_t seg = __riscv_vlsseg2e8_v_i8mf2x2(ptr, 0, VLEN_8);
+        src = __riscv_vset_v_i8mf2_i8mf2x2(src, 0, __riscv_vmerge_vvm_i8mf2(__riscv_vget_v_i8mf2x2_i8mf2(src, 0), __riscv_vget_v_i8mf2x2_i8mf2(seg, 0), mask, VLEN_8));
+        src = __riscv_vset_v_i8mf2_i8mf2x2(src, 1, __riscv_vmerge_vvm_i8mf2(__riscv_vget_v_i8mf2x2_i8mf2(src, 1), __riscv_vget_v_i8mf2x2_i8mf2(seg, 1), mask, VLEN_8));
+        return src;
+    #else
+        vbool8_t mask = __riscv_vmseq_vx_u8m1_b8(__riscv_vid_v_u8m1(VLEN_8), lane, VLEN_8);
+        int8x8x2_t seg = __riscv_vlsseg2e8_v_i8m1x2(ptr, 0, VLEN_8);
+        src = __riscv_vset_v_i8m1_i8m1x2(src, 0, __riscv_vmerge_vvm_i8m1(__riscv_vget_v_i8m1x2_i8m1(src, 0), __riscv_vget_v_i8m1x2_i8m1(seg, 0), mask, VLEN_8));
+        src = __riscv_vset_v_i8m1_i8m1x2(src, 1, __riscv_vmerge_vvm_i8m1(__riscv_vget_v_i8m1x2_i8m1(src, 1), __riscv_vget_v_i8m1x2_i8m1(seg, 1), mask, VLEN_8));
+        return src;
+    #endif
+}
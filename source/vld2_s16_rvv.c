@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two 64-bit vectors of 16-bit signed integers from interleaved memory.
+ *
+ * This function loads 4 pairs of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every pair, analogous to the ARM Neon function `vld2_s16`. It is a single
+ * unit-stride segment load (`vlseg2e16.v`).
+ *
+ * @param ptr Pointer to the 8 interleaved elements to load.
+ * @return int16x4x2_t The two deinterleaved vectors.
+ */
+RHAL_API int16x4x2_t vld2_s16_rvv(const int16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlseg2e16_v_i16mf2x2(ptr, VLEN_4);
+    #else
+        return __riscv_vlseg2e16_v_i16m1x2(ptr, VLEN_4);
+    #endif
+}
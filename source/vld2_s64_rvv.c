@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two 64-bit vectors of 64-bit signed integers from interleaved memory.
+ *
+ * This function loads 1 pairs of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every pair, analogous to the ARM Neon function `vld2_s64`. It is a single
+ * unit-stride segment load (`vlseg2e64.v`).
+ *
+ * @param ptr Pointer to the 2 interleaved elements to load.
+ * @return int64x1x2_t The two deinterleaved vectors.
+ */
+RHAL_API int64x1x2_t vld2_s64_rvv(const int64_t *ptr) {
+    return __riscv_vlseg2e64_v_i64m1x2(ptr, VLEN_1);
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two 64-bit vectors of 8-bit signed integers from interleaved memory.
+ *
+ * This function loads 8 pairs of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every pair, analogous to the ARM Neon function `vld2_s8`. It is a single
+ * unit-stride segment load (`vlseg2e8.v`).
+ *
+ * @param ptr Pointer to the 16 interleaved elements to load.
+ * @return int8x8x2_t The two deinterleaved vectors.
+ */
+RHAL_API int8x8x2_t vld2_s8_rvv(const int8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlseg2e8_v_i8mf2x2(ptr, VLEN_8);
+    #else
+        return __riscv_vlseg2e8_v_i8m1x2(ptr, VLEN_8);
+    #endif
+}
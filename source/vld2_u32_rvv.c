@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two 64-bit vectors of 32-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 2 pairs of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every pair, analogous to the ARM Neon function `vld2_u32`. It is a single
+ * unit-stride segment load (`vlseg2e32.v`).
+ *
+ * @param ptr Pointer to the 4 interleaved elements to load.
+ * @return uint32x2x2_t The two deinterleaved vectors.
+ */
+RHAL_API uint32x2x2_t vld2_u32_rvv(const uint32_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlseg2e32_v_u32mf2x2(ptr, VLEN_2);
+    #else
+        return __riscv_vlseg2e32_v_u32m1x2(ptr, VLEN_2);
+    #endif
+}
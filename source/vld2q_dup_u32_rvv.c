@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two elements of 32-bit unsigned integers from memory into all lanes of two 128-bit vectors.
+ *
+ * This function loads the two consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld2q_dup_u32`. It is a single strided segment load
+ * (`vlsseg2e32.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the two elements to load.
+ * @return uint32x4x2_t The two vectors with their element in every lane.
+ */
+RHAL_API uint32x4x2_t vld2q_dup_u32_rvv(const uint32_t *ptr) {
+    return __riscv_vlsseg2e32_v_u32m1x2(ptr, 0, VLEN_4);
+}
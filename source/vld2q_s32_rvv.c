@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two 128-bit vectors of 32-bit signed integers from interleaved memory.
+ *
+ * This function loads 4 pairs of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every pair, analogous to the ARM Neon function `vld2q_s32`. It is a single
+ * unit-stride segment load (`vlseg2e32.v`).
+ *
+ * @param ptr Pointer to the 8 interleaved elements to load.
+ * @return int32x4x2_t The two deinterleaved vectors.
+ */
+RHAL_API int32x4x2_t vld2q_s32_rvv(const int32_t *ptr) {
+    return __riscv_vlseg2e32_v_i32m1x2(ptr, VLEN_4);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two 128-bit vectors of 16-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 8 pairs of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every pair, analogous to the ARM Neon function `vld2q_u16`. It is a single
+ * unit-stride segment load (`vlseg2e16.v`).
+ *
+ * @param ptr Pointer to the 16 interleaved elements to load.
+ * @return uint16x8x2_t The two deinterleaved vectors.
+ */
+RHAL_API uint16x8x2_t vld2q_u16_rvv(const uint16_t *ptr) {
+    return __riscv_vlseg2e16_v_u16m1x2(ptr, VLEN_8);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two 128-bit vectors of 64-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 2 pairs of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every pair, analogous to the ARM Neon function `vld2q_u64`. It is a single
+ * unit-stride segment load (`vlseg2e64.v`).
+ *
+ * @param ptr Pointer to the 4 interleaved elements to load.
+ * @return uint64x2x2_t The two deinterleaved vectors.
+ */
+RHAL_API uint64x2x2_t vld2q_u64_rvv(const uint64_t *ptr) {
+    return __riscv_vlseg2e64_v_u64m1x2(ptr, VLEN_2);
+}
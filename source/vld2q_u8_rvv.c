@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads two 128-bit vectors of 8-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 16 pairs of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every pair, analogous to the ARM Neon function `vld2q_u8`. It is a single
+ * unit-stride segment load (`vlseg2e8.v`).
+ *
+ * @param ptr Pointer to the 32 interleaved elements to load.
+ * @return uint8x16x2_t The two deinterleaved vectors.
+ */
+RHAL_API uint8x16x2_t vld2q_u8_rvv(const uint8_t *ptr) {
+    return __riscv_vlseg2e8_v_u8m1x2(ptr, VLEN_16);
+}
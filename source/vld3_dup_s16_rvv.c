@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three elements of 16-bit signed integers from memory into all lanes of three 64-bit vectors.
+ *
+ * This function loads the three consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld3_dup_s16`. It is a single strided segment load
+ * (`vlsseg3e16.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the three elements to load.
+ * @return int16x4x3_t The three vectors with their element in every lane.
+ */
+RHAL_API int16x4x3_t vld3_dup_s16_rvv(const int16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlsseg3e16_v_i16mf2x3(ptr, 0, VLEN_4);
+    #else
+        return __riscv_vlsseg3e16_v_i16m1x3(ptr, 0, VLEN_4);
+    #endif
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three elements of 64-bit unsigned integers from memory into all lanes of three 64-bit vectors.
+ *
+ * This function loads the three consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld3_dup_u64`. It is a single strided segment load
+ * (`vlsseg3e64.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the three elements to load.
+ * @return uint64x1x3_t The three vectors with their element in every lane.
+ */
+RHAL_API uint64x1x3_t vld3_dup_u64_rvv(const uint64_t *ptr) {
+    return __riscv_vlsseg3e64_v_u64m1x3(ptr, 0, VLEN_1);
+}
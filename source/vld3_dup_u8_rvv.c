@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three elements of 8-bit unsigned integers from memory into all lanes of three 64-bit vectors.
+ *
+ * This function loads the three consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld3_dup_u8`. It is a single strided segment load
+ * (`vlsseg3e8.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the three elements to load.
+ * @return uint8x8x3_t The three vectors with their element in every lane.
+ */
+RHAL_API uint8x8x3_t vld3_dup_u8_rvv(const uint8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlsseg3e8_v_u8mf2x3(ptr, 0, VLEN_8);
+    #else
+        return __riscv_vlsseg3e8_v_u8m1x3(ptr, 0, VLEN_8);
+    #endif
+}
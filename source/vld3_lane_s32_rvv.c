@@ -0,0 +1,34 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three elements of 32-bit signed integers from memory into a lane of three 64-bit vectors.
+ *
+ * This function returns `src` with element `lane` of vector j replaced by element j at `ptr`,
+ * analogous to the ARM Neon function `vld3_lane_s32`. The elements are broadcast with a segment load
+ * with a stride of 0 and merged into `src` with a mask of the lane, which keeps the default
+ * tail-agnostic policy.
+ *
+ * @param ptr Pointer to the three elements to load.
+ * @param src The three vectors of type int32x2x3_t to insert the elements into.
+ * @param lane The lane to replace, from 0 to 1.
+ * @return int32x2x3_t The vectors `src` with the loaded elements in lane `lane`.
+ */
+RHAL_API int32x2x3_t vld3_lane_s32_rvv(const int32_t *ptr, int32x2x3_t src, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vbool64_t mask = __riscv_vmseq_vx_u32mf2_b64(__riscv_vid_v_u32mf2(VLEN_2), lane, VLEN_2);
+        int32x2x3_t seg = __riscv_vlsseg3e32_v_i32mf2x3(ptr, 0, VLEN_2);
+        src = __riscv_vset_v_i32mf2_i32mf2x3(src, 0, __riscv_vmerge_vvm_i32mf2(__riscv_vget_v_i32mf2x3_i32mf2(src, 0), __riscv_vget_v_i32mf2x3_i32mf2(seg, 0), mask, VLEN_2));
+        src = __riscv_vset_v_i32mf2_i32mf2x3(src, 1, __riscv_vmerge_vvm_i32mf2(__riscv_vget_v_i32mf2x3_i32mf2(src, 1), __riscv_vget_v_i32mf2x3_i32mf2(seg, 1), mask, VLEN_2));
+        src = __riscv_vset_v_i32mf2_i32mf2x3(src, 2, __riscv_vmerge_vvm_i32mf2(__riscv_vget_v_i32mf2x3_i32mf2(src, 2), __riscv_vget_v_i32mf2x3_i32mf2(seg, 2), mask, VLEN_2));
+        return src;
+    #else
+        vbool32_t mask = __riscv_vmseq_vx_u32m1_b32(__riscv_vid_v_u32m1(VLEN_2), lane, VLEN_2);
+        int32x2x3_t seg = __riscv_vlsseg3e32_v_i32m1x3(ptr, 0, VLEN_2);
+        src = __riscv_vset_v_i32m1_i32m1x3(src, 0, __riscv_vmerge_vvm_i32m1(__riscv_vget_v_i32m1x3_i32m1(src, 0), __riscv_vget_v_i32m1x3_i32m1(seg, 0), mask, VLEN_2));
+        src = __riscv_vset_v_i32m1_i32m1x3(src, 1, __riscv_vmerge_vvm_i32m1(__riscv_vget_v_i32m1x3_i32m1(src, 1), __riscv_vget_v_i32m1x3_i32m1(seg, 1), mask, VLEN_2));
+        src = __riscv_vset_v_i32m1_i32m1x3(src, 2, __riscv_vmerge_vvm_i32m1(__riscv_vget_v_i32m1x3_i32m1(src, 2), __riscv_vget_v_i32m1x3_i32m1(seg, 2), mask, VLEN_2));
+        return src;
+    #endif
+}
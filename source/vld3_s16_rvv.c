@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three 64-bit vectors of 16-bit signed integers from interleaved memory.
+ *
+ * This function loads 4 triples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every triple, analogous to the ARM Neon function `vld3_s16`. It is a single
+ * unit-stride segment load (`vlseg3e16.v`).
+ *
+ * @param ptr Pointer to the 12 interleaved elements to load.
+ * @return int16x4x3_t The three deinterleaved vectors.
+ */
+RHAL_API int16x4x3_t vld3_s16_rvv(const int16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlseg3e16_v_i16mf2x3(ptr, VLEN_4);
+    #else
+        return __riscv_vlseg3e16_v_i16m1x3(ptr, VLEN_4);
+    #endif
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three elements of 32-bit signed integers from memory into all lanes of three 128-bit vectors.
+ *
+ * This function loads the three consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld3q_dup_s32`. It is a single strided segment load
+ * (`vlsseg3e32.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the three elements to load.
+ * @return int32x4x3_t The three vectors with their element in every lane.
+ */
+RHAL_API int32x4x3_t vld3q_dup_s32_rvv(const int32_t *ptr) {
+    return __riscv_vlsseg3e32_v_i32m1x3(ptr, 0, VLEN_4);
+}
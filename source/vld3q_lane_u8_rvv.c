@@ -0,0 +1,25 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three elements of 8-bit unsigned integers from memory into a lane of three 128-bit vectors.
+ *
+ * This function returns `src` with element `lane` of vector j replaced by element j at `ptr`,
+ * analogous to the ARM Neon function `vld3q_lane_u8`. The elements are broadcast with a segment load
+ * with a stride of 0 and merged into `src` with a mask of the lane, which keeps the default
+ * tail-agnostic policy.
+ *
+ * @param ptr Pointer to the three elements to load.
+ * @param src The three vectors of type uint8x16x3_t to insert the elements into.
+ * @param lane The lane to replace, from 0 to 15.
+ * @return uint8x16x3_t The vectors `src` with the loaded elements in lane `lane`.
+ */
+RHAL_API uint8x16x3_t vld3q_lane_u8_rvv(const uint8_t *ptr, uint8x16x3_t src, const int lane) {
+    vbool8_t mask = __riscv_vmseq_vx_u8m1_b8(__riscv_vid_v_u8m1(VLEN_16), lane, VLEN_16);
+    uint8x16x3_t seg = __riscv_vlsseg3e8_v_u8m1x3(ptr, 0, VLEN_16);
+    src = __riscv_vset_v_u8m1_u8m1x3(src, 0, __riscv_vmerge_vvm_u8m1(__riscv_vget_v_u8m1x3_u8m1(src, 0), __riscv_vget_v_u8m1x3_u8m1(seg, 0), mask, VLEN_16));
+    src = __riscv_vset_v_u8m1_u8m1x3(src, 1, __riscv_vmerge_vvm_u8m1(__riscv_vget_v_u8m1x3_u8m1(src, 1), __riscv_vget_v_u8m1x3_u8m1(seg, 1), mask, VLEN_16));
+    src = __riscv_vset_v_u8m1_u8m1x3(src, 2, __riscv_vmerge_vvm_u8m1(__riscv_vget_v_u8m1x3_u8m1(src, 2), __riscv_vget_v_u8m1x3_u8m1(seg, 2), mask, VLEN_16));
+    return src;
+}
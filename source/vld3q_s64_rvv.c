@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three 128-bit vectors of 64-bit signed integers from interleaved memory.
+ *
+ * This function loads 2 triples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every triple, analogous to the ARM Neon function `vld3q_s64`. It is a single
+ * unit-stride segment load (`vlseg3e64.v`).
+ *
+ * @param ptr Pointer to the 6 interleaved elements to load.
+ * @return int64x2x3_t The three deinterleaved vectors.
+ */
+RHAL_API int64x2x3_t vld3q_s64_rvv(const int64_t *ptr) {
+    return __riscv_vlseg3e64_v_i64m1x3(ptr, VLEN_2);
+}
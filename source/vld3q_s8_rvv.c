@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three 128-bit vectors of 8-bit signed integers from interleaved memory.
+ *
+ * This function loads 16 triples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every triple, analogous to the ARM Neon function `vld3q_s8`. It is a single
+ * unit-stride segment load (`vlseg3e8.v`).
+ *
+ * @param ptr Pointer to the 48 interleaved elements to load.
+ * @return int8x16x3_t The three deinterleaved vectors.
+ */
+RHAL_API int8x16x3_t vld3q_s8_rvv(const int8_t *ptr) {
+    return __riscv_vlseg3e8_v_i8m1x3(ptr, VLEN_16);
+}
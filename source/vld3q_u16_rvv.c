@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three 128-bit vectors of 16-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 8 triples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every triple, analogous to the ARM Neon function `vld3q_u16`. It is a single
+ * unit-stride segment load (`vlseg3e16.v`).
+ *
+ * @param ptr Pointer to the 24 interleaved elements to load.
+ * @return uint16x8x3_t The three deinterleaved vectors.
+ */
+RHAL_API uint16x8x3_t vld3q_u16_rvv(const uint16_t *ptr) {
+    return __riscv_vlseg3e16_v_u16m1x3(ptr, VLEN_8);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three 128-bit vectors of 32-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 4 triples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every triple, analogous to the ARM Neon function `vld3q_u32`. It is a single
+ * unit-stride segment load (`vlseg3e32.v`).
+ *
+ * @param ptr Pointer to the 12 interleaved elements to load.
+ * @return uint32x4x3_t The three deinterleaved vectors.
+ */
+RHAL_API uint32x4x3_t vld3q_u32_rvv(const uint32_t *ptr) {
+    return __riscv_vlseg3e32_v_u32m1x3(ptr, VLEN_4);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads three 128-bit vectors of 64-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 2 triples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every triple, analogous to the ARM Neon function `vld3q_u64`. It is a single
+ * unit-stride segment load (`vlseg3e64.v`).
+ *
+ * @param ptr Pointer to the 6 interleaved elements to load.
+ * @return uint64x2x3_t The three deinterleaved vectors.
+ */
+RHAL_API uint64x2x3_t vld3q_u64_rvv(const uint64_t *ptr) {
+    return __riscv_vlseg3e64_v_u64m1x3(ptr, VLEN_2);
+}
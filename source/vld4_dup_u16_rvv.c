@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four elements of 16-bit unsigned integers from memory into all lanes of four 64-bit vectors.
+ *
+ * This function loads the four consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld4_dup_u16`. It is a single strided segment load
+ * (`vlsseg4e16.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the four elements to load.
+ * @return uint16x4x4_t The four vectors with their element in every lane.
+ */
+RHAL_API uint16x4x4_t vld4_dup_u16_rvv(const uint16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlsseg4e16_v_u16mf2x4(ptr, 0, VLEN_4);
+    #else
+        return __riscv_vlsseg4e16_v_u16m1x4(ptr, 0, VLEN_4);
+    #endif
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four elements of 8-bit unsigned integers from memory into all lanes of four 64-bit vectors.
+ *
+ * This function loads the four consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld4_dup_u8`. It is a single strided segment load
+ * (`vlsseg4e8.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the four elements to load.
+ * @return uint8x8x4_t The four vectors with their element in every lane.
+ */
+RHAL_API uint8x8x4_t vld4_dup_u8_rvv(const uint8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlsseg4e8_v_u8mf2x4(ptr, 0, VLEN_8);
+    #else
+        return __riscv_vlsseg4e8_v_u8m1x4(ptr, 0, VLEN_8);
+    #endif
+}
@@ -0,0 +1,36 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four elements of 16-bit signed integers from memory into a lane of four 64-bit vectors.
+ *
+ * This function returns `src` with element `lane` of vector j replaced by element j at `ptr`,
+ * analogous to the ARM Neon function `vld4_lane_s16`. The elements are broadcast with a segment load
+ * with a stride of 0 and merged into `src` with a mask of the lane, which keeps the default
+ * tail-agnostic policy.
+ *
+ * @param ptr Pointer to the four elements to load.
+ * @param src The four vectors of type int16x4x4_t to insert the elements into.
+ * @param lane The lane to replace, from 0 to 3.
+ * @return int16x4x4_t The vectors `src` with the loaded elements in lane `lane`.
+ */
+RHAL_API int16x4x4_t vld4_lane_s16_rvv(const int16_t *ptr, int16x4x4_t src, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vbool32_t mask = __riscv_vmseq_vx_u16mf2_b32(__riscv_vid_v_u16mf2(VLEN_4), lane, VLEN_4);
+        int16x4x4_t seg = __riscv_vlsseg4e16_v_i16mf2x4(ptr, 0, VLEN_4);
+        src = __riscv_vset_v_i16mf2_i16mf2x4(src, 0, __riscv_vmerge_vvm_i16mf2(__riscv_vget_v_i16mf2x4_i16mf2(src, 0), __riscv_vget_v_i16mf2x4_i16mf2(seg, 0), mask, VLEN_4));
+        src = __riscv_vset_v_i16mf2_i16mf2x4(src, 1, __riscv_vmerge_vvm_i16mf2(__riscv_vget_v_i16mf2x4_i16mf2(src, 1), __riscv_vget_v_i16mf2x4_i16mf2(seg, 1), mask, VLEN_4));
+        src = __riscv_vset_v_i16mf2_i16mf2x4(src, 2, __riscv_vmerge_vvm_i16mf2(__riscv_vget_v_i16mf2x4_i16mf2(src, 2), __riscv_vget_v_i16mf2x4_i16mf2(seg, 2), mask, VLEN_4));
+        src = __riscv_vset_v_i16mf2_i16mf2x4(src, 3, __riscv_vmerge_vvm_i16mf2(__riscv_vget_v_i16mf2x4_i16mf2(src, 3), __riscv_vget_v_i16mf2x4_i16mf2(seg, 3), mask, VLEN_4));
+        return src;
+    #else
+        vbool16_t mask = __riscv_vmseq_vx_u16m1_b16(__riscv_vid_v_u16m1(VLEN_4), lane, VLEN_4);
+        int16x4x4_t seg = __riscv_vlsseg4e16_v_i16m1x4(ptr, 0, VLEN_4);
+        src = __riscv_vset_v_i16m1_i16m1x4(src, 0, __riscv_vmerge_vvm_i16m1(__riscv_vget_v_i16m1x4_i16m1(src, 0), __riscv_vget_v_i16m1x4_i16m1(seg, 0), mask, VLEN_4));
+        src = __riscv_vset_v_i16m1_i16m1x4(src, 1, __riscv_vmerge_vvm_i16m1(__riscv_vget_v_i16m1x4_i16m1(src, 1), __riscv_vget_v_i16m1x4_i16m1(seg, 1), mask, VLEN_4));
+        src = __riscv_vset_v_i16m1_i16m1x4(src, 2, __riscv_vmerge_vvm_i16m1(__riscv_vget_v_i16m1x4_i16m1(src, 2), __riscv_vget_v_i16m1x4_i16m1(seg, 2), mask, VLEN_4));
+        src = __riscv_vset_v_i16m1_i16m1x4(src, 3, __riscv_vmerge_vvm_i16m1(__riscv_vget_v_i16m1x4_i16m1(src, 3), __riscv_vget_v_i16m1x4_i16m1(seg, 3), mask, VLEN_4));
+        return src;
+    #endif
+}
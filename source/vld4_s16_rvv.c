@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four 64-bit vectors of 16-bit signed integers from interleaved memory.
+ *
+ * This function loads 4 quadruples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every quadruple, analogous to the ARM Neon function `vld4_s16`. It is a single
+ * unit-stride segment load (`vlseg4e16.v`).
+ *
+ * @param ptr Pointer to the 16 interleaved elements to load.
+ * @return int16x4x4_t The four deinterleaved vectors.
+ */
+RHAL_API int16x4x4_t vld4_s16_rvv(const int16_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlseg4e16_v_i16mf2x4(ptr, VLEN_4);
+    #else
+        return __riscv_vlseg4e16_v_i16m1x4(ptr, VLEN_4);
+    #endif
+}
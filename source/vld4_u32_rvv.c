@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four 64-bit vectors of 32-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 2 quadruples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every quadruple, analogous to the ARM Neon function `vld4_u32`. It is a single
+ * unit-stride segment load (`vlseg4e32.v`).
+ *
+ * @param ptr Pointer to the 8 interleaved elements to load.
+ * @return uint32x2x4_t The four deinterleaved vectors.
+ */
+RHAL_API uint32x2x4_t vld4_u32_rvv(const uint32_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlseg4e32_v_u32mf2x4(ptr, VLEN_2);
+    #else
+        return __riscv_vlseg4e32_v_u32m1x4(ptr, VLEN_2);
+    #endif
+}
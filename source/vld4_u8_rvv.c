@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four 64-bit vectors of 8-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 8 quadruples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every quadruple, analogous to the ARM Neon function `vld4_u8`. It is a single
+ * unit-stride segment load (`vlseg4e8.v`).
+ *
+ * @param ptr Pointer to the 32 interleaved elements to load.
+ * @return uint8x8x4_t The four deinterleaved vectors.
+ */
+RHAL_API uint8x8x4_t vld4_u8_rvv(const uint8_t *ptr) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vlseg4e8_v_u8mf2x4(ptr, VLEN_8);
+    #else
+        return __riscv_vlseg4e8_v_u8m1x4(ptr, VLEN_8);
+    #endif
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four elements of 64-bit unsigned integers from memory into all lanes of four 128-bit vectors.
+ *
+ * This function loads the four consecutive elements at `ptr` and broadcasts element j to all lanes
+ * of vector j, analogous to the ARM Neon function `vld4q_dup_u64`. It is a single strided segment load
+ * (`vlsseg4e64.v`) with a stride of 0.
+ *
+ * @param ptr Pointer to the four elements to load.
+ * @return uint64x2x4_t The four vectors with their element in every lane.
+ */
+RHAL_API uint64x2x4_t vld4q_dup_u64_rvv(const uint64_t *ptr) {
+    return __riscv_vlsseg4e64_v_u64m1x4(ptr, 0, VLEN_2);
+}
@@ -0,0 +1,26 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four elements of 16-bit unsigned integers from memory into a lane of four 128-bit vectors.
+ *
+ * This function returns `src` with element `lane` of vector j replaced by element j at `ptr`,
+ * analogous to the ARM Neon function `vld4q_lane_u16`. The elements are broadcast with a segment load
+ * with a stride of 0 and merged into `src` with a mask of the lane, which keeps the default
+ * tail-agnostic policy.
+ *
+ * @param ptr Pointer to the four elements to load.
+ * @param src The four vectors of type uint16x8x4_t to insert the elements into.
+ * @param lane The lane to replace, from 0 to 7.
+ * @return uint16x8x4_t The vectors `src` with the loaded elements in lane `lane`.
+ */
+RHAL_API uint16x8x4_t vld4q_lane_u16_rvv(const uint16_t *ptr, uint16x8x4_t src, const int lane) {
+    vbool16_t mask = __riscv_vmseq_vx_u16m1_b16(__riscv_vid_v_u16m1(VLEN_8), lane, VLEN_8);
+    uint16x8x4_t seg = __riscv_vlsseg4e16_v_u16m1x4(ptr, 0, VLEN_8);
+    src = __riscv_vset_v_u16m1_u16m1x4(src, 0, __riscv_vmerge_vvm_u16m1(__riscv_vget_v_u16m1x4_u16m1(src, 0), __riscv_vget_v_u16m1x4_u16m1(seg, 0), mask, VLEN_8));
+    src = __riscv_vset_v_u16m1_u16m1x4(src, 1, __riscv_vmerge_vvm_u16m1(__riscv_vget_v_u16m1x4_u16m1(src, 1), __riscv_vget_v_u16m1x4_u16m1(seg, 1), mask, VLEN_8));
+    src = __riscv_vset_v_u16m1_u16m1x4(src, 2, __riscv_vmerge_vvm_u16m1(__riscv_vget_v_u16m1x4_u16m1(src, 2), __riscv_vget_v_u16m1x4_u16m1(seg, 2), mask, VLEN_8));
+    src = __riscv_vset_v_u16m1_u16m1x4(src, 3, __riscv_vmerge_vvm_u16m1(__riscv_vget_v_u16m1x4_u16m1(src, 3), __riscv_vget_v_u16m1x4_u16m1(seg, 3), mask, VLEN_8));
+    return src;
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four 128-bit vectors of 16-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 8 quadruples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every quadruple, analogous to the ARM Neon function `vld4q_u16`. It is a single
+ * unit-stride segment load (`vlseg4e16.v`).
+ *
+ * @param ptr Pointer to the 32 interleaved elements to load.
+ * @return uint16x8x4_t The four deinterleaved vectors.
+ */
+RHAL_API uint16x8x4_t vld4q_u16_rvv(const uint16_t *ptr) {
+    return __riscv_vlseg4e16_v_u16m1x4(ptr, VLEN_8);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four 128-bit vectors of 32-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 4 quadruples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every quadruple, analogous to the ARM Neon function `vld4q_u32`. It is a single
+ * unit-stride segment load (`vlseg4e32.v`).
+ *
+ * @param ptr Pointer to the 16 interleaved elements to load.
+ * @return uint32x4x4_t The four deinterleaved vectors.
+ */
+RHAL_API uint32x4x4_t vld4q_u32_rvv(const uint32_t *ptr) {
+    return __riscv_vlseg4e32_v_u32m1x4(ptr, VLEN_4);
+}
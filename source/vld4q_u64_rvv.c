@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four 128-bit vectors of 64-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 2 quadruples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every quadruple, analogous to the ARM Neon function `vld4q_u64`. It is a single
+ * unit-stride segment load (`vlseg4e64.v`).
+ *
+ * @param ptr Pointer to the 8 interleaved elements to load.
+ * @return uint64x2x4_t The four deinterleaved vectors.
+ */
+RHAL_API uint64x2x4_t vld4q_u64_rvv(const uint64_t *ptr) {
+    return __riscv_vlseg4e64_v_u64m1x4(ptr, VLEN_2);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Loads four 128-bit vectors of 8-bit unsigned integers from interleaved memory.
+ *
+ * This function loads 16 quadruples of elements from `ptr` and deinterleaves them, so that vector j
+ * holds element j of every quadruple, analogous to the ARM Neon function `vld4q_u8`. It is a single
+ * unit-stride segment load (`vlseg4e8.v`).
+ *
+ * @param ptr Pointer to the 64 interleaved elements to load.
+ * @return uint8x16x4_t The four deinterleaved vectors.
+ */
+RHAL_API uint8x16x4_t vld4q_u8_rvv(const uint8_t *ptr) {
+    return __riscv_vlseg4e8_v_u8m1x4(ptr, VLEN_16);
+}
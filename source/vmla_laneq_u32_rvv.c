@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 64-bit vector of 32-bit unsigned integers by one lane of a 128-bit vector into an accumulator.
+ *
+ * This function computes `a + b * v[lane]` element-wise, keeping the low 32 bits, analogous to the
+ * ARM Neon function `vmla_laneq_u32`. The lane is broadcast in registers with `vrgather.vx` and
+ * accumulated with `vmacc.vv`.
+ *
+ * @param a The accumulator vector of type uint32x2_t.
+ * @param b The multiplicand vector of type uint32x2_t.
+ * @param v The vector of type uint32x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return uint32x2_t The accumulator plus the products.
+ */
+RHAL_API uint32x2_t vmla_laneq_u32_rvv(uint32x2_t a, uint32x2_t b, uint32x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmacc_vv_u32mf2(a, b, __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vrgather_vx_u32m1(v, lane, VLEN_2)), VLEN_2);
+    #else
+        return __riscv_vmacc_vv_u32m1(a, b, __riscv_vrgather_vx_u32m1(v, lane, VLEN_2), VLEN_2);
+    #endif
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates two 64-bit vectors of 8-bit signed integers into an accumulator.
+ *
+ * This function computes `a + b * c` element-wise, keeping the low 8 bits, analogous to the ARM Neon
+ * function `vmla_s8`. It maps to `vmacc.vv`, which adds the product to `a` in place.
+ *
+ * @param a The accumulator vector of type int8x8_t.
+ * @param b The first multiplicand vector of type int8x8_t.
+ * @param c The second multiplicand vector of type int8x8_t.
+ * @return int8x8_t The accumulator plus the element-wise products.
+ */
+RHAL_API int8x8_t vmla_s8_rvv(int8x8_t a, int8x8_t b, int8x8_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmacc_vv_i8mf2(a, b, c, VLEN_8);
+    #else
+        return __riscv_vmacc_vv_i8m1(a, b, c, VLEN_8);
+    #endif
+}
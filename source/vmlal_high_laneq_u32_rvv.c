@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates the high half of a 128-bit vector of 32-bit unsigned integers by one lane of a 128-bit vector into a 64-bit accumulator.
+ *
+ * This function computes `a + high(b) * v[lane]` element-wise with the products widened to 64-bit,
+ * analogous to the ARM Neon function `vmlal_high_laneq_u32`. The high half is moved down with
+ * `vslidedown`. The lane is broadcast in registers with `vrgather.vx`. It maps to `vwmaccu.vv`, which
+ * accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type uint64x2_t.
+ * @param b The multiplicand vector of type uint32x4_t, of which the high half is used.
+ * @param v The vector of type uint32x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return uint64x2_t The accumulator plus the widened products.
+ */
+RHAL_API uint64x2_t vmlal_high_laneq_u32_rvv(uint64x2_t a, uint32x4_t b, uint32x4_t v, const int lane) {
+    return __riscv_vwmaccu_vv_u64m1(a, __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(b, 2, VLEN_2)), __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vrgather_vx_u32m1(v, lane, VLEN_2)), VLEN_2);
+}
@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates the high half of a 128-bit vector of 16-bit unsigned integers by a scalar into a 32-bit accumulator.
+ *
+ * This function computes `a + high(b) * c` element-wise with the products widened to 32-bit, analogous
+ * to the ARM Neon function `vmlal_high_n_u16`. The high half is moved down with `vslidedown`. It maps
+ * to `vwmaccu.vx`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type uint32x4_t.
+ * @param b The multiplicand vector of type uint16x8_t, of which the high half is used.
+ * @param c The scalar multiplier.
+ * @return uint32x4_t The accumulator plus the widened products.
+ */
+RHAL_API uint32x4_t vmlal_high_n_u16_rvv(uint32x4_t a, uint16x8_t b, uint16_t c) {
+    return __riscv_vwmaccu_vx_u32m1(a, c, __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(b, 4, VLEN_4)), VLEN_4);
+}
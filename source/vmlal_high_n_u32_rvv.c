@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates the high half of a 128-bit vector of 32-bit unsigned integers by a scalar into a 64-bit accumulator.
+ *
+ * This function computes `a + high(b) * c` element-wise with the products widened to 64-bit, analogous
+ * to the ARM Neon function `vmlal_high_n_u32`. The high half is moved down with `vslidedown`. It maps
+ * to `vwmaccu.vx`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type uint64x2_t.
+ * @param b The multiplicand vector of type uint32x4_t, of which the high half is used.
+ * @param c The scalar multiplier.
+ * @return uint64x2_t The accumulator plus the widened products.
+ */
+RHAL_API uint64x2_t vmlal_high_n_u32_rvv(uint64x2_t a, uint32x4_t b, uint32_t c) {
+    return __riscv_vwmaccu_vx_u64m1(a, c, __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(b, 2, VLEN_2)), VLEN_2);
+}
@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates the high half of a 128-bit vector of 32-bit signed integers by the high half of another into a 64-bit accumulator.
+ *
+ * This function computes `a + high(b) * high(c)` element-wise with the products widened to 64-bit,
+ * analogous to the ARM Neon function `vmlal_high_s32`. The high halves are moved down with
+ * `vslidedown`. It maps to `vwmacc.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type int64x2_t.
+ * @param b The first multiplicand vector of type int32x4_t, of which the high half is used.
+ * @param c The second multiplicand vector of type int32x4_t, of which the high half is used.
+ * @return int64x2_t The accumulator plus the widened products.
+ */
+RHAL_API int64x2_t vmlal_high_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t c) {
+    return __riscv_vwmacc_vv_i64m1(a, __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(b, 2, VLEN_2)), __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(c, 2, VLEN_2)), VLEN_2);
+}
@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates the high half of a 128-bit vector of 8-bit signed integers by the high half of another into a 16-bit accumulator.
+ *
+ * This function computes `a + high(b) * high(c)` element-wise with the products widened to 16-bit,
+ * analogous to the ARM Neon function `vmlal_high_s8`. The high halves are moved down with
+ * `vslidedown`. It maps to `vwmacc.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type int16x8_t.
+ * @param b The first multiplicand vector of type int8x16_t, of which the high half is used.
+ * @param c The second multiplicand vector of type int8x16_t, of which the high half is used.
+ * @return int16x8_t The accumulator plus the widened products.
+ */
+RHAL_API int16x8_t vmlal_high_s8_rvv(int16x8_t a, int8x16_t b, int8x16_t c) {
+    return __riscv_vwmacc_vv_i16m1(a, __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(b, 8, VLEN_8)), __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(c, 8, VLEN_8)), VLEN_8);
+}
@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates the high half of a 128-bit vector of 8-bit unsigned integers by the high half of another into a 16-bit accumulator.
+ *
+ * This function computes `a + high(b) * high(c)` element-wise with the products widened to 16-bit,
+ * analogous to the ARM Neon function `vmlal_high_u8`. The high halves are moved down with
+ * `vslidedown`. It maps to `vwmaccu.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type uint16x8_t.
+ * @param b The first multiplicand vector of type uint8x16_t, of which the high half is used.
+ * @param c The second multiplicand vector of type uint8x16_t, of which the high half is used.
+ * @return uint16x8_t The accumulator plus the widened products.
+ */
+RHAL_API uint16x8_t vmlal_high_u8_rvv(uint16x8_t a, uint8x16_t b, uint8x16_t c) {
+    return __riscv_vwmaccu_vv_u16m1(a, __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(b, 8, VLEN_8)), __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(c, 8, VLEN_8)), VLEN_8);
+}
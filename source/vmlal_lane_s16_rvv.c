@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 64-bit vector of 16-bit signed integers by one lane of a 64-bit vector into a 32-bit accumulator.
+ *
+ * This function computes `a + b * v[lane]` element-wise with the products widened to 32-bit, analogous
+ * to the ARM Neon function `vmlal_lane_s16`. The lane is broadcast in registers with `vrgather.vx`. It
+ * maps to `vwmacc.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The multiplicand vector of type int16x4_t.
+ * @param v The vector of type int16x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return int32x4_t The accumulator plus the widened products.
+ */
+RHAL_API int32x4_t vmlal_lane_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmacc_vv_i32m1(a, b, __riscv_vrgather_vx_i16mf2(v, lane, VLEN_4), VLEN_4);
+    #else
+        return __riscv_vwmacc_vv_i32m1(a, __riscv_vlmul_trunc_v_i16m1_i16mf2(b), __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vrgather_vx_i16m1(v, lane, VLEN_4)), VLEN_4);
+    #endif
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 64-bit vector of 32-bit signed integers by one lane of a 64-bit vector into a 64-bit accumulator.
+ *
+ * This function computes `a + b * v[lane]` element-wise with the products widened to 64-bit, analogous
+ * to the ARM Neon function `vmlal_lane_s32`. The lane is broadcast in registers with `vrgather.vx`. It
+ * maps to `vwmacc.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type int64x2_t.
+ * @param b The multiplicand vector of type int32x2_t.
+ * @param v The vector of type int32x2_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 1.
+ * @return int64x2_t The accumulator plus the widened products.
+ */
+RHAL_API int64x2_t vmlal_lane_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmacc_vv_i64m1(a, b, __riscv_vrgather_vx_i32mf2(v, lane, VLEN_2), VLEN_2);
+    #else
+        return __riscv_vwmacc_vv_i64m1(a, __riscv_vlmul_trunc_v_i32m1_i32mf2(b), __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vrgather_vx_i32m1(v, lane, VLEN_2)), VLEN_2);
+    #endif
+}
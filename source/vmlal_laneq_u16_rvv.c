@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 64-bit vector of 16-bit unsigned integers by one lane of a 128-bit vector into a 32-bit accumulator.
+ *
+ * This function computes `a + b * v[lane]` element-wise with the products widened to 32-bit, analogous
+ * to the ARM Neon function `vmlal_laneq_u16`. The lane is broadcast in registers with `vrgather.vx`.
+ * It maps to `vwmaccu.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type uint32x4_t.
+ * @param b The multiplicand vector of type uint16x4_t.
+ * @param v The vector of type uint16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return uint32x4_t The accumulator plus the widened products.
+ */
+RHAL_API uint32x4_t vmlal_laneq_u16_rvv(uint32x4_t a, uint16x4_t b, uint16x8_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmaccu_vv_u32m1(a, b, __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vrgather_vx_u16m1(v, lane, VLEN_4)), VLEN_4);
+    #else
+        return __riscv_vwmaccu_vv_u32m1(a, __riscv_vlmul_trunc_v_u16m1_u16mf2(b), __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vrgather_vx_u16m1(v, lane, VLEN_4)), VLEN_4);
+    #endif
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 64-bit vector of 32-bit unsigned integers by one lane of a 128-bit vector into a 64-bit accumulator.
+ *
+ * This function computes `a + b * v[lane]` element-wise with the products widened to 64-bit, analogous
+ * to the ARM Neon function `vmlal_laneq_u32`. The lane is broadcast in registers with `vrgather.vx`.
+ * It maps to `vwmaccu.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type uint64x2_t.
+ * @param b The multiplicand vector of type uint32x2_t.
+ * @param v The vector of type uint32x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return uint64x2_t The accumulator plus the widened products.
+ */
+RHAL_API uint64x2_t vmlal_laneq_u32_rvv(uint64x2_t a, uint32x2_t b, uint32x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmaccu_vv_u64m1(a, b, __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vrgather_vx_u32m1(v, lane, VLEN_2)), VLEN_2);
+    #else
+        return __riscv_vwmaccu_vv_u64m1(a, __riscv_vlmul_trunc_v_u32m1_u32mf2(b), __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vrgather_vx_u32m1(v, lane, VLEN_2)), VLEN_2);
+    #endif
+}
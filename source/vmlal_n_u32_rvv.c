@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 64-bit vector of 32-bit unsigned integers by a scalar into a 64-bit accumulator.
+ *
+ * This function computes `a + b * c` element-wise with the products widened to 64-bit, analogous to
+ * the ARM Neon function `vmlal_n_u32`. It maps to `vwmaccu.vx`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type uint64x2_t.
+ * @param b The multiplicand vector of type uint32x2_t.
+ * @param c The scalar multiplier.
+ * @return uint64x2_t The accumulator plus the widened products.
+ */
+RHAL_API uint64x2_t vmlal_n_u32_rvv(uint64x2_t a, uint32x2_t b, uint32_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmaccu_vx_u64m1(a, c, b, VLEN_2);
+    #else
+        return __riscv_vwmaccu_vx_u64m1(a, c, __riscv_vlmul_trunc_v_u32m1_u32mf2(b), VLEN_2);
+    #endif
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 64-bit vector of 16-bit signed integers by another into a 32-bit accumulator.
+ *
+ * This function computes `a + b * c` element-wise with the products widened to 32-bit, analogous to
+ * the ARM Neon function `vmlal_s16`. It maps to `vwmacc.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The first multiplicand vector of type int16x4_t.
+ * @param c The second multiplicand vector of type int16x4_t.
+ * @return int32x4_t The accumulator plus the widened products.
+ */
+RHAL_API int32x4_t vmlal_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmacc_vv_i32m1(a, b, c, VLEN_4);
+    #else
+        return __riscv_vwmacc_vv_i32m1(a, __riscv_vlmul_trunc_v_i16m1_i16mf2(b), __riscv_vlmul_trunc_v_i16m1_i16mf2(c), VLEN_4);
+    #endif
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 64-bit vector of 16-bit unsigned integers by another into a 32-bit accumulator.
+ *
+ * This function computes `a + b * c` element-wise with the products widened to 32-bit, analogous to
+ * the ARM Neon function `vmlal_u16`. It maps to `vwmaccu.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type uint32x4_t.
+ * @param b The first multiplicand vector of type uint16x4_t.
+ * @param c The second multiplicand vector of type uint16x4_t.
+ * @return uint32x4_t The accumulator plus the widened products.
+ */
+RHAL_API uint32x4_t vmlal_u16_rvv(uint32x4_t a, uint16x4_t b, uint16x4_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmaccu_vv_u32m1(a, b, c, VLEN_4);
+    #else
+        return __riscv_vwmaccu_vv_u32m1(a, __riscv_vlmul_trunc_v_u16m1_u16mf2(b), __riscv_vlmul_trunc_v_u16m1_u16mf2(c), VLEN_4);
+    #endif
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 64-bit vector of 32-bit unsigned integers by another into a 64-bit accumulator.
+ *
+ * This function computes `a + b * c` element-wise with the products widened to 64-bit, analogous to
+ * the ARM Neon function `vmlal_u32`. It maps to `vwmaccu.vv`, which accumulates into `a` in place.
+ *
+ * @param a The accumulator vector of type uint64x2_t.
+ * @param b The first multiplicand vector of type uint32x2_t.
+ * @param c The second multiplicand vector of type uint32x2_t.
+ * @return uint64x2_t The accumulator plus the widened products.
+ */
+RHAL_API uint64x2_t vmlal_u32_rvv(uint64x2_t a, uint32x2_t b, uint32x2_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmaccu_vv_u64m1(a, b, c, VLEN_2);
+    #else
+        return __riscv_vwmaccu_vv_u64m1(a, __riscv_vlmul_trunc_v_u32m1_u32mf2(b), __riscv_vlmul_trunc_v_u32m1_u32mf2(c), VLEN_2);
+    #endif
+}
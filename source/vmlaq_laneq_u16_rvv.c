@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 128-bit vector of 16-bit unsigned integers by one lane of a 128-bit vector into an accumulator.
+ *
+ * This function computes `a + b * v[lane]` element-wise, keeping the low 16 bits, analogous to the
+ * ARM Neon function `vmlaq_laneq_u16`. The lane is broadcast in registers with `vrgather.vx` and
+ * accumulated with `vmacc.vv`.
+ *
+ * @param a The accumulator vector of type uint16x8_t.
+ * @param b The multiplicand vector of type uint16x8_t.
+ * @param v The vector of type uint16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return uint16x8_t The accumulator plus the products.
+ */
+RHAL_API uint16x8_t vmlaq_laneq_u16_rvv(uint16x8_t a, uint16x8_t b, uint16x8_t v, const int lane) {
+    return __riscv_vmacc_vv_u16m1(a, b, __riscv_vrgather_vx_u16m1(v, lane, VLEN_8), VLEN_8);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 128-bit vector of 16-bit unsigned integers by a scalar into an accumulator.
+ *
+ * This function computes `a + b * c` for every element of `b`, keeping the low 16 bits, analogous to
+ * the ARM Neon function `vmlaq_n_u16`. It maps to `vmacc.vx`.
+ *
+ * @param a The accumulator vector of type uint16x8_t.
+ * @param b The multiplicand vector of type uint16x8_t.
+ * @param c The scalar multiplier.
+ * @return uint16x8_t The accumulator plus the products.
+ */
+RHAL_API uint16x8_t vmlaq_n_u16_rvv(uint16x8_t a, uint16x8_t b, uint16_t c) {
+    return __riscv_vmacc_vx_u16m1(a, c, b, VLEN_8);
+}
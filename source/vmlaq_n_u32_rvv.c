@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates a 128-bit vector of 32-bit unsigned integers by a scalar into an accumulator.
+ *
+ * This function computes `a + b * c` for every element of `b`, keeping the low 32 bits, analogous to
+ * the ARM Neon function `vmlaq_n_u32`. It maps to `vmacc.vx`.
+ *
+ * @param a The accumulator vector of type uint32x4_t.
+ * @param b The multiplicand vector of type uint32x4_t.
+ * @param c The scalar multiplier.
+ * @return uint32x4_t The accumulator plus the products.
+ */
+RHAL_API uint32x4_t vmlaq_n_u32_rvv(uint32x4_t a, uint32x4_t b, uint32_t c) {
+    return __riscv_vmacc_vx_u32m1(a, c, b, VLEN_4);
+}
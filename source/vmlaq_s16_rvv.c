@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates two 128-bit vectors of 16-bit signed integers into an accumulator.
+ *
+ * This function computes `a + b * c` element-wise, keeping the low 16 bits, analogous to the ARM Neon
+ * function `vmlaq_s16`. It maps to `vmacc.vv`, which adds the product to `a` in place.
+ *
+ * @param a The accumulator vector of type int16x8_t.
+ * @param b The first multiplicand vector of type int16x8_t.
+ * @param c The second multiplicand vector of type int16x8_t.
+ * @return int16x8_t The accumulator plus the element-wise products.
+ */
+RHAL_API int16x8_t vmlaq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t c) {
+    return __riscv_vmacc_vv_i16m1(a, b, c, VLEN_8);
+}
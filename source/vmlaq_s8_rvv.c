@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates two 128-bit vectors of 8-bit signed integers into an accumulator.
+ *
+ * This function computes `a + b * c` element-wise, keeping the low 8 bits, analogous to the ARM Neon
+ * function `vmlaq_s8`. It maps to `vmacc.vv`, which adds the product to `a` in place.
+ *
+ * @param a The accumulator vector of type int8x16_t.
+ * @param b The first multiplicand vector of type int8x16_t.
+ * @param c The second multiplicand vector of type int8x16_t.
+ * @return int8x16_t The accumulator plus the element-wise products.
+ */
+RHAL_API int8x16_t vmlaq_s8_rvv(int8x16_t a, int8x16_t b, int8x16_t c) {
+    return __riscv_vmacc_vv_i8m1(a, b, c, VLEN_16);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and accumulates two 128-bit vectors of 32-bit unsigned integers into an accumulator.
+ *
+ * This function computes `a + b * c` element-wise, keeping the low 32 bits, analogous to the ARM Neon
+ * function `vmlaq_u32`. It maps to `vmacc.vv`, which adds the product to `a` in place.
+ *
+ * @param a The accumulator vector of type uint32x4_t.
+ * @param b The first multiplicand vector of type uint32x4_t.
+ * @param c The second multiplicand vector of type uint32x4_t.
+ * @return uint32x4_t The accumulator plus the element-wise products.
+ */
+RHAL_API uint32x4_t vmlaq_u32_rvv(uint32x4_t a, uint32x4_t b, uint32x4_t c) {
+    return __riscv_vmacc_vv_u32m1(a, b, c, VLEN_4);
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 64-bit vector of 16-bit signed integers by one lane of a 128-bit vector from an accumulator.
+ *
+ * This function computes `a - b * v[lane]` element-wise, keeping the low 16 bits, analogous to the
+ * ARM Neon function `vmls_laneq_s16`. The lane is broadcast in registers with `vrgather.vx` and
+ * accumulated with `vnmsac.vv`.
+ *
+ * @param a The accumulator vector of type int16x4_t.
+ * @param b The multiplicand vector of type int16x4_t.
+ * @param v The vector of type int16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return int16x4_t The accumulator minus the products.
+ */
+RHAL_API int16x4_t vmls_laneq_s16_rvv(int16x4_t a, int16x4_t b, int16x8_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnmsac_vv_i16mf2(a, b, __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vrgather_vx_i16m1(v, lane, VLEN_4)), VLEN_4);
+    #else
+        return __riscv_vnmsac_vv_i16m1(a, b, __riscv_vrgather_vx_i16m1(v, lane, VLEN_4), VLEN_4);
+    #endif
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 64-bit vector of 16-bit unsigned integers by a scalar from an accumulator.
+ *
+ * This function computes `a - b * c` for every element of `b`, keeping the low 16 bits, analogous to
+ * the ARM Neon function `vmls_n_u16`. It maps to `vnmsac.vx`.
+ *
+ * @param a The accumulator vector of type uint16x4_t.
+ * @param b The multiplicand vector of type uint16x4_t.
+ * @param c The scalar multiplier.
+ * @return uint16x4_t The accumulator minus the products.
+ */
+RHAL_API uint16x4_t vmls_n_u16_rvv(uint16x4_t a, uint16x4_t b, uint16_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnmsac_vx_u16mf2(a, c, b, VLEN_4);
+    #else
+        return __riscv_vnmsac_vx_u16m1(a, c, b, VLEN_4);
+    #endif
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 64-bit vector of 32-bit unsigned integers by a scalar from an accumulator.
+ *
+ * This function computes `a - b * c` for every element of `b`, keeping the low 32 bits, analogous to
+ * the ARM Neon function `vmls_n_u32`. It maps to `vnmsac.vx`.
+ *
+ * @param a The accumulator vector of type uint32x2_t.
+ * @param b The multiplicand vector of type uint32x2_t.
+ * @param c The scalar multiplier.
+ * @return uint32x2_t The accumulator minus the products.
+ */
+RHAL_API uint32x2_t vmls_n_u32_rvv(uint32x2_t a, uint32x2_t b, uint32_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnmsac_vx_u32mf2(a, c, b, VLEN_2);
+    #else
+        return __riscv_vnmsac_vx_u32m1(a, c, b, VLEN_2);
+    #endif
+}
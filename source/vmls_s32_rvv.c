@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts two 64-bit vectors of 32-bit signed integers from an accumulator.
+ *
+ * This function computes `a - b * c` element-wise, keeping the low 32 bits, analogous to the ARM Neon
+ * function `vmls_s32`. It maps to `vnmsac.vv`, which subtracts the product from `a` in place.
+ *
+ * @param a The accumulator vector of type int32x2_t.
+ * @param b The first multiplicand vector of type int32x2_t.
+ * @param c The second multiplicand vector of type int32x2_t.
+ * @return int32x2_t The accumulator minus the element-wise products.
+ */
+RHAL_API int32x2_t vmls_s32_rvv(int32x2_t a, int32x2_t b, int32x2_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnmsac_vv_i32mf2(a, b, c, VLEN_2);
+    #else
+        return __riscv_vnmsac_vv_i32m1(a, b, c, VLEN_2);
+    #endif
+}
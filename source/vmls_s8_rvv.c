@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts two 64-bit vectors of 8-bit signed integers from an accumulator.
+ *
+ * This function computes `a - b * c` element-wise, keeping the low 8 bits, analogous to the ARM Neon
+ * function `vmls_s8`. It maps to `vnmsac.vv`, which subtracts the product from `a` in place.
+ *
+ * @param a The accumulator vector of type int8x8_t.
+ * @param b The first multiplicand vector of type int8x8_t.
+ * @param c The second multiplicand vector of type int8x8_t.
+ * @return int8x8_t The accumulator minus the element-wise products.
+ */
+RHAL_API int8x8_t vmls_s8_rvv(int8x8_t a, int8x8_t b, int8x8_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnmsac_vv_i8mf2(a, b, c, VLEN_8);
+    #else
+        return __riscv_vnmsac_vv_i8m1(a, b, c, VLEN_8);
+    #endif
+}
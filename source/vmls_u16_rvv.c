@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts two 64-bit vectors of 16-bit unsigned integers from an accumulator.
+ *
+ * This function computes `a - b * c` element-wise, keeping the low 16 bits, analogous to the ARM Neon
+ * function `vmls_u16`. It maps to `vnmsac.vv`, which subtracts the product from `a` in place.
+ *
+ * @param a The accumulator vector of type uint16x4_t.
+ * @param b The first multiplicand vector of type uint16x4_t.
+ * @param c The second multiplicand vector of type uint16x4_t.
+ * @return uint16x4_t The accumulator minus the element-wise products.
+ */
+RHAL_API uint16x4_t vmls_u16_rvv(uint16x4_t a, uint16x4_t b, uint16x4_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnmsac_vv_u16mf2(a, b, c, VLEN_4);
+    #else
+        return __riscv_vnmsac_vv_u16m1(a, b, c, VLEN_4);
+    #endif
+}
@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts two 64-bit vectors of 32-bit unsigned integers from an accumulator.
+ *
+ * This function computes `a - b * c` element-wise, keeping the low 32 bits, analogous to the ARM Neon
+ * function `vmls_u32`. It maps to `vnmsac.vv`, which subtracts the product from `a` in place.
+ *
+ * @param a The accumulator vector of type uint32x2_t.
+ * @param b The first multiplicand vector of type uint32x2_t.
+ * @param c The second multiplicand vector of type uint32x2_t.
+ * @return uint32x2_t The accumulator minus the element-wise products.
+ */
+RHAL_API uint32x2_t vmls_u32_rvv(uint32x2_t a, uint32x2_t b, uint32x2_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnmsac_vv_u32mf2(a, b, c, VLEN_2);
+    #else
+        return __riscv_vnmsac_vv_u32m1(a, b, c, VLEN_2);
+    #endif
+}
@@ -0,0 +1,25 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts the high half of a 128-bit vector of 16-bit unsigned integers by one lane of a 64-bit vector from a 32-bit accumulator.
+ *
+ * This function computes `a - high(b) * v[lane]` element-wise with the products widened to 32-bit,
+ * analogous to the ARM Neon function `vmlsl_high_lane_u16`. The high half is moved down with
+ * `vslidedown`. The lane is broadcast in registers with `vrgather.vx`. RVV has no widening
+ * multiply-subtract, so the product of `vwmulu.vv` is subtracted with `vsub.vv`.
+ *
+ * @param a The accumulator vector of type uint32x4_t.
+ * @param b The multiplicand vector of type uint16x8_t, of which the high half is used.
+ * @param v The vector of type uint16x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return uint32x4_t The accumulator minus the widened products.
+ */
+RHAL_API uint32x4_t vmlsl_high_lane_u16_rvv(uint32x4_t a, uint16x8_t b, uint16x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsub_vv_u32m1(a, __riscv_vwmulu_vv_u32m1(__riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(b, 4, VLEN_4)), __riscv_vrgather_vx_u16mf2(v, lane, VLEN_4), VLEN_4), VLEN_4);
+    #else
+        return __riscv_vsub_vv_u32m1(a, __riscv_vwmulu_vv_u32m1(__riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(b, 4, VLEN_4)), __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vrgather_vx_u16m1(v, lane, VLEN_4)), VLEN_4), VLEN_4);
+    #endif
+}
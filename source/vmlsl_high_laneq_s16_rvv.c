@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts the high half of a 128-bit vector of 16-bit signed integers by one lane of a 128-bit vector from a 32-bit accumulator.
+ *
+ * This function computes `a - high(b) * v[lane]` element-wise with the products widened to 32-bit,
+ * analogous to the ARM Neon function `vmlsl_high_laneq_s16`. The high half is moved down with
+ * `vslidedown`. The lane is broadcast in registers with `vrgather.vx`. RVV has no widening
+ * multiply-subtract, so the product of `vwmul.vv` is subtracted with `vsub.vv`.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The multiplicand vector of type int16x8_t, of which the high half is used.
+ * @param v The vector of type int16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return int32x4_t The accumulator minus the widened products.
+ */
+RHAL_API int32x4_t vmlsl_high_laneq_s16_rvv(int32x4_t a, int16x8_t b, int16x8_t v, const int lane) {
+    return __riscv_vsub_vv_i32m1(a, __riscv_vwmul_vv_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(b, 4, VLEN_4)), __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vrgather_vx_i16m1(v, lane, VLEN_4)), VLEN_4), VLEN_4);
+}
@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts the high half of a 128-bit vector of 32-bit unsigned integers by a scalar from a 64-bit accumulator.
+ *
+ * This function computes `a - high(b) * c` element-wise with the products widened to 64-bit, analogous
+ * to the ARM Neon function `vmlsl_high_n_u32`. The high half is moved down with `vslidedown`. RVV has
+ * no widening multiply-subtract, so the product of `vwmulu.vx` is subtracted with `vsub.vv`.
+ *
+ * @param a The accumulator vector of type uint64x2_t.
+ * @param b The multiplicand vector of type uint32x4_t, of which the high half is used.
+ * @param c The scalar multiplier.
+ * @return uint64x2_t The accumulator minus the widened products.
+ */
+RHAL_API uint64x2_t vmlsl_high_n_u32_rvv(uint64x2_t a, uint32x4_t b, uint32_t c) {
+    return __riscv_vsub_vv_u64m1(a, __riscv_vwmulu_vx_u64m1(__riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(b, 2, VLEN_2)), c, VLEN_2), VLEN_2);
+}
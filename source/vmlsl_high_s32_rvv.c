@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts the high half of a 128-bit vector of 32-bit signed integers by the high half of another from a 64-bit accumulator.
+ *
+ * This function computes `a - high(b) * high(c)` element-wise with the products widened to 64-bit,
+ * analogous to the ARM Neon function `vmlsl_high_s32`. The high halves are moved down with
+ * `vslidedown`. RVV has no widening multiply-subtract, so the product of `vwmul.vv` is subtracted with
+ * `vsub.vv`.
+ *
+ * @param a The accumulator vector of type int64x2_t.
+ * @param b The first multiplicand vector of type int32x4_t, of which the high half is used.
+ * @param c The second multiplicand vector of type int32x4_t, of which the high half is used.
+ * @return int64x2_t The accumulator minus the widened products.
+ */
+RHAL_API int64x2_t vmlsl_high_s32_rvv(int64x2_t a, int32x4_t b, int32x4_t c) {
+    return __riscv_vsub_vv_i64m1(a, __riscv_vwmul_vv_i64m1(__riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(b, 2, VLEN_2)), __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(c, 2, VLEN_2)), VLEN_2), VLEN_2);
+}
@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts the high half of a 128-bit vector of 8-bit unsigned integers by the high half of another from a 16-bit accumulator.
+ *
+ * This function computes `a - high(b) * high(c)` element-wise with the products widened to 16-bit,
+ * analogous to the ARM Neon function `vmlsl_high_u8`. The high halves are moved down with
+ * `vslidedown`. RVV has no widening multiply-subtract, so the product of `vwmulu.vv` is subtracted
+ * with `vsub.vv`.
+ *
+ * @param a The accumulator vector of type uint16x8_t.
+ * @param b The first multiplicand vector of type uint8x16_t, of which the high half is used.
+ * @param c The second multiplicand vector of type uint8x16_t, of which the high half is used.
+ * @return uint16x8_t The accumulator minus the widened products.
+ */
+RHAL_API uint16x8_t vmlsl_high_u8_rvv(uint16x8_t a, uint8x16_t b, uint8x16_t c) {
+    return __riscv_vsub_vv_u16m1(a, __riscv_vwmulu_vv_u16m1(__riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(b, 8, VLEN_8)), __riscv_vlmul_trunc_v_u8m1_u8mf2(__riscv_vslidedown_vx_u8m1(c, 8, VLEN_8)), VLEN_8), VLEN_8);
+}
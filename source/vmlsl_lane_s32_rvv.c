@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 64-bit vector of 32-bit signed integers by one lane of a 64-bit vector from a 64-bit accumulator.
+ *
+ * This function computes `a - b * v[lane]` element-wise with the products widened to 64-bit, analogous
+ * to the ARM Neon function `vmlsl_lane_s32`. The lane is broadcast in registers with `vrgather.vx`.
+ * RVV has no widening multiply-subtract, so the product of `vwmul.vv` is subtracted with `vsub.vv`.
+ *
+ * @param a The accumulator vector of type int64x2_t.
+ * @param b The multiplicand vector of type int32x2_t.
+ * @param v The vector of type int32x2_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 1.
+ * @return int64x2_t The accumulator minus the widened products.
+ */
+RHAL_API int64x2_t vmlsl_lane_s32_rvv(int64x2_t a, int32x2_t b, int32x2_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsub_vv_i64m1(a, __riscv_vwmul_vv_i64m1(b, __riscv_vrgather_vx_i32mf2(v, lane, VLEN_2), VLEN_2), VLEN_2);
+    #else
+        return __riscv_vsub_vv_i64m1(a, __riscv_vwmul_vv_i64m1(__riscv_vlmul_trunc_v_i32m1_i32mf2(b), __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vrgather_vx_i32m1(v, lane, VLEN_2)), VLEN_2), VLEN_2);
+    #endif
+}
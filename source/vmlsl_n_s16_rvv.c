@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 64-bit vector of 16-bit signed integers by a scalar from a 32-bit accumulator.
+ *
+ * This function computes `a - b * c` element-wise with the products widened to 32-bit, analogous to
+ * the ARM Neon function `vmlsl_n_s16`. RVV has no widening multiply-subtract, so the product of
+ * `vwmul.vx` is subtracted with `vsub.vv`.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The multiplicand vector of type int16x4_t.
+ * @param c The scalar multiplier.
+ * @return int32x4_t The accumulator minus the widened products.
+ */
+RHAL_API int32x4_t vmlsl_n_s16_rvv(int32x4_t a, int16x4_t b, int16_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsub_vv_i32m1(a, __riscv_vwmul_vx_i32m1(b, c, VLEN_4), VLEN_4);
+    #else
+        return __riscv_vsub_vv_i32m1(a, __riscv_vwmul_vx_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(b), c, VLEN_4), VLEN_4);
+    #endif
+}
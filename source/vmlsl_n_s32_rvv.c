@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 64-bit vector of 32-bit signed integers by a scalar from a 64-bit accumulator.
+ *
+ * This function computes `a - b * c` element-wise with the products widened to 64-bit, analogous to
+ * the ARM Neon function `vmlsl_n_s32`. RVV has no widening multiply-subtract, so the product of
+ * `vwmul.vx` is subtracted with `vsub.vv`.
+ *
+ * @param a The accumulator vector of type int64x2_t.
+ * @param b The multiplicand vector of type int32x2_t.
+ * @param c The scalar multiplier.
+ * @return int64x2_t The accumulator minus the widened products.
+ */
+RHAL_API int64x2_t vmlsl_n_s32_rvv(int64x2_t a, int32x2_t b, int32_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsub_vv_i64m1(a, __riscv_vwmul_vx_i64m1(b, c, VLEN_2), VLEN_2);
+    #else
+        return __riscv_vsub_vv_i64m1(a, __riscv_vwmul_vx_i64m1(__riscv_vlmul_trunc_v_i32m1_i32mf2(b), c, VLEN_2), VLEN_2);
+    #endif
+}
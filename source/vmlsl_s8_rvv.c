@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 64-bit vector of 8-bit signed integers by another from a 16-bit accumulator.
+ *
+ * This function computes `a - b * c` element-wise with the products widened to 16-bit, analogous to
+ * the ARM Neon function `vmlsl_s8`. RVV has no widening multiply-subtract, so the product of
+ * `vwmul.vv` is subtracted with `vsub.vv`.
+ *
+ * @param a The accumulator vector of type int16x8_t.
+ * @param b The first multiplicand vector of type int8x8_t.
+ * @param c The second multiplicand vector of type int8x8_t.
+ * @return int16x8_t The accumulator minus the widened products.
+ */
+RHAL_API int16x8_t vmlsl_s8_rvv(int16x8_t a, int8x8_t b, int8x8_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsub_vv_i16m1(a, __riscv_vwmul_vv_i16m1(b, c, VLEN_8), VLEN_8);
+    #else
+        return __riscv_vsub_vv_i16m1(a, __riscv_vwmul_vv_i16m1(__riscv_vlmul_trunc_v_i8m1_i8mf2(b), __riscv_vlmul_trunc_v_i8m1_i8mf2(c), VLEN_8), VLEN_8);
+    #endif
+}
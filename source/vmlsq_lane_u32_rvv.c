@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 128-bit vector of 32-bit unsigned integers by one lane of a 64-bit vector from an accumulator.
+ *
+ * This function computes `a - b * v[lane]` element-wise, keeping the low 32 bits, analogous to the
+ * ARM Neon function `vmlsq_lane_u32`. The lane is broadcast in registers with `vrgather.vx` and
+ * accumulated with `vnmsac.vv`.
+ *
+ * @param a The accumulator vector of type uint32x4_t.
+ * @param b The multiplicand vector of type uint32x4_t.
+ * @param v The vector of type uint32x2_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 1.
+ * @return uint32x4_t The accumulator minus the products.
+ */
+RHAL_API uint32x4_t vmlsq_lane_u32_rvv(uint32x4_t a, uint32x4_t b, uint32x2_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnmsac_vv_u32m1(a, b, __riscv_vrgather_vx_u32m1(__riscv_vlmul_ext_v_u32mf2_u32m1(v), lane, VLEN_4), VLEN_4);
+    #else
+        return __riscv_vnmsac_vv_u32m1(a, b, __riscv_vrgather_vx_u32m1(v, lane, VLEN_4), VLEN_4);
+    #endif
+}
@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 128-bit vector of 32-bit signed integers by one lane of a 128-bit vector from an accumulator.
+ *
+ * This function computes `a - b * v[lane]` element-wise, keeping the low 32 bits, analogous to the
+ * ARM Neon function `vmlsq_laneq_s32`. The lane is broadcast in registers with `vrgather.vx` and
+ * accumulated with `vnmsac.vv`.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The multiplicand vector of type int32x4_t.
+ * @param v The vector of type int32x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return int32x4_t The accumulator minus the products.
+ */
+RHAL_API int32x4_t vmlsq_laneq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t v, const int lane) {
+    return __riscv_vnmsac_vv_i32m1(a, b, __riscv_vrgather_vx_i32m1(v, lane, VLEN_4), VLEN_4);
+}
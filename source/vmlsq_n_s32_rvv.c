@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts a 128-bit vector of 32-bit signed integers by a scalar from an accumulator.
+ *
+ * This function computes `a - b * c` for every element of `b`, keeping the low 32 bits, analogous to
+ * the ARM Neon function `vmlsq_n_s32`. It maps to `vnmsac.vx`.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The multiplicand vector of type int32x4_t.
+ * @param c The scalar multiplier.
+ * @return int32x4_t The accumulator minus the products.
+ */
+RHAL_API int32x4_t vmlsq_n_s32_rvv(int32x4_t a, int32x4_t b, int32_t c) {
+    return __riscv_vnmsac_vx_i32m1(a, c, b, VLEN_4);
+}
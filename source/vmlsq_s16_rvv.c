@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts two 128-bit vectors of 16-bit signed integers from an accumulator.
+ *
+ * This function computes `a - b * c` element-wise, keeping the low 16 bits, analogous to the ARM Neon
+ * function `vmlsq_s16`. It maps to `vnmsac.vv`, which subtracts the product from `a` in place.
+ *
+ * @param a The accumulator vector of type int16x8_t.
+ * @param b The first multiplicand vector of type int16x8_t.
+ * @param c The second multiplicand vector of type int16x8_t.
+ * @return int16x8_t The accumulator minus the element-wise products.
+ */
+RHAL_API int16x8_t vmlsq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t c) {
+    return __riscv_vnmsac_vv_i16m1(a, b, c, VLEN_8);
+}
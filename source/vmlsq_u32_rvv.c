@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies and subtracts two 128-bit vectors of 32-bit unsigned integers from an accumulator.
+ *
+ * This function computes `a - b * c` element-wise, keeping the low 32 bits, analogous to the ARM Neon
+ * function `vmlsq_u32`. It maps to `vnmsac.vv`, which subtracts the product from `a` in place.
+ *
+ * @param a The accumulator vector of type uint32x4_t.
+ * @param b The first multiplicand vector of type uint32x4_t.
+ * @param c The second multiplicand vector of type uint32x4_t.
+ * @return uint32x4_t The accumulator minus the element-wise products.
+ */
+RHAL_API uint32x4_t vmlsq_u32_rvv(uint32x4_t a, uint32x4_t b, uint32x4_t c) {
+    return __riscv_vnmsac_vv_u32m1(a, b, c, VLEN_4);
+}
@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 16-bit signed integers by one lane of a 128-bit vector.
+ *
+ * This function multiplies every element of `a` by element `lane` of `v`, keeping the low 16 bits,
+ * analogous to the ARM Neon function `vmul_laneq_s16`. The lane is broadcast in registers with
+ * `vrgather.vx` and multiplied with `vmul.vv`.
+ *
+ * @param a The input vector of type int16x4_t.
+ * @param v The vector of type int16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return int16x4_t The element-wise products.
+ */
+RHAL_API int16x4_t vmul_laneq_s16_rvv(int16x4_t a, int16x8_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_i16mf2(a, __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vrgather_vx_i16m1(v, lane, VLEN_4)), VLEN_4);
+    #else
+        return __riscv_vmul_vv_i16m1(a, __riscv_vrgather_vx_i16m1(v, lane, VLEN_4), VLEN_4);
+    #endif
+}
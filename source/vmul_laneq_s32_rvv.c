@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 32-bit signed integers by one lane of a 128-bit vector.
+ *
+ * This function multiplies every element of `a` by element `lane` of `v`, keeping the low 32 bits,
+ * analogous to the ARM Neon function `vmul_laneq_s32`. The lane is broadcast in registers with
+ * `vrgather.vx` and multiplied with `vmul.vv`.
+ *
+ * @param a The input vector of type int32x2_t.
+ * @param v The vector of type int32x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return int32x2_t The element-wise products.
+ */
+RHAL_API int32x2_t vmul_laneq_s32_rvv(int32x2_t a, int32x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_i32mf2(a, __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vrgather_vx_i32m1(v, lane, VLEN_2)), VLEN_2);
+    #else
+        return __riscv_vmul_vv_i32m1(a, __riscv_vrgather_vx_i32m1(v, lane, VLEN_2), VLEN_2);
+    #endif
+}
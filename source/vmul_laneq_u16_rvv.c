@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 16-bit unsigned integers by one lane of a 128-bit vector.
+ *
+ * This function multiplies every element of `a` by element `lane` of `v`, keeping the low 16 bits,
+ * analogous to the ARM Neon function `vmul_laneq_u16`. The lane is broadcast in registers with
+ * `vrgather.vx` and multiplied with `vmul.vv`.
+ *
+ * @param a The input vector of type uint16x4_t.
+ * @param v The vector of type uint16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return uint16x4_t The element-wise products.
+ */
+RHAL_API uint16x4_t vmul_laneq_u16_rvv(uint16x4_t a, uint16x8_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_u16mf2(a, __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vrgather_vx_u16m1(v, lane, VLEN_4)), VLEN_4);
+    #else
+        return __riscv_vmul_vv_u16m1(a, __riscv_vrgather_vx_u16m1(v, lane, VLEN_4), VLEN_4);
+    #endif
+}
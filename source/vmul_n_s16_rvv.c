@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 16-bit signed integers by a scalar.
+ *
+ * This function multiplies every element of `a` by `b`, keeping the low 16 bits of every product,
+ * analogous to the ARM Neon function `vmul_n_s16`. It maps to `vmul.vx`.
+ *
+ * @param a The input vector of type int16x4_t.
+ * @param b The scalar multiplier.
+ * @return int16x4_t The element-wise products.
+ */
+RHAL_API int16x4_t vmul_n_s16_rvv(int16x4_t a, int16_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vx_i16mf2(a, b, VLEN_4);
+    #else
+        return __riscv_vmul_vx_i16m1(a, b, VLEN_4);
+    #endif
+}
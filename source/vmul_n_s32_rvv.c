@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 32-bit signed integers by a scalar.
+ *
+ * This function multiplies every element of `a` by `b`, keeping the low 32 bits of every product,
+ * analogous to the ARM Neon function `vmul_n_s32`. It maps to `vmul.vx`.
+ *
+ * @param a The input vector of type int32x2_t.
+ * @param b The scalar multiplier.
+ * @return int32x2_t The element-wise products.
+ */
+RHAL_API int32x2_t vmul_n_s32_rvv(int32x2_t a, int32_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vx_i32mf2(a, b, VLEN_2);
+    #else
+        return __riscv_vmul_vx_i32m1(a, b, VLEN_2);
+    #endif
+}
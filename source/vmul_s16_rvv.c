@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies two 64-bit vectors of 16-bit signed integers.
+ *
+ * This function multiplies the corresponding elements of `a` and `b`, keeping the low 16 bits of
+ * every product, analogous to the ARM Neon function `vmul_s16`. It maps to `vmul.vv`.
+ *
+ * @param a The first input vector of type int16x4_t.
+ * @param b The second input vector of type int16x4_t.
+ * @return int16x4_t The element-wise products.
+ */
+RHAL_API int16x4_t vmul_s16_rvv(int16x4_t a, int16x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_i16mf2(a, b, VLEN_4);
+    #else
+        return __riscv_vmul_vv_i16m1(a, b, VLEN_4);
+    #endif
+}
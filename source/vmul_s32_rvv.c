@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies two 64-bit vectors of 32-bit signed integers.
+ *
+ * This function multiplies the corresponding elements of `a` and `b`, keeping the low 32 bits of
+ * every product, analogous to the ARM Neon function `vmul_s32`. It maps to `vmul.vv`.
+ *
+ * @param a The first input vector of type int32x2_t.
+ * @param b The second input vector of type int32x2_t.
+ * @return int32x2_t The element-wise products.
+ */
+RHAL_API int32x2_t vmul_s32_rvv(int32x2_t a, int32x2_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_i32mf2(a, b, VLEN_2);
+    #else
+        return __riscv_vmul_vv_i32m1(a, b, VLEN_2);
+    #endif
+}
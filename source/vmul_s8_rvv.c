@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies two 64-bit vectors of 8-bit signed integers.
+ *
+ * This function multiplies the corresponding elements of `a` and `b`, keeping the low 8 bits of
+ * every product, analogous to the ARM Neon function `vmul_s8`. It maps to `vmul.vv`.
+ *
+ * @param a The first input vector of type int8x8_t.
+ * @param b The second input vector of type int8x8_t.
+ * @return int8x8_t The element-wise products.
+ */
+RHAL_API int8x8_t vmul_s8_rvv(int8x8_t a, int8x8_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_i8mf2(a, b, VLEN_8);
+    #else
+        return __riscv_vmul_vv_i8m1(a, b, VLEN_8);
+    #endif
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies two 64-bit vectors of 16-bit unsigned integers.
+ *
+ * This function multiplies the corresponding elements of `a` and `b`, keeping the low 16 bits of
+ * every product, analogous to the ARM Neon function `vmul_u16`. It maps to `vmul.vv`.
+ *
+ * @param a The first input vector of type uint16x4_t.
+ * @param b The second input vector of type uint16x4_t.
+ * @return uint16x4_t The element-wise products.
+ */
+RHAL_API uint16x4_t vmul_u16_rvv(uint16x4_t a, uint16x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_u16mf2(a, b, VLEN_4);
+    #else
+        return __riscv_vmul_vv_u16m1(a, b, VLEN_4);
+    #endif
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 16-bit unsigned integers by one lane of a 64-bit vector with widening.
+ *
+ * This function multiplies every element of the high half of `a` by element `lane` of `v`, widening
+ * the products to 32-bit, analogous to the ARM Neon function `vmull_high_lane_u16`. The high half is
+ * moved down with `vslidedown`. The lane is broadcast in registers with `vrgather.vx`. It maps to
+ * `vwmulu.vv`.
+ *
+ * @param a The input vector of type uint16x8_t, of which the high half is used.
+ * @param v The vector of type uint16x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return uint32x4_t The widened element-wise products.
+ */
+RHAL_API uint32x4_t vmull_high_lane_u16_rvv(uint16x8_t a, uint16x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmulu_vv_u32m1(__riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(a, 4, VLEN_4)), __riscv_vrgather_vx_u16mf2(v, lane, VLEN_4), VLEN_4);
+    #else
+        return __riscv_vwmulu_vv_u32m1(__riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(a, 4, VLEN_4)), __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vrgather_vx_u16m1(v, lane, VLEN_4)), VLEN_4);
+    #endif
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 32-bit unsigned integers by one lane of a 64-bit vector with widening.
+ *
+ * This function multiplies every element of the high half of `a` by element `lane` of `v`, widening
+ * the products to 64-bit, analogous to the ARM Neon function `vmull_high_lane_u32`. The high half is
+ * moved down with `vslidedown`. The lane is broadcast in registers with `vrgather.vx`. It maps to
+ * `vwmulu.vv`.
+ *
+ * @param a The input vector of type uint32x4_t, of which the high half is used.
+ * @param v The vector of type uint32x2_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 1.
+ * @return uint64x2_t The widened element-wise products.
+ */
+RHAL_API uint64x2_t vmull_high_lane_u32_rvv(uint32x4_t a, uint32x2_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmulu_vv_u64m1(__riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(a, 2, VLEN_2)), __riscv_vrgather_vx_u32mf2(v, lane, VLEN_2), VLEN_2);
+    #else
+        return __riscv_vwmulu_vv_u64m1(__riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(a, 2, VLEN_2)), __riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vrgather_vx_u32m1(v, lane, VLEN_2)), VLEN_2);
+    #endif
+}
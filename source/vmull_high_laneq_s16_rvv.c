@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 16-bit signed integers by one lane of a 128-bit vector with widening.
+ *
+ * This function multiplies every element of the high half of `a` by element `lane` of `v`, widening
+ * the products to 32-bit, analogous to the ARM Neon function `vmull_high_laneq_s16`. The high half is
+ * moved down with `vslidedown`. The lane is broadcast in registers with `vrgather.vx`. It maps to
+ * `vwmul.vv`.
+ *
+ * @param a The input vector of type int16x8_t, of which the high half is used.
+ * @param v The vector of type int16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return int32x4_t The widened element-wise products.
+ */
+RHAL_API int32x4_t vmull_high_laneq_s16_rvv(int16x8_t a, int16x8_t v, const int lane) {
+    return __riscv_vwmul_vv_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(a, 4, VLEN_4)), __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vrgather_vx_i16m1(v, lane, VLEN_4)), VLEN_4);
+}
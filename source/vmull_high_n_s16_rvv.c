@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 16-bit signed integers by a scalar with widening.
+ *
+ * This function multiplies every element of the high half of `a` by the scalar `b`, widening the
+ * products to 32-bit, analogous to the ARM Neon function `vmull_high_n_s16`. The high half is moved
+ * down with `vslidedown`. It maps to `vwmul.vx`.
+ *
+ * @param a The input vector of type int16x8_t, of which the high half is used.
+ * @param b The scalar multiplier.
+ * @return int32x4_t The widened element-wise products.
+ */
+RHAL_API int32x4_t vmull_high_n_s16_rvv(int16x8_t a, int16_t b) {
+    return __riscv_vwmul_vx_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(a, 4, VLEN_4)), b, VLEN_4);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 16-bit unsigned integers by a scalar with widening.
+ *
+ * This function multiplies every element of the high half of `a` by the scalar `b`, widening the
+ * products to 32-bit, analogous to the ARM Neon function `vmull_high_n_u16`. The high half is moved
+ * down with `vslidedown`. It maps to `vwmulu.vx`.
+ *
+ * @param a The input vector of type uint16x8_t, of which the high half is used.
+ * @param b The scalar multiplier.
+ * @return uint32x4_t The widened element-wise products.
+ */
+RHAL_API uint32x4_t vmull_high_n_u16_rvv(uint16x8_t a, uint16_t b) {
+    return __riscv_vwmulu_vx_u32m1(__riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(a, 4, VLEN_4)), b, VLEN_4);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 32-bit unsigned integers by a scalar with widening.
+ *
+ * This function multiplies every element of the high half of `a` by the scalar `b`, widening the
+ * products to 64-bit, analogous to the ARM Neon function `vmull_high_n_u32`. The high half is moved
+ * down with `vslidedown`. It maps to `vwmulu.vx`.
+ *
+ * @param a The input vector of type uint32x4_t, of which the high half is used.
+ * @param b The scalar multiplier.
+ * @return uint64x2_t The widened element-wise products.
+ */
+RHAL_API uint64x2_t vmull_high_n_u32_rvv(uint32x4_t a, uint32_t b) {
+    return __riscv_vwmulu_vx_u64m1(__riscv_vlmul_trunc_v_u32m1_u32mf2(__riscv_vslidedown_vx_u32m1(a, 2, VLEN_2)), b, VLEN_2);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 16-bit signed integers by the high half of another with widening.
+ *
+ * This function multiplies every element of the high half of `a` by the corresponding element of the
+ * high half of `b`, widening the products to 32-bit, analogous to the ARM Neon function
+ * `vmull_high_s16`. The high halves are moved down with `vslidedown`. It maps to `vwmul.vv`.
+ *
+ * @param a The first input vector of type int16x8_t, of which the high half is used.
+ * @param b The second input vector of type int16x8_t, of which the high half is used.
+ * @return int32x4_t The widened element-wise products.
+ */
+RHAL_API int32x4_t vmull_high_s16_rvv(int16x8_t a, int16x8_t b) {
+    return __riscv_vwmul_vv_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(a, 4, VLEN_4)), __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(b, 4, VLEN_4)), VLEN_4);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 32-bit signed integers by the high half of another with widening.
+ *
+ * This function multiplies every element of the high half of `a` by the corresponding element of the
+ * high half of `b`, widening the products to 64-bit, analogous to the ARM Neon function
+ * `vmull_high_s32`. The high halves are moved down with `vslidedown`. It maps to `vwmul.vv`.
+ *
+ * @param a The first input vector of type int32x4_t, of which the high half is used.
+ * @param b The second input vector of type int32x4_t, of which the high half is used.
+ * @return int64x2_t The widened element-wise products.
+ */
+RHAL_API int64x2_t vmull_high_s32_rvv(int32x4_t a, int32x4_t b) {
+    return __riscv_vwmul_vv_i64m1(__riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(a, 2, VLEN_2)), __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(b, 2, VLEN_2)), VLEN_2);
+}
@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 8-bit signed integers by the high half of another with widening.
+ *
+ * This function multiplies every element of the high half of `a` by the corresponding element of the
+ * high half of `b`, widening the products to 16-bit, analogous to the ARM Neon function
+ * `vmull_high_s8`. The high halves are moved down with `vslidedown`. It maps to `vwmul.vv`.
+ *
+ * @param a The first input vector of type int8x16_t, of which the high half is used.
+ * @param b The second input vector of type int8x16_t, of which the high half is used.
+ * @return int16x8_t The widened element-wise products.
+ */
+RHAL_API int16x8_t vmull_high_s8_rvv(int8x16_t a, int8x16_t b) {
+    return __riscv_vwmul_vv_i16m1(__riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(a, 8, VLEN_8)), __riscv_vlmul_trunc_v_i8m1_i8mf2(__riscv_vslidedown_vx_i8m1(b, 8, VLEN_8)), VLEN_8);
+}
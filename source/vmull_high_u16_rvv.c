@@ -0,0 +1,18 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies the high half of a 128-bit vector of 16-bit unsigned integers by the high half of another with widening.
+ *
+ * This function multiplies every element of the high half of `a` by the corresponding element of the
+ * high half of `b`, widening the products to 32-bit, analogous to the ARM Neon function
+ * `vmull_high_u16`. The high halves are moved down with `vslidedown`. It maps to `vwmulu.vv`.
+ *
+ * @param a The first input vector of type uint16x8_t, of which the high half is used.
+ * @param b The second input vector of type uint16x8_t, of which the high half is used.
+ * @return uint32x4_t The widened element-wise products.
+ */
+RHAL_API uint32x4_t vmull_high_u16_rvv(uint16x8_t a, uint16x8_t b) {
+    return __riscv_vwmulu_vv_u32m1(__riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(a, 4, VLEN_4)), __riscv_vlmul_trunc_v_u16m1_u16mf2(__riscv_vslidedown_vx_u16m1(b, 4, VLEN_4)), VLEN_4);
+}
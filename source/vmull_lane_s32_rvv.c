@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 32-bit signed integers by one lane of a 64-bit vector with widening.
+ *
+ * This function multiplies every element of `a` by element `lane` of `v`, widening the products to
+ * 64-bit, analogous to the ARM Neon function `vmull_lane_s32`. The lane is broadcast in registers with
+ * `vrgather.vx`. It maps to `vwmul.vv`.
+ *
+ * @param a The input vector of type int32x2_t.
+ * @param v The vector of type int32x2_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 1.
+ * @return int64x2_t The widened element-wise products.
+ */
+RHAL_API int64x2_t vmull_lane_s32_rvv(int32x2_t a, int32x2_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmul_vv_i64m1(a, __riscv_vrgather_vx_i32mf2(v, lane, VLEN_2), VLEN_2);
+    #else
+        return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(a, __riscv_vrgather_vx_i32m1(v, lane, VLEN_2), VLEN_2));
+    #endif
+}
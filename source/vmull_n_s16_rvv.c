@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 16-bit signed integers by a scalar with widening.
+ *
+ * This function multiplies every element of `a` by the scalar `b`, widening the products to 32-bit,
+ * analogous to the ARM Neon function `vmull_n_s16`. It maps to `vwmul.vx`.
+ *
+ * @param a The input vector of type int16x4_t.
+ * @param b The scalar multiplier.
+ * @return int32x4_t The widened element-wise products.
+ */
+RHAL_API int32x4_t vmull_n_s16_rvv(int16x4_t a, int16_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmul_vx_i32m1(a, b, VLEN_4);
+    #else
+        return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vx_i32m2(a, b, VLEN_4));
+    #endif
+}
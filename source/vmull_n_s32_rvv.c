@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 32-bit signed integers by a scalar with widening.
+ *
+ * This function multiplies every element of `a` by the scalar `b`, widening the products to 64-bit,
+ * analogous to the ARM Neon function `vmull_n_s32`. It maps to `vwmul.vx`.
+ *
+ * @param a The input vector of type int32x2_t.
+ * @param b The scalar multiplier.
+ * @return int64x2_t The widened element-wise products.
+ */
+RHAL_API int64x2_t vmull_n_s32_rvv(int32x2_t a, int32_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmul_vx_i64m1(a, b, VLEN_2);
+    #else
+        return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vx_i64m2(a, b, VLEN_2));
+    #endif
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 32-bit unsigned integers by a scalar with widening.
+ *
+ * This function multiplies every element of `a` by the scalar `b`, widening the products to 64-bit,
+ * analogous to the ARM Neon function `vmull_n_u32`. It maps to `vwmulu.vx`.
+ *
+ * @param a The input vector of type uint32x2_t.
+ * @param b The scalar multiplier.
+ * @return uint64x2_t The widened element-wise products.
+ */
+RHAL_API uint64x2_t vmull_n_u32_rvv(uint32x2_t a, uint32_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmulu_vx_u64m1(a, b, VLEN_2);
+    #else
+        return __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwmulu_vx_u64m2(a, b, VLEN_2));
+    #endif
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 16-bit signed integers by another with widening.
+ *
+ * This function multiplies every element of `a` by the corresponding element of `b`, widening the
+ * products to 32-bit, analogous to the ARM Neon function `vmull_s16`. It maps to `vwmul.vv`.
+ *
+ * @param a The first input vector of type int16x4_t.
+ * @param b The second input vector of type int16x4_t.
+ * @return int32x4_t The widened element-wise products.
+ */
+RHAL_API int32x4_t vmull_s16_rvv(int16x4_t a, int16x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmul_vv_i32m1(a, b, VLEN_4);
+    #else
+        return __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(a, b, VLEN_4));
+    #endif
+}
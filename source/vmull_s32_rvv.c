@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 32-bit signed integers by another with widening.
+ *
+ * This function multiplies every element of `a` by the corresponding element of `b`, widening the
+ * products to 64-bit, analogous to the ARM Neon function `vmull_s32`. It maps to `vwmul.vv`.
+ *
+ * @param a The first input vector of type int32x2_t.
+ * @param b The second input vector of type int32x2_t.
+ * @return int64x2_t The widened element-wise products.
+ */
+RHAL_API int64x2_t vmull_s32_rvv(int32x2_t a, int32x2_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmul_vv_i64m1(a, b, VLEN_2);
+    #else
+        return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vv_i64m2(a, b, VLEN_2));
+    #endif
+}
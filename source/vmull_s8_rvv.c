@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 8-bit signed integers by another with widening.
+ *
+ * This function multiplies every element of `a` by the corresponding element of `b`, widening the
+ * products to 16-bit, analogous to the ARM Neon function `vmull_s8`. It maps to `vwmul.vv`.
+ *
+ * @param a The first input vector of type int8x8_t.
+ * @param b The second input vector of type int8x8_t.
+ * @return int16x8_t The widened element-wise products.
+ */
+RHAL_API int16x8_t vmull_s8_rvv(int8x8_t a, int8x8_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmul_vv_i16m1(a, b, VLEN_8);
+    #else
+        return __riscv_vlmul_trunc_v_i16m2_i16m1(__riscv_vwmul_vv_i16m2(a, b, VLEN_8));
+    #endif
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 16-bit unsigned integers by another with widening.
+ *
+ * This function multiplies every element of `a` by the corresponding element of `b`, widening the
+ * products to 32-bit, analogous to the ARM Neon function `vmull_u16`. It maps to `vwmulu.vv`.
+ *
+ * @param a The first input vector of type uint16x4_t.
+ * @param b The second input vector of type uint16x4_t.
+ * @return uint32x4_t The widened element-wise products.
+ */
+RHAL_API uint32x4_t vmull_u16_rvv(uint16x4_t a, uint16x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmulu_vv_u32m1(a, b, VLEN_4);
+    #else
+        return __riscv_vlmul_trunc_v_u32m2_u32m1(__riscv_vwmulu_vv_u32m2(a, b, VLEN_4));
+    #endif
+}
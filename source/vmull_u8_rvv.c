@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 64-bit vector of 8-bit unsigned integers by another with widening.
+ *
+ * This function multiplies every element of `a` by the corresponding element of `b`, widening the
+ * products to 16-bit, analogous to the ARM Neon function `vmull_u8`. It maps to `vwmulu.vv`.
+ *
+ * @param a The first input vector of type uint8x8_t.
+ * @param b The second input vector of type uint8x8_t.
+ * @return uint16x8_t The widened element-wise products.
+ */
+RHAL_API uint16x8_t vmull_u8_rvv(uint8x8_t a, uint8x8_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwmulu_vv_u16m1(a, b, VLEN_8);
+    #else
+        return __riscv_vlmul_trunc_v_u16m2_u16m1(__riscv_vwmulu_vv_u16m2(a, b, VLEN_8));
+    #endif
+}
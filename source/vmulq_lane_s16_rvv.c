@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 128-bit vector of 16-bit signed integers by one lane of a 64-bit vector.
+ *
+ * This function multiplies every element of `a` by element `lane` of `v`, keeping the low 16 bits,
+ * analogous to the ARM Neon function `vmulq_lane_s16`. The lane is broadcast in registers with
+ * `vrgather.vx` and multiplied with `vmul.vv`.
+ *
+ * @param a The input vector of type int16x8_t.
+ * @param v The vector of type int16x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return int16x8_t The element-wise products.
+ */
+RHAL_API int16x8_t vmulq_lane_s16_rvv(int16x8_t a, int16x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_i16m1(a, __riscv_vrgather_vx_i16m1(__riscv_vlmul_ext_v_i16mf2_i16m1(v), lane, VLEN_8), VLEN_8);
+    #else
+        return __riscv_vmul_vv_i16m1(a, __riscv_vrgather_vx_i16m1(v, lane, VLEN_8), VLEN_8);
+    #endif
+}
@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 128-bit vector of 16-bit unsigned integers by one lane of a 64-bit vector.
+ *
+ * This function multiplies every element of `a` by element `lane` of `v`, keeping the low 16 bits,
+ * analogous to the ARM Neon function `vmulq_lane_u16`. The lane is broadcast in registers with
+ * `vrgather.vx` and multiplied with `vmul.vv`.
+ *
+ * @param a The input vector of type uint16x8_t.
+ * @param v The vector of type uint16x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return uint16x8_t The element-wise products.
+ */
+RHAL_API uint16x8_t vmulq_lane_u16_rvv(uint16x8_t a, uint16x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_u16m1(a, __riscv_vrgather_vx_u16m1(__riscv_vlmul_ext_v_u16mf2_u16m1(v), lane, VLEN_8), VLEN_8);
+    #else
+        return __riscv_vmul_vv_u16m1(a, __riscv_vrgather_vx_u16m1(v, lane, VLEN_8), VLEN_8);
+    #endif
+}
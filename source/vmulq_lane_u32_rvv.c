@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 128-bit vector of 32-bit unsigned integers by one lane of a 64-bit vector.
+ *
+ * This function multiplies every element of `a` by element `lane` of `v`, keeping the low 32 bits,
+ * analogous to the ARM Neon function `vmulq_lane_u32`. The lane is broadcast in registers with
+ * `vrgather.vx` and multiplied with `vmul.vv`.
+ *
+ * @param a The input vector of type uint32x4_t.
+ * @param v The vector of type uint32x2_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 1.
+ * @return uint32x4_t The element-wise products.
+ */
+RHAL_API uint32x4_t vmulq_lane_u32_rvv(uint32x4_t a, uint32x2_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vmul_vv_u32m1(a, __riscv_vrgather_vx_u32m1(__riscv_vlmul_ext_v_u32mf2_u32m1(v), lane, VLEN_4), VLEN_4);
+    #else
+        return __riscv_vmul_vv_u32m1(a, __riscv_vrgather_vx_u32m1(v, lane, VLEN_4), VLEN_4);
+    #endif
+}
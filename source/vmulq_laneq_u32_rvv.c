@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 128-bit vector of 32-bit unsigned integers by one lane of a 128-bit vector.
+ *
+ * This function multiplies every element of `a` by element `lane` of `v`, keeping the low 32 bits,
+ * analogous to the ARM Neon function `vmulq_laneq_u32`. The lane is broadcast in registers with
+ * `vrgather.vx` and multiplied with `vmul.vv`.
+ *
+ * @param a The input vector of type uint32x4_t.
+ * @param v The vector of type uint32x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return uint32x4_t The element-wise products.
+ */
+RHAL_API uint32x4_t vmulq_laneq_u32_rvv(uint32x4_t a, uint32x4_t v, const int lane) {
+    return __riscv_vmul_vv_u32m1(a, __riscv_vrgather_vx_u32m1(v, lane, VLEN_4), VLEN_4);
+}
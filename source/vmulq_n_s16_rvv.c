@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 128-bit vector of 16-bit signed integers by a scalar.
+ *
+ * This function multiplies every element of `a` by `b`, keeping the low 16 bits of every product,
+ * analogous to the ARM Neon function `vmulq_n_s16`. It maps to `vmul.vx`.
+ *
+ * @param a The input vector of type int16x8_t.
+ * @param b The scalar multiplier.
+ * @return int16x8_t The element-wise products.
+ */
+RHAL_API int16x8_t vmulq_n_s16_rvv(int16x8_t a, int16_t b) {
+    return __riscv_vmul_vx_i16m1(a, b, VLEN_8);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 128-bit vector of 16-bit unsigned integers by a scalar.
+ *
+ * This function multiplies every element of `a` by `b`, keeping the low 16 bits of every product,
+ * analogous to the ARM Neon function `vmulq_n_u16`. It maps to `vmul.vx`.
+ *
+ * @param a The input vector of type uint16x8_t.
+ * @param b The scalar multiplier.
+ * @return uint16x8_t The element-wise products.
+ */
+RHAL_API uint16x8_t vmulq_n_u16_rvv(uint16x8_t a, uint16_t b) {
+    return __riscv_vmul_vx_u16m1(a, b, VLEN_8);
+}
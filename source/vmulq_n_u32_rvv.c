@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies a 128-bit vector of 32-bit unsigned integers by a scalar.
+ *
+ * This function multiplies every element of `a` by `b`, keeping the low 32 bits of every product,
+ * analogous to the ARM Neon function `vmulq_n_u32`. It maps to `vmul.vx`.
+ *
+ * @param a The input vector of type uint32x4_t.
+ * @param b The scalar multiplier.
+ * @return uint32x4_t The element-wise products.
+ */
+RHAL_API uint32x4_t vmulq_n_u32_rvv(uint32x4_t a, uint32_t b) {
+    return __riscv_vmul_vx_u32m1(a, b, VLEN_4);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies two 128-bit vectors of 16-bit signed integers.
+ *
+ * This function multiplies the corresponding elements of `a` and `b`, keeping the low 16 bits of
+ * every product, analogous to the ARM Neon function `vmulq_s16`. It maps to `vmul.vv`.
+ *
+ * @param a The first input vector of type int16x8_t.
+ * @param b The second input vector of type int16x8_t.
+ * @return int16x8_t The element-wise products.
+ */
+RHAL_API int16x8_t vmulq_s16_rvv(int16x8_t a, int16x8_t b) {
+    return __riscv_vmul_vv_i16m1(a, b, VLEN_8);
+}
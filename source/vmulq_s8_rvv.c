@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies two 128-bit vectors of 8-bit signed integers.
+ *
+ * This function multiplies the corresponding elements of `a` and `b`, keeping the low 8 bits of
+ * every product, analogous to the ARM Neon function `vmulq_s8`. It maps to `vmul.vv`.
+ *
+ * @param a The first input vector of type int8x16_t.
+ * @param b The second input vector of type int8x16_t.
+ * @return int8x16_t The element-wise products.
+ */
+RHAL_API int8x16_t vmulq_s8_rvv(int8x16_t a, int8x16_t b) {
+    return __riscv_vmul_vv_i8m1(a, b, VLEN_16);
+}
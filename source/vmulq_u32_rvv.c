@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies two 128-bit vectors of 32-bit unsigned integers.
+ *
+ * This function multiplies the corresponding elements of `a` and `b`, keeping the low 32 bits of
+ * every product, analogous to the ARM Neon function `vmulq_u32`. It maps to `vmul.vv`.
+ *
+ * @param a The first input vector of type uint32x4_t.
+ * @param b The second input vector of type uint32x4_t.
+ * @return uint32x4_t The element-wise products.
+ */
+RHAL_API uint32x4_t vmulq_u32_rvv(uint32x4_t a, uint32x4_t b) {
+    return __riscv_vmul_vv_u32m1(a, b, VLEN_4);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Multiplies two 128-bit vectors of 8-bit unsigned integers.
+ *
+ * This function multiplies the corresponding elements of `a` and `b`, keeping the low 8 bits of
+ * every product, analogous to the ARM Neon function `vmulq_u8`. It maps to `vmul.vv`.
+ *
+ * @param a The first input vector of type uint8x16_t.
+ * @param b The second input vector of type uint8x16_t.
+ * @return uint8x16_t The element-wise products.
+ */
+RHAL_API uint8x16_t vmulq_u8_rvv(uint8x16_t a, uint8x16_t b) {
+    return __riscv_vmul_vv_u8m1(a, b, VLEN_16);
+}
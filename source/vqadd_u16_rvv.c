@@ -15,6 +15,10 @@
  * @param b The second input vector of type uint16x4_t containing 16-bit unsigned integers.
  * @return uint16x4_t The result of the element-wise saturating addition, returned as an 16-bit unsigned integer vector.
  */
-uint16x4_t vqadd_u16_rvv(uint16x4_t a, uint16x4_t b) {
-    return __riscv_vsaddu_vv_u16m1(a, b, VLEN_4);
+RHAL_API uint16x4_t vqadd_u16_rvv(uint16x4_t a, uint16x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsaddu_vv_u16mf2(a, b, VLEN_4);
+    #else
+        return __riscv_vsaddu_vv_u16m1(a, b, VLEN_4);
+    #endif
 }
@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Performs an element-wise saturating addition of two pairs of 128-bit vectors of 16-bit signed integers.
+ * 
+ * This function performs the element-wise saturating addition of `vqaddq_s16` on two 128-bit vectors packed into
+ * each register (`a` and `b`, see vcombineq_s16_x2_rvv), i.e. on 16 elements with a single instruction.
+ * It requires VLEN >= 256 (rhal_paired_supported()). The result holds the saturated sum of the low vectors
+ * in its low half and the saturated sum of the high vectors in its high half.
+ * 
+ * @param a The first input pair of type int16x16_t containing 16-bit signed integers.
+ * @param b The second input pair of type int16x16_t containing 16-bit signed integers.
+ * @return int16x16_t The pair of results of the element-wise saturating addition.
+ */
+RHAL_API int16x16_t vqaddq_s16_x2_rvv(int16x16_t a, int16x16_t b) {
+    return __riscv_vsadd_vv_i16m1(a, b, VLEN_16);
+}
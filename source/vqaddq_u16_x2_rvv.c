@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Performs an element-wise saturating addition of two pairs of 128-bit vectors of 16-bit unsigned integers.
+ * 
+ * This function performs the element-wise saturating addition of `vqaddq_u16` on two 128-bit vectors packed into
+ * each register (`a` and `b`, see vcombineq_u16_x2_rvv), i.e. on 16 elements with a single instruction.
+ * It requires VLEN >= 256 (rhal_paired_supported()). The result holds the saturated sum of the low vectors
+ * in its low half and the saturated sum of the high vectors in its high half.
+ * 
+ * @param a The first input pair of type uint16x16_t containing 16-bit unsigned integers.
+ * @param b The second input pair of type uint16x16_t containing 16-bit unsigned integers.
+ * @return uint16x16_t The pair of results of the element-wise saturating addition.
+ */
+RHAL_API uint16x16_t vqaddq_u16_x2_rvv(uint16x16_t a, uint16x16_t b) {
+    return __riscv_vsaddu_vv_u16m1(a, b, VLEN_16);
+}
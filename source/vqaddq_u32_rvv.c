@@ -15,6 +15,6 @@
  * @param b The second input vector of type uint32x4_t containing 32-bit unsigned integers.
  * @return uint32x4_t The result of the element-wise saturating addition, returned as an 32-bit unsigned integer vector.
  */
-uint32x4_t vqaddq_u32_rvv(uint32x4_t a, uint32x4_t b) {
+RHAL_API uint32x4_t vqaddq_u32_rvv(uint32x4_t a, uint32x4_t b) {
     return __riscv_vsaddu_vv_u32m1(a, b, VLEN_4);
 }
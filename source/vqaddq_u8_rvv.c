@@ -15,6 +15,6 @@
  * @param b The second input vector of type uint8x16_t containing 8-bit unsigned integers.
  * @return uint8x16_t The result of the element-wise saturating addition, returned as an 8-bit unsigned integer vector.
  */
-uint8x16_t vqaddq_u8_rvv(uint8x16_t a, uint8x16_t b) {
+RHAL_API uint8x16_t vqaddq_u8_rvv(uint8x16_t a, uint8x16_t b) {
     return __riscv_vsaddu_vv_u8m1(a, b, VLEN_16);
 }
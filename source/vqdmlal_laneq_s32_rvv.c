@@ -0,0 +1,28 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply and accumulate of a 64-bit vector of 32-bit signed integers by one lane of a 128-bit vector into a 64-bit accumulator.
+ *
+ * This function computes `a + 2 * b * v[lane]` element-wise in 64-bit, saturating the doubled product
+ * and then the sum, analogous to the ARM Neon function `vqdmlal_laneq_s32`. The exact product of
+ * `vwmul.vv` is doubled with the saturating `vsadd.vv`, so only INT32_MIN * INT32_MIN saturates, to
+ * INT64_MAX, and sets `vxsat` as Neon sets QC. It is then accumulated with `vsadd.vv`. The lane is
+ * broadcast in registers with `vrgather.vx`.
+ *
+ * @param a The accumulator vector of type int64x2_t.
+ * @param b The multiplicand vector of type int32x2_t.
+ * @param v The vector of type int32x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return int64x2_t The saturated sum of the accumulator and the doubled products.
+ */
+RHAL_API int64x2_t vqdmlal_laneq_s32_rvv(int64x2_t a, int32x2_t b, int32x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint64m1_t product = __riscv_vwmul_vv_i64m1(b, __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vrgather_vx_i32m1(v, lane, VLEN_2)), VLEN_2);
+        return __riscv_vsadd_vv_i64m1(a, __riscv_vsadd_vv_i64m1(product, product, VLEN_2), VLEN_2);
+    #else
+        vint64m1_t product = __riscv_vwmul_vv_i64m1(__riscv_vlmul_trunc_v_i32m1_i32mf2(b), __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vrgather_vx_i32m1(v, lane, VLEN_2)), VLEN_2);
+        return __riscv_vsadd_vv_i64m1(a, __riscv_vsadd_vv_i64m1(product, product, VLEN_2), VLEN_2);
+    #endif
+}
@@ -0,0 +1,26 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply and accumulate of a 64-bit vector of 16-bit signed integers by a scalar into a 32-bit accumulator.
+ *
+ * This function computes `a + 2 * b * c` element-wise in 32-bit, saturating the doubled product and
+ * then the sum, analogous to the ARM Neon function `vqdmlal_n_s16`. The exact product of `vwmul.vx` is
+ * doubled with the saturating `vsadd.vv`, so only INT16_MIN * INT16_MIN saturates, to INT32_MAX, and
+ * sets `vxsat` as Neon sets QC. It is then accumulated with `vsadd.vv`.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The multiplicand vector of type int16x4_t.
+ * @param c The scalar multiplier.
+ * @return int32x4_t The saturated sum of the accumulator and the doubled products.
+ */
+RHAL_API int32x4_t vqdmlal_n_s16_rvv(int32x4_t a, int16x4_t b, int16_t c) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint32m1_t product = __riscv_vwmul_vx_i32m1(b, c, VLEN_4);
+        return __riscv_vsadd_vv_i32m1(a, __riscv_vsadd_vv_i32m1(product, product, VLEN_4), VLEN_4);
+    #else
+        vint32m1_t product = __riscv_vwmul_vx_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(b), c, VLEN_4);
+        return __riscv_vsadd_vv_i32m1(a, __riscv_vsadd_vv_i32m1(product, product, VLEN_4), VLEN_4);
+    #endif
+}
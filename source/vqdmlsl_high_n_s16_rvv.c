@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply and subtract of the high half of a 128-bit vector of 16-bit signed integers by a scalar from a 32-bit accumulator.
+ *
+ * This function computes `a - 2 * high(b) * c` element-wise in 32-bit, saturating the doubled product
+ * and then the difference, analogous to the ARM Neon function `vqdmlsl_high_n_s16`. The exact product
+ * of `vwmul.vx` is doubled with the saturating `vsadd.vv`, so only INT16_MIN * INT16_MIN saturates, to
+ * INT32_MAX, and sets `vxsat` as Neon sets QC. It is then subtracted with `vssub.vv`. The high half is
+ * moved down with `vslidedown`.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The multiplicand vector of type int16x8_t, of which the high half is used.
+ * @param c The scalar multiplier.
+ * @return int32x4_t The saturated difference of the accumulator and the doubled products.
+ */
+RHAL_API int32x4_t vqdmlsl_high_n_s16_rvv(int32x4_t a, int16x8_t b, int16_t c) {
+    vint32m1_t product = __riscv_vwmul_vx_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(b, 4, VLEN_4)), c, VLEN_4);
+    return __riscv_vssub_vv_i32m1(a, __riscv_vsadd_vv_i32m1(product, product, VLEN_4), VLEN_4);
+}
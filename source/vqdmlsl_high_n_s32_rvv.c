@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply and subtract of the high half of a 128-bit vector of 32-bit signed integers by a scalar from a 64-bit accumulator.
+ *
+ * This function computes `a - 2 * high(b) * c` element-wise in 64-bit, saturating the doubled product
+ * and then the difference, analogous to the ARM Neon function `vqdmlsl_high_n_s32`. The exact product
+ * of `vwmul.vx` is doubled with the saturating `vsadd.vv`, so only INT32_MIN * INT32_MIN saturates, to
+ * INT64_MAX, and sets `vxsat` as Neon sets QC. It is then subtracted with `vssub.vv`. The high half is
+ * moved down with `vslidedown`.
+ *
+ * @param a The accumulator vector of type int64x2_t.
+ * @param b The multiplicand vector of type int32x4_t, of which the high half is used.
+ * @param c The scalar multiplier.
+ * @return int64x2_t The saturated difference of the accumulator and the doubled products.
+ */
+RHAL_API int64x2_t vqdmlsl_high_n_s32_rvv(int64x2_t a, int32x4_t b, int32_t c) {
+    vint64m1_t product = __riscv_vwmul_vx_i64m1(__riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(b, 2, VLEN_2)), c, VLEN_2);
+    return __riscv_vssub_vv_i64m1(a, __riscv_vsadd_vv_i64m1(product, product, VLEN_2), VLEN_2);
+}
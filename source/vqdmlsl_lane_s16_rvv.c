@@ -0,0 +1,28 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply and subtract of a 64-bit vector of 16-bit signed integers by one lane of a 64-bit vector from a 32-bit accumulator.
+ *
+ * This function computes `a - 2 * b * v[lane]` element-wise in 32-bit, saturating the doubled product
+ * and then the difference, analogous to the ARM Neon function `vqdmlsl_lane_s16`. The exact product of
+ * `vwmul.vv` is doubled with the saturating `vsadd.vv`, so only INT16_MIN * INT16_MIN saturates, to
+ * INT32_MAX, and sets `vxsat` as Neon sets QC. It is then subtracted with `vssub.vv`. The lane is
+ * broadcast in registers with `vrgather.vx`.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The multiplicand vector of type int16x4_t.
+ * @param v The vector of type int16x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return int32x4_t The saturated difference of the accumulator and the doubled products.
+ */
+RHAL_API int32x4_t vqdmlsl_lane_s16_rvv(int32x4_t a, int16x4_t b, int16x4_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint32m1_t product = __riscv_vwmul_vv_i32m1(b, __riscv_vrgather_vx_i16mf2(v, lane, VLEN_4), VLEN_4);
+        return __riscv_vssub_vv_i32m1(a, __riscv_vsadd_vv_i32m1(product, product, VLEN_4), VLEN_4);
+    #else
+        vint32m1_t product = __riscv_vwmul_vv_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(b), __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vrgather_vx_i16m1(v, lane, VLEN_4)), VLEN_4);
+        return __riscv_vssub_vv_i32m1(a, __riscv_vsadd_vv_i32m1(product, product, VLEN_4), VLEN_4);
+    #endif
+}
@@ -0,0 +1,39 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply of a 64-bit vector of 32-bit signed integers by one lane of a 128-bit vector, returning the high half.
+ *
+ * This function computes `(2 * a * b) >> 32` for every element of `a` and element `lane` of `v`,
+ * saturated to 32 bits, analogous to the ARM Neon function `vqdmulh_laneq_s32`. It maps to `vsmul.vv`,
+ * the signed fractional multiply, with the rounding mode round-down. Only INT32_MIN * INT32_MIN
+ * saturates, to INT32_MAX, which sets `vxsat` as Neon sets QC. Without explicit rounding modes in the
+ * intrinsics, or with RHAL_VXRM_BLOCK, it is built from `vmulh` and `vmul` instead, as twice the high
+ * half of the product (doubled with `vsadd`) plus the top bit of the low half, which does not depend
+ * on `vxrm`. The lane is broadcast in registers with `vrgather.vx`.
+ *
+ * @param a The first input vector of type int32x2_t.
+ * @param v The vector of type int32x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return int32x2_t The saturated high halves of the doubled products.
+ */
+RHAL_API int32x2_t vqdmulh_laneq_s32_rvv(int32x2_t a, int32x4_t v, const int lane) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        vint32mf2_t m = __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vrgather_vx_i32m1(v, lane, VLEN_2));
+        return __riscv_vsmul_vv_i32mf2(a, m, __RISCV_VXRM_RDN, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        vint32m1_t m = __riscv_vrgather_vx_i32m1(v, lane, VLEN_2);
+        return __riscv_vsmul_vv_i32m1(a, m, __RISCV_VXRM_RDN, VLEN_2);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        vint32mf2_t m = __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vrgather_vx_i32m1(v, lane, VLEN_2));
+        vint32mf2_t high = __riscv_vmulh_vv_i32mf2(a, m, VLEN_2);
+        vuint32mf2_t low = __riscv_vreinterpret_v_i32mf2_u32mf2(__riscv_vmul_vv_i32mf2(a, m, VLEN_2));
+        return __riscv_vor_vv_i32mf2(__riscv_vsadd_vv_i32mf2(high, high, VLEN_2), __riscv_vreinterpret_v_u32mf2_i32mf2(__riscv_vsrl_vx_u32mf2(low, 31, VLEN_2)), VLEN_2);
+    #else
+        vint32m1_t m = __riscv_vrgather_vx_i32m1(v, lane, VLEN_2);
+        vint32m1_t high = __riscv_vmulh_vv_i32m1(a, m, VLEN_2);
+        vuint32m1_t low = __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vmul_vv_i32m1(a, m, VLEN_2));
+        return __riscv_vor_vv_i32m1(__riscv_vsadd_vv_i32m1(high, high, VLEN_2), __riscv_vreinterpret_v_u32m1_i32m1(__riscv_vsrl_vx_u32m1(low, 31, VLEN_2)), VLEN_2);
+    #endif
+}
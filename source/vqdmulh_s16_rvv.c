@@ -0,0 +1,34 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply of a 64-bit vector of 16-bit signed integers by another, returning the high half.
+ *
+ * This function computes `(2 * a * b) >> 16` for every element of `a` and the corresponding element of
+ * `b`, saturated to 16 bits, analogous to the ARM Neon function `vqdmulh_s16`. It maps to `vsmul.vv`,
+ * the signed fractional multiply, with the rounding mode round-down. Only INT16_MIN * INT16_MIN
+ * saturates, to INT16_MAX, which sets `vxsat` as Neon sets QC. Without explicit rounding modes in the
+ * intrinsics, or with RHAL_VXRM_BLOCK, it is built from `vmulh` and `vmul` instead, as twice the high
+ * half of the product (doubled with `vsadd`) plus the top bit of the low half, which does not depend
+ * on `vxrm`.
+ *
+ * @param a The first input vector of type int16x4_t.
+ * @param b The second input vector of type int16x4_t.
+ * @return int16x4_t The saturated high halves of the doubled products.
+ */
+RHAL_API int16x4_t vqdmulh_s16_rvv(int16x4_t a, int16x4_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsmul_vv_i16mf2(a, b, __RISCV_VXRM_RDN, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vsmul_vv_i16m1(a, b, __RISCV_VXRM_RDN, VLEN_4);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        vint16mf2_t high = __riscv_vmulh_vv_i16mf2(a, b, VLEN_4);
+        vuint16mf2_t low = __riscv_vreinterpret_v_i16mf2_u16mf2(__riscv_vmul_vv_i16mf2(a, b, VLEN_4));
+        return __riscv_vor_vv_i16mf2(__riscv_vsadd_vv_i16mf2(high, high, VLEN_4), __riscv_vreinterpret_v_u16mf2_i16mf2(__riscv_vsrl_vx_u16mf2(low, 15, VLEN_4)), VLEN_4);
+    #else
+        vint16m1_t high = __riscv_vmulh_vv_i16m1(a, b, VLEN_4);
+        vuint16m1_t low = __riscv_vreinterpret_v_i16m1_u16m1(__riscv_vmul_vv_i16m1(a, b, VLEN_4));
+        return __riscv_vor_vv_i16m1(__riscv_vsadd_vv_i16m1(high, high, VLEN_4), __riscv_vreinterpret_v_u16m1_i16m1(__riscv_vsrl_vx_u16m1(low, 15, VLEN_4)), VLEN_4);
+    #endif
+}
@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply of a 128-bit vector of 16-bit signed integers by one lane of a 128-bit vector, returning the high half.
+ *
+ * This function computes `(2 * a * b) >> 16` for every element of `a` and element `lane` of `v`,
+ * saturated to 16 bits, analogous to the ARM Neon function `vqdmulhq_laneq_s16`. It maps to
+ * `vsmul.vv`, the signed fractional multiply, with the rounding mode round-down. Only INT16_MIN *
+ * INT16_MIN saturates, to INT16_MAX, which sets `vxsat` as Neon sets QC. Without explicit rounding
+ * modes in the intrinsics, or with RHAL_VXRM_BLOCK, it is built from `vmulh` and `vmul` instead, as
+ * twice the high half of the product (doubled with `vsadd`) plus the top bit of the low half, which
+ * does not depend on `vxrm`. The lane is broadcast in registers with `vrgather.vx`.
+ *
+ * @param a The first input vector of type int16x8_t.
+ * @param v The vector of type int16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return int16x8_t The saturated high halves of the doubled products.
+ */
+RHAL_API int16x8_t vqdmulhq_laneq_s16_rvv(int16x8_t a, int16x8_t v, const int lane) {
+    #if defined(RHAL_VXRM_EXPLICIT)
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(v, lane, VLEN_8);
+        return __riscv_vsmul_vv_i16m1(a, m, __RISCV_VXRM_RDN, VLEN_8);
+    #else
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(v, lane, VLEN_8);
+        vint16m1_t high = __riscv_vmulh_vv_i16m1(a, m, VLEN_8);
+        vuint16m1_t low = __riscv_vreinterpret_v_i16m1_u16m1(__riscv_vmul_vv_i16m1(a, m, VLEN_8));
+        return __riscv_vor_vv_i16m1(__riscv_vsadd_vv_i16m1(high, high, VLEN_8), __riscv_vreinterpret_v_u16m1_i16m1(__riscv_vsrl_vx_u16m1(low, 15, VLEN_8)), VLEN_8);
+    #endif
+}
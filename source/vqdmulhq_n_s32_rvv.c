@@ -0,0 +1,27 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply of a 128-bit vector of 32-bit signed integers by a scalar, returning the high half.
+ *
+ * This function computes `(2 * a * b) >> 32` for every element of `a` and `b`, saturated to 32 bits,
+ * analogous to the ARM Neon function `vqdmulhq_n_s32`. It maps to `vsmul.vx`, the signed fractional
+ * multiply, with the rounding mode round-down. Only INT32_MIN * INT32_MIN saturates, to INT32_MAX,
+ * which sets `vxsat` as Neon sets QC. Without explicit rounding modes in the intrinsics, or with
+ * RHAL_VXRM_BLOCK, it is built from `vmulh` and `vmul` instead, as twice the high half of the product
+ * (doubled with `vsadd`) plus the top bit of the low half, which does not depend on `vxrm`.
+ *
+ * @param a The first input vector of type int32x4_t.
+ * @param b The scalar multiplier.
+ * @return int32x4_t The saturated high halves of the doubled products.
+ */
+RHAL_API int32x4_t vqdmulhq_n_s32_rvv(int32x4_t a, int32_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vsmul_vx_i32m1(a, b, __RISCV_VXRM_RDN, VLEN_4);
+    #else
+        vint32m1_t high = __riscv_vmulh_vx_i32m1(a, b, VLEN_4);
+        vuint32m1_t low = __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vmul_vx_i32m1(a, b, VLEN_4));
+        return __riscv_vor_vv_i32m1(__riscv_vsadd_vv_i32m1(high, high, VLEN_4), __riscv_vreinterpret_v_u32m1_i32m1(__riscv_vsrl_vx_u32m1(low, 31, VLEN_4)), VLEN_4);
+    #endif
+}
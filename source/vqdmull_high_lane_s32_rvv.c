@@ -0,0 +1,27 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply of the high half of a 128-bit vector of 32-bit signed integers by one lane of a 64-bit vector with widening.
+ *
+ * This function computes `2 * high(a) * v[lane]` element-wise in 64-bit, saturated, analogous to the
+ * ARM Neon function `vqdmull_high_lane_s32`. The exact product of `vwmul.vv` is doubled with the
+ * saturating `vsadd.vv`, so only INT32_MIN * INT32_MIN saturates, to INT64_MAX, and sets `vxsat` as
+ * Neon sets QC. The high half is moved down with `vslidedown`. The lane is broadcast in registers with
+ * `vrgather.vx`.
+ *
+ * @param a The input vector of type int32x4_t, of which the high half is used.
+ * @param v The vector of type int32x2_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 1.
+ * @return int64x2_t The saturated doubled products.
+ */
+RHAL_API int64x2_t vqdmull_high_lane_s32_rvv(int32x4_t a, int32x2_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint64m1_t product = __riscv_vwmul_vv_i64m1(__riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(a, 2, VLEN_2)), __riscv_vrgather_vx_i32mf2(v, lane, VLEN_2), VLEN_2);
+        return __riscv_vsadd_vv_i64m1(product, product, VLEN_2);
+    #else
+        vint64m1_t product = __riscv_vwmul_vv_i64m1(__riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vslidedown_vx_i32m1(a, 2, VLEN_2)), __riscv_vlmul_trunc_v_i32m1_i32mf2(__riscv_vrgather_vx_i32m1(v, lane, VLEN_2)), VLEN_2);
+        return __riscv_vsadd_vv_i64m1(product, product, VLEN_2);
+    #endif
+}
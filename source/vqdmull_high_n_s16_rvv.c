@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply of the high half of a 128-bit vector of 16-bit signed integers by a scalar with widening.
+ *
+ * This function computes `2 * high(a) * b` element-wise in 32-bit, saturated, analogous to the ARM
+ * Neon function `vqdmull_high_n_s16`. The exact product of `vwmul.vx` is doubled with the saturating
+ * `vsadd.vv`, so only INT16_MIN * INT16_MIN saturates, to INT32_MAX, and sets `vxsat` as Neon sets QC.
+ * The high half is moved down with `vslidedown`.
+ *
+ * @param a The input vector of type int16x8_t, of which the high half is used.
+ * @param b The scalar multiplier.
+ * @return int32x4_t The saturated doubled products.
+ */
+RHAL_API int32x4_t vqdmull_high_n_s16_rvv(int16x8_t a, int16_t b) {
+    vint32m1_t product = __riscv_vwmul_vx_i32m1(__riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vslidedown_vx_i16m1(a, 4, VLEN_4)), b, VLEN_4);
+    return __riscv_vsadd_vv_i32m1(product, product, VLEN_4);
+}
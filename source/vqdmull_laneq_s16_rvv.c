@@ -0,0 +1,26 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply of a 64-bit vector of 16-bit signed integers by one lane of a 128-bit vector with widening.
+ *
+ * This function computes `2 * a * v[lane]` element-wise in 32-bit, saturated, analogous to the ARM
+ * Neon function `vqdmull_laneq_s16`. The exact product of `vwmul.vv` is doubled with the saturating
+ * `vsadd.vv`, so only INT16_MIN * INT16_MIN saturates, to INT32_MAX, and sets `vxsat` as Neon sets QC.
+ * The lane is broadcast in registers with `vrgather.vx`.
+ *
+ * @param a The input vector of type int16x4_t.
+ * @param v The vector of type int16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return int32x4_t The saturated doubled products.
+ */
+RHAL_API int32x4_t vqdmull_laneq_s16_rvv(int16x4_t a, int16x8_t v, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint32m1_t product = __riscv_vwmul_vv_i32m1(a, __riscv_vlmul_trunc_v_i16m1_i16mf2(__riscv_vrgather_vx_i16m1(v, lane, VLEN_4)), VLEN_4);
+        return __riscv_vsadd_vv_i32m1(product, product, VLEN_4);
+    #else
+        vint32m1_t product = __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vv_i32m2(a, __riscv_vrgather_vx_i16m1(v, lane, VLEN_4), VLEN_4));
+        return __riscv_vsadd_vv_i32m1(product, product, VLEN_4);
+    #endif
+}
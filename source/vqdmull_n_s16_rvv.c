@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply of a 64-bit vector of 16-bit signed integers by a scalar with widening.
+ *
+ * This function computes `2 * a * b` element-wise in 32-bit, saturated, analogous to the ARM Neon
+ * function `vqdmull_n_s16`. The exact product of `vwmul.vx` is doubled with the saturating `vsadd.vv`,
+ * so only INT16_MIN * INT16_MIN saturates, to INT32_MAX, and sets `vxsat` as Neon sets QC.
+ *
+ * @param a The input vector of type int16x4_t.
+ * @param b The scalar multiplier.
+ * @return int32x4_t The saturated doubled products.
+ */
+RHAL_API int32x4_t vqdmull_n_s16_rvv(int16x4_t a, int16_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint32m1_t product = __riscv_vwmul_vx_i32m1(a, b, VLEN_4);
+        return __riscv_vsadd_vv_i32m1(product, product, VLEN_4);
+    #else
+        vint32m1_t product = __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwmul_vx_i32m2(a, b, VLEN_4));
+        return __riscv_vsadd_vv_i32m1(product, product, VLEN_4);
+    #endif
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating doubling multiply of a 64-bit vector of 32-bit signed integers by a scalar with widening.
+ *
+ * This function computes `2 * a * b` element-wise in 64-bit, saturated, analogous to the ARM Neon
+ * function `vqdmull_n_s32`. The exact product of `vwmul.vx` is doubled with the saturating `vsadd.vv`,
+ * so only INT32_MIN * INT32_MIN saturates, to INT64_MAX, and sets `vxsat` as Neon sets QC.
+ *
+ * @param a The input vector of type int32x2_t.
+ * @param b The scalar multiplier.
+ * @return int64x2_t The saturated doubled products.
+ */
+RHAL_API int64x2_t vqdmull_n_s32_rvv(int32x2_t a, int32_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint64m1_t product = __riscv_vwmul_vx_i64m1(a, b, VLEN_2);
+        return __riscv_vsadd_vv_i64m1(product, product, VLEN_2);
+    #else
+        vint64m1_t product = __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwmul_vx_i64m2(a, b, VLEN_2));
+        return __riscv_vsadd_vv_i64m1(product, product, VLEN_2);
+    #endif
+}
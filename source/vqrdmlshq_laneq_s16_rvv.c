@@ -0,0 +1,38 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating rounding doubling multiply subtract of a 128-bit vector of 16-bit signed integers by one lane of a 128-bit vector, returning the high half.
+ *
+ * This function computes `((a << 16) - 2 * b * v[lane] + (1 << 15)) >> 16` element-wise, saturated to
+ * 16 bits once, analogous to the ARM Neon function `vqrdmlshq_laneq_s16` of Armv8.1-A. Saturating the
+ * rounded product first (`vsmul` and then `vsadd`) would differ, e.g. for a = -1 and b = v[lane] =
+ * INT16_MIN, so the sum is formed in 32-bit as `(a << 15) - b * v[lane]` (with `vwmul.vv`), which
+ * cannot overflow, and narrowed with `vnclip.wi` by 15 with round-to-nearest-up, which saturates and
+ * sets `vxsat` as Neon sets QC. The lane is broadcast in registers with `vrgather.vx`.
+ *
+ * @param a The accumulator vector of type int16x8_t.
+ * @param b The multiplicand vector of type int16x8_t.
+ * @param v The vector of type int16x8_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 7.
+ * @return int16x8_t The saturated difference of the accumulator and the rounded high halves.
+ */
+RHAL_API int16x8_t vqrdmlshq_laneq_s16_rvv(int16x8_t a, int16x8_t b, int16x8_t v, const int lane) {
+    #if defined(RHAL_VXRM_BLOCK)
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(v, lane, VLEN_8);
+        vint32m2_t acc = __riscv_vsll_vx_i32m2(__riscv_vsext_vf2_i32m2(a, VLEN_8), 15, VLEN_8);
+        acc = __riscv_vsub_vv_i32m2(acc, __riscv_vwmul_vv_i32m2(b, m, VLEN_8), VLEN_8);
+        return RHAL_VXRM_AMBIENT_WI(int16x8_t, "vnclip.wi", "e16", "m1", acc, 15, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(v, lane, VLEN_8);
+        vint32m2_t acc = __riscv_vsll_vx_i32m2(__riscv_vsext_vf2_i32m2(a, VLEN_8), 15, VLEN_8);
+        acc = __riscv_vsub_vv_i32m2(acc, __riscv_vwmul_vv_i32m2(b, m, VLEN_8), VLEN_8);
+        return __riscv_vnclip_wx_i16m1(acc, 15, __RISCV_VXRM_RNU, VLEN_8);
+    #else
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(v, lane, VLEN_8);
+        vint32m2_t acc = __riscv_vsll_vx_i32m2(__riscv_vsext_vf2_i32m2(a, VLEN_8), 15, VLEN_8);
+        acc = __riscv_vsub_vv_i32m2(acc, __riscv_vwmul_vv_i32m2(b, m, VLEN_8), VLEN_8);
+        return __riscv_vnclip_wx_i16m1(acc, 15, VLEN_8);
+    #endif
+}
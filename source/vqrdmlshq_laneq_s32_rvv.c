@@ -0,0 +1,38 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating rounding doubling multiply subtract of a 128-bit vector of 32-bit signed integers by one lane of a 128-bit vector, returning the high half.
+ *
+ * This function computes `((a << 32) - 2 * b * v[lane] + (1 << 31)) >> 32` element-wise, saturated to
+ * 32 bits once, analogous to the ARM Neon function `vqrdmlshq_laneq_s32` of Armv8.1-A. Saturating the
+ * rounded product first (`vsmul` and then `vsadd`) would differ, e.g. for a = -1 and b = v[lane] =
+ * INT32_MIN, so the sum is formed in 64-bit as `(a << 31) - b * v[lane]` (with `vwmul.vv`), which
+ * cannot overflow, and narrowed with `vnclip.wi` by 31 with round-to-nearest-up, which saturates and
+ * sets `vxsat` as Neon sets QC. The lane is broadcast in registers with `vrgather.vx`.
+ *
+ * @param a The accumulator vector of type int32x4_t.
+ * @param b The multiplicand vector of type int32x4_t.
+ * @param v The vector of type int32x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return int32x4_t The saturated difference of the accumulator and the rounded high halves.
+ */
+RHAL_API int32x4_t vqrdmlshq_laneq_s32_rvv(int32x4_t a, int32x4_t b, int32x4_t v, const int lane) {
+    #if defined(RHAL_VXRM_BLOCK)
+        vint32m1_t m = __riscv_vrgather_vx_i32m1(v, lane, VLEN_4);
+        vint64m2_t acc = __riscv_vsll_vx_i64m2(__riscv_vsext_vf2_i64m2(a, VLEN_4), 31, VLEN_4);
+        acc = __riscv_vsub_vv_i64m2(acc, __riscv_vwmul_vv_i64m2(b, m, VLEN_4), VLEN_4);
+        return RHAL_VXRM_AMBIENT_WI(int32x4_t, "vnclip.wi", "e32", "m1", acc, 31, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        vint32m1_t m = __riscv_vrgather_vx_i32m1(v, lane, VLEN_4);
+        vint64m2_t acc = __riscv_vsll_vx_i64m2(__riscv_vsext_vf2_i64m2(a, VLEN_4), 31, VLEN_4);
+        acc = __riscv_vsub_vv_i64m2(acc, __riscv_vwmul_vv_i64m2(b, m, VLEN_4), VLEN_4);
+        return __riscv_vnclip_wx_i32m1(acc, 31, __RISCV_VXRM_RNU, VLEN_4);
+    #else
+        vint32m1_t m = __riscv_vrgather_vx_i32m1(v, lane, VLEN_4);
+        vint64m2_t acc = __riscv_vsll_vx_i64m2(__riscv_vsext_vf2_i64m2(a, VLEN_4), 31, VLEN_4);
+        acc = __riscv_vsub_vv_i64m2(acc, __riscv_vwmul_vv_i64m2(b, m, VLEN_4), VLEN_4);
+        return __riscv_vnclip_wx_i32m1(acc, 31, VLEN_4);
+    #endif
+}
@@ -0,0 +1,39 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating rounding doubling multiply of a 64-bit vector of 32-bit signed integers by one lane of a 64-bit vector, returning the high half.
+ *
+ * This function computes `(2 * a * b + (1 << 31)) >> 32` for every element of `a` and element `lane`
+ * of `v`, saturated to 32 bits, analogous to the ARM Neon function `vqrdmulh_lane_s32`. It maps to
+ * `vsmul.vv`, the signed fractional multiply, with the rounding mode round-to-nearest-up. Only
+ * INT32_MIN * INT32_MIN saturates, to INT32_MAX, which sets `vxsat` as Neon sets QC. The lane is
+ * broadcast in registers with `vrgather.vx`.
+ *
+ * @param a The first input vector of type int32x2_t.
+ * @param v The vector of type int32x2_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 1.
+ * @return int32x2_t The saturated high halves of the doubled products.
+ */
+RHAL_API int32x2_t vqrdmulh_lane_s32_rvv(int32x2_t a, int32x2_t v, const int lane) {
+    #if defined(RHAL_VXRM_BLOCK) && defined(RHAL_FRACTIONAL_LMUL)
+        vint32mf2_t m = __riscv_vrgather_vx_i32mf2(v, lane, VLEN_2);
+        return RHAL_VXRM_AMBIENT_VV("vsmul.vv", "e32", RHAL_LMUL_D, a, m, VLEN_2);
+    #elif defined(RHAL_VXRM_BLOCK)
+        vint32m1_t m = __riscv_vrgather_vx_i32m1(v, lane, VLEN_2);
+        return RHAL_VXRM_AMBIENT_VV("vsmul.vv", "e32", RHAL_LMUL_D, a, m, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        vint32mf2_t m = __riscv_vrgather_vx_i32mf2(v, lane, VLEN_2);
+        return __riscv_vsmul_vv_i32mf2(a, m, __RISCV_VXRM_RNU, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        vint32m1_t m = __riscv_vrgather_vx_i32m1(v, lane, VLEN_2);
+        return __riscv_vsmul_vv_i32m1(a, m, __RISCV_VXRM_RNU, VLEN_2);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        vint32mf2_t m = __riscv_vrgather_vx_i32mf2(v, lane, VLEN_2);
+        return __riscv_vsmul_vv_i32mf2(a, m, VLEN_2);
+    #else
+        vint32m1_t m = __riscv_vrgather_vx_i32m1(v, lane, VLEN_2);
+        return __riscv_vsmul_vv_i32m1(a, m, VLEN_2);
+    #endif
+}
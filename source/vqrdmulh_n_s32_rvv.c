@@ -0,0 +1,31 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating rounding doubling multiply of a 64-bit vector of 32-bit signed integers by a scalar, returning the high half.
+ *
+ * This function computes `(2 * a * b + (1 << 31)) >> 32` for every element of `a` and `b`, saturated
+ * to 32 bits, analogous to the ARM Neon function `vqrdmulh_n_s32`. It maps to `vsmul.vx`, the signed
+ * fractional multiply, with the rounding mode round-to-nearest-up. Only INT32_MIN * INT32_MIN
+ * saturates, to INT32_MAX, which sets `vxsat` as Neon sets QC.
+ *
+ * @param a The first input vector of type int32x2_t.
+ * @param b The scalar multiplier.
+ * @return int32x2_t The saturated high halves of the doubled products.
+ */
+RHAL_API int32x2_t vqrdmulh_n_s32_rvv(int32x2_t a, int32_t b) {
+    #if defined(RHAL_VXRM_BLOCK) && defined(RHAL_FRACTIONAL_LMUL)
+        return RHAL_VXRM_AMBIENT_VV("vsmul.vv", "e32", RHAL_LMUL_D, a, __riscv_vmv_v_x_i32mf2(b, VLEN_2), VLEN_2);
+    #elif defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vsmul.vv", "e32", RHAL_LMUL_D, a, __riscv_vmv_v_x_i32m1(b, VLEN_2), VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsmul_vx_i32mf2(a, b, __RISCV_VXRM_RNU, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vsmul_vx_i32m1(a, b, __RISCV_VXRM_RNU, VLEN_2);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsmul_vx_i32mf2(a, b, VLEN_2);
+    #else
+        return __riscv_vsmul_vx_i32m1(a, b, VLEN_2);
+    #endif
+}
@@ -0,0 +1,30 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating rounding doubling multiply of a 64-bit vector of 16-bit signed integers by another, returning the high half.
+ *
+ * This function computes `(2 * a * b + (1 << 15)) >> 16` for every element of `a` and the
+ * corresponding element of `b`, saturated to 16 bits, analogous to the ARM Neon function
+ * `vqrdmulh_s16`. It maps to `vsmul.vv`, the signed fractional multiply, with the rounding mode
+ * round-to-nearest-up. Only INT16_MIN * INT16_MIN saturates, to INT16_MAX, which sets `vxsat` as Neon
+ * sets QC.
+ *
+ * @param a The first input vector of type int16x4_t.
+ * @param b The second input vector of type int16x4_t.
+ * @return int16x4_t The saturated high halves of the doubled products.
+ */
+RHAL_API int16x4_t vqrdmulh_s16_rvv(int16x4_t a, int16x4_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vsmul.vv", "e16", RHAL_LMUL_D, a, b, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsmul_vv_i16mf2(a, b, __RISCV_VXRM_RNU, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vsmul_vv_i16m1(a, b, __RISCV_VXRM_RNU, VLEN_4);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsmul_vv_i16mf2(a, b, VLEN_4);
+    #else
+        return __riscv_vsmul_vv_i16m1(a, b, VLEN_4);
+    #endif
+}
@@ -0,0 +1,39 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating rounding doubling multiply of a 128-bit vector of 16-bit signed integers by one lane of a 64-bit vector, returning the high half.
+ *
+ * This function computes `(2 * a * b + (1 << 15)) >> 16` for every element of `a` and element `lane`
+ * of `v`, saturated to 16 bits, analogous to the ARM Neon function `vqrdmulhq_lane_s16`. It maps to
+ * `vsmul.vv`, the signed fractional multiply, with the rounding mode round-to-nearest-up. Only
+ * INT16_MIN * INT16_MIN saturates, to INT16_MAX, which sets `vxsat` as Neon sets QC. The lane is
+ * broadcast in registers with `vrgather.vx`.
+ *
+ * @param a The first input vector of type int16x8_t.
+ * @param v The vector of type int16x4_t holding the multiplier.
+ * @param lane The lane of `v`, from 0 to 3.
+ * @return int16x8_t The saturated high halves of the doubled products.
+ */
+RHAL_API int16x8_t vqrdmulhq_lane_s16_rvv(int16x8_t a, int16x4_t v, const int lane) {
+    #if defined(RHAL_VXRM_BLOCK) && defined(RHAL_FRACTIONAL_LMUL)
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(__riscv_vlmul_ext_v_i16mf2_i16m1(v), lane, VLEN_8);
+        return RHAL_VXRM_AMBIENT_VV("vsmul.vv", "e16", "m1", a, m, VLEN_8);
+    #elif defined(RHAL_VXRM_BLOCK)
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(v, lane, VLEN_8);
+        return RHAL_VXRM_AMBIENT_VV("vsmul.vv", "e16", "m1", a, m, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(__riscv_vlmul_ext_v_i16mf2_i16m1(v), lane, VLEN_8);
+        return __riscv_vsmul_vv_i16m1(a, m, __RISCV_VXRM_RNU, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(v, lane, VLEN_8);
+        return __riscv_vsmul_vv_i16m1(a, m, __RISCV_VXRM_RNU, VLEN_8);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(__riscv_vlmul_ext_v_i16mf2_i16m1(v), lane, VLEN_8);
+        return __riscv_vsmul_vv_i16m1(a, m, VLEN_8);
+    #else
+        vint16m1_t m = __riscv_vrgather_vx_i16m1(v, lane, VLEN_8);
+        return __riscv_vsmul_vv_i16m1(a, m, VLEN_8);
+    #endif
+}
@@ -0,0 +1,25 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating rounding doubling multiply of a 128-bit vector of 16-bit signed integers by a scalar, returning the high half.
+ *
+ * This function computes `(2 * a * b + (1 << 15)) >> 16` for every element of `a` and `b`, saturated
+ * to 16 bits, analogous to the ARM Neon function `vqrdmulhq_n_s16`. It maps to `vsmul.vx`, the signed
+ * fractional multiply, with the rounding mode round-to-nearest-up. Only INT16_MIN * INT16_MIN
+ * saturates, to INT16_MAX, which sets `vxsat` as Neon sets QC.
+ *
+ * @param a The first input vector of type int16x8_t.
+ * @param b The scalar multiplier.
+ * @return int16x8_t The saturated high halves of the doubled products.
+ */
+RHAL_API int16x8_t vqrdmulhq_n_s16_rvv(int16x8_t a, int16_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vsmul.vv", "e16", "m1", a, __riscv_vmv_v_x_i16m1(b, VLEN_8), VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vsmul_vx_i16m1(a, b, __RISCV_VXRM_RNU, VLEN_8);
+    #else
+        return __riscv_vsmul_vx_i16m1(a, b, VLEN_8);
+    #endif
+}
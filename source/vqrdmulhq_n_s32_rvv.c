@@ -0,0 +1,25 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Saturating rounding doubling multiply of a 128-bit vector of 32-bit signed integers by a scalar, returning the high half.
+ *
+ * This function computes `(2 * a * b + (1 << 31)) >> 32` for every element of `a` and `b`, saturated
+ * to 32 bits, analogous to the ARM Neon function `vqrdmulhq_n_s32`. It maps to `vsmul.vx`, the signed
+ * fractional multiply, with the rounding mode round-to-nearest-up. Only INT32_MIN * INT32_MIN
+ * saturates, to INT32_MAX, which sets `vxsat` as Neon sets QC.
+ *
+ * @param a The first input vector of type int32x4_t.
+ * @param b The scalar multiplier.
+ * @return int32x4_t The saturated high halves of the doubled products.
+ */
+RHAL_API int32x4_t vqrdmulhq_n_s32_rvv(int32x4_t a, int32_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vsmul.vv", "e32", "m1", a, __riscv_vmv_v_x_i32m1(b, VLEN_4), VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vsmul_vx_i32m1(a, b, __RISCV_VXRM_RNU, VLEN_4);
+    #else
+        return __riscv_vsmul_vx_i32m1(a, b, VLEN_4);
+    #endif
+}
@@ -15,6 +15,6 @@
  * @param b The second input vector of type uint64x1_t containing 64-bit unsigned integers.
  * @return uint64x1_t The result of the element-wise saturating subtraction, returned as an 64-bit unsigned integer vector.
  */
-uint64x1_t vqsub_u64_rvv(uint64x1_t a, uint64x1_t b) {
+RHAL_API uint64x1_t vqsub_u64_rvv(uint64x1_t a, uint64x1_t b) {
     return __riscv_vssubu_vv_u64m1(a, b, VLEN_1);
 }
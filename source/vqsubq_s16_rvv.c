@@ -15,6 +15,6 @@
  * @param b The second input vector of type int16x8_t containing 16-bit signed integers.
  * @return int16x8_t The result of the element-wise saturating subtraction, returned as an 16-bit signed integer vector.
  */
-int16x8_t vqsubq_s16_rvv(int16x8_t a, int16x8_t b) {
+RHAL_API int16x8_t vqsubq_s16_rvv(int16x8_t a, int16x8_t b) {
     return __riscv_vssub_vv_i16m1(a, b, VLEN_8);
 }
@@ -15,6 +15,6 @@
  * @param b The second input vector of type int32x4_t containing 32-bit signed integers.
  * @return int32x4_t The result of the element-wise saturating subtraction, returned as an 32-bit signed integer vector.
  */
-int32x4_t vqsubq_s32_rvv(int32x4_t a, int32x4_t b) {
+RHAL_API int32x4_t vqsubq_s32_rvv(int32x4_t a, int32x4_t b) {
     return __riscv_vssub_vv_i32m1(a, b, VLEN_4);
 }
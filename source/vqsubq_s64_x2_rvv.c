@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Performs an element-wise saturating subtraction of two pairs of 128-bit vectors of 64-bit signed integers.
+ * 
+ * This function performs the element-wise saturating subtraction of `vqsubq_s64` on two 128-bit vectors packed into
+ * each register (`a` and `b`, see vcombineq_s64_x2_rvv), i.e. on 4 elements with a single instruction.
+ * It requires VLEN >= 256 (rhal_paired_supported()). The result holds the saturated difference of the low vectors
+ * in its low half and the saturated difference of the high vectors in its high half.
+ * 
+ * @param a The first input pair of type int64x4_t containing 64-bit signed integers.
+ * @param b The second input pair of type int64x4_t containing 64-bit signed integers.
+ * @return int64x4_t The pair of results of the element-wise saturating subtraction.
+ */
+RHAL_API int64x4_t vqsubq_s64_x2_rvv(int64x4_t a, int64x4_t b) {
+    return __riscv_vssub_vv_i64m1(a, b, VLEN_4);
+}
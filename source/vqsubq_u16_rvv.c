@@ -15,6 +15,6 @@
  * @param b The second input vector of type uint16x8_t containing 16-bit unsigned integers.
  * @return uint16x8_t The result of the element-wise saturating subtraction, returned as an 16-bit unsigned integer vector.
  */
-uint16x8_t vqsubq_u16_rvv(uint16x8_t a, uint16x8_t b) {
+RHAL_API uint16x8_t vqsubq_u16_rvv(uint16x8_t a, uint16x8_t b) {
     return __riscv_vssubu_vv_u16m1(a, b, VLEN_8);
 }
@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Performs an element-wise saturating subtraction of two pairs of 128-bit vectors of 8-bit unsigned integers.
+ * 
+ * This function performs the element-wise saturating subtraction of `vqsubq_u8` on two 128-bit vectors packed into
+ * each register (`a` and `b`, see vcombineq_u8_x2_rvv), i.e. on 32 elements with a single instruction.
+ * It requires VLEN >= 256 (rhal_paired_supported()). The result holds the saturated difference of the low vectors
+ * in its low half and the saturated difference of the high vectors in its high half.
+ * 
+ * @param a The first input pair of type uint8x32_t containing 8-bit unsigned integers.
+ * @param b The second input pair of type uint8x32_t containing 8-bit unsigned integers.
+ * @return uint8x32_t The pair of results of the element-wise saturating subtraction.
+ */
+RHAL_API uint8x32_t vqsubq_u8_x2_rvv(uint8x32_t a, uint8x32_t b) {
+    return __riscv_vssubu_vv_u8m1(a, b, VLEN_32);
+}
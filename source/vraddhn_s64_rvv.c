@@ -16,6 +16,14 @@
  * @return int32x2_t The narrowed result of the element-wise rounding addition, where each element is an 32-bit signed integer extracted from the 
  * most significant half of the corresponding 64-bit rounded sum.
  */
-int32x2_t vraddhn_s64_rvv(int64x2_t a, int64x2_t b) {
-    return __riscv_vlmul_ext_v_i32mf2_i32m1(__riscv_vnsra_wx_i32mf2(__riscv_vadd_vx_i64m1(__riscv_vadd_vv_i64m1(a, b, VLEN_2),(int64_t)1<<31,VLEN_2), 32, VLEN_2));
+RHAL_API int32x2_t vraddhn_s64_rvv(int64x2_t a, int64x2_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vncvt_x_x_w_i32mf2(__riscv_vssra_vx_i64m1(__riscv_vadd_vv_i64m1(a, b, VLEN_2), 32, __RISCV_VXRM_RNU, VLEN_2), VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vlmul_ext_v_i32mf2_i32m1(__riscv_vncvt_x_x_w_i32mf2(__riscv_vssra_vx_i64m1(__riscv_vadd_vv_i64m1(a, b, VLEN_2), 32, __RISCV_VXRM_RNU, VLEN_2), VLEN_2));
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsra_wx_i32mf2(__riscv_vadd_vx_i64m1(__riscv_vadd_vv_i64m1(a, b, VLEN_2),(int64_t)1<<31,VLEN_2), 32, VLEN_2);
+    #else
+        return __riscv_vlmul_ext_v_i32mf2_i32m1(__riscv_vnsra_wx_i32mf2(__riscv_vadd_vx_i64m1(__riscv_vadd_vv_i64m1(a, b, VLEN_2),(int64_t)1<<31,VLEN_2), 32, VLEN_2));
+    #endif
 }
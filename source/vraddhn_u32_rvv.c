@@ -16,6 +16,14 @@
  * @return int16x4_t The narrowed result of the element-wise rounding addition, where each element is an 16-bit unsigned integer extracted from the 
  * most significant half of the corresponding 32-bit rounded sum.
  */
-uint16x4_t vraddhn_u32_rvv(uint32x4_t a, uint32x4_t b) {
-    return __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vnsrl_wx_u16mf2(__riscv_vadd_vx_u32m1(__riscv_vadd_vv_u32m1(a, b, VLEN_4),1<<15,VLEN_4), 16, VLEN_4));
+RHAL_API uint16x4_t vraddhn_u32_rvv(uint32x4_t a, uint32x4_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vncvt_x_x_w_u16mf2(__riscv_vssrl_vx_u32m1(__riscv_vadd_vv_u32m1(a, b, VLEN_4), 16, __RISCV_VXRM_RNU, VLEN_4), VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vncvt_x_x_w_u16mf2(__riscv_vssrl_vx_u32m1(__riscv_vadd_vv_u32m1(a, b, VLEN_4), 16, __RISCV_VXRM_RNU, VLEN_4), VLEN_4));
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsrl_wx_u16mf2(__riscv_vadd_vx_u32m1(__riscv_vadd_vv_u32m1(a, b, VLEN_4),1<<15,VLEN_4), 16, VLEN_4);
+    #else
+        return __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vnsrl_wx_u16mf2(__riscv_vadd_vx_u32m1(__riscv_vadd_vv_u32m1(a, b, VLEN_4),1<<15,VLEN_4), 16, VLEN_4));
+    #endif
 }
@@ -16,6 +16,14 @@
  * @return int32x2_t The narrowed result of the element-wise rounding addition, where each element is an 32-bit unsigned integer extracted from the 
  * most significant half of the corresponding 64-bit rounded sum.
  */
-uint32x2_t vraddhn_u64_rvv(uint64x2_t a, uint64x2_t b) {
-    return __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnsrl_wx_u32mf2(__riscv_vadd_vx_u64m1(__riscv_vadd_vv_u64m1(a, b, VLEN_2),(uint64_t)1<<31,VLEN_2), 32, VLEN_2));
+RHAL_API uint32x2_t vraddhn_u64_rvv(uint64x2_t a, uint64x2_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vncvt_x_x_w_u32mf2(__riscv_vssrl_vx_u64m1(__riscv_vadd_vv_u64m1(a, b, VLEN_2), 32, __RISCV_VXRM_RNU, VLEN_2), VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vncvt_x_x_w_u32mf2(__riscv_vssrl_vx_u64m1(__riscv_vadd_vv_u64m1(a, b, VLEN_2), 32, __RISCV_VXRM_RNU, VLEN_2), VLEN_2));
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsrl_wx_u32mf2(__riscv_vadd_vx_u64m1(__riscv_vadd_vv_u64m1(a, b, VLEN_2),(uint64_t)1<<31,VLEN_2), 32, VLEN_2);
+    #else
+        return __riscv_vlmul_ext_v_u32mf2_u32m1(__riscv_vnsrl_wx_u32mf2(__riscv_vadd_vx_u64m1(__riscv_vadd_vv_u64m1(a, b, VLEN_2),(uint64_t)1<<31,VLEN_2), 32, VLEN_2));
+    #endif
 }
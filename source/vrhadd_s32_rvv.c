@@ -17,6 +17,16 @@
  * @param b The second input vector of type int32x2_t containing 32-bit signed integers.
  * @return int32x2_t The result of the rounding halving addition, returned as an 32-bit signed integer vector.
  */
-int32x2_t vrhadd_s32_rvv(int32x2_t a, int32x2_t b) {
-    return __riscv_vaadd_vv_i32m1(a, b, VLEN_2);
+RHAL_API int32x2_t vrhadd_s32_rvv(int32x2_t a, int32x2_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaadd.vv", "e32", RHAL_LMUL_D, a, b, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaadd_vv_i32mf2(a, b, __RISCV_VXRM_RNU, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaadd_vv_i32m1(a, b, __RISCV_VXRM_RNU, VLEN_2);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaadd_vv_i32mf2(a, b, VLEN_2);
+    #else
+        return __riscv_vaadd_vv_i32m1(a, b, VLEN_2);
+    #endif
 }
@@ -17,6 +17,16 @@
  * @param b The second input vector of type int8x8_t containing 8-bit signed integers.
  * @return int8x8_t The result of the rounding halving addition, returned as an 8-bit signed integer vector.
  */
-int8x8_t vrhadd_s8_rvv(int8x8_t a, int8x8_t b) {
-    return __riscv_vaadd_vv_i8m1(a, b, VLEN_8);
+RHAL_API int8x8_t vrhadd_s8_rvv(int8x8_t a, int8x8_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaadd.vv", "e8", RHAL_LMUL_D, a, b, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaadd_vv_i8mf2(a, b, __RISCV_VXRM_RNU, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaadd_vv_i8m1(a, b, __RISCV_VXRM_RNU, VLEN_8);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaadd_vv_i8mf2(a, b, VLEN_8);
+    #else
+        return __riscv_vaadd_vv_i8m1(a, b, VLEN_8);
+    #endif
 }
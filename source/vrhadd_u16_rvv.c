@@ -17,6 +17,16 @@
  * @param b The second input vector of type uint16x4_t containing 16-bit unsigned integers.
  * @return uint16x4_t The result of the rounding halving addition, returned as an 16-bit unsigned integer vector.
  */
-uint16x4_t vrhadd_u16_rvv(uint16x4_t a, uint16x4_t b) {
-    return __riscv_vaaddu_vv_u16m1(a, b, VLEN_4);
+RHAL_API uint16x4_t vrhadd_u16_rvv(uint16x4_t a, uint16x4_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaaddu.vv", "e16", RHAL_LMUL_D, a, b, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaaddu_vv_u16mf2(a, b, __RISCV_VXRM_RNU, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaaddu_vv_u16m1(a, b, __RISCV_VXRM_RNU, VLEN_4);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaaddu_vv_u16mf2(a, b, VLEN_4);
+    #else
+        return __riscv_vaaddu_vv_u16m1(a, b, VLEN_4);
+    #endif
 }
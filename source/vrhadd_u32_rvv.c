@@ -17,6 +17,16 @@
  * @param b The second input vector of type uint32x2_t containing 32-bit unsigned integers.
  * @return uint32x2_t The result of the rounding halving addition, returned as an 32-bit unsigned integer vector.
  */
-uint32x2_t vrhadd_u32_rvv(uint32x2_t a, uint32x2_t b) {
-    return __riscv_vaaddu_vv_u32m1(a, b, VLEN_2);
+RHAL_API uint32x2_t vrhadd_u32_rvv(uint32x2_t a, uint32x2_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaaddu.vv", "e32", RHAL_LMUL_D, a, b, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaaddu_vv_u32mf2(a, b, __RISCV_VXRM_RNU, VLEN_2);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaaddu_vv_u32m1(a, b, __RISCV_VXRM_RNU, VLEN_2);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaaddu_vv_u32mf2(a, b, VLEN_2);
+    #else
+        return __riscv_vaaddu_vv_u32m1(a, b, VLEN_2);
+    #endif
 }
@@ -17,6 +17,16 @@
  * @param b The second input vector of type uint8x8_t containing 8-bit unsigned integers.
  * @return uint8x8_t The result of the rounding halving addition, returned as an 8-bit unsigned integer vector.
  */
-uint8x8_t vrhadd_u8_rvv(uint8x8_t a, uint8x8_t b) {
-    return __riscv_vaaddu_vv_u8m1(a, b, VLEN_8);
+RHAL_API uint8x8_t vrhadd_u8_rvv(uint8x8_t a, uint8x8_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaaddu.vv", "e8", RHAL_LMUL_D, a, b, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaaddu_vv_u8mf2(a, b, __RISCV_VXRM_RNU, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaaddu_vv_u8m1(a, b, __RISCV_VXRM_RNU, VLEN_8);
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vaaddu_vv_u8mf2(a, b, VLEN_8);
+    #else
+        return __riscv_vaaddu_vv_u8m1(a, b, VLEN_8);
+    #endif
 }
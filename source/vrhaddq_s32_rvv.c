@@ -17,6 +17,12 @@
  * @param b The second input vector of type int32x4_t containing 16 elements of 32-bit signed integers.
  * @return int32x4_t The result of the rounding halving addition, returned as a 128-bit vector of 32-bit signed integers.
  */
-int32x4_t vrhaddq_s32_rvv(int32x4_t a, int32x4_t b) {
-    return __riscv_vaadd_vv_i32m1(a, b, VLEN_4);
+RHAL_API int32x4_t vrhaddq_s32_rvv(int32x4_t a, int32x4_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaadd.vv", "e32", "m1", a, b, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaadd_vv_i32m1(a, b, __RISCV_VXRM_RNU, VLEN_4);
+    #else
+        return __riscv_vaadd_vv_i32m1(a, b, VLEN_4);
+    #endif
 }
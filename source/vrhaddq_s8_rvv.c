@@ -17,6 +17,12 @@
  * @param b The second input vector of type int8x16_t containing 16 elements of 8-bit signed integers.
  * @return int8x16_t The result of the rounding halving addition, returned as a 128-bit vector of 8-bit signed integers.
  */
-int8x16_t vrhaddq_s8_rvv(int8x16_t a, int8x16_t b) {
-    return __riscv_vaadd_vv_i8m1(a, b, VLEN_16);
+RHAL_API int8x16_t vrhaddq_s8_rvv(int8x16_t a, int8x16_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaadd.vv", "e8", "m1", a, b, VLEN_16);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaadd_vv_i8m1(a, b, __RISCV_VXRM_RNU, VLEN_16);
+    #else
+        return __riscv_vaadd_vv_i8m1(a, b, VLEN_16);
+    #endif
 }
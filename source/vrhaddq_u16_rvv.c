@@ -17,6 +17,12 @@
  * @param b The second input vector of type uint16x8_t containing 16 elements of 16-bit unsigned integers.
  * @return uint16x8_t The result of the rounding halving addition, returned as a 128-bit vector of 16-bit unsigned integers.
  */
-uint16x8_t vrhaddq_u16_rvv(uint16x8_t a, uint16x8_t b) {
-    return __riscv_vaaddu_vv_u16m1(a, b, VLEN_8);
+RHAL_API uint16x8_t vrhaddq_u16_rvv(uint16x8_t a, uint16x8_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaaddu.vv", "e16", "m1", a, b, VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaaddu_vv_u16m1(a, b, __RISCV_VXRM_RNU, VLEN_8);
+    #else
+        return __riscv_vaaddu_vv_u16m1(a, b, VLEN_8);
+    #endif
 }
@@ -17,6 +17,12 @@
  * @param b The second input vector of type uint32x4_t containing 16 elements of 32-bit unsigned integers.
  * @return uint32x4_t The result of the rounding halving addition, returned as a 128-bit vector of 32-bit unsigned integers.
  */
-uint32x4_t vrhaddq_u32_rvv(uint32x4_t a, uint32x4_t b) {
-    return __riscv_vaaddu_vv_u32m1(a, b, VLEN_4);
+RHAL_API uint32x4_t vrhaddq_u32_rvv(uint32x4_t a, uint32x4_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaaddu.vv", "e32", "m1", a, b, VLEN_4);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaaddu_vv_u32m1(a, b, __RISCV_VXRM_RNU, VLEN_4);
+    #else
+        return __riscv_vaaddu_vv_u32m1(a, b, VLEN_4);
+    #endif
 }
@@ -17,6 +17,12 @@
  * @param b The second input vector of type uint8x16_t containing 16 elements of 8-bit unsigned integers.
  * @return uint8x16_t The result of the rounding halving addition, returned as a 128-bit vector of 8-bit unsigned integers.
  */
-uint8x16_t vrhaddq_u8_rvv(uint8x16_t a, uint8x16_t b) {
-    return __riscv_vaaddu_vv_u8m1(a, b, VLEN_16);
+RHAL_API uint8x16_t vrhaddq_u8_rvv(uint8x16_t a, uint8x16_t b) {
+    #if defined(RHAL_VXRM_BLOCK)
+        return RHAL_VXRM_AMBIENT_VV("vaaddu.vv", "e8", "m1", a, b, VLEN_16);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vaaddu_vv_u8m1(a, b, __RISCV_VXRM_RNU, VLEN_16);
+    #else
+        return __riscv_vaaddu_vv_u8m1(a, b, VLEN_16);
+    #endif
 }
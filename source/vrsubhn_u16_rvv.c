@@ -16,6 +16,14 @@
  * @return int8x8_t The narrowed result of the element-wise rounding subtraction, where each element is an 8-bit unsigned integer extracted from the 
  * most significant half of the corresponding 16-bit rounded difference.
  */
-uint8x8_t vrsubhn_u16_rvv(uint16x8_t a, uint16x8_t b) {
-    return __riscv_vlmul_ext_v_u8mf2_u8m1(__riscv_vnsrl_wx_u8mf2(__riscv_vadd_vx_u16m1(__riscv_vsub_vv_u16m1(a, b, VLEN_8),1<<7,VLEN_8), 8, VLEN_8));
+RHAL_API uint8x8_t vrsubhn_u16_rvv(uint16x8_t a, uint16x8_t b) {
+    #if defined(RHAL_VXRM_EXPLICIT) && defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vncvt_x_x_w_u8mf2(__riscv_vssrl_vx_u16m1(__riscv_vsub_vv_u16m1(a, b, VLEN_8), 8, __RISCV_VXRM_RNU, VLEN_8), VLEN_8);
+    #elif defined(RHAL_VXRM_EXPLICIT)
+        return __riscv_vlmul_ext_v_u8mf2_u8m1(__riscv_vncvt_x_x_w_u8mf2(__riscv_vssrl_vx_u16m1(__riscv_vsub_vv_u16m1(a, b, VLEN_8), 8, __RISCV_VXRM_RNU, VLEN_8), VLEN_8));
+    #elif defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsrl_wx_u8mf2(__riscv_vadd_vx_u16m1(__riscv_vsub_vv_u16m1(a, b, VLEN_8),1<<7,VLEN_8), 8, VLEN_8);
+    #else
+        return __riscv_vlmul_ext_v_u8mf2_u8m1(__riscv_vnsrl_wx_u8mf2(__riscv_vadd_vx_u16m1(__riscv_vsub_vv_u16m1(a, b, VLEN_8),1<<7,VLEN_8), 8, VLEN_8));
+    #endif
 }
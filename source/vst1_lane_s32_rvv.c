@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of a 64-bit vector of 32-bit signed integers to memory.
+ *
+ * This function slides element `lane` of `val` down to element 0 and stores it to `ptr` as a scalar,
+ * analogous to the ARM Neon function `vst1_lane_s32`.
+ *
+ * @param ptr Pointer to the memory for the element.
+ * @param val The vector of type int32x2_t.
+ * @param lane The lane to store, from 0 to 1.
+ */
+RHAL_API void vst1_lane_s32_rvv(int32_t *ptr, int32x2_t val, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        *ptr = __riscv_vmv_x_s_i32mf2_i32(__riscv_vslidedown_vx_i32mf2(val, lane, VLEN_1));
+    #else
+        *ptr = __riscv_vmv_x_s_i32m1_i32(__riscv_vslidedown_vx_i32m1(val, lane, VLEN_1));
+    #endif
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of a 64-bit vector of 64-bit unsigned integers to memory.
+ *
+ * This function slides element `lane` of `val` down to element 0 and stores it to `ptr` as a scalar,
+ * analogous to the ARM Neon function `vst1_lane_u64`.
+ *
+ * @param ptr Pointer to the memory for the element.
+ * @param val The vector of type uint64x1_t.
+ * @param lane The lane to store, from 0 to 0.
+ */
+RHAL_API void vst1_lane_u64_rvv(uint64_t *ptr, uint64x1_t val, const int lane) {
+    *ptr = __riscv_vmv_x_s_u64m1_u64(__riscv_vslidedown_vx_u64m1(val, lane, VLEN_1));
+}
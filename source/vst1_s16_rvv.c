@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 64-bit vector of 16-bit signed integers to memory.
+ *
+ * This function stores the 4 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1_s16`.
+ *
+ * @param ptr Pointer to the memory for the 4 elements.
+ * @param val The vector of type int16x4_t to store.
+ */
+RHAL_API void vst1_s16_rvv(int16_t *ptr, int16x4_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_i16mf2(ptr, val, VLEN_4);
+    #else
+        __riscv_vse16_v_i16m1(ptr, val, VLEN_4);
+    #endif
+}
@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 64-bit vectors of 16-bit signed integers to consecutive memory.
+ *
+ * This function joins the four vectors of `val` into a register group of LMUL=2 and stores the
+ * 16 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1_s16_x4`.
+ * Vector i is slid up to element 4 * i of the group.
+ *
+ * @param ptr Pointer to the memory for the 16 elements.
+ * @param val The four vectors of type int16x4x4_t to store.
+ */
+RHAL_API void vst1_s16_x4_rvv(int16_t *ptr, int16x4x4_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint16m2_t v = __riscv_vlmul_ext_v_i16mf2_i16m2(__riscv_vget_v_i16mf2x4_i16mf2(val, 0));
+        v = __riscv_vslideup_vx_i16m2(v, __riscv_vlmul_ext_v_i16mf2_i16m2(__riscv_vget_v_i16mf2x4_i16mf2(val, 1)), 4, VLEN_8);
+        v = __riscv_vslideup_vx_i16m2(v, __riscv_vlmul_ext_v_i16mf2_i16m2(__riscv_vget_v_i16mf2x4_i16mf2(val, 2)), 8, VLEN_12);
+        v = __riscv_vslideup_vx_i16m2(v, __riscv_vlmul_ext_v_i16mf2_i16m2(__riscv_vget_v_i16mf2x4_i16mf2(val, 3)), 12, VLEN_16);
+        __riscv_vse16_v_i16m2(ptr, v, VLEN_16);
+    #else
+        vint16m2_t v = __riscv_vlmul_ext_v_i16m1_i16m2(__riscv_vget_v_i16m1x4_i16m1(val, 0));
+        v = __riscv_vslideup_vx_i16m2(v, __riscv_vlmul_ext_v_i16m1_i16m2(__riscv_vget_v_i16m1x4_i16m1(val, 1)), 4, VLEN_8);
+        v = __riscv_vslideup_vx_i16m2(v, __riscv_vlmul_ext_v_i16m1_i16m2(__riscv_vget_v_i16m1x4_i16m1(val, 2)), 8, VLEN_12);
+        v = __riscv_vslideup_vx_i16m2(v, __riscv_vlmul_ext_v_i16m1_i16m2(__riscv_vget_v_i16m1x4_i16m1(val, 3)), 12, VLEN_16);
+        __riscv_vse16_v_i16m2(ptr, v, VLEN_16);
+    #endif
+}
@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 64-bit vector of 32-bit signed integers to memory.
+ *
+ * This function stores the 2 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1_s32`.
+ *
+ * @param ptr Pointer to the memory for the 2 elements.
+ * @param val The vector of type int32x2_t to store.
+ */
+RHAL_API void vst1_s32_rvv(int32_t *ptr, int32x2_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_i32mf2(ptr, val, VLEN_2);
+    #else
+        __riscv_vse32_v_i32m1(ptr, val, VLEN_2);
+    #endif
+}
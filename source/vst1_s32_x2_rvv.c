@@ -0,0 +1,25 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 64-bit vectors of 32-bit signed integers to consecutive memory.
+ *
+ * This function joins the two vectors of `val` into a register group of LMUL=1 and stores the
+ * 4 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1_s32_x2`.
+ * Vector i is slid up to element 2 * i of the group.
+ *
+ * @param ptr Pointer to the memory for the 4 elements.
+ * @param val The two vectors of type int32x2x2_t to store.
+ */
+RHAL_API void vst1_s32_x2_rvv(int32_t *ptr, int32x2x2_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint32m1_t v = __riscv_vlmul_ext_v_i32mf2_i32m1(__riscv_vget_v_i32mf2x2_i32mf2(val, 0));
+        v = __riscv_vslideup_vx_i32m1(v, __riscv_vlmul_ext_v_i32mf2_i32m1(__riscv_vget_v_i32mf2x2_i32mf2(val, 1)), 2, VLEN_4);
+        __riscv_vse32_v_i32m1(ptr, v, VLEN_4);
+    #else
+        vint32m1_t v = __riscv_vget_v_i32m1x2_i32m1(val, 0);
+        v = __riscv_vslideup_vx_i32m1(v, __riscv_vget_v_i32m1x2_i32m1(val, 1), 2, VLEN_4);
+        __riscv_vse32_v_i32m1(ptr, v, VLEN_4);
+    #endif
+}
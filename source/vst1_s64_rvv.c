@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 64-bit vector of 64-bit signed integers to memory.
+ *
+ * This function stores the 1 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1_s64`.
+ *
+ * @param ptr Pointer to the memory for the 1 elements.
+ * @param val The vector of type int64x1_t to store.
+ */
+RHAL_API void vst1_s64_rvv(int64_t *ptr, int64x1_t val) {
+    __riscv_vse64_v_i64m1(ptr, val, VLEN_1);
+}
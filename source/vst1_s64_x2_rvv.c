@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 64-bit vectors of 64-bit signed integers to consecutive memory.
+ *
+ * This function joins the two vectors of `val` into a register group of LMUL=1 and stores the
+ * 2 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1_s64_x2`.
+ * Vector i is slid up to element 1 * i of the group.
+ *
+ * @param ptr Pointer to the memory for the 2 elements.
+ * @param val The two vectors of type int64x1x2_t to store.
+ */
+RHAL_API void vst1_s64_x2_rvv(int64_t *ptr, int64x1x2_t val) {
+    vint64m1_t v = __riscv_vget_v_i64m1x2_i64m1(val, 0);
+    v = __riscv_vslideup_vx_i64m1(v, __riscv_vget_v_i64m1x2_i64m1(val, 1), 1, VLEN_2);
+    __riscv_vse64_v_i64m1(ptr, v, VLEN_2);
+}
@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores three 64-bit vectors of 64-bit signed integers to consecutive memory.
+ *
+ * This function joins the three vectors of `val` into a register group of LMUL=2 and stores the
+ * 3 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1_s64_x3`.
+ * Vector i is slid up to element 1 * i of the group.
+ *
+ * @param ptr Pointer to the memory for the 3 elements.
+ * @param val The three vectors of type int64x1x3_t to store.
+ */
+RHAL_API void vst1_s64_x3_rvv(int64_t *ptr, int64x1x3_t val) {
+    vint64m2_t v = __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vget_v_i64m1x3_i64m1(val, 0));
+    v = __riscv_vslideup_vx_i64m2(v, __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vget_v_i64m1x3_i64m1(val, 1)), 1, VLEN_2);
+    v = __riscv_vslideup_vx_i64m2(v, __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vget_v_i64m1x3_i64m1(val, 2)), 2, VLEN_3);
+    __riscv_vse64_v_i64m2(ptr, v, VLEN_3);
+}
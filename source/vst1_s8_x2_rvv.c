@@ -0,0 +1,25 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 64-bit vectors of 8-bit signed integers to consecutive memory.
+ *
+ * This function joins the two vectors of `val` into a register group of LMUL=1 and stores the
+ * 16 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1_s8_x2`.
+ * Vector i is slid up to element 8 * i of the group.
+ *
+ * @param ptr Pointer to the memory for the 16 elements.
+ * @param val The two vectors of type int8x8x2_t to store.
+ */
+RHAL_API void vst1_s8_x2_rvv(int8_t *ptr, int8x8x2_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint8m1_t v = __riscv_vlmul_ext_v_i8mf2_i8m1(__riscv_vget_v_i8mf2x2_i8mf2(val, 0));
+        v = __riscv_vslideup_vx_i8m1(v, __riscv_vlmul_ext_v_i8mf2_i8m1(__riscv_vget_v_i8mf2x2_i8mf2(val, 1)), 8, VLEN_16);
+        __riscv_vse8_v_i8m1(ptr, v, VLEN_16);
+    #else
+        vint8m1_t v = __riscv_vget_v_i8m1x2_i8m1(val, 0);
+        v = __riscv_vslideup_vx_i8m1(v, __riscv_vget_v_i8m1x2_i8m1(val, 1), 8, VLEN_16);
+        __riscv_vse8_v_i8m1(ptr, v, VLEN_16);
+    #endif
+}
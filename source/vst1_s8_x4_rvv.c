@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 64-bit vectors of 8-bit signed integers to consecutive memory.
+ *
+ * This function joins the four vectors of `val` into a register group of LMUL=2 and stores the
+ * 32 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1_s8_x4`.
+ * Vector i is slid up to element 8 * i of the group.
+ *
+ * @param ptr Pointer to the memory for the 32 elements.
+ * @param val The four vectors of type int8x8x4_t to store.
+ */
+RHAL_API void vst1_s8_x4_rvv(int8_t *ptr, int8x8x4_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vint8m2_t v = __riscv_vlmul_ext_v_i8mf2_i8m2(__riscv_vget_v_i8mf2x4_i8mf2(val, 0));
+        v = __riscv_vslideup_vx_i8m2(v, __riscv_vlmul_ext_v_i8mf2_i8m2(__riscv_vget_v_i8mf2x4_i8mf2(val, 1)), 8, VLEN_16);
+        v = __riscv_vslideup_vx_i8m2(v, __riscv_vlmul_ext_v_i8mf2_i8m2(__riscv_vget_v_i8mf2x4_i8mf2(val, 2)), 16, VLEN_24);
+        v = __riscv_vslideup_vx_i8m2(v, __riscv_vlmul_ext_v_i8mf2_i8m2(__riscv_vget_v_i8mf2x4_i8mf2(val, 3)), 24, VLEN_32);
+        __riscv_vse8_v_i8m2(ptr, v, VLEN_32);
+    #else
+        vint8m2_t v = __riscv_vlmul_ext_v_i8m1_i8m2(__riscv_vget_v_i8m1x4_i8m1(val, 0));
+        v = __riscv_vslideup_vx_i8m2(v, __riscv_vlmul_ext_v_i8m1_i8m2(__riscv_vget_v_i8m1x4_i8m1(val, 1)), 8, VLEN_16);
+        v = __riscv_vslideup_vx_i8m2(v, __riscv_vlmul_ext_v_i8m1_i8m2(__riscv_vget_v_i8m1x4_i8m1(val, 2)), 16, VLEN_24);
+        v = __riscv_vslideup_vx_i8m2(v, __riscv_vlmul_ext_v_i8m1_i8m2(__riscv_vget_v_i8m1x4_i8m1(val, 3)), 24, VLEN_32);
+        __riscv_vse8_v_i8m2(ptr, v, VLEN_32);
+    #endif
+}
@@ -0,0 +1,25 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 64-bit vectors of 16-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the two vectors of `val` into a register group of LMUL=1 and stores the
+ * 8 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1_u16_x2`.
+ * Vector i is slid up to element 4 * i of the group.
+ *
+ * @param ptr Pointer to the memory for the 8 elements.
+ * @param val The two vectors of type uint16x4x2_t to store.
+ */
+RHAL_API void vst1_u16_x2_rvv(uint16_t *ptr, uint16x4x2_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vuint16m1_t v = __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vget_v_u16mf2x2_u16mf2(val, 0));
+        v = __riscv_vslideup_vx_u16m1(v, __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vget_v_u16mf2x2_u16mf2(val, 1)), 4, VLEN_8);
+        __riscv_vse16_v_u16m1(ptr, v, VLEN_8);
+    #else
+        vuint16m1_t v = __riscv_vget_v_u16m1x2_u16m1(val, 0);
+        v = __riscv_vslideup_vx_u16m1(v, __riscv_vget_v_u16m1x2_u16m1(val, 1), 4, VLEN_8);
+        __riscv_vse16_v_u16m1(ptr, v, VLEN_8);
+    #endif
+}
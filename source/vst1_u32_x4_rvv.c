@@ -0,0 +1,29 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 64-bit vectors of 32-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the four vectors of `val` into a register group of LMUL=2 and stores the
+ * 8 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1_u32_x4`.
+ * Vector i is slid up to element 2 * i of the group.
+ *
+ * @param ptr Pointer to the memory for the 8 elements.
+ * @param val The four vectors of type uint32x2x4_t to store.
+ */
+RHAL_API void vst1_u32_x4_rvv(uint32_t *ptr, uint32x2x4_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        vuint32m2_t v = __riscv_vlmul_ext_v_u32mf2_u32m2(__riscv_vget_v_u32mf2x4_u32mf2(val, 0));
+        v = __riscv_vslideup_vx_u32m2(v, __riscv_vlmul_ext_v_u32mf2_u32m2(__riscv_vget_v_u32mf2x4_u32mf2(val, 1)), 2, VLEN_4);
+        v = __riscv_vslideup_vx_u32m2(v, __riscv_vlmul_ext_v_u32mf2_u32m2(__riscv_vget_v_u32mf2x4_u32mf2(val, 2)), 4, VLEN_6);
+        v = __riscv_vslideup_vx_u32m2(v, __riscv_vlmul_ext_v_u32mf2_u32m2(__riscv_vget_v_u32mf2x4_u32mf2(val, 3)), 6, VLEN_8);
+        __riscv_vse32_v_u32m2(ptr, v, VLEN_8);
+    #else
+        vuint32m2_t v = __riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vget_v_u32m1x4_u32m1(val, 0));
+        v = __riscv_vslideup_vx_u32m2(v, __riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vget_v_u32m1x4_u32m1(val, 1)), 2, VLEN_4);
+        v = __riscv_vslideup_vx_u32m2(v, __riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vget_v_u32m1x4_u32m1(val, 2)), 4, VLEN_6);
+        v = __riscv_vslideup_vx_u32m2(v, __riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vget_v_u32m1x4_u32m1(val, 3)), 6, VLEN_8);
+        __riscv_vse32_v_u32m2(ptr, v, VLEN_8);
+    #endif
+}
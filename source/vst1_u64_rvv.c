@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 64-bit vector of 64-bit unsigned integers to memory.
+ *
+ * This function stores the 1 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1_u64`.
+ *
+ * @param ptr Pointer to the memory for the 1 elements.
+ * @param val The vector of type uint64x1_t to store.
+ */
+RHAL_API void vst1_u64_rvv(uint64_t *ptr, uint64x1_t val) {
+    __riscv_vse64_v_u64m1(ptr, val, VLEN_1);
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 64-bit vectors of 64-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the four vectors of `val` into a register group of LMUL=2 and stores the
+ * 4 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1_u64_x4`.
+ * Vector i is slid up to element 1 * i of the group.
+ *
+ * @param ptr Pointer to the memory for the 4 elements.
+ * @param val The four vectors of type uint64x1x4_t to store.
+ */
+RHAL_API void vst1_u64_x4_rvv(uint64_t *ptr, uint64x1x4_t val) {
+    vuint64m2_t v = __riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vget_v_u64m1x4_u64m1(val, 0));
+    v = __riscv_vslideup_vx_u64m2(v, __riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vget_v_u64m1x4_u64m1(val, 1)), 1, VLEN_2);
+    v = __riscv_vslideup_vx_u64m2(v, __riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vget_v_u64m1x4_u64m1(val, 2)), 2, VLEN_3);
+    v = __riscv_vslideup_vx_u64m2(v, __riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vget_v_u64m1x4_u64m1(val, 3)), 3, VLEN_4);
+    __riscv_vse64_v_u64m2(ptr, v, VLEN_4);
+}
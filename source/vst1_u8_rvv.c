@@ -0,0 +1,20 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 64-bit vector of 8-bit unsigned integers to memory.
+ *
+ * This function stores the 8 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1_u8`.
+ *
+ * @param ptr Pointer to the memory for the 8 elements.
+ * @param val The vector of type uint8x8_t to store.
+ */
+RHAL_API void vst1_u8_rvv(uint8_t *ptr, uint8x8_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse8_v_u8mf2(ptr, val, VLEN_8);
+    #else
+        __riscv_vse8_v_u8m1(ptr, val, VLEN_8);
+    #endif
+}
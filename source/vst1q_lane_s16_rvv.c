@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of a 128-bit vector of 16-bit signed integers to memory.
+ *
+ * This function slides element `lane` of `val` down to element 0 and stores it to `ptr` as a scalar,
+ * analogous to the ARM Neon function `vst1q_lane_s16`.
+ *
+ * @param ptr Pointer to the memory for the element.
+ * @param val The vector of type int16x8_t.
+ * @param lane The lane to store, from 0 to 7.
+ */
+RHAL_API void vst1q_lane_s16_rvv(int16_t *ptr, int16x8_t val, const int lane) {
+    *ptr = __riscv_vmv_x_s_i16m1_i16(__riscv_vslidedown_vx_i16m1(val, lane, VLEN_1));
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of a 128-bit vector of 16-bit unsigned integers to memory.
+ *
+ * This function slides element `lane` of `val` down to element 0 and stores it to `ptr` as a scalar,
+ * analogous to the ARM Neon function `vst1q_lane_u16`.
+ *
+ * @param ptr Pointer to the memory for the element.
+ * @param val The vector of type uint16x8_t.
+ * @param lane The lane to store, from 0 to 7.
+ */
+RHAL_API void vst1q_lane_u16_rvv(uint16_t *ptr, uint16x8_t val, const int lane) {
+    *ptr = __riscv_vmv_x_s_u16m1_u16(__riscv_vslidedown_vx_u16m1(val, lane, VLEN_1));
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of a 128-bit vector of 8-bit unsigned integers to memory.
+ *
+ * This function slides element `lane` of `val` down to element 0 and stores it to `ptr` as a scalar,
+ * analogous to the ARM Neon function `vst1q_lane_u8`.
+ *
+ * @param ptr Pointer to the memory for the element.
+ * @param val The vector of type uint8x16_t.
+ * @param lane The lane to store, from 0 to 15.
+ */
+RHAL_API void vst1q_lane_u8_rvv(uint8_t *ptr, uint8x16_t val, const int lane) {
+    *ptr = __riscv_vmv_x_s_u8m1_u8(__riscv_vslidedown_vx_u8m1(val, lane, VLEN_1));
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 128-bit vector of 16-bit signed integers to memory.
+ *
+ * This function stores the 8 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1q_s16`.
+ *
+ * @param ptr Pointer to the memory for the 8 elements.
+ * @param val The vector of type int16x8_t to store.
+ */
+RHAL_API void vst1q_s16_rvv(int16_t *ptr, int16x8_t val) {
+    __riscv_vse16_v_i16m1(ptr, val, VLEN_8);
+}
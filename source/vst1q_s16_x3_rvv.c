@@ -0,0 +1,26 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores three 128-bit vectors of 16-bit signed integers to consecutive memory.
+ *
+ * This function joins the three vectors of `val` into a register group of LMUL=4 and stores the
+ * 24 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_s16_x3`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 8 * i.
+ *
+ * @param ptr Pointer to the memory for the 24 elements.
+ * @param val The three vectors of type int16x8x3_t to store.
+ */
+RHAL_API void vst1q_s16_x3_rvv(int16_t *ptr, int16x8x3_t val) {
+    vint16m4_t v = __riscv_vlmul_ext_v_i16m1_i16m4(__riscv_vget_v_i16m1x3_i16m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_i16m1_i16m4(v, 1, __riscv_vget_v_i16m1x3_i16m1(val, 1));
+        v = __riscv_vset_v_i16m1_i16m4(v, 2, __riscv_vget_v_i16m1x3_i16m1(val, 2));
+    #else
+        v = __riscv_vslideup_vx_i16m4(v, __riscv_vlmul_ext_v_i16m1_i16m4(__riscv_vget_v_i16m1x3_i16m1(val, 1)), 8, VLEN_16);
+        v = __riscv_vslideup_vx_i16m4(v, __riscv_vlmul_ext_v_i16m1_i16m4(__riscv_vget_v_i16m1x3_i16m1(val, 2)), 16, VLEN_24);
+    #endif
+    __riscv_vse16_v_i16m4(ptr, v, VLEN_24);
+}
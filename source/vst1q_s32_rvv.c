@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 128-bit vector of 32-bit signed integers to memory.
+ *
+ * This function stores the 4 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1q_s32`.
+ *
+ * @param ptr Pointer to the memory for the 4 elements.
+ * @param val The vector of type int32x4_t to store.
+ */
+RHAL_API void vst1q_s32_rvv(int32_t *ptr, int32x4_t val) {
+    __riscv_vse32_v_i32m1(ptr, val, VLEN_4);
+}
@@ -0,0 +1,28 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 128-bit vectors of 32-bit signed integers to consecutive memory.
+ *
+ * This function joins the four vectors of `val` into a register group of LMUL=4 and stores the
+ * 16 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_s32_x4`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 4 * i.
+ *
+ * @param ptr Pointer to the memory for the 16 elements.
+ * @param val The four vectors of type int32x4x4_t to store.
+ */
+RHAL_API void vst1q_s32_x4_rvv(int32_t *ptr, int32x4x4_t val) {
+    vint32m4_t v = __riscv_vlmul_ext_v_i32m1_i32m4(__riscv_vget_v_i32m1x4_i32m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_i32m1_i32m4(v, 1, __riscv_vget_v_i32m1x4_i32m1(val, 1));
+        v = __riscv_vset_v_i32m1_i32m4(v, 2, __riscv_vget_v_i32m1x4_i32m1(val, 2));
+        v = __riscv_vset_v_i32m1_i32m4(v, 3, __riscv_vget_v_i32m1x4_i32m1(val, 3));
+    #else
+        v = __riscv_vslideup_vx_i32m4(v, __riscv_vlmul_ext_v_i32m1_i32m4(__riscv_vget_v_i32m1x4_i32m1(val, 1)), 4, VLEN_8);
+        v = __riscv_vslideup_vx_i32m4(v, __riscv_vlmul_ext_v_i32m1_i32m4(__riscv_vget_v_i32m1x4_i32m1(val, 2)), 8, VLEN_12);
+        v = __riscv_vslideup_vx_i32m4(v, __riscv_vlmul_ext_v_i32m1_i32m4(__riscv_vget_v_i32m1x4_i32m1(val, 3)), 12, VLEN_16);
+    #endif
+    __riscv_vse32_v_i32m4(ptr, v, VLEN_16);
+}
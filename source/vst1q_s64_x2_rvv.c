@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 128-bit vectors of 64-bit signed integers to consecutive memory.
+ *
+ * This function joins the two vectors of `val` into a register group of LMUL=2 and stores the
+ * 4 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_s64_x2`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 2 * i.
+ *
+ * @param ptr Pointer to the memory for the 4 elements.
+ * @param val The two vectors of type int64x2x2_t to store.
+ */
+RHAL_API void vst1q_s64_x2_rvv(int64_t *ptr, int64x2x2_t val) {
+    vint64m2_t v = __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vget_v_i64m1x2_i64m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_i64m1_i64m2(v, 1, __riscv_vget_v_i64m1x2_i64m1(val, 1));
+    #else
+        v = __riscv_vslideup_vx_i64m2(v, __riscv_vlmul_ext_v_i64m1_i64m2(__riscv_vget_v_i64m1x2_i64m1(val, 1)), 2, VLEN_4);
+    #endif
+    __riscv_vse64_v_i64m2(ptr, v, VLEN_4);
+}
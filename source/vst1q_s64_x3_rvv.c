@@ -0,0 +1,26 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores three 128-bit vectors of 64-bit signed integers to consecutive memory.
+ *
+ * This function joins the three vectors of `val` into a register group of LMUL=4 and stores the
+ * 6 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_s64_x3`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 2 * i.
+ *
+ * @param ptr Pointer to the memory for the 6 elements.
+ * @param val The three vectors of type int64x2x3_t to store.
+ */
+RHAL_API void vst1q_s64_x3_rvv(int64_t *ptr, int64x2x3_t val) {
+    vint64m4_t v = __riscv_vlmul_ext_v_i64m1_i64m4(__riscv_vget_v_i64m1x3_i64m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_i64m1_i64m4(v, 1, __riscv_vget_v_i64m1x3_i64m1(val, 1));
+        v = __riscv_vset_v_i64m1_i64m4(v, 2, __riscv_vget_v_i64m1x3_i64m1(val, 2));
+    #else
+        v = __riscv_vslideup_vx_i64m4(v, __riscv_vlmul_ext_v_i64m1_i64m4(__riscv_vget_v_i64m1x3_i64m1(val, 1)), 2, VLEN_4);
+        v = __riscv_vslideup_vx_i64m4(v, __riscv_vlmul_ext_v_i64m1_i64m4(__riscv_vget_v_i64m1x3_i64m1(val, 2)), 4, VLEN_6);
+    #endif
+    __riscv_vse64_v_i64m4(ptr, v, VLEN_6);
+}
@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 128-bit vector of 8-bit signed integers to memory.
+ *
+ * This function stores the 16 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1q_s8`.
+ *
+ * @param ptr Pointer to the memory for the 16 elements.
+ * @param val The vector of type int8x16_t to store.
+ */
+RHAL_API void vst1q_s8_rvv(int8_t *ptr, int8x16_t val) {
+    __riscv_vse8_v_i8m1(ptr, val, VLEN_16);
+}
@@ -0,0 +1,28 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 128-bit vectors of 8-bit signed integers to consecutive memory.
+ *
+ * This function joins the four vectors of `val` into a register group of LMUL=4 and stores the
+ * 64 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_s8_x4`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 16 * i.
+ *
+ * @param ptr Pointer to the memory for the 64 elements.
+ * @param val The four vectors of type int8x16x4_t to store.
+ */
+RHAL_API void vst1q_s8_x4_rvv(int8_t *ptr, int8x16x4_t val) {
+    vint8m4_t v = __riscv_vlmul_ext_v_i8m1_i8m4(__riscv_vget_v_i8m1x4_i8m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_i8m1_i8m4(v, 1, __riscv_vget_v_i8m1x4_i8m1(val, 1));
+        v = __riscv_vset_v_i8m1_i8m4(v, 2, __riscv_vget_v_i8m1x4_i8m1(val, 2));
+        v = __riscv_vset_v_i8m1_i8m4(v, 3, __riscv_vget_v_i8m1x4_i8m1(val, 3));
+    #else
+        v = __riscv_vslideup_vx_i8m4(v, __riscv_vlmul_ext_v_i8m1_i8m4(__riscv_vget_v_i8m1x4_i8m1(val, 1)), 16, VLEN_32);
+        v = __riscv_vslideup_vx_i8m4(v, __riscv_vlmul_ext_v_i8m1_i8m4(__riscv_vget_v_i8m1x4_i8m1(val, 2)), 32, VLEN_48);
+        v = __riscv_vslideup_vx_i8m4(v, __riscv_vlmul_ext_v_i8m1_i8m4(__riscv_vget_v_i8m1x4_i8m1(val, 3)), 48, VLEN_64);
+    #endif
+    __riscv_vse8_v_i8m4(ptr, v, VLEN_64);
+}
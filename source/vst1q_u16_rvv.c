@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 128-bit vector of 16-bit unsigned integers to memory.
+ *
+ * This function stores the 8 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1q_u16`.
+ *
+ * @param ptr Pointer to the memory for the 8 elements.
+ * @param val The vector of type uint16x8_t to store.
+ */
+RHAL_API void vst1q_u16_rvv(uint16_t *ptr, uint16x8_t val) {
+    __riscv_vse16_v_u16m1(ptr, val, VLEN_8);
+}
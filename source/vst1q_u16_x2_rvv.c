@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 128-bit vectors of 16-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the two vectors of `val` into a register group of LMUL=2 and stores the
+ * 16 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_u16_x2`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 8 * i.
+ *
+ * @param ptr Pointer to the memory for the 16 elements.
+ * @param val The two vectors of type uint16x8x2_t to store.
+ */
+RHAL_API void vst1q_u16_x2_rvv(uint16_t *ptr, uint16x8x2_t val) {
+    vuint16m2_t v = __riscv_vlmul_ext_v_u16m1_u16m2(__riscv_vget_v_u16m1x2_u16m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_u16m1_u16m2(v, 1, __riscv_vget_v_u16m1x2_u16m1(val, 1));
+    #else
+        v = __riscv_vslideup_vx_u16m2(v, __riscv_vlmul_ext_v_u16m1_u16m2(__riscv_vget_v_u16m1x2_u16m1(val, 1)), 8, VLEN_16);
+    #endif
+    __riscv_vse16_v_u16m2(ptr, v, VLEN_16);
+}
@@ -0,0 +1,28 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 128-bit vectors of 16-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the four vectors of `val` into a register group of LMUL=4 and stores the
+ * 32 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_u16_x4`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 8 * i.
+ *
+ * @param ptr Pointer to the memory for the 32 elements.
+ * @param val The four vectors of type uint16x8x4_t to store.
+ */
+RHAL_API void vst1q_u16_x4_rvv(uint16_t *ptr, uint16x8x4_t val) {
+    vuint16m4_t v = __riscv_vlmul_ext_v_u16m1_u16m4(__riscv_vget_v_u16m1x4_u16m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_u16m1_u16m4(v, 1, __riscv_vget_v_u16m1x4_u16m1(val, 1));
+        v = __riscv_vset_v_u16m1_u16m4(v, 2, __riscv_vget_v_u16m1x4_u16m1(val, 2));
+        v = __riscv_vset_v_u16m1_u16m4(v, 3, __riscv_vget_v_u16m1x4_u16m1(val, 3));
+    #else
+        v = __riscv_vslideup_vx_u16m4(v, __riscv_vlmul_ext_v_u16m1_u16m4(__riscv_vget_v_u16m1x4_u16m1(val, 1)), 8, VLEN_16);
+        v = __riscv_vslideup_vx_u16m4(v, __riscv_vlmul_ext_v_u16m1_u16m4(__riscv_vget_v_u16m1x4_u16m1(val, 2)), 16, VLEN_24);
+        v = __riscv_vslideup_vx_u16m4(v, __riscv_vlmul_ext_v_u16m1_u16m4(__riscv_vget_v_u16m1x4_u16m1(val, 3)), 24, VLEN_32);
+    #endif
+    __riscv_vse16_v_u16m4(ptr, v, VLEN_32);
+}
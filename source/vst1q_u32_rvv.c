@@ -0,0 +1,16 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores a 128-bit vector of 32-bit unsigned integers to memory.
+ *
+ * This function stores the 4 elements of `val` to `ptr` with a single unit-stride vector store
+ * of fixed length, analogous to the ARM Neon function `vst1q_u32`.
+ *
+ * @param ptr Pointer to the memory for the 4 elements.
+ * @param val The vector of type uint32x4_t to store.
+ */
+RHAL_API void vst1q_u32_rvv(uint32_t *ptr, uint32x4_t val) {
+    __riscv_vse32_v_u32m1(ptr, val, VLEN_4);
+}
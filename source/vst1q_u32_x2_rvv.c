@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 128-bit vectors of 32-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the two vectors of `val` into a register group of LMUL=2 and stores the
+ * 8 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_u32_x2`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 4 * i.
+ *
+ * @param ptr Pointer to the memory for the 8 elements.
+ * @param val The two vectors of type uint32x4x2_t to store.
+ */
+RHAL_API void vst1q_u32_x2_rvv(uint32_t *ptr, uint32x4x2_t val) {
+    vuint32m2_t v = __riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vget_v_u32m1x2_u32m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_u32m1_u32m2(v, 1, __riscv_vget_v_u32m1x2_u32m1(val, 1));
+    #else
+        v = __riscv_vslideup_vx_u32m2(v, __riscv_vlmul_ext_v_u32m1_u32m2(__riscv_vget_v_u32m1x2_u32m1(val, 1)), 4, VLEN_8);
+    #endif
+    __riscv_vse32_v_u32m2(ptr, v, VLEN_8);
+}
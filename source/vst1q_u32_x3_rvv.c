@@ -0,0 +1,26 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores three 128-bit vectors of 32-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the three vectors of `val` into a register group of LMUL=4 and stores the
+ * 12 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_u32_x3`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 4 * i.
+ *
+ * @param ptr Pointer to the memory for the 12 elements.
+ * @param val The three vectors of type uint32x4x3_t to store.
+ */
+RHAL_API void vst1q_u32_x3_rvv(uint32_t *ptr, uint32x4x3_t val) {
+    vuint32m4_t v = __riscv_vlmul_ext_v_u32m1_u32m4(__riscv_vget_v_u32m1x3_u32m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_u32m1_u32m4(v, 1, __riscv_vget_v_u32m1x3_u32m1(val, 1));
+        v = __riscv_vset_v_u32m1_u32m4(v, 2, __riscv_vget_v_u32m1x3_u32m1(val, 2));
+    #else
+        v = __riscv_vslideup_vx_u32m4(v, __riscv_vlmul_ext_v_u32m1_u32m4(__riscv_vget_v_u32m1x3_u32m1(val, 1)), 4, VLEN_8);
+        v = __riscv_vslideup_vx_u32m4(v, __riscv_vlmul_ext_v_u32m1_u32m4(__riscv_vget_v_u32m1x3_u32m1(val, 2)), 8, VLEN_12);
+    #endif
+    __riscv_vse32_v_u32m4(ptr, v, VLEN_12);
+}
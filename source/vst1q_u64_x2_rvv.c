@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 128-bit vectors of 64-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the two vectors of `val` into a register group of LMUL=2 and stores the
+ * 4 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_u64_x2`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 2 * i.
+ *
+ * @param ptr Pointer to the memory for the 4 elements.
+ * @param val The two vectors of type uint64x2x2_t to store.
+ */
+RHAL_API void vst1q_u64_x2_rvv(uint64_t *ptr, uint64x2x2_t val) {
+    vuint64m2_t v = __riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vget_v_u64m1x2_u64m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_u64m1_u64m2(v, 1, __riscv_vget_v_u64m1x2_u64m1(val, 1));
+    #else
+        v = __riscv_vslideup_vx_u64m2(v, __riscv_vlmul_ext_v_u64m1_u64m2(__riscv_vget_v_u64m1x2_u64m1(val, 1)), 2, VLEN_4);
+    #endif
+    __riscv_vse64_v_u64m2(ptr, v, VLEN_4);
+}
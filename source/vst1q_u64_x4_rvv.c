@@ -0,0 +1,28 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 128-bit vectors of 64-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the four vectors of `val` into a register group of LMUL=4 and stores the
+ * 8 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_u64_x4`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 2 * i.
+ *
+ * @param ptr Pointer to the memory for the 8 elements.
+ * @param val The four vectors of type uint64x2x4_t to store.
+ */
+RHAL_API void vst1q_u64_x4_rvv(uint64_t *ptr, uint64x2x4_t val) {
+    vuint64m4_t v = __riscv_vlmul_ext_v_u64m1_u64m4(__riscv_vget_v_u64m1x4_u64m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_u64m1_u64m4(v, 1, __riscv_vget_v_u64m1x4_u64m1(val, 1));
+        v = __riscv_vset_v_u64m1_u64m4(v, 2, __riscv_vget_v_u64m1x4_u64m1(val, 2));
+        v = __riscv_vset_v_u64m1_u64m4(v, 3, __riscv_vget_v_u64m1x4_u64m1(val, 3));
+    #else
+        v = __riscv_vslideup_vx_u64m4(v, __riscv_vlmul_ext_v_u64m1_u64m4(__riscv_vget_v_u64m1x4_u64m1(val, 1)), 2, VLEN_4);
+        v = __riscv_vslideup_vx_u64m4(v, __riscv_vlmul_ext_v_u64m1_u64m4(__riscv_vget_v_u64m1x4_u64m1(val, 2)), 4, VLEN_6);
+        v = __riscv_vslideup_vx_u64m4(v, __riscv_vlmul_ext_v_u64m1_u64m4(__riscv_vget_v_u64m1x4_u64m1(val, 3)), 6, VLEN_8);
+    #endif
+    __riscv_vse64_v_u64m4(ptr, v, VLEN_8);
+}
@@ -0,0 +1,24 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 128-bit vectors of 8-bit unsigned integers to consecutive memory.
+ *
+ * This function joins the two vectors of `val` into a register group of LMUL=2 and stores the
+ * 32 elements to `ptr` with a single unit-stride store, analogous to the ARM Neon function `vst1q_u8_x2`.
+ * With RHAL_VLEN_128 every vector is a whole register of the group, otherwise vector i is slid
+ * up to element 16 * i.
+ *
+ * @param ptr Pointer to the memory for the 32 elements.
+ * @param val The two vectors of type uint8x16x2_t to store.
+ */
+RHAL_API void vst1q_u8_x2_rvv(uint8_t *ptr, uint8x16x2_t val) {
+    vuint8m2_t v = __riscv_vlmul_ext_v_u8m1_u8m2(__riscv_vget_v_u8m1x2_u8m1(val, 0));
+    #if defined(RHAL_VLEN_128)
+        v = __riscv_vset_v_u8m1_u8m2(v, 1, __riscv_vget_v_u8m1x2_u8m1(val, 1));
+    #else
+        v = __riscv_vslideup_vx_u8m2(v, __riscv_vlmul_ext_v_u8m1_u8m2(__riscv_vget_v_u8m1x2_u8m1(val, 1)), 16, VLEN_32);
+    #endif
+    __riscv_vse8_v_u8m2(ptr, v, VLEN_32);
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of two 64-bit vectors of 64-bit signed integers to consecutive memory.
+ *
+ * This function stores element `lane` of each of the two vectors of `val` to `ptr`, in the order of
+ * the vectors, analogous to the ARM Neon function `vst2_lane_s64`. The elements are slid down to element 0
+ * and stored with one segment store (`vsseg2e64.v`) of one segment.
+ *
+ * @param ptr Pointer to the memory for the two elements.
+ * @param val The two vectors of type int64x1x2_t.
+ * @param lane The lane to store, from 0 to 0.
+ */
+RHAL_API void vst2_lane_s64_rvv(int64_t *ptr, int64x1x2_t val, const int lane) {
+    int64x1x2_t r = __riscv_vundefined_i64m1x2();
+    r = __riscv_vset_v_i64m1_i64m1x2(r, 0, __riscv_vslidedown_vx_i64m1(__riscv_vget_v_i64m1x2_i64m1(val, 0), lane, VLEN_1));
+    r = __riscv_vset_v_i64m1_i64m1x2(r, 1, __riscv_vslidedown_vx_i64m1(__riscv_vget_v_i64m1x2_i64m1(val, 1), lane, VLEN_1));
+    __riscv_vsseg2e64_v_i64m1x2(ptr, r, VLEN_1);
+}
@@ -0,0 +1,28 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of two 64-bit vectors of 8-bit signed integers to consecutive memory.
+ *
+ * This function stores element `lane` of each of the two vectors of `val` to `ptr`, in the order of
+ * the vectors, analogous to the ARM Neon function `vst2_lane_s8`. The elements are slid down to element 0
+ * and stored with one segment store (`vsseg2e8.v`) of one segment.
+ *
+ * @param ptr Pointer to the memory for the two elements.
+ * @param val The two vectors of type int8x8x2_t.
+ * @param lane The lane to store, from 0 to 7.
+ */
+RHAL_API void vst2_lane_s8_rvv(int8_t *ptr, int8x8x2_t val, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int8x8x2_t r = __riscv_vundefined_i8mf2x2();
+        r = __riscv_vset_v_i8mf2_i8mf2x2(r, 0, __riscv_vslidedown_vx_i8mf2(__riscv_vget_v_i8mf2x2_i8mf2(val, 0), lane, VLEN_1));
+        r = __riscv_vset_v_i8mf2_i8mf2x2(r, 1, __riscv_vslidedown_vx_i8mf2(__riscv_vget_v_i8mf2x2_i8mf2(val, 1), lane, VLEN_1));
+        __riscv_vsseg2e8_v_i8mf2x2(ptr, r, VLEN_1);
+    #else
+        int8x8x2_t r = __riscv_vundefined_i8m1x2();
+        r = __riscv_vset_v_i8m1_i8m1x2(r, 0, __riscv_vslidedown_vx_i8m1(__riscv_vget_v_i8m1x2_i8m1(val, 0), lane, VLEN_1));
+        r = __riscv_vset_v_i8m1_i8m1x2(r, 1, __riscv_vslidedown_vx_i8m1(__riscv_vget_v_i8m1x2_i8m1(val, 1), lane, VLEN_1));
+        __riscv_vsseg2e8_v_i8m1x2(ptr, r, VLEN_1);
+    #endif
+}
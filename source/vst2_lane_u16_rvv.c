@@ -0,0 +1,28 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of two 64-bit vectors of 16-bit unsigned integers to consecutive memory.
+ *
+ * This function stores element `lane` of each of the two vectors of `val` to `ptr`, in the order of
+ * the vectors, analogous to the ARM Neon function `vst2_lane_u16`. The elements are slid down to element 0
+ * and stored with one segment store (`vsseg2e16.v`) of one segment.
+ *
+ * @param ptr Pointer to the memory for the two elements.
+ * @param val The two vectors of type uint16x4x2_t.
+ * @param lane The lane to store, from 0 to 3.
+ */
+RHAL_API void vst2_lane_u16_rvv(uint16_t *ptr, uint16x4x2_t val, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint16x4x2_t r = __riscv_vundefined_u16mf2x2();
+        r = __riscv_vset_v_u16mf2_u16mf2x2(r, 0, __riscv_vslidedown_vx_u16mf2(__riscv_vget_v_u16mf2x2_u16mf2(val, 0), lane, VLEN_1));
+        r = __riscv_vset_v_u16mf2_u16mf2x2(r, 1, __riscv_vslidedown_vx_u16mf2(__riscv_vget_v_u16mf2x2_u16mf2(val, 1), lane, VLEN_1));
+        __riscv_vsseg2e16_v_u16mf2x2(ptr, r, VLEN_1);
+    #else
+        uint16x4x2_t r = __riscv_vundefined_u16m1x2();
+        r = __riscv_vset_v_u16m1_u16m1x2(r, 0, __riscv_vslidedown_vx_u16m1(__riscv_vget_v_u16m1x2_u16m1(val, 0), lane, VLEN_1));
+        r = __riscv_vset_v_u16m1_u16m1x2(r, 1, __riscv_vslidedown_vx_u16m1(__riscv_vget_v_u16m1x2_u16m1(val, 1), lane, VLEN_1));
+        __riscv_vsseg2e16_v_u16m1x2(ptr, r, VLEN_1);
+    #endif
+}
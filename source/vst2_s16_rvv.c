@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 64-bit vectors of 16-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the two vectors of `val` and stores them to `ptr` as 4 pairs, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst2_s16`. It is a single
+ * unit-stride segment store (`vsseg2e16.v`).
+ *
+ * @param ptr Pointer to the memory for the 8 interleaved elements.
+ * @param val The two vectors of type int16x4x2_t to store.
+ */
+RHAL_API void vst2_s16_rvv(int16_t *ptr, int16x4x2_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vsseg2e16_v_i16mf2x2(ptr, val, VLEN_4);
+    #else
+        __riscv_vsseg2e16_v_i16m1x2(ptr, val, VLEN_4);
+    #endif
+}
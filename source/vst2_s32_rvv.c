@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 64-bit vectors of 32-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the two vectors of `val` and stores them to `ptr` as 2 pairs, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst2_s32`. It is a single
+ * unit-stride segment store (`vsseg2e32.v`).
+ *
+ * @param ptr Pointer to the memory for the 4 interleaved elements.
+ * @param val The two vectors of type int32x2x2_t to store.
+ */
+RHAL_API void vst2_s32_rvv(int32_t *ptr, int32x2x2_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vsseg2e32_v_i32mf2x2(ptr, val, VLEN_2);
+    #else
+        __riscv_vsseg2e32_v_i32m1x2(ptr, val, VLEN_2);
+    #endif
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 64-bit vectors of 64-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the two vectors of `val` and stores them to `ptr` as 1 pairs, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst2_s64`. It is a single
+ * unit-stride segment store (`vsseg2e64.v`).
+ *
+ * @param ptr Pointer to the memory for the 2 interleaved elements.
+ * @param val The two vectors of type int64x1x2_t to store.
+ */
+RHAL_API void vst2_s64_rvv(int64_t *ptr, int64x1x2_t val) {
+    __riscv_vsseg2e64_v_i64m1x2(ptr, val, VLEN_1);
+}
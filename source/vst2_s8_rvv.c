@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 64-bit vectors of 8-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the two vectors of `val` and stores them to `ptr` as 8 pairs, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst2_s8`. It is a single
+ * unit-stride segment store (`vsseg2e8.v`).
+ *
+ * @param ptr Pointer to the memory for the 16 interleaved elements.
+ * @param val The two vectors of type int8x8x2_t to store.
+ */
+RHAL_API void vst2_s8_rvv(int8_t *ptr, int8x8x2_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vsseg2e8_v_i8mf2x2(ptr, val, VLEN_8);
+    #else
+        __riscv_vsseg2e8_v_i8m1x2(ptr, val, VLEN_8);
+    #endif
+}
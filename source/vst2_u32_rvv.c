@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 64-bit vectors of 32-bit unsigned integers to interleaved memory.
+ *
+ * This function interleaves the two vectors of `val` and stores them to `ptr` as 2 pairs, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst2_u32`. It is a single
+ * unit-stride segment store (`vsseg2e32.v`).
+ *
+ * @param ptr Pointer to the memory for the 4 interleaved elements.
+ * @param val The two vectors of type uint32x2x2_t to store.
+ */
+RHAL_API void vst2_u32_rvv(uint32_t *ptr, uint32x2x2_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vsseg2e32_v_u32mf2x2(ptr, val, VLEN_2);
+    #else
+        __riscv_vsseg2e32_v_u32m1x2(ptr, val, VLEN_2);
+    #endif
+}
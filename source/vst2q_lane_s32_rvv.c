@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of two 128-bit vectors of 32-bit signed integers to consecutive memory.
+ *
+ * This function stores element `lane` of each of the two vectors of `val` to `ptr`, in the order of
+ * the vectors, analogous to the ARM Neon function `vst2q_lane_s32`. The elements are slid down to element 0
+ * and stored with one segment store (`vsseg2e32.v`) of one segment.
+ *
+ * @param ptr Pointer to the memory for the two elements.
+ * @param val The two vectors of type int32x4x2_t.
+ * @param lane The lane to store, from 0 to 3.
+ */
+RHAL_API void vst2q_lane_s32_rvv(int32_t *ptr, int32x4x2_t val, const int lane) {
+    int32x4x2_t r = __riscv_vundefined_i32m1x2();
+    r = __riscv_vset_v_i32m1_i32m1x2(r, 0, __riscv_vslidedown_vx_i32m1(__riscv_vget_v_i32m1x2_i32m1(val, 0), lane, VLEN_1));
+    r = __riscv_vset_v_i32m1_i32m1x2(r, 1, __riscv_vslidedown_vx_i32m1(__riscv_vget_v_i32m1x2_i32m1(val, 1), lane, VLEN_1));
+    __riscv_vsseg2e32_v_i32m1x2(ptr, r, VLEN_1);
+}
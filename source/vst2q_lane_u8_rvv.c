@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of two 128-bit vectors of 8-bit unsigned integers to consecutive memory.
+ *
+ * This function stores element `lane` of each of the two vectors of `val` to `ptr`, in the order of
+ * the vectors, analogous to the ARM Neon function `vst2q_lane_u8`. The elements are slid down to element 0
+ * and stored with one segment store (`vsseg2e8.v`) of one segment.
+ *
+ * @param ptr Pointer to the memory for the two elements.
+ * @param val The two vectors of type uint8x16x2_t.
+ * @param lane The lane to store, from 0 to 15.
+ */
+RHAL_API void vst2q_lane_u8_rvv(uint8_t *ptr, uint8x16x2_t val, const int lane) {
+    uint8x16x2_t r = __riscv_vundefined_u8m1x2();
+    r = __riscv_vset_v_u8m1_u8m1x2(r, 0, __riscv_vslidedown_vx_u8m1(__riscv_vget_v_u8m1x2_u8m1(val, 0), lane, VLEN_1));
+    r = __riscv_vset_v_u8m1_u8m1x2(r, 1, __riscv_vslidedown_vx_u8m1(__riscv_vget_v_u8m1x2_u8m1(val, 1), lane, VLEN_1));
+    __riscv_vsseg2e8_v_u8m1x2(ptr, r, VLEN_1);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 128-bit vectors of 16-bit unsigned integers to interleaved memory.
+ *
+ * This function interleaves the two vectors of `val` and stores them to `ptr` as 8 pairs, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst2q_u16`. It is a single
+ * unit-stride segment store (`vsseg2e16.v`).
+ *
+ * @param ptr Pointer to the memory for the 16 interleaved elements.
+ * @param val The two vectors of type uint16x8x2_t to store.
+ */
+RHAL_API void vst2q_u16_rvv(uint16_t *ptr, uint16x8x2_t val) {
+    __riscv_vsseg2e16_v_u16m1x2(ptr, val, VLEN_8);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 128-bit vectors of 32-bit unsigned integers to interleaved memory.
+ *
+ * This function interleaves the two vectors of `val` and stores them to `ptr` as 4 pairs, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst2q_u32`. It is a single
+ * unit-stride segment store (`vsseg2e32.v`).
+ *
+ * @param ptr Pointer to the memory for the 8 interleaved elements.
+ * @param val The two vectors of type uint32x4x2_t to store.
+ */
+RHAL_API void vst2q_u32_rvv(uint32_t *ptr, uint32x4x2_t val) {
+    __riscv_vsseg2e32_v_u32m1x2(ptr, val, VLEN_4);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores two 128-bit vectors of 8-bit unsigned integers to interleaved memory.
+ *
+ * This function interleaves the two vectors of `val` and stores them to `ptr` as 16 pairs, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst2q_u8`. It is a single
+ * unit-stride segment store (`vsseg2e8.v`).
+ *
+ * @param ptr Pointer to the memory for the 32 interleaved elements.
+ * @param val The two vectors of type uint8x16x2_t to store.
+ */
+RHAL_API void vst2q_u8_rvv(uint8_t *ptr, uint8x16x2_t val) {
+    __riscv_vsseg2e8_v_u8m1x2(ptr, val, VLEN_16);
+}
@@ -0,0 +1,30 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of three 64-bit vectors of 16-bit signed integers to consecutive memory.
+ *
+ * This function stores element `lane` of each of the three vectors of `val` to `ptr`, in the order of
+ * the vectors, analogous to the ARM Neon function `vst3_lane_s16`. The elements are slid down to element 0
+ * and stored with one segment store (`vsseg3e16.v`) of one segment.
+ *
+ * @param ptr Pointer to the memory for the three elements.
+ * @param val The three vectors of type int16x4x3_t.
+ * @param lane The lane to store, from 0 to 3.
+ */
+RHAL_API void vst3_lane_s16_rvv(int16_t *ptr, int16x4x3_t val, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4x3_t r = __riscv_vundefined_i16mf2x3();
+        r = __riscv_vset_v_i16mf2_i16mf2x3(r, 0, __riscv_vslidedown_vx_i16mf2(__riscv_vget_v_i16mf2x3_i16mf2(val, 0), lane, VLEN_1));
+        r = __riscv_vset_v_i16mf2_i16mf2x3(r, 1, __riscv_vslidedown_vx_i16mf2(__riscv_vget_v_i16mf2x3_i16mf2(val, 1), lane, VLEN_1));
+        r = __riscv_vset_v_i16mf2_i16mf2x3(r, 2, __riscv_vslidedown_vx_i16mf2(__riscv_vget_v_i16mf2x3_i16mf2(val, 2), lane, VLEN_1));
+        __riscv_vsseg3e16_v_i16mf2x3(ptr, r, VLEN_1);
+    #else
+        int16x4x3_t r = __riscv_vundefined_i16m1x3();
+        r = __riscv_vset_v_i16m1_i16m1x3(r, 0, __riscv_vslidedown_vx_i16m1(__riscv_vget_v_i16m1x3_i16m1(val, 0), lane, VLEN_1));
+        r = __riscv_vset_v_i16m1_i16m1x3(r, 1, __riscv_vslidedown_vx_i16m1(__riscv_vget_v_i16m1x3_i16m1(val, 1), lane, VLEN_1));
+        r = __riscv_vset_v_i16m1_i16m1x3(r, 2, __riscv_vslidedown_vx_i16m1(__riscv_vget_v_i16m1x3_i16m1(val, 2), lane, VLEN_1));
+        __riscv_vsseg3e16_v_i16m1x3(ptr, r, VLEN_1);
+    #endif
+}
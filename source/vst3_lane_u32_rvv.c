@@ -0,0 +1,30 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of three 64-bit vectors of 32-bit unsigned integers to consecutive memory.
+ *
+ * This function stores element `lane` of each of the three vectors of `val` to `ptr`, in the order of
+ * the vectors, analogous to the ARM Neon function `vst3_lane_u32`. The elements are slid down to element 0
+ * and stored with one segment store (`vsseg3e32.v`) of one segment.
+ *
+ * @param ptr Pointer to the memory for the three elements.
+ * @param val The three vectors of type uint32x2x3_t.
+ * @param lane The lane to store, from 0 to 1.
+ */
+RHAL_API void vst3_lane_u32_rvv(uint32_t *ptr, uint32x2x3_t val, const int lane) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x2x3_t r = __riscv_vundefined_u32mf2x3();
+        r = __riscv_vset_v_u32mf2_u32mf2x3(r, 0, __riscv_vslidedown_vx_u32mf2(__riscv_vget_v_u32mf2x3_u32mf2(val, 0), lane, VLEN_1));
+        r = __riscv_vset_v_u32mf2_u32mf2x3(r, 1, __riscv_vslidedown_vx_u32mf2(__riscv_vget_v_u32mf2x3_u32mf2(val, 1), lane, VLEN_1));
+        r = __riscv_vset_v_u32mf2_u32mf2x3(r, 2, __riscv_vslidedown_vx_u32mf2(__riscv_vget_v_u32mf2x3_u32mf2(val, 2), lane, VLEN_1));
+        __riscv_vsseg3e32_v_u32mf2x3(ptr, r, VLEN_1);
+    #else
+        uint32x2x3_t r = __riscv_vundefined_u32m1x3();
+        r = __riscv_vset_v_u32m1_u32m1x3(r, 0, __riscv_vslidedown_vx_u32m1(__riscv_vget_v_u32m1x3_u32m1(val, 0), lane, VLEN_1));
+        r = __riscv_vset_v_u32m1_u32m1x3(r, 1, __riscv_vslidedown_vx_u32m1(__riscv_vget_v_u32m1x3_u32m1(val, 1), lane, VLEN_1));
+        r = __riscv_vset_v_u32m1_u32m1x3(r, 2, __riscv_vslidedown_vx_u32m1(__riscv_vget_v_u32m1x3_u32m1(val, 2), lane, VLEN_1));
+        __riscv_vsseg3e32_v_u32m1x3(ptr, r, VLEN_1);
+    #endif
+}
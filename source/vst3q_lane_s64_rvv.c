@@ -0,0 +1,22 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of three 128-bit vectors of 64-bit signed integers to consecutive memory.
+ *
+ * This function stores element `lane` of each of the three vectors of `val` to `ptr`, in the order of
+ * the vectors, analogous to the ARM Neon function `vst3q_lane_s64`. The elements are slid down to element 0
+ * and stored with one segment store (`vsseg3e64.v`) of one segment.
+ *
+ * @param ptr Pointer to the memory for the three elements.
+ * @param val The three vectors of type int64x2x3_t.
+ * @param lane The lane to store, from 0 to 1.
+ */
+RHAL_API void vst3q_lane_s64_rvv(int64_t *ptr, int64x2x3_t val, const int lane) {
+    int64x2x3_t r = __riscv_vundefined_i64m1x3();
+    r = __riscv_vset_v_i64m1_i64m1x3(r, 0, __riscv_vslidedown_vx_i64m1(__riscv_vget_v_i64m1x3_i64m1(val, 0), lane, VLEN_1));
+    r = __riscv_vset_v_i64m1_i64m1x3(r, 1, __riscv_vslidedown_vx_i64m1(__riscv_vget_v_i64m1x3_i64m1(val, 1), lane, VLEN_1));
+    r = __riscv_vset_v_i64m1_i64m1x3(r, 2, __riscv_vslidedown_vx_i64m1(__riscv_vget_v_i64m1x3_i64m1(val, 2), lane, VLEN_1));
+    __riscv_vsseg3e64_v_i64m1x3(ptr, r, VLEN_1);
+}
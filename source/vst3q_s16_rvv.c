@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores three 128-bit vectors of 16-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the three vectors of `val` and stores them to `ptr` as 8 triples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst3q_s16`. It is a single
+ * unit-stride segment store (`vsseg3e16.v`).
+ *
+ * @param ptr Pointer to the memory for the 24 interleaved elements.
+ * @param val The three vectors of type int16x8x3_t to store.
+ */
+RHAL_API void vst3q_s16_rvv(int16_t *ptr, int16x8x3_t val) {
+    __riscv_vsseg3e16_v_i16m1x3(ptr, val, VLEN_8);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores three 128-bit vectors of 32-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the three vectors of `val` and stores them to `ptr` as 4 triples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst3q_s32`. It is a single
+ * unit-stride segment store (`vsseg3e32.v`).
+ *
+ * @param ptr Pointer to the memory for the 12 interleaved elements.
+ * @param val The three vectors of type int32x4x3_t to store.
+ */
+RHAL_API void vst3q_s32_rvv(int32_t *ptr, int32x4x3_t val) {
+    __riscv_vsseg3e32_v_i32m1x3(ptr, val, VLEN_4);
+}
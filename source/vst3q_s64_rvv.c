@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores three 128-bit vectors of 64-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the three vectors of `val` and stores them to `ptr` as 2 triples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst3q_s64`. It is a single
+ * unit-stride segment store (`vsseg3e64.v`).
+ *
+ * @param ptr Pointer to the memory for the 6 interleaved elements.
+ * @param val The three vectors of type int64x2x3_t to store.
+ */
+RHAL_API void vst3q_s64_rvv(int64_t *ptr, int64x2x3_t val) {
+    __riscv_vsseg3e64_v_i64m1x3(ptr, val, VLEN_2);
+}
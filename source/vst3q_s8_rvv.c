@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores three 128-bit vectors of 8-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the three vectors of `val` and stores them to `ptr` as 16 triples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst3q_s8`. It is a single
+ * unit-stride segment store (`vsseg3e8.v`).
+ *
+ * @param ptr Pointer to the memory for the 48 interleaved elements.
+ * @param val The three vectors of type int8x16x3_t to store.
+ */
+RHAL_API void vst3q_s8_rvv(int8_t *ptr, int8x16x3_t val) {
+    __riscv_vsseg3e8_v_i8m1x3(ptr, val, VLEN_16);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores three 128-bit vectors of 16-bit unsigned integers to interleaved memory.
+ *
+ * This function interleaves the three vectors of `val` and stores them to `ptr` as 8 triples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst3q_u16`. It is a single
+ * unit-stride segment store (`vsseg3e16.v`).
+ *
+ * @param ptr Pointer to the memory for the 24 interleaved elements.
+ * @param val The three vectors of type uint16x8x3_t to store.
+ */
+RHAL_API void vst3q_u16_rvv(uint16_t *ptr, uint16x8x3_t val) {
+    __riscv_vsseg3e16_v_u16m1x3(ptr, val, VLEN_8);
+}
@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 64-bit vectors of 16-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the four vectors of `val` and stores them to `ptr` as 4 quadruples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst4_s16`. It is a single
+ * unit-stride segment store (`vsseg4e16.v`).
+ *
+ * @param ptr Pointer to the memory for the 16 interleaved elements.
+ * @param val The four vectors of type int16x4x4_t to store.
+ */
+RHAL_API void vst4_s16_rvv(int16_t *ptr, int16x4x4_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vsseg4e16_v_i16mf2x4(ptr, val, VLEN_4);
+    #else
+        __riscv_vsseg4e16_v_i16m1x4(ptr, val, VLEN_4);
+    #endif
+}
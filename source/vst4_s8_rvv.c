@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 64-bit vectors of 8-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the four vectors of `val` and stores them to `ptr` as 8 quadruples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst4_s8`. It is a single
+ * unit-stride segment store (`vsseg4e8.v`).
+ *
+ * @param ptr Pointer to the memory for the 32 interleaved elements.
+ * @param val The four vectors of type int8x8x4_t to store.
+ */
+RHAL_API void vst4_s8_rvv(int8_t *ptr, int8x8x4_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vsseg4e8_v_i8mf2x4(ptr, val, VLEN_8);
+    #else
+        __riscv_vsseg4e8_v_i8m1x4(ptr, val, VLEN_8);
+    #endif
+}
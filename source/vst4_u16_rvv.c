@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 64-bit vectors of 16-bit unsigned integers to interleaved memory.
+ *
+ * This function interleaves the four vectors of `val` and stores them to `ptr` as 4 quadruples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst4_u16`. It is a single
+ * unit-stride segment store (`vsseg4e16.v`).
+ *
+ * @param ptr Pointer to the memory for the 16 interleaved elements.
+ * @param val The four vectors of type uint16x4x4_t to store.
+ */
+RHAL_API void vst4_u16_rvv(uint16_t *ptr, uint16x4x4_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vsseg4e16_v_u16mf2x4(ptr, val, VLEN_4);
+    #else
+        __riscv_vsseg4e16_v_u16m1x4(ptr, val, VLEN_4);
+    #endif
+}
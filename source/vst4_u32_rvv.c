@@ -0,0 +1,21 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 64-bit vectors of 32-bit unsigned integers to interleaved memory.
+ *
+ * This function interleaves the four vectors of `val` and stores them to `ptr` as 2 quadruples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst4_u32`. It is a single
+ * unit-stride segment store (`vsseg4e32.v`).
+ *
+ * @param ptr Pointer to the memory for the 8 interleaved elements.
+ * @param val The four vectors of type uint32x2x4_t to store.
+ */
+RHAL_API void vst4_u32_rvv(uint32_t *ptr, uint32x2x4_t val) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vsseg4e32_v_u32mf2x4(ptr, val, VLEN_2);
+    #else
+        __riscv_vsseg4e32_v_u32m1x4(ptr, val, VLEN_2);
+    #endif
+}
@@ -0,0 +1,23 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores one lane of four 128-bit vectors of 16-bit unsigned integers to consecutive memory.
+ *
+ * This function stores element `lane` of each of the four vectors of `val` to `ptr`, in the order of
+ * the vectors, analogous to the ARM Neon function `vst4q_lane_u16`. The elements are slid down to element 0
+ * and stored with one segment store (`vsseg4e16.v`) of one segment.
+ *
+ * @param ptr Pointer to the memory for the four elements.
+ * @param val The four vectors of type uint16x8x4_t.
+ * @param lane The lane to store, from 0 to 7.
+ */
+RHAL_API void vst4q_lane_u16_rvv(uint16_t *ptr, uint16x8x4_t val, const int lane) {
+    uint16x8x4_t r = __riscv_vundefined_u16m1x4();
+    r = __riscv_vset_v_u16m1_u16m1x4(r, 0, __riscv_vslidedown_vx_u16m1(__riscv_vget_v_u16m1x4_u16m1(val, 0), lane, VLEN_1));
+    r = __riscv_vset_v_u16m1_u16m1x4(r, 1, __riscv_vslidedown_vx_u16m1(__riscv_vget_v_u16m1x4_u16m1(val, 1), lane, VLEN_1));
+    r = __riscv_vset_v_u16m1_u16m1x4(r, 2, __riscv_vslidedown_vx_u16m1(__riscv_vget_v_u16m1x4_u16m1(val, 2), lane, VLEN_1));
+    r = __riscv_vset_v_u16m1_u16m1x4(r, 3, __riscv_vslidedown_vx_u16m1(__riscv_vget_v_u16m1x4_u16m1(val, 3), lane, VLEN_1));
+    __riscv_vsseg4e16_v_u16m1x4(ptr, r, VLEN_1);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 128-bit vectors of 16-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the four vectors of `val` and stores them to `ptr` as 8 quadruples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst4q_s16`. It is a single
+ * unit-stride segment store (`vsseg4e16.v`).
+ *
+ * @param ptr Pointer to the memory for the 32 interleaved elements.
+ * @param val The four vectors of type int16x8x4_t to store.
+ */
+RHAL_API void vst4q_s16_rvv(int16_t *ptr, int16x8x4_t val) {
+    __riscv_vsseg4e16_v_i16m1x4(ptr, val, VLEN_8);
+}
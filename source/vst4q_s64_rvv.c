@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 128-bit vectors of 64-bit signed integers to interleaved memory.
+ *
+ * This function interleaves the four vectors of `val` and stores them to `ptr` as 2 quadruples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst4q_s64`. It is a single
+ * unit-stride segment store (`vsseg4e64.v`).
+ *
+ * @param ptr Pointer to the memory for the 8 interleaved elements.
+ * @param val The four vectors of type int64x2x4_t to store.
+ */
+RHAL_API void vst4q_s64_rvv(int64_t *ptr, int64x2x4_t val) {
+    __riscv_vsseg4e64_v_i64m1x4(ptr, val, VLEN_2);
+}
@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 128-bit vectors of 16-bit unsigned integers to interleaved memory.
+ *
+ * This function interleaves the four vectors of `val` and stores them to `ptr` as 8 quadruples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst4q_u16`. It is a single
+ * unit-stride segment store (`vsseg4e16.v`).
+ *
+ * @param ptr Pointer to the memory for the 32 interleaved elements.
+ * @param val The four vectors of type uint16x8x4_t to store.
+ */
+RHAL_API void vst4q_u16_rvv(uint16_t *ptr, uint16x8x4_t val) {
+    __riscv_vsseg4e16_v_u16m1x4(ptr, val, VLEN_8);
+}
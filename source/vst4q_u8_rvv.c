@@ -0,0 +1,17 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Stores four 128-bit vectors of 8-bit unsigned integers to interleaved memory.
+ *
+ * This function interleaves the four vectors of `val` and stores them to `ptr` as 16 quadruples, the
+ * ith holding element i of every vector, analogous to the ARM Neon function `vst4q_u8`. It is a single
+ * unit-stride segment store (`vsseg4e8.v`).
+ *
+ * @param ptr Pointer to the memory for the 64 interleaved elements.
+ * @param val The four vectors of type uint8x16x4_t to store.
+ */
+RHAL_API void vst4q_u8_rvv(uint8_t *ptr, uint8x16x4_t val) {
+    __riscv_vsseg4e8_v_u8m1x4(ptr, val, VLEN_16);
+}
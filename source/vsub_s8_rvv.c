@@ -14,6 +14,10 @@
  * @param b The second input vector of type int8x8_t containing 8-bit signed integers.
  * @return int8x8_t The result of the element-wise subtraction, returned as an 8-bit signed integer vector.
  */
-int8x8_t vsub_s8_rvv(int8x8_t a, int8x8_t b) {
-    return __riscv_vsub_vv_i8m1(a, b, VLEN_8);
+RHAL_API int8x8_t vsub_s8_rvv(int8x8_t a, int8x8_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsub_vv_i8mf2(a, b, VLEN_8);
+    #else
+        return __riscv_vsub_vv_i8m1(a, b, VLEN_8);
+    #endif
 }
@@ -14,6 +14,10 @@
  * @param b The second input vector of type uint32x2_t containing 32-bit unsigned integers.
  * @return uint32x2_t The result of the element-wise subtraction, returned as an 32-bit unsigned integer vector.
  */
-uint32x2_t vsub_u32_rvv(uint32x2_t a, uint32x2_t b) {
-    return __riscv_vsub_vv_u32m1(a, b, VLEN_2);
+RHAL_API uint32x2_t vsub_u32_rvv(uint32x2_t a, uint32x2_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vsub_vv_u32mf2(a, b, VLEN_2);
+    #else
+        return __riscv_vsub_vv_u32m1(a, b, VLEN_2);
+    #endif
 }
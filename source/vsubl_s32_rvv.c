@@ -15,6 +15,10 @@
  * @param b The second input vector of type int32x2_t containing 32-bit signed integers.
  * @return int64x2_t The result of the element-wise subtraction, returned as a vector of 64-bit signed integers.
  */
-int64x2_t vsubl_s32_rvv(int32x2_t a, int32x2_t b) {
-    return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwsub_vv_i64m2(a, b, VLEN_2));
+RHAL_API int64x2_t vsubl_s32_rvv(int32x2_t a, int32x2_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwsub_vv_i64m1(a, b, VLEN_2);
+    #else
+        return __riscv_vlmul_trunc_v_i64m2_i64m1(__riscv_vwsub_vv_i64m2(a, b, VLEN_2));
+    #endif
 }
@@ -0,0 +1,19 @@
+// Copyright 2024 10xEngineers
+
+#include "rhal_base.h"
+
+/**
+ * @brief Performs an element-wise subtraction of two pairs of 128-bit vectors of 32-bit unsigned integers.
+ * 
+ * This function performs the element-wise subtraction of `vsubq_u32` on two 128-bit vectors packed into
+ * each register (`a` and `b`, see vcombineq_u32_x2_rvv), i.e. on 8 elements with a single instruction.
+ * It requires VLEN >= 256 (rhal_paired_supported()). The result holds the difference of the low vectors
+ * in its low half and the difference of the high vectors in its high half.
+ * 
+ * @param a The first input pair of type uint32x8_t containing 32-bit unsigned integers.
+ * @param b The second input pair of type uint32x8_t containing 32-bit unsigned integers.
+ * @return uint32x8_t The pair of results of the element-wise subtraction.
+ */
+RHAL_API uint32x8_t vsubq_u32_x2_rvv(uint32x8_t a, uint32x8_t b) {
+    return __riscv_vsub_vv_u32m1(a, b, VLEN_8);
+}
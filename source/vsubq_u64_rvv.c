@@ -14,6 +14,6 @@
  * @param b The second input vector of type uint64x2_t containing 64-bit unsigned integers.
  * @return uint64x2_t The result of the element-wise subtraction, returned as an 64-bit unsigned integer vector.
  */
-uint64x2_t vsubq_u64_rvv(uint64x2_t a, uint64x2_t b) {
+RHAL_API uint64x2_t vsubq_u64_rvv(uint64x2_t a, uint64x2_t b) {
     return __riscv_vsub_vv_u64m1(a, b, VLEN_2);
 }
@@ -17,6 +17,10 @@
  * @param b The second input vector of type int16x4_t containing 16-bit signed integers.
  * @return int32x4_t The result of the element-wise subtraction, returned as a vector of 32-bit signed integers.
  */
-int32x4_t vsubw_s16_rvv(int32x4_t a, int16x4_t b) {
-    return __riscv_vsub_vv_i32m1(a , __riscv_vlmul_trunc_v_i32m2_i32m1(__riscv_vwsub_vx_i32m2(b, 0, VLEN_4)), VLEN_4);
+RHAL_API int32x4_t vsubw_s16_rvv(int32x4_t a, int16x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwsub_wv_i32m1(a, b, VLEN_4);
+    #else
+        return __riscv_vwsub_wv_i32m1(a, __riscv_vlmul_trunc_v_i16m1_i16mf2(b), VLEN_4);
+    #endif
 }
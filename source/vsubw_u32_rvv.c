@@ -17,6 +17,10 @@
  * @param b The second input vector of type uint32x2_t containing 32-bit unsigned integers.
  * @return uint64x2_t The result of the element-wise subtraction, returned as a vector of 64-bit unsigned integers.
  */
-uint64x2_t vsubw_u32_rvv(uint64x2_t a, uint32x2_t b) {
-    return __riscv_vsub_vv_u64m1(a , __riscv_vlmul_trunc_v_u64m2_u64m1(__riscv_vwsubu_vx_u64m2(b, 0, VLEN_2)), VLEN_2);
+RHAL_API uint64x2_t vsubw_u32_rvv(uint64x2_t a, uint32x2_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vwsubu_wv_u64m1(a, b, VLEN_2);
+    #else
+        return __riscv_vwsubu_wv_u64m1(a, __riscv_vlmul_trunc_v_u32m1_u32mf2(b), VLEN_2);
+    #endif
 }
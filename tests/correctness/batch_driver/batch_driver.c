@@ -0,0 +1,60 @@
+// Copyright 2024 10xEngineers
+
+#include <string.h>
+
+#include "common_utilities.h"
+
+// Runs every correctness test in one process and prints the results in the
+// "testname,test no,result" CSV format of run_tests_correctness.sh. Build it
+// with BATCH=1, which compiles each test with its main() renamed to
+// <test>_main and generates batch_tests.h with one RHAL_BATCH_TEST(<test>)
+// line per test. Arguments select the tests whose names contain any of them.
+
+#define RHAL_BATCH_TEST(name) int name##_main();
+#include "batch_tests.h"
+#undef RHAL_BATCH_TEST
+
+struct batch_test {
+    const char *name;
+    int (*run)();
+};
+
+static const struct batch_test batch_tests[] = {
+#define RHAL_BATCH_TEST(name) { #name, name##_main },
+#include "batch_tests.h"
+#undef RHAL_BATCH_TEST
+};
+
+// Returns whether the test matches the filter arguments (all tests without any)
+static int batch_selected(const char *name, int argc, char *argv[]) {
+    int filters = 0;
+    for (int i = 1; i < argc; i++) {
+        // Options of the runner (e.g. qemu's -D) are not filters
+        if (argv[i][0] == '-') {
+            continue;
+        }
+        filters++;
+        if (strstr(name, argv[i]) != NULL) {
+            return 1;
+        }
+    }
+    return filters == 0;
+}
+
+int main(int argc, char *argv[]) {
+    int num_tests = sizeof(batch_tests) / sizeof(batch_tests[0]);
+    int failed = 0;
+
+    printf("testname,test no,result\n");
+    for (int i = 0; i < num_tests; i++) {
+        if (!batch_selected(batch_tests[i].name, argc, argv)) {
+            continue;
+        }
+        set_results_prefix(batch_tests[i].name);
+        if (batch_tests[i].run() != 0) {
+            failed++;
+        }
+        set_results_prefix(NULL);
+    }
+    return failed != 0;
+}
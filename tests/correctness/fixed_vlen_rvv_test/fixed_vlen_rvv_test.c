@@ -0,0 +1,118 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Number of vectors kept in the accumulator
+#define NUM_VECTORS 4
+
+// Function to run test cases with a given vect_accumulate
+void run_test_cases(void (*vect_accumulate)(uint8_t*, int, uint8_t*)) {
+    uint8_t test_cases[][16] = {
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},          // Regular positive numbers
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},                  // All zeros
+        {255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240}, // High positive numbers (near max uint8_t)
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255}, // Maximum uint8_t value
+        {255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0},  // Max and Min uint8_t values
+        {50, 205, 100, 155, 25, 230, 75, 180, 50, 205, 100, 155, 25, 230, 75, 180}, // Mixed positive numbers
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}                    // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    // The accumulator keeps its state across test cases
+    for (int i = 0; i < num_tests; i++) {
+        uint8_t *a = test_cases[i];
+        uint8_t result[16 * NUM_VECTORS];
+
+        vect_accumulate(a, 16, result);
+        print_results(result, 16 * NUM_VECTORS, UINT8);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, with the vectors held in a global struct
+typedef struct {
+    uint8x16_t vectors[NUM_VECTORS];
+} accumulator_t;
+
+accumulator_t accumulator;
+
+void accumulate_neon(uint8_t *a, int size, uint8_t *result) {
+    uint8x16_t x = vld1q_u8(a);
+    for (int i = 0; i < NUM_VECTORS; i++) {
+        accumulator.vectors[i] = vaddq_u8(accumulator.vectors[i], x);
+        x = vaddq_u8(x, x);
+    }
+    for (int i = 0; i < NUM_VECTORS; i++) {
+        vst1q_u8(result + 16 * i, accumulator.vectors[i]);
+    }
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(accumulate_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+#if defined(RHAL_FIXED_VLEN)
+// RISC-V Vector-specific implementation, with the fixed-size vectors held in a global struct
+typedef struct {
+    uint8x16_t vectors[NUM_VECTORS];
+} accumulator_t;
+
+accumulator_t accumulator;
+
+void accumulate_rvvector(uint8_t *a, int size, uint8_t *result) {
+    uint8x16_t x = __riscv_vle8_v_u8m1(a, size);
+    for (int i = 0; i < NUM_VECTORS; i++) {
+        accumulator.vectors[i] = vaddq_u8_rvv(accumulator.vectors[i], x);
+        x = vaddq_u8_rvv(x, x);
+    }
+    for (int i = 0; i < NUM_VECTORS; i++) {
+        __riscv_vse8_v_u8m1(result + 16 * i, accumulator.vectors[i], size);
+    }
+}
+#else
+// RISC-V Vector-specific implementation, with the sizeless vectors round-tripped through memory
+typedef struct {
+    uint8_t vectors[NUM_VECTORS][16];
+} accumulator_t;
+
+accumulator_t accumulator;
+
+void accumulate_rvvector(uint8_t *a, int size, uint8_t *result) {
+    uint8x16_t x = __riscv_vle8_v_u8m1(a, size);
+    for (int i = 0; i < NUM_VECTORS; i++) {
+        uint8x16_t acc = __riscv_vle8_v_u8m1(accumulator.vectors[i], size);
+        __riscv_vse8_v_u8m1(accumulator.vectors[i], vaddq_u8_rvv(acc, x), size);
+        x = vaddq_u8_rvv(x, x);
+    }
+    for (int i = 0; i < NUM_VECTORS; i++) {
+        uint8x16_t acc = __riscv_vle8_v_u8m1(accumulator.vectors[i], size);
+        __riscv_vse8_v_u8m1(result + 16 * i, acc, size);
+    }
+}
+#endif
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(accumulate_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,607 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Each kernel applies vaddq, vsubq, vqaddq and vqsubq to the low and high 128-bit vectors of
+// a and b. On RISC-V with VLEN >= 256 they are packed into pairs and processed by the paired
+// functions, otherwise the 128-bit functions are used, and the results must be the same.
+
+// Function to run test cases with a given u8 pair kernel
+void run_test_cases_u8(void (*vect_pair)(uint8_t*, uint8_t*, int, uint8_t*)) {
+    uint8_t test_cases[][32] = {
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32},  // Regular positive numbers
+        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255},  // Maximum value
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // Minimum value
+        {255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0}  // Max and Min values
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        uint8_t *a = test_cases[i];
+        uint8_t b[32] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32};
+        uint8_t result[128];
+
+        vect_pair(a, b, 16, result);
+        print_results(result, 128, UINT8);
+    }
+}
+
+// Function to run test cases with a given s8 pair kernel
+void run_test_cases_s8(void (*vect_pair)(int8_t*, int8_t*, int, int8_t*)) {
+    int8_t test_cases[][32] = {
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32},  // Regular positive numbers
+        {127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127},  // Maximum value
+        {-128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128},  // Minimum value
+        {127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128}  // Max and Min values
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int8_t *a = test_cases[i];
+        int8_t b[32] = {1, -2, 3, -4, 5, -6, 7, -8, 9, -10, 11, -12, 13, -14, 15, -16, 17, -18, 19, -20, 21, -22, 23, -24, 25, -26, 27, -28, 29, -30, 31, -32};
+        int8_t result[128];
+
+        vect_pair(a, b, 16, result);
+        print_results(result, 128, INT8);
+    }
+}
+
+// Function to run test cases with a given u16 pair kernel
+void run_test_cases_u16(void (*vect_pair)(uint16_t*, uint16_t*, int, uint16_t*)) {
+    uint16_t test_cases[][16] = {
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},  // Regular positive numbers
+        {65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},  // Maximum value
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},  // Minimum value
+        {65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0, 65535, 0}  // Max and Min values
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        uint16_t *a = test_cases[i];
+        uint16_t b[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        uint16_t result[64];
+
+        vect_pair(a, b, 8, result);
+        print_results(result, 64, UINT16);
+    }
+}
+
+// Function to run test cases with a given s16 pair kernel
+void run_test_cases_s16(void (*vect_pair)(int16_t*, int16_t*, int, int16_t*)) {
+    int16_t test_cases[][16] = {
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},  // Regular positive numbers
+        {32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767},  // Maximum value
+        {-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768},  // Minimum value
+        {32767, -32768, 32767, -32768, 32767, -32768, 32767, -32768, 32767, -32768, 32767, -32768, 32767, -32768, 32767, -32768}  // Max and Min values
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int16_t *a = test_cases[i];
+        int16_t b[16] = {1, -2, 3, -4, 5, -6, 7, -8, 9, -10, 11, -12, 13, -14, 15, -16};
+        int16_t result[64];
+
+        vect_pair(a, b, 8, result);
+        print_results(result, 64, INT16);
+    }
+}
+
+// Function to run test cases with a given u32 pair kernel
+void run_test_cases_u32(void (*vect_pair)(uint32_t*, uint32_t*, int, uint32_t*)) {
+    uint32_t test_cases[][8] = {
+        {1, 2, 3, 4, 5, 6, 7, 8},  // Regular positive numbers
+        {4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295, 4294967295},  // Maximum value
+        {0, 0, 0, 0, 0, 0, 0, 0},  // Minimum value
+        {4294967295, 0, 4294967295, 0, 4294967295, 0, 4294967295, 0}  // Max and Min values
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        uint32_t *a = test_cases[i];
+        uint32_t b[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+        uint32_t result[32];
+
+        vect_pair(a, b, 4, result);
+        print_results(result, 32, UINT32);
+    }
+}
+
+// Function to run test cases with a given s32 pair kernel
+void run_test_cases_s32(void (*vect_pair)(int32_t*, int32_t*, int, int32_t*)) {
+    int32_t test_cases[][8] = {
+        {1, 2, 3, 4, 5, 6, 7, 8},  // Regular positive numbers
+        {2147483647, 2147483647, 2147483647, 2147483647, 2147483647, 2147483647, 2147483647, 2147483647},  // Maximum value
+        {INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN},  // Minimum value
+        {2147483647, INT32_MIN, 2147483647, INT32_MIN, 2147483647, INT32_MIN, 2147483647, INT32_MIN}  // Max and Min values
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int32_t *a = test_cases[i];
+        int32_t b[8] = {1, -2, 3, -4, 5, -6, 7, -8};
+        int32_t result[32];
+
+        vect_pair(a, b, 4, result);
+        print_results(result, 32, INT32);
+    }
+}
+
+// Function to run test cases with a given u64 pair kernel
+void run_test_cases_u64(void (*vect_pair)(uint64_t*, uint64_t*, int, uint64_t*)) {
+    uint64_t test_cases[][4] = {
+        {1ULL, 2ULL, 3ULL, 4ULL},  // Regular positive numbers
+        {18446744073709551615ULL, 18446744073709551615ULL, 18446744073709551615ULL, 18446744073709551615ULL},  // Maximum value
+        {0ULL, 0ULL, 0ULL, 0ULL},  // Minimum value
+        {18446744073709551615ULL, 0ULL, 18446744073709551615ULL, 0ULL}  // Max and Min values
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        uint64_t *a = test_cases[i];
+        uint64_t b[4] = {1ULL, 2ULL, 3ULL, 4ULL};
+        uint64_t result[16];
+
+        vect_pair(a, b, 2, result);
+        print_results(result, 16, UINT64);
+    }
+}
+
+// Function to run test cases with a given s64 pair kernel
+void run_test_cases_s64(void (*vect_pair)(int64_t*, int64_t*, int, int64_t*)) {
+    int64_t test_cases[][4] = {
+        {1LL, 2LL, 3LL, 4LL},  // Regular positive numbers
+        {9223372036854775807LL, 9223372036854775807LL, 9223372036854775807LL, 9223372036854775807LL},  // Maximum value
+        {INT64_MIN, INT64_MIN, INT64_MIN, INT64_MIN},  // Minimum value
+        {9223372036854775807LL, INT64_MIN, 9223372036854775807LL, INT64_MIN}  // Max and Min values
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int64_t *a = test_cases[i];
+        int64_t b[4] = {1LL, -2LL, 3LL, -4LL};
+        int64_t result[16];
+
+        vect_pair(a, b, 2, result);
+        print_results(result, 16, INT64);
+    }
+}
+
+#if defined(ARM_NEON)
+
+// ARM Neon-specific implementation
+void pair_u8_neon(uint8_t *a, uint8_t *b, int size, uint8_t *result) {
+    uint8x16_t a_lo = vld1q_u8(a);
+    uint8x16_t a_hi = vld1q_u8(a + size);
+    uint8x16_t b_lo = vld1q_u8(b);
+    uint8x16_t b_hi = vld1q_u8(b + size);
+    vst1q_u8(result + 0 * size, vaddq_u8(a_lo, b_lo));
+    vst1q_u8(result + 1 * size, vaddq_u8(a_hi, b_hi));
+    vst1q_u8(result + 2 * size, vsubq_u8(a_lo, b_lo));
+    vst1q_u8(result + 3 * size, vsubq_u8(a_hi, b_hi));
+    vst1q_u8(result + 4 * size, vqaddq_u8(a_lo, b_lo));
+    vst1q_u8(result + 5 * size, vqaddq_u8(a_hi, b_hi));
+    vst1q_u8(result + 6 * size, vqsubq_u8(a_lo, b_lo));
+    vst1q_u8(result + 7 * size, vqsubq_u8(a_hi, b_hi));
+}
+// ARM Neon-specific implementation
+void pair_s8_neon(int8_t *a, int8_t *b, int size, int8_t *result) {
+    int8x16_t a_lo = vld1q_s8(a);
+    int8x16_t a_hi = vld1q_s8(a + size);
+    int8x16_t b_lo = vld1q_s8(b);
+    int8x16_t b_hi = vld1q_s8(b + size);
+    vst1q_s8(result + 0 * size, vaddq_s8(a_lo, b_lo));
+    vst1q_s8(result + 1 * size, vaddq_s8(a_hi, b_hi));
+    vst1q_s8(result + 2 * size, vsubq_s8(a_lo, b_lo));
+    vst1q_s8(result + 3 * size, vsubq_s8(a_hi, b_hi));
+    vst1q_s8(result + 4 * size, vqaddq_s8(a_lo, b_lo));
+    vst1q_s8(result + 5 * size, vqaddq_s8(a_hi, b_hi));
+    vst1q_s8(result + 6 * size, vqsubq_s8(a_lo, b_lo));
+    vst1q_s8(result + 7 * size, vqsubq_s8(a_hi, b_hi));
+}
+// ARM Neon-specific implementation
+void pair_u16_neon(uint16_t *a, uint16_t *b, int size, uint16_t *result) {
+    uint16x8_t a_lo = vld1q_u16(a);
+    uint16x8_t a_hi = vld1q_u16(a + size);
+    uint16x8_t b_lo = vld1q_u16(b);
+    uint16x8_t b_hi = vld1q_u16(b + size);
+    vst1q_u16(result + 0 * size, vaddq_u16(a_lo, b_lo));
+    vst1q_u16(result + 1 * size, vaddq_u16(a_hi, b_hi));
+    vst1q_u16(result + 2 * size, vsubq_u16(a_lo, b_lo));
+    vst1q_u16(result + 3 * size, vsubq_u16(a_hi, b_hi));
+    vst1q_u16(result + 4 * size, vqaddq_u16(a_lo, b_lo));
+    vst1q_u16(result + 5 * size, vqaddq_u16(a_hi, b_hi));
+    vst1q_u16(result + 6 * size, vqsubq_u16(a_lo, b_lo));
+    vst1q_u16(result + 7 * size, vqsubq_u16(a_hi, b_hi));
+}
+// ARM Neon-specific implementation
+void pair_s16_neon(int16_t *a, int16_t *b, int size, int16_t *result) {
+    int16x8_t a_lo = vld1q_s16(a);
+    int16x8_t a_hi = vld1q_s16(a + size);
+    int16x8_t b_lo = vld1q_s16(b);
+    int16x8_t b_hi = vld1q_s16(b + size);
+    vst1q_s16(result + 0 * size, vaddq_s16(a_lo, b_lo));
+    vst1q_s16(result + 1 * size, vaddq_s16(a_hi, b_hi));
+    vst1q_s16(result + 2 * size, vsubq_s16(a_lo, b_lo));
+    vst1q_s16(result + 3 * size, vsubq_s16(a_hi, b_hi));
+    vst1q_s16(result + 4 * size, vqaddq_s16(a_lo, b_lo));
+    vst1q_s16(result + 5 * size, vqaddq_s16(a_hi, b_hi));
+    vst1q_s16(result + 6 * size, vqsubq_s16(a_lo, b_lo));
+    vst1q_s16(result + 7 * size, vqsubq_s16(a_hi, b_hi));
+}
+// ARM Neon-specific implementation
+void pair_u32_neon(uint32_t *a, uint32_t *b, int size, uint32_t *result) {
+    uint32x4_t a_lo = vld1q_u32(a);
+    uint32x4_t a_hi = vld1q_u32(a + size);
+    uint32x4_t b_lo = vld1q_u32(b);
+    uint32x4_t b_hi = vld1q_u32(b + size);
+    vst1q_u32(result + 0 * size, vaddq_u32(a_lo, b_lo));
+    vst1q_u32(result + 1 * size, vaddq_u32(a_hi, b_hi));
+    vst1q_u32(result + 2 * size, vsubq_u32(a_lo, b_lo));
+    vst1q_u32(result + 3 * size, vsubq_u32(a_hi, b_hi));
+    vst1q_u32(result + 4 * size, vqaddq_u32(a_lo, b_lo));
+    vst1q_u32(result + 5 * size, vqaddq_u32(a_hi, b_hi));
+    vst1q_u32(result + 6 * size, vqsubq_u32(a_lo, b_lo));
+    vst1q_u32(result + 7 * size, vqsubq_u32(a_hi, b_hi));
+}
+// ARM Neon-specific implementation
+void pair_s32_neon(int32_t *a, int32_t *b, int size, int32_t *result) {
+    int32x4_t a_lo = vld1q_s32(a);
+    int32x4_t a_hi = vld1q_s32(a + size);
+    int32x4_t b_lo = vld1q_s32(b);
+    int32x4_t b_hi = vld1q_s32(b + size);
+    vst1q_s32(result + 0 * size, vaddq_s32(a_lo, b_lo));
+    vst1q_s32(result + 1 * size, vaddq_s32(a_hi, b_hi));
+    vst1q_s32(result + 2 * size, vsubq_s32(a_lo, b_lo));
+    vst1q_s32(result + 3 * size, vsubq_s32(a_hi, b_hi));
+    vst1q_s32(result + 4 * size, vqaddq_s32(a_lo, b_lo));
+    vst1q_s32(result + 5 * size, vqaddq_s32(a_hi, b_hi));
+    vst1q_s32(result + 6 * size, vqsubq_s32(a_lo, b_lo));
+    vst1q_s32(result + 7 * size, vqsubq_s32(a_hi, b_hi));
+}
+// ARM Neon-specific implementation
+void pair_u64_neon(uint64_t *a, uint64_t *b, int size, uint64_t *result) {
+    uint64x2_t a_lo = vld1q_u64(a);
+    uint64x2_t a_hi = vld1q_u64(a + size);
+    uint64x2_t b_lo = vld1q_u64(b);
+    uint64x2_t b_hi = vld1q_u64(b + size);
+    vst1q_u64(result + 0 * size, vaddq_u64(a_lo, b_lo));
+    vst1q_u64(result + 1 * size, vaddq_u64(a_hi, b_hi));
+    vst1q_u64(result + 2 * size, vsubq_u64(a_lo, b_lo));
+    vst1q_u64(result + 3 * size, vsubq_u64(a_hi, b_hi));
+    vst1q_u64(result + 4 * size, vqaddq_u64(a_lo, b_lo));
+    vst1q_u64(result + 5 * size, vqaddq_u64(a_hi, b_hi));
+    vst1q_u64(result + 6 * size, vqsubq_u64(a_lo, b_lo));
+    vst1q_u64(result + 7 * size, vqsubq_u64(a_hi, b_hi));
+}
+// ARM Neon-specific implementation
+void pair_s64_neon(int64_t *a, int64_t *b, int size, int64_t *result) {
+    int64x2_t a_lo = vld1q_s64(a);
+    int64x2_t a_hi = vld1q_s64(a + size);
+    int64x2_t b_lo = vld1q_s64(b);
+    int64x2_t b_hi = vld1q_s64(b + size);
+    vst1q_s64(result + 0 * size, vaddq_s64(a_lo, b_lo));
+    vst1q_s64(result + 1 * size, vaddq_s64(a_hi, b_hi));
+    vst1q_s64(result + 2 * size, vsubq_s64(a_lo, b_lo));
+    vst1q_s64(result + 3 * size, vsubq_s64(a_hi, b_hi));
+    vst1q_s64(result + 4 * size, vqaddq_s64(a_lo, b_lo));
+    vst1q_s64(result + 5 * size, vqaddq_s64(a_hi, b_hi));
+    vst1q_s64(result + 6 * size, vqsubq_s64(a_lo, b_lo));
+    vst1q_s64(result + 7 * size, vqsubq_s64(a_hi, b_hi));
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases_u8(pair_u8_neon);
+    run_test_cases_s8(pair_s8_neon);
+    run_test_cases_u16(pair_u16_neon);
+    run_test_cases_s16(pair_s16_neon);
+    run_test_cases_u32(pair_u32_neon);
+    run_test_cases_s32(pair_s32_neon);
+    run_test_cases_u64(pair_u64_neon);
+    run_test_cases_s64(pair_s64_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+
+// RISC-V Vector-specific implementation
+void pair_u8_rvvector(uint8_t *a, uint8_t *b, int size, uint8_t *result) {
+    uint8x16_t a_lo = __riscv_vle8_v_u8m1(a, size);
+    uint8x16_t a_hi = __riscv_vle8_v_u8m1(a + size, size);
+    uint8x16_t b_lo = __riscv_vle8_v_u8m1(b, size);
+    uint8x16_t b_hi = __riscv_vle8_v_u8m1(b + size, size);
+    if (rhal_paired_supported()) {
+        uint8x32_t x = vcombineq_u8_x2_rvv(a_lo, a_hi);
+        uint8x32_t y = vcombineq_u8_x2_rvv(b_lo, b_hi);
+        uint8x32_t z;
+        z = vaddq_u8_x2_rvv(x, y);
+        __riscv_vse8_v_u8m1(result + 0 * size, vgetq_low_u8_x2_rvv(z), size);
+        __riscv_vse8_v_u8m1(result + 1 * size, vgetq_high_u8_x2_rvv(z), size);
+        z = vsubq_u8_x2_rvv(x, y);
+        __riscv_vse8_v_u8m1(result + 2 * size, vgetq_low_u8_x2_rvv(z), size);
+        __riscv_vse8_v_u8m1(result + 3 * size, vgetq_high_u8_x2_rvv(z), size);
+        z = vqaddq_u8_x2_rvv(x, y);
+        __riscv_vse8_v_u8m1(result + 4 * size, vgetq_low_u8_x2_rvv(z), size);
+        __riscv_vse8_v_u8m1(result + 5 * size, vgetq_high_u8_x2_rvv(z), size);
+        z = vqsubq_u8_x2_rvv(x, y);
+        __riscv_vse8_v_u8m1(result + 6 * size, vgetq_low_u8_x2_rvv(z), size);
+        __riscv_vse8_v_u8m1(result + 7 * size, vgetq_high_u8_x2_rvv(z), size);
+    } else {
+        __riscv_vse8_v_u8m1(result + 0 * size, vaddq_u8_rvv(a_lo, b_lo), size);
+        __riscv_vse8_v_u8m1(result + 1 * size, vaddq_u8_rvv(a_hi, b_hi), size);
+        __riscv_vse8_v_u8m1(result + 2 * size, vsubq_u8_rvv(a_lo, b_lo), size);
+        __riscv_vse8_v_u8m1(result + 3 * size, vsubq_u8_rvv(a_hi, b_hi), size);
+        __riscv_vse8_v_u8m1(result + 4 * size, vqaddq_u8_rvv(a_lo, b_lo), size);
+        __riscv_vse8_v_u8m1(result + 5 * size, vqaddq_u8_rvv(a_hi, b_hi), size);
+        __riscv_vse8_v_u8m1(result + 6 * size, vqsubq_u8_rvv(a_lo, b_lo), size);
+        __riscv_vse8_v_u8m1(result + 7 * size, vqsubq_u8_rvv(a_hi, b_hi), size);
+    }
+}
+// RISC-V Vector-specific implementation
+void pair_s8_rvvector(int8_t *a, int8_t *b, int size, int8_t *result) {
+    int8x16_t a_lo = __riscv_vle8_v_i8m1(a, size);
+    int8x16_t a_hi = __riscv_vle8_v_i8m1(a + size, size);
+    int8x16_t b_lo = __riscv_vle8_v_i8m1(b, size);
+    int8x16_t b_hi = __riscv_vle8_v_i8m1(b + size, size);
+    if (rhal_paired_supported()) {
+        int8x32_t x = vcombineq_s8_x2_rvv(a_lo, a_hi);
+        int8x32_t y = vcombineq_s8_x2_rvv(b_lo, b_hi);
+        int8x32_t z;
+        z = vaddq_s8_x2_rvv(x, y);
+        __riscv_vse8_v_i8m1(result + 0 * size, vgetq_low_s8_x2_rvv(z), size);
+        __riscv_vse8_v_i8m1(result + 1 * size, vgetq_high_s8_x2_rvv(z), size);
+        z = vsubq_s8_x2_rvv(x, y);
+        __riscv_vse8_v_i8m1(result + 2 * size, vgetq_low_s8_x2_rvv(z), size);
+        __riscv_vse8_v_i8m1(result + 3 * size, vgetq_high_s8_x2_rvv(z), size);
+        z = vqaddq_s8_x2_rvv(x, y);
+        __riscv_vse8_v_i8m1(result + 4 * size, vgetq_low_s8_x2_rvv(z), size);
+        __riscv_vse8_v_i8m1(result + 5 * size, vgetq_high_s8_x2_rvv(z), size);
+        z = vqsubq_s8_x2_rvv(x, y);
+        __riscv_vse8_v_i8m1(result + 6 * size, vgetq_low_s8_x2_rvv(z), size);
+        __riscv_vse8_v_i8m1(result + 7 * size, vgetq_high_s8_x2_rvv(z), size);
+    } else {
+        __riscv_vse8_v_i8m1(result + 0 * size, vaddq_s8_rvv(a_lo, b_lo), size);
+        __riscv_vse8_v_i8m1(result + 1 * size, vaddq_s8_rvv(a_hi, b_hi), size);
+        __riscv_vse8_v_i8m1(result + 2 * size, vsubq_s8_rvv(a_lo, b_lo), size);
+        __riscv_vse8_v_i8m1(result + 3 * size, vsubq_s8_rvv(a_hi, b_hi), size);
+        __riscv_vse8_v_i8m1(result + 4 * size, vqaddq_s8_rvv(a_lo, b_lo), size);
+        __riscv_vse8_v_i8m1(result + 5 * size, vqaddq_s8_rvv(a_hi, b_hi), size);
+        __riscv_vse8_v_i8m1(result + 6 * size, vqsubq_s8_rvv(a_lo, b_lo), size);
+        __riscv_vse8_v_i8m1(result + 7 * size, vqsubq_s8_rvv(a_hi, b_hi), size);
+    }
+}
+// RISC-V Vector-specific implementation
+void pair_u16_rvvector(uint16_t *a, uint16_t *b, int size, uint16_t *result) {
+    uint16x8_t a_lo = __riscv_vle16_v_u16m1(a, size);
+    uint16x8_t a_hi = __riscv_vle16_v_u16m1(a + size, size);
+    uint16x8_t b_lo = __riscv_vle16_v_u16m1(b, size);
+    uint16x8_t b_hi = __riscv_vle16_v_u16m1(b + size, size);
+    if (rhal_paired_supported()) {
+        uint16x16_t x = vcombineq_u16_x2_rvv(a_lo, a_hi);
+        uint16x16_t y = vcombineq_u16_x2_rvv(b_lo, b_hi);
+        uint16x16_t z;
+        z = vaddq_u16_x2_rvv(x, y);
+        __riscv_vse16_v_u16m1(result + 0 * size, vgetq_low_u16_x2_rvv(z), size);
+        __riscv_vse16_v_u16m1(result + 1 * size, vgetq_high_u16_x2_rvv(z), size);
+        z = vsubq_u16_x2_rvv(x, y);
+        __riscv_vse16_v_u16m1(result + 2 * size, vgetq_low_u16_x2_rvv(z), size);
+        __riscv_vse16_v_u16m1(result + 3 * size, vgetq_high_u16_x2_rvv(z), size);
+        z = vqaddq_u16_x2_rvv(x, y);
+        __riscv_vse16_v_u16m1(result + 4 * size, vgetq_low_u16_x2_rvv(z), size);
+        __riscv_vse16_v_u16m1(result + 5 * size, vgetq_high_u16_x2_rvv(z), size);
+        z = vqsubq_u16_x2_rvv(x, y);
+        __riscv_vse16_v_u16m1(result + 6 * size, vgetq_low_u16_x2_rvv(z), size);
+        __riscv_vse16_v_u16m1(result + 7 * size, vgetq_high_u16_x2_rvv(z), size);
+    } else {
+        __riscv_vse16_v_u16m1(result + 0 * size, vaddq_u16_rvv(a_lo, b_lo), size);
+        __riscv_vse16_v_u16m1(result + 1 * size, vaddq_u16_rvv(a_hi, b_hi), size);
+        __riscv_vse16_v_u16m1(result + 2 * size, vsubq_u16_rvv(a_lo, b_lo), size);
+        __riscv_vse16_v_u16m1(result + 3 * size, vsubq_u16_rvv(a_hi, b_hi), size);
+        __riscv_vse16_v_u16m1(result + 4 * size, vqaddq_u16_rvv(a_lo, b_lo), size);
+        __riscv_vse16_v_u16m1(result + 5 * size, vqaddq_u16_rvv(a_hi, b_hi), size);
+        __riscv_vse16_v_u16m1(result + 6 * size, vqsubq_u16_rvv(a_lo, b_lo), size);
+        __riscv_vse16_v_u16m1(result + 7 * size, vqsubq_u16_rvv(a_hi, b_hi), size);
+    }
+}
+// RISC-V Vector-specific implementation
+void pair_s16_rvvector(int16_t *a, int16_t *b, int size, int16_t *result) {
+    int16x8_t a_lo = __riscv_vle16_v_i16m1(a, size);
+    int16x8_t a_hi = __riscv_vle16_v_i16m1(a + size, size);
+    int16x8_t b_lo = __riscv_vle16_v_i16m1(b, size);
+    int16x8_t b_hi = __riscv_vle16_v_i16m1(b + size, size);
+    if (rhal_paired_supported()) {
+        int16x16_t x = vcombineq_s16_x2_rvv(a_lo, a_hi);
+        int16x16_t y = vcombineq_s16_x2_rvv(b_lo, b_hi);
+        int16x16_t z;
+        z = vaddq_s16_x2_rvv(x, y);
+        __riscv_vse16_v_i16m1(result + 0 * size, vgetq_low_s16_x2_rvv(z), size);
+        __riscv_vse16_v_i16m1(result + 1 * size, vgetq_high_s16_x2_rvv(z), size);
+        z = vsubq_s16_x2_rvv(x, y);
+        __riscv_vse16_v_i16m1(result + 2 * size, vgetq_low_s16_x2_rvv(z), size);
+        __riscv_vse16_v_i16m1(result + 3 * size, vgetq_high_s16_x2_rvv(z), size);
+        z = vqaddq_s16_x2_rvv(x, y);
+        __riscv_vse16_v_i16m1(result + 4 * size, vgetq_low_s16_x2_rvv(z), size);
+        __riscv_vse16_v_i16m1(result + 5 * size, vgetq_high_s16_x2_rvv(z), size);
+        z = vqsubq_s16_x2_rvv(x, y);
+        __riscv_vse16_v_i16m1(result + 6 * size, vgetq_low_s16_x2_rvv(z), size);
+        __riscv_vse16_v_i16m1(result + 7 * size, vgetq_high_s16_x2_rvv(z), size);
+    } else {
+        __riscv_vse16_v_i16m1(result + 0 * size, vaddq_s16_rvv(a_lo, b_lo), size);
+        __riscv_vse16_v_i16m1(result + 1 * size, vaddq_s16_rvv(a_hi, b_hi), size);
+        __riscv_vse16_v_i16m1(result + 2 * size, vsubq_s16_rvv(a_lo, b_lo), size);
+        __riscv_vse16_v_i16m1(result + 3 * size, vsubq_s16_rvv(a_hi, b_hi), size);
+        __riscv_vse16_v_i16m1(result + 4 * size, vqaddq_s16_rvv(a_lo, b_lo), size);
+        __riscv_vse16_v_i16m1(result + 5 * size, vqaddq_s16_rvv(a_hi, b_hi), size);
+        __riscv_vse16_v_i16m1(result + 6 * size, vqsubq_s16_rvv(a_lo, b_lo), size);
+        __riscv_vse16_v_i16m1(result + 7 * size, vqsubq_s16_rvv(a_hi, b_hi), size);
+    }
+}
+// RISC-V Vector-specific implementation
+void pair_u32_rvvector(uint32_t *a, uint32_t *b, int size, uint32_t *result) {
+    uint32x4_t a_lo = __riscv_vle32_v_u32m1(a, size);
+    uint32x4_t a_hi = __riscv_vle32_v_u32m1(a + size, size);
+    uint32x4_t b_lo = __riscv_vle32_v_u32m1(b, size);
+    uint32x4_t b_hi = __riscv_vle32_v_u32m1(b + size, size);
+    if (rhal_paired_supported()) {
+        uint32x8_t x = vcombineq_u32_x2_rvv(a_lo, a_hi);
+        uint32x8_t y = vcombineq_u32_x2_rvv(b_lo, b_hi);
+        uint32x8_t z;
+        z = vaddq_u32_x2_rvv(x, y);
+        __riscv_vse32_v_u32m1(result + 0 * size, vgetq_low_u32_x2_rvv(z), size);
+        __riscv_vse32_v_u32m1(result + 1 * size, vgetq_high_u32_x2_rvv(z), size);
+        z = vsubq_u32_x2_rvv(x, y);
+        __riscv_vse32_v_u32m1(result + 2 * size, vgetq_low_u32_x2_rvv(z), size);
+        __riscv_vse32_v_u32m1(result + 3 * size, vgetq_high_u32_x2_rvv(z), size);
+        z = vqaddq_u32_x2_rvv(x, y);
+        __riscv_vse32_v_u32m1(result + 4 * size, vgetq_low_u32_x2_rvv(z), size);
+        __riscv_vse32_v_u32m1(result + 5 * size, vgetq_high_u32_x2_rvv(z), size);
+        z = vqsubq_u32_x2_rvv(x, y);
+        __riscv_vse32_v_u32m1(result + 6 * size, vgetq_low_u32_x2_rvv(z), size);
+        __riscv_vse32_v_u32m1(result + 7 * size, vgetq_high_u32_x2_rvv(z), size);
+    } else {
+        __riscv_vse32_v_u32m1(result + 0 * size, vaddq_u32_rvv(a_lo, b_lo), size);
+        __riscv_vse32_v_u32m1(result + 1 * size, vaddq_u32_rvv(a_hi, b_hi), size);
+        __riscv_vse32_v_u32m1(result + 2 * size, vsubq_u32_rvv(a_lo, b_lo), size);
+        __riscv_vse32_v_u32m1(result + 3 * size, vsubq_u32_rvv(a_hi, b_hi), size);
+        __riscv_vse32_v_u32m1(result + 4 * size, vqaddq_u32_rvv(a_lo, b_lo), size);
+        __riscv_vse32_v_u32m1(result + 5 * size, vqaddq_u32_rvv(a_hi, b_hi), size);
+        __riscv_vse32_v_u32m1(result + 6 * size, vqsubq_u32_rvv(a_lo, b_lo), size);
+        __riscv_vse32_v_u32m1(result + 7 * size, vqsubq_u32_rvv(a_hi, b_hi), size);
+    }
+}
+// RISC-V Vector-specific implementation
+void pair_s32_rvvector(int32_t *a, int32_t *b, int size, int32_t *result) {
+    int32x4_t a_lo = __riscv_vle32_v_i32m1(a, size);
+    int32x4_t a_hi = __riscv_vle32_v_i32m1(a + size, size);
+    int32x4_t b_lo = __riscv_vle32_v_i32m1(b, size);
+    int32x4_t b_hi = __riscv_vle32_v_i32m1(b + size, size);
+    if (rhal_paired_supported()) {
+        int32x8_t x = vcombineq_s32_x2_rvv(a_lo, a_hi);
+        int32x8_t y = vcombineq_s32_x2_rvv(b_lo, b_hi);
+        int32x8_t z;
+        z = vaddq_s32_x2_rvv(x, y);
+        __riscv_vse32_v_i32m1(result + 0 * size, vgetq_low_s32_x2_rvv(z), size);
+        __riscv_vse32_v_i32m1(result + 1 * size, vgetq_high_s32_x2_rvv(z), size);
+        z = vsubq_s32_x2_rvv(x, y);
+        __riscv_vse32_v_i32m1(result + 2 * size, vgetq_low_s32_x2_rvv(z), size);
+        __riscv_vse32_v_i32m1(result + 3 * size, vgetq_high_s32_x2_rvv(z), size);
+        z = vqaddq_s32_x2_rvv(x, y);
+        __riscv_vse32_v_i32m1(result + 4 * size, vgetq_low_s32_x2_rvv(z), size);
+        __riscv_vse32_v_i32m1(result + 5 * size, vgetq_high_s32_x2_rvv(z), size);
+        z = vqsubq_s32_x2_rvv(x, y);
+        __riscv_vse32_v_i32m1(result + 6 * size, vgetq_low_s32_x2_rvv(z), size);
+        __riscv_vse32_v_i32m1(result + 7 * size, vgetq_high_s32_x2_rvv(z), size);
+    } else {
+        __riscv_vse32_v_i32m1(result + 0 * size, vaddq_s32_rvv(a_lo, b_lo), size);
+        __riscv_vse32_v_i32m1(result + 1 * size, vaddq_s32_rvv(a_hi, b_hi), size);
+        __riscv_vse32_v_i32m1(result + 2 * size, vsubq_s32_rvv(a_lo, b_lo), size);
+        __riscv_vse32_v_i32m1(result + 3 * size, vsubq_s32_rvv(a_hi, b_hi), size);
+        __riscv_vse32_v_i32m1(result + 4 * size, vqaddq_s32_rvv(a_lo, b_lo), size);
+        __riscv_vse32_v_i32m1(result + 5 * size, vqaddq_s32_rvv(a_hi, b_hi), size);
+        __riscv_vse32_v_i32m1(result + 6 * size, vqsubq_s32_rvv(a_lo, b_lo), size);
+        __riscv_vse32_v_i32m1(result + 7 * size, vqsubq_s32_rvv(a_hi, b_hi), size);
+    }
+}
+// RISC-V Vector-specific implementation
+void pair_u64_rvvector(uint64_t *a, uint64_t *b, int size, uint64_t *result) {
+    uint64x2_t a_lo = __riscv_vle64_v_u64m1(a, size);
+    uint64x2_t a_hi = __riscv_vle64_v_u64m1(a + size, size);
+    uint64x2_t b_lo = __riscv_vle64_v_u64m1(b, size);
+    uint64x2_t b_hi = __riscv_vle64_v_u64m1(b + size, size);
+    if (rhal_paired_supported()) {
+        uint64x4_t x = vcombineq_u64_x2_rvv(a_lo, a_hi);
+        uint64x4_t y = vcombineq_u64_x2_rvv(b_lo, b_hi);
+        uint64x4_t z;
+        z = vaddq_u64_x2_rvv(x, y);
+        __riscv_vse64_v_u64m1(result + 0 * size, vgetq_low_u64_x2_rvv(z), size);
+        __riscv_vse64_v_u64m1(result + 1 * size, vgetq_high_u64_x2_rvv(z), size);
+        z = vsubq_u64_x2_rvv(x, y);
+        __riscv_vse64_v_u64m1(result + 2 * size, vgetq_low_u64_x2_rvv(z), size);
+        __riscv_vse64_v_u64m1(result + 3 * size, vgetq_high_u64_x2_rvv(z), size);
+        z = vqaddq_u64_x2_rvv(x, y);
+        __riscv_vse64_v_u64m1(result + 4 * size, vgetq_low_u64_x2_rvv(z), size);
+        __riscv_vse64_v_u64m1(result + 5 * size, vgetq_high_u64_x2_rvv(z), size);
+        z = vqsubq_u64_x2_rvv(x, y);
+        __riscv_vse64_v_u64m1(result + 6 * size, vgetq_low_u64_x2_rvv(z), size);
+        __riscv_vse64_v_u64m1(result + 7 * size, vgetq_high_u64_x2_rvv(z), size);
+    } else {
+        __riscv_vse64_v_u64m1(result + 0 * size, vaddq_u64_rvv(a_lo, b_lo), size);
+        __riscv_vse64_v_u64m1(result + 1 * size, vaddq_u64_rvv(a_hi, b_hi), size);
+        __riscv_vse64_v_u64m1(result + 2 * size, vsubq_u64_rvv(a_lo, b_lo), size);
+        __riscv_vse64_v_u64m1(result + 3 * size, vsubq_u64_rvv(a_hi, b_hi), size);
+        __riscv_vse64_v_u64m1(result + 4 * size, vqaddq_u64_rvv(a_lo, b_lo), size);
+        __riscv_vse64_v_u64m1(result + 5 * size, vqaddq_u64_rvv(a_hi, b_hi), size);
+        __riscv_vse64_v_u64m1(result + 6 * size, vqsubq_u64_rvv(a_lo, b_lo), size);
+        __riscv_vse64_v_u64m1(result + 7 * size, vqsubq_u64_rvv(a_hi, b_hi), size);
+    }
+}
+// RISC-V Vector-specific implementation
+void pair_s64_rvvector(int64_t *a, int64_t *b, int size, int64_t *result) {
+    int64x2_t a_lo = __riscv_vle64_v_i64m1(a, size);
+    int64x2_t a_hi = __riscv_vle64_v_i64m1(a + size, size);
+    int64x2_t b_lo = __riscv_vle64_v_i64m1(b, size);
+    int64x2_t b_hi = __riscv_vle64_v_i64m1(b + size, size);
+    if (rhal_paired_supported()) {
+        int64x4_t x = vcombineq_s64_x2_rvv(a_lo, a_hi);
+        int64x4_t y = vcombineq_s64_x2_rvv(b_lo, b_hi);
+        int64x4_t z;
+        z = vaddq_s64_x2_rvv(x, y);
+        __riscv_vse64_v_i64m1(result + 0 * size, vgetq_low_s64_x2_rvv(z), size);
+        __riscv_vse64_v_i64m1(result + 1 * size, vgetq_high_s64_x2_rvv(z), size);
+        z = vsubq_s64_x2_rvv(x, y);
+        __riscv_vse64_v_i64m1(result + 2 * size, vgetq_low_s64_x2_rvv(z), size);
+        __riscv_vse64_v_i64m1(result + 3 * size, vgetq_high_s64_x2_rvv(z), size);
+        z = vqaddq_s64_x2_rvv(x, y);
+        __riscv_vse64_v_i64m1(result + 4 * size, vgetq_low_s64_x2_rvv(z), size);
+        __riscv_vse64_v_i64m1(result + 5 * size, vgetq_high_s64_x2_rvv(z), size);
+        z = vqsubq_s64_x2_rvv(x, y);
+        __riscv_vse64_v_i64m1(result + 6 * size, vgetq_low_s64_x2_rvv(z), size);
+        __riscv_vse64_v_i64m1(result + 7 * size, vgetq_high_s64_x2_rvv(z), size);
+    } else {
+        __riscv_vse64_v_i64m1(result + 0 * size, vaddq_s64_rvv(a_lo, b_lo), size);
+        __riscv_vse64_v_i64m1(result + 1 * size, vaddq_s64_rvv(a_hi, b_hi), size);
+        __riscv_vse64_v_i64m1(result + 2 * size, vsubq_s64_rvv(a_lo, b_lo), size);
+        __riscv_vse64_v_i64m1(result + 3 * size, vsubq_s64_rvv(a_hi, b_hi), size);
+        __riscv_vse64_v_i64m1(result + 4 * size, vqaddq_s64_rvv(a_lo, b_lo), size);
+        __riscv_vse64_v_i64m1(result + 5 * size, vqaddq_s64_rvv(a_hi, b_hi), size);
+        __riscv_vse64_v_i64m1(result + 6 * size, vqsubq_s64_rvv(a_lo, b_lo), size);
+        __riscv_vse64_v_i64m1(result + 7 * size, vqsubq_s64_rvv(a_hi, b_hi), size);
+    }
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases_u8(pair_u8_rvvector);
+    run_test_cases_s8(pair_s8_rvvector);
+    run_test_cases_u16(pair_u16_rvvector);
+    run_test_cases_s16(pair_s16_rvvector);
+    run_test_cases_u32(pair_u32_rvvector);
+    run_test_cases_s32(pair_s32_rvvector);
+    run_test_cases_u64(pair_u64_rvvector);
+    run_test_cases_s64(pair_s64_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,104 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #define RHAL_QC
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Function to run test cases with a given vect_qc, which returns the saturating sum and
+// the cumulative saturation flag after it, after a second non-saturating op, and after a clear
+void run_test_cases(void (*vect_qc)(int8_t*, int8_t*, int, int8_t*, int32_t*)) {
+    int8_t test_cases[][16] = {
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},   // Regular positive numbers
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},          // All zeros
+        {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16}, // Negative numbers
+        {127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127}, // Maximum int8_t value
+        {-128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128}, // Minimum int8_t value
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 120},        // Single saturating element
+        {50, -50, 100, -100, 25, -25, 75, -75, 50, -50, 100, -100, 25, -25, 75, -75}, // Mixed positive and negative numbers
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int8_t *a = test_cases[i];
+        int8_t b[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        int8_t result[16];
+        int32_t qc[3];
+
+        vect_qc(a, b, 16, result, qc);
+        print_results(result, 16, INT8);
+        print_results(qc, 3, INT32);
+    }
+}
+
+#if defined(ARM_NEON)
+// Read and clear FPSR.QC (bit 27)
+static int get_qc_neon(void) {
+    uint64_t fpsr;
+    __asm__ __volatile__ ("mrs %0, fpsr" : "=r"(fpsr) :: "memory");
+    return (int)((fpsr >> 27) & 1);
+}
+static void clear_qc_neon(void) {
+    uint64_t fpsr;
+    __asm__ __volatile__ ("mrs %0, fpsr" : "=r"(fpsr) :: "memory");
+    fpsr &= ~((uint64_t)1 << 27);
+    __asm__ __volatile__ ("msr fpsr, %0" :: "r"(fpsr) : "memory");
+}
+
+// ARM Neon-specific implementation
+void qc_neon(int8_t *a, int8_t *b, int size, int8_t *result, int32_t *qc) {
+    int8x16_t x = vld1q_s8(a);
+    int8x16_t y = vld1q_s8(b);
+    clear_qc_neon();
+    vst1q_s8(result, vqaddq_s8(x, y));
+    qc[0] = get_qc_neon();
+    // The flag is sticky, a non-saturating operation keeps it
+    int8_t tmp[16];
+    vst1q_s8(tmp, vqsubq_s8(vld1q_s8(result), y));
+    qc[1] = get_qc_neon();
+    clear_qc_neon();
+    qc[2] = get_qc_neon();
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(qc_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void qc_rvvector(int8_t *a, int8_t *b, int size, int8_t *result, int32_t *qc) {
+    int8x16_t x = __riscv_vle8_v_i8m1(a, size);
+    int8x16_t y = __riscv_vle8_v_i8m1(b, size);
+    rhal_clear_qc();
+    __riscv_vse8_v_i8m1(result, vqaddq_s8_rvv(x, y), size);
+    qc[0] = rhal_get_qc();
+    // The flag is sticky, a non-saturating operation keeps it
+    int8_t tmp[16];
+    __riscv_vse8_v_i8m1(tmp, vqsubq_s8_rvv(__riscv_vle8_v_i8m1(result, size), y), size);
+    qc[1] = rhal_get_qc();
+    rhal_clear_qc();
+    qc[2] = rhal_get_qc();
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(qc_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
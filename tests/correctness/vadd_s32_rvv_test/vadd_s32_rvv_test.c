@@ -51,10 +51,19 @@ void run_tests_neon() {
 #elif defined(RISCV_VECTOR)
 // RISC-V Vector-specific implementation
 void vadd_s32_rvvector(int32_t *a, int32_t *b, int size, int32_t *result) {
-    int32x2_t x = __riscv_vle32_v_i32m1(a, size);
-    int32x2_t y = __riscv_vle32_v_i32m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int32x2_t x = __riscv_vle32_v_i32mf2(a, size);
+        int32x2_t y = __riscv_vle32_v_i32mf2(b, size);
+    #else
+        int32x2_t x = __riscv_vle32_v_i32m1(a, size);
+        int32x2_t y = __riscv_vle32_v_i32m1(b, size);
+    #endif
     int32x2_t z = vadd_s32_rvv(x, y);
-    __riscv_vse32_v_i32m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_i32mf2(result, z, size);
+    #else
+        __riscv_vse32_v_i32m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
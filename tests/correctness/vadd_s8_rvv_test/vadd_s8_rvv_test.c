@@ -51,10 +51,19 @@ void run_tests_neon() {
 #elif defined(RISCV_VECTOR)
 // RISC-V Vector-specific implementation
 void vadd_s8_rvvector(int8_t *a, int8_t *b, int size, int8_t *result) {
-    int8x8_t x = __riscv_vle8_v_i8m1(a, size);
-    int8x8_t y = __riscv_vle8_v_i8m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int8x8_t x = __riscv_vle8_v_i8mf2(a, size);
+        int8x8_t y = __riscv_vle8_v_i8mf2(b, size);
+    #else
+        int8x8_t x = __riscv_vle8_v_i8m1(a, size);
+        int8x8_t y = __riscv_vle8_v_i8m1(b, size);
+    #endif
     int8x8_t z = vadd_s8_rvv(x, y);
-    __riscv_vse8_v_i8m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse8_v_i8mf2(result, z, size);
+    #else
+        __riscv_vse8_v_i8m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
@@ -54,7 +54,11 @@ void vaddhn_s32_rvvector(int32_t *a, int32_t *b, int size, int16_t *result) {
     int32x4_t x = __riscv_vle32_v_i32m1(a, size);
     int32x4_t y = __riscv_vle32_v_i32m1(b, size);
     int16x4_t z = vaddhn_s32_rvv(x, y);
-    __riscv_vse16_v_i16m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_i16mf2(result, z, size);
+    #else
+        __riscv_vse16_v_i16m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
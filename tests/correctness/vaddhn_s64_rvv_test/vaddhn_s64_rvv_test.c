@@ -54,7 +54,11 @@ void vaddhn_s64_rvvector(int64_t *a, int64_t *b, int size, int32_t *result) {
     int64x2_t x = __riscv_vle64_v_i64m1(a, size);
     int64x2_t y = __riscv_vle64_v_i64m1(b, size);
     int32x2_t z = vaddhn_s64_rvv(x, y);
-    __riscv_vse32_v_i32m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_i32mf2(result, z, size);
+    #else
+        __riscv_vse32_v_i32m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
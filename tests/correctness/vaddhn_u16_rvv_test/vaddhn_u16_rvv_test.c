@@ -54,7 +54,11 @@ void vaddhn_u16_rvvector(uint16_t *a, uint16_t *b, int size, uint8_t *result) {
     uint16x8_t x = __riscv_vle16_v_u16m1(a, size);
     uint16x8_t y = __riscv_vle16_v_u16m1(b, size);
     uint8x8_t z = vaddhn_u16_rvv(x, y);
-    __riscv_vse8_v_u8m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse8_v_u8mf2(result, z, size);
+    #else
+        __riscv_vse8_v_u8m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
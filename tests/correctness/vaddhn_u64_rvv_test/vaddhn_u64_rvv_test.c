@@ -54,7 +54,11 @@ void vaddhn_u64_rvvector(uint64_t *a, uint64_t *b, int size, uint32_t *result) {
     uint64x2_t x = __riscv_vle64_v_u64m1(a, size);
     uint64x2_t y = __riscv_vle64_v_u64m1(b, size);
     uint32x2_t z = vaddhn_u64_rvv(x, y);
-    __riscv_vse32_v_u32m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_u32mf2(result, z, size);
+    #else
+        __riscv_vse32_v_u32m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
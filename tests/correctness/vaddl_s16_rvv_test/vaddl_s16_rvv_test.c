@@ -51,8 +51,13 @@ void run_tests_neon() {
 #elif defined(RISCV_VECTOR)
 // RISC-V Vector-specific implementation
 void vaddl_s16_rvvector(int16_t *a, int16_t *b, int size, int32_t *result) {
-    int16x4_t x = __riscv_vle16_v_i16m1(a, size);
-    int16x4_t y = __riscv_vle16_v_i16m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t x = __riscv_vle16_v_i16mf2(a, size);
+        int16x4_t y = __riscv_vle16_v_i16mf2(b, size);
+    #else
+        int16x4_t x = __riscv_vle16_v_i16m1(a, size);
+        int16x4_t y = __riscv_vle16_v_i16m1(b, size);
+    #endif
     int32x4_t z = vaddl_s16_rvv(x, y);
     __riscv_vse32_v_i32m1(result, z, size);
 }
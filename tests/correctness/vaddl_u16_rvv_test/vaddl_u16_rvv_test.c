@@ -51,8 +51,13 @@ void run_tests_neon() {
 #elif defined(RISCV_VECTOR)
 // RISC-V Vector-specific implementation
 void vaddl_u16_rvvector(uint16_t *a, uint16_t *b, int size, uint32_t *result) {
-    uint16x4_t x = __riscv_vle16_v_u16m1(a, size);
-    uint16x4_t y = __riscv_vle16_v_u16m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint16x4_t x = __riscv_vle16_v_u16mf2(a, size);
+        uint16x4_t y = __riscv_vle16_v_u16mf2(b, size);
+    #else
+        uint16x4_t x = __riscv_vle16_v_u16m1(a, size);
+        uint16x4_t y = __riscv_vle16_v_u16m1(b, size);
+    #endif
     uint32x4_t z = vaddl_u16_rvv(x, y);
     __riscv_vse32_v_u32m1(result, z, size);
 }
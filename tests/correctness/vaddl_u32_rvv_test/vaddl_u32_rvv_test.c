@@ -51,8 +51,13 @@ void run_tests_neon() {
 #elif defined(RISCV_VECTOR)
 // RISC-V Vector-specific implementation
 void vaddl_u32_rvvector(uint32_t *a, uint32_t *b, int size, uint64_t *result) {
-    uint32x2_t x = __riscv_vle32_v_u32m1(a, size);
-    uint32x2_t y = __riscv_vle32_v_u32m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x2_t x = __riscv_vle32_v_u32mf2(a, size);
+        uint32x2_t y = __riscv_vle32_v_u32mf2(b, size);
+    #else
+        uint32x2_t x = __riscv_vle32_v_u32m1(a, size);
+        uint32x2_t y = __riscv_vle32_v_u32m1(b, size);
+    #endif
     uint64x2_t z = vaddl_u32_rvv(x, y);
     __riscv_vse64_v_u64m1(result, z, size);
 }
@@ -52,7 +52,11 @@ void run_tests_neon() {
 // RISC-V Vector-specific implementation
 void vaddw_s16_rvvector(int32_t *a, int16_t *b, int size, int32_t *result) {
     int32x4_t x = __riscv_vle32_v_i32m1(a, size);
-    int16x4_t y = __riscv_vle16_v_i16m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t y = __riscv_vle16_v_i16mf2(b, size);
+    #else
+        int16x4_t y = __riscv_vle16_v_i16m1(b, size);
+    #endif
     int32x4_t z = vaddw_s16_rvv(x, y);
     __riscv_vse32_v_i32m1(result, z, size);
 }
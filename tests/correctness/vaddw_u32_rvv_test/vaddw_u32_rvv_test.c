@@ -52,7 +52,11 @@ void run_tests_neon() {
 // RISC-V Vector-specific implementation
 void vaddw_u32_rvvector(uint64_t *a, uint32_t *b, int size, uint64_t *result) {
     uint64x2_t x = __riscv_vle64_v_u64m1(a, size);
-    uint32x2_t y = __riscv_vle32_v_u32m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x2_t y = __riscv_vle32_v_u32mf2(b, size);
+    #else
+        uint32x2_t y = __riscv_vle32_v_u32m1(b, size);
+    #endif
     uint64x2_t z = vaddw_u32_rvv(x, y);
     __riscv_vse64_v_u64m1(result, z, size);
 }
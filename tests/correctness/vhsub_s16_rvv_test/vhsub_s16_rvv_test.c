@@ -51,10 +51,19 @@ void run_tests_neon() {
 #elif defined(RISCV_VECTOR)
 // RISC-V Vector-specific implementation
 void vhsub_s16_rvvector(int16_t *a, int16_t *b, int size, int16_t *result) {
-    int16x4_t x = __riscv_vle16_v_i16m1(a, size);
-    int16x4_t y = __riscv_vle16_v_i16m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t x = __riscv_vle16_v_i16mf2(a, size);
+        int16x4_t y = __riscv_vle16_v_i16mf2(b, size);
+    #else
+        int16x4_t x = __riscv_vle16_v_i16m1(a, size);
+        int16x4_t y = __riscv_vle16_v_i16m1(b, size);
+    #endif
     int16x4_t z = vhsub_s16_rvv(x, y);
-    __riscv_vse16_v_i16m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_i16mf2(result, z, size);
+    #else
+        __riscv_vse16_v_i16m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
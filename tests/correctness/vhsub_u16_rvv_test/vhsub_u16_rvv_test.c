@@ -51,10 +51,19 @@ void run_tests_neon() {
 #elif defined(RISCV_VECTOR)
 // RISC-V Vector-specific implementation
 void vhsub_u16_rvvector(uint16_t *a, uint16_t *b, int size, uint16_t *result) {
-    uint16x4_t x = __riscv_vle16_v_u16m1(a, size);
-    uint16x4_t y = __riscv_vle16_v_u16m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint16x4_t x = __riscv_vle16_v_u16mf2(a, size);
+        uint16x4_t y = __riscv_vle16_v_u16mf2(b, size);
+    #else
+        uint16x4_t x = __riscv_vle16_v_u16m1(a, size);
+        uint16x4_t y = __riscv_vle16_v_u16m1(b, size);
+    #endif
     uint16x4_t z = vhsub_u16_rvv(x, y);
-    __riscv_vse16_v_u16m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_u16mf2(result, z, size);
+    #else
+        __riscv_vse16_v_u16m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
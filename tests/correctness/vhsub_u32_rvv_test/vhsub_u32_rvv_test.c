@@ -51,10 +51,19 @@ void run_tests_neon() {
 #elif defined(RISCV_VECTOR)
 // RISC-V Vector-specific implementation
 void vhsub_u32_rvvector(uint32_t *a, uint32_t *b, int size, uint32_t *result) {
-    uint32x2_t x = __riscv_vle32_v_u32m1(a, size);
-    uint32x2_t y = __riscv_vle32_v_u32m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x2_t x = __riscv_vle32_v_u32mf2(a, size);
+        uint32x2_t y = __riscv_vle32_v_u32mf2(b, size);
+    #else
+        uint32x2_t x = __riscv_vle32_v_u32m1(a, size);
+        uint32x2_t y = __riscv_vle32_v_u32m1(b, size);
+    #endif
     uint32x2_t z = vhsub_u32_rvv(x, y);
-    __riscv_vse32_v_u32m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_u32mf2(result, z, size);
+    #else
+        __riscv_vse32_v_u32m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
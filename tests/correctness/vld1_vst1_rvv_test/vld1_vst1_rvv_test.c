@@ -0,0 +1,149 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Tests the vld1/vst1 family for every integer type: each load is stored back with vst1 (or
+// each vector of a group with vst1, for the _x2/_x3/_x4 loads), so the results of ARM Neon and
+// R-Halogen must be the same.
+
+#if defined(ARM_NEON)
+    #define RHAL(fn) fn
+    #define TUPLE_GET(t, rvv, n, i) (t).val[i]
+#elif defined(RISCV_VECTOR)
+    #define RHAL(fn) fn##_rvv
+    #define TUPLE_GET(t, rvv, n, i) TUPLE_GET_RVV(t, rvv, n, i)
+    #define TUPLE_GET_RVV(t, rvv, n, i) __riscv_vget_v_##rvv##x##n##_##rvv(t, i)
+
+    // RVV type of the vectors of a group, for __riscv_vget
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        #define RVV_D_s8  i8mf2
+        #define RVV_D_s16 i16mf2
+        #define RVV_D_s32 i32mf2
+        #define RVV_D_u8  u8mf2
+        #define RVV_D_u16 u16mf2
+        #define RVV_D_u32 u32mf2
+    #else
+        #define RVV_D_s8  i8m1
+        #define RVV_D_s16 i16m1
+        #define RVV_D_s32 i32m1
+        #define RVV_D_u8  u8m1
+        #define RVV_D_u16 u16m1
+        #define RVV_D_u32 u32m1
+    #endif
+    #define RVV_D_s64 i64m1
+    #define RVV_D_u64 u64m1
+    #define RVV_Q_s8  i8m1
+    #define RVV_Q_s16 i16m1
+    #define RVV_Q_s32 i32m1
+    #define RVV_Q_s64 i64m1
+    #define RVV_Q_u8  u8m1
+    #define RVV_Q_u16 u16m1
+    #define RVV_Q_u32 u32m1
+    #define RVV_Q_u64 u64m1
+#endif
+
+// Defines test_<q><sfx>() for the vector type vec_t with `lanes` elements of elem_t. q is empty
+// for the 64-bit functions and q for the 128-bit ones, rvv is the RVV type of a vector of a group.
+#define DEFINE_TEST(elem_t, print_type, vec, q, sfx, lanes, rvv)                                 \
+    void test_##q##sfx(void) {                                                                   \
+        elem_t src[4 * lanes];                                                                   \
+        elem_t result[4 * lanes];                                                                \
+                                                                                                 \
+        /* Mixes of small, large, positive and negative values */                                \
+        for (int i = 0; i < 4 * lanes; i++) {                                                    \
+            src[i] = (elem_t)((uint64_t)(i + 1) * 0x9E3779B97F4A7C15ULL);                        \
+        }                                                                                        \
+                                                                                                 \
+        vec##_t v = RHAL(vld1##q##_##sfx)(src);                                                  \
+        RHAL(vst1##q##_##sfx)(result, v);                                                        \
+        print_results(result, lanes, print_type);                                                \
+                                                                                                 \
+        RHAL(vst1##q##_##sfx)(result, RHAL(vld1##q##_dup_##sfx)(src + 1));                       \
+        print_results(result, lanes, print_type);                                                \
+                                                                                                 \
+        RHAL(vst1##q##_##sfx)(result, RHAL(vld1##q##_lane_##sfx)(src + 2, v, 0));                \
+        print_results(result, lanes, print_type);                                                \
+        RHAL(vst1##q##_##sfx)(result, RHAL(vld1##q##_lane_##sfx)(src + 2, v, lanes - 1));        \
+        print_results(result, lanes, print_type);                                                \
+                                                                                                 \
+        RHAL(vst1##q##_lane_##sfx)(result, v, 0);                                                \
+        RHAL(vst1##q##_lane_##sfx)(result + 1, v, lanes - 1);                                    \
+        print_results(result, 2, print_type);                                                    \
+                                                                                                 \
+        vec##x2_t v2 = RHAL(vld1##q##_##sfx##_x2)(src);                                          \
+        RHAL(vst1##q##_##sfx)(result, TUPLE_GET(v2, rvv, 2, 0));                                 \
+        RHAL(vst1##q##_##sfx)(result + lanes, TUPLE_GET(v2, rvv, 2, 1));                         \
+        print_results(result, 2 * lanes, print_type);                                            \
+        RHAL(vst1##q##_##sfx##_x2)(result, RHAL(vld1##q##_##sfx##_x2)(src + lanes));             \
+        print_results(result, 2 * lanes, print_type);                                            \
+                                                                                                 \
+        vec##x3_t v3 = RHAL(vld1##q##_##sfx##_x3)(src);                                          \
+        RHAL(vst1##q##_##sfx)(result, TUPLE_GET(v3, rvv, 3, 0));                                 \
+        RHAL(vst1##q##_##sfx)(result + lanes, TUPLE_GET(v3, rvv, 3, 1));                         \
+        RHAL(vst1##q##_##sfx)(result + 2 * lanes, TUPLE_GET(v3, rvv, 3, 2));                     \
+        print_results(result, 3 * lanes, print_type);                                            \
+        RHAL(vst1##q##_##sfx##_x3)(result, RHAL(vld1##q##_##sfx##_x3)(src + lanes));             \
+        print_results(result, 3 * lanes, print_type);                                            \
+                                                                                                 \
+        vec##x4_t v4 = RHAL(vld1##q##_##sfx##_x4)(src);                                          \
+        RHAL(vst1##q##_##sfx)(result, TUPLE_GET(v4, rvv, 4, 0));                                 \
+        RHAL(vst1##q##_##sfx)(result + lanes, TUPLE_GET(v4, rvv, 4, 1));                         \
+        RHAL(vst1##q##_##sfx)(result + 2 * lanes, TUPLE_GET(v4, rvv, 4, 2));                     \
+        RHAL(vst1##q##_##sfx)(result + 3 * lanes, TUPLE_GET(v4, rvv, 4, 3));                     \
+        print_results(result, 4 * lanes, print_type);                                            \
+        RHAL(vst1##q##_##sfx##_x4)(result, v4);                                                  \
+        print_results(result, 4 * lanes, print_type);                                            \
+    }
+
+#if defined(ARM_NEON)
+    #define RVV(q, sfx)
+#elif defined(RISCV_VECTOR)
+    #define RVV(q, sfx) RVV_##q##_##sfx
+#endif
+
+DEFINE_TEST(int8_t, INT8, int8x8, , s8, 8, RVV(D, s8))
+DEFINE_TEST(int16_t, INT16, int16x4, , s16, 4, RVV(D, s16))
+DEFINE_TEST(int32_t, INT32, int32x2, , s32, 2, RVV(D, s32))
+DEFINE_TEST(int64_t, INT64, int64x1, , s64, 1, RVV(D, s64))
+DEFINE_TEST(uint8_t, UINT8, uint8x8, , u8, 8, RVV(D, u8))
+DEFINE_TEST(uint16_t, UINT16, uint16x4, , u16, 4, RVV(D, u16))
+DEFINE_TEST(uint32_t, UINT32, uint32x2, , u32, 2, RVV(D, u32))
+DEFINE_TEST(uint64_t, UINT64, uint64x1, , u64, 1, RVV(D, u64))
+
+DEFINE_TEST(int8_t, INT8, int8x16, q, s8, 16, RVV(Q, s8))
+DEFINE_TEST(int16_t, INT16, int16x8, q, s16, 8, RVV(Q, s16))
+DEFINE_TEST(int32_t, INT32, int32x4, q, s32, 4, RVV(Q, s32))
+DEFINE_TEST(int64_t, INT64, int64x2, q, s64, 2, RVV(Q, s64))
+DEFINE_TEST(uint8_t, UINT8, uint8x16, q, u8, 16, RVV(Q, u8))
+DEFINE_TEST(uint16_t, UINT16, uint16x8, q, u16, 8, RVV(Q, u16))
+DEFINE_TEST(uint32_t, UINT32, uint32x4, q, u32, 4, RVV(Q, u32))
+DEFINE_TEST(uint64_t, UINT64, uint64x2, q, u64, 2, RVV(Q, u64))
+
+int main() {
+    test_s8();
+    test_s16();
+    test_s32();
+    test_s64();
+    test_u8();
+    test_u16();
+    test_u32();
+    test_u64();
+
+    test_qs8();
+    test_qs16();
+    test_qs32();
+    test_qs64();
+    test_qu8();
+    test_qu16();
+    test_qu32();
+    test_qu64();
+    return 0;
+}
@@ -0,0 +1,184 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Tests the vld2/vld3/vld4 and vst2/vst3/vst4 families for every integer type: every vector of
+// a loaded group is stored back with vst1, so the results of ARM Neon and R-Halogen must be the
+// same.
+
+#if defined(ARM_NEON)
+    #define RHAL(fn) fn
+    #define TUPLE_GET(t, rvv, n, i) (t).val[i]
+#elif defined(RISCV_VECTOR)
+    #define RHAL(fn) fn##_rvv
+    #define TUPLE_GET(t, rvv, n, i) TUPLE_GET_RVV(t, rvv, n, i)
+    #define TUPLE_GET_RVV(t, rvv, n, i) __riscv_vget_v_##rvv##x##n##_##rvv(t, i)
+
+    // RVV type of the vectors of a group, for __riscv_vget
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        #define RVV_D_s8  i8mf2
+        #define RVV_D_s16 i16mf2
+        #define RVV_D_s32 i32mf2
+        #define RVV_D_u8  u8mf2
+        #define RVV_D_u16 u16mf2
+        #define RVV_D_u32 u32mf2
+    #else
+        #define RVV_D_s8  i8m1
+        #define RVV_D_s16 i16m1
+        #define RVV_D_s32 i32m1
+        #define RVV_D_u8  u8m1
+        #define RVV_D_u16 u16m1
+        #define RVV_D_u32 u32m1
+    #endif
+    #define RVV_D_s64 i64m1
+    #define RVV_D_u64 u64m1
+    #define RVV_Q_s8  i8m1
+    #define RVV_Q_s16 i16m1
+    #define RVV_Q_s32 i32m1
+    #define RVV_Q_s64 i64m1
+    #define RVV_Q_u8  u8m1
+    #define RVV_Q_u16 u16m1
+    #define RVV_Q_u32 u32m1
+    #define RVV_Q_u64 u64m1
+#endif
+
+// Stores the vectors of the group t of n vectors to consecutive memory at r, with vst1
+#define STORE_GROUP_2(vst1, r, t, rvv, n, lanes)                                              \
+    vst1((r), TUPLE_GET(t, rvv, n, 0));                                                       \
+    vst1((r) + (lanes), TUPLE_GET(t, rvv, n, 1));
+#define STORE_GROUP_3(vst1, r, t, rvv, n, lanes)                                              \
+    STORE_GROUP_2(vst1, r, t, rvv, n, lanes)                                                  \
+    vst1((r) + 2 * (lanes), TUPLE_GET(t, rvv, n, 2));
+#define STORE_GROUP_4(vst1, r, t, rvv, n, lanes)                                              \
+    STORE_GROUP_3(vst1, r, t, rvv, n, lanes)                                                  \
+    vst1((r) + 3 * (lanes), TUPLE_GET(t, rvv, n, 3));
+
+// Defines test_<n><q><sfx>() for groups of n vectors of type vec_t with `lanes` elements of
+// elem_t. q is empty for the 64-bit functions and q for the 128-bit ones, rvv is the RVV type
+// of a vector of a group.
+#define DEFINE_TEST(elem_t, print_type, vec, q, sfx, lanes, rvv, n)                              \
+    void test_##n##q##sfx(void) {                                                                \
+        elem_t src[n * lanes + 8];                                                               \
+        elem_t result[n * lanes];                                                                \
+                                                                                                 \
+        /* Mixes of small, large, positive and negative values */                                \
+        for (int i = 0; i < n * lanes + 8; i++) {                                                \
+            src[i] = (elem_t)((uint64_t)(i + 1) * 0x9E3779B97F4A7C15ULL);                        \
+        }                                                                                        \
+                                                                                                 \
+        vec##x##n##_t v = RHAL(vld##n##q##_##sfx)(src);                                          \
+        STORE_GROUP_##n(RHAL(vst1##q##_##sfx), result, v, rvv, n, lanes)                         \
+        print_results(result, n * lanes, print_type);                                            \
+        RHAL(vst##n##q##_##sfx)(result, v);                                                      \
+        print_results(result, n * lanes, print_type);                                            \
+                                                                                                 \
+        vec##x##n##_t d = RHAL(vld##n##q##_dup_##sfx)(src + 1);                                  \
+        STORE_GROUP_##n(RHAL(vst1##q##_##sfx), result, d, rvv, n, lanes)                         \
+        print_results(result, n * lanes, print_type);                                            \
+                                                                                                 \
+        vec##x##n##_t l = RHAL(vld##n##q##_lane_##sfx)(src + 2, v, 0);                           \
+        STORE_GROUP_##n(RHAL(vst1##q##_##sfx), result, l, rvv, n, lanes)                         \
+        print_results(result, n * lanes, print_type);                                            \
+        l = RHAL(vld##n##q##_lane_##sfx)(src + 2, v, lanes - 1);                                 \
+        STORE_GROUP_##n(RHAL(vst1##q##_##sfx), result, l, rvv, n, lanes)                         \
+        print_results(result, n * lanes, print_type);                                            \
+                                                                                                 \
+        RHAL(vst##n##q##_lane_##sfx)(result, v, 0);                                              \
+        RHAL(vst##n##q##_lane_##sfx)(result + n, v, lanes - 1);                                  \
+        print_results(result, 2 * n, print_type);                                                \
+    }
+
+#if defined(ARM_NEON)
+    #define RVV(q, sfx)
+#elif defined(RISCV_VECTOR)
+    #define RVV(q, sfx) RVV_##q##_##sfx
+#endif
+
+// Defines the tests of the groups of two, three and four vectors of a type
+#define DEFINE_TESTS(elem_t, print_type, vec, q, sfx, lanes, rvv)                                \
+    DEFINE_TEST(elem_t, print_type, vec, q, sfx, lanes, rvv, 2)                                  \
+    DEFINE_TEST(elem_t, print_type, vec, q, sfx, lanes, rvv, 3)                                  \
+    DEFINE_TEST(elem_t, print_type, vec, q, sfx, lanes, rvv, 4)
+
+DEFINE_TESTS(int8_t, INT8, int8x8, , s8, 8, RVV(D, s8))
+DEFINE_TESTS(int16_t, INT16, int16x4, , s16, 4, RVV(D, s16))
+DEFINE_TESTS(int32_t, INT32, int32x2, , s32, 2, RVV(D, s32))
+DEFINE_TESTS(int64_t, INT64, int64x1, , s64, 1, RVV(D, s64))
+DEFINE_TESTS(uint8_t, UINT8, uint8x8, , u8, 8, RVV(D, u8))
+DEFINE_TESTS(uint16_t, UINT16, uint16x4, , u16, 4, RVV(D, u16))
+DEFINE_TESTS(uint32_t, UINT32, uint32x2, , u32, 2, RVV(D, u32))
+DEFINE_TESTS(uint64_t, UINT64, uint64x1, , u64, 1, RVV(D, u64))
+
+DEFINE_TESTS(int8_t, INT8, int8x16, q, s8, 16, RVV(Q, s8))
+DEFINE_TESTS(int16_t, INT16, int16x8, q, s16, 8, RVV(Q, s16))
+DEFINE_TESTS(int32_t, INT32, int32x4, q, s32, 4, RVV(Q, s32))
+DEFINE_TESTS(int64_t, INT64, int64x2, q, s64, 2, RVV(Q, s64))
+DEFINE_TESTS(uint8_t, UINT8, uint8x16, q, u8, 16, RVV(Q, u8))
+DEFINE_TESTS(uint16_t, UINT16, uint16x8, q, u16, 8, RVV(Q, u16))
+DEFINE_TESTS(uint32_t, UINT32, uint32x4, q, u32, 4, RVV(Q, u32))
+DEFINE_TESTS(uint64_t, UINT64, uint64x2, q, u64, 2, RVV(Q, u64))
+
+int main() {
+    test_2s8();
+    test_2s16();
+    test_2s32();
+    test_2s64();
+    test_2u8();
+    test_2u16();
+    test_2u32();
+    test_2u64();
+
+    test_3s8();
+    test_3s16();
+    test_3s32();
+    test_3s64();
+    test_3u8();
+    test_3u16();
+    test_3u32();
+    test_3u64();
+
+    test_4s8();
+    test_4s16();
+    test_4s32();
+    test_4s64();
+    test_4u8();
+    test_4u16();
+    test_4u32();
+    test_4u64();
+
+    test_2qs8();
+    test_2qs16();
+    test_2qs32();
+    test_2qs64();
+    test_2qu8();
+    test_2qu16();
+    test_2qu32();
+    test_2qu64();
+
+    test_3qs8();
+    test_3qs16();
+    test_3qs32();
+    test_3qs64();
+    test_3qu8();
+    test_3qu16();
+    test_3qu32();
+    test_3qu64();
+
+    test_4qs8();
+    test_4qs16();
+    test_4qs32();
+    test_4qs64();
+    test_4qu8();
+    test_4qu16();
+    test_4qu32();
+    test_4qu64();
+    return 0;
+}
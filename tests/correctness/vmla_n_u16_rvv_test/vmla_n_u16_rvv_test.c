@@ -0,0 +1,87 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Function to run test cases with a given vect_vmla
+void run_test_cases(void (*vect_vmla)(uint16_t*, uint16_t*, uint16_t*, int, uint16_t*)) {
+    uint16_t test_cases[][4] = {
+        {1, 2, 3, 4},                  // Regular positive numbers
+        {0, 0, 0, 0},                  // All zeros
+        {65535, 65534, 65533, 65532},  // Near maximum uint16_t values
+        {65535, 65535, 65535, 65535},  // Maximum uint16_t value
+        {1, 0, 65535, 2},              // Mixed near boundary values
+        {50, 50, 50, 50},              // Repeated positive numbers
+        {200, 100, 150, 50},           // Arbitrary mixed values
+        {1, 1, 1, 1}                   // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        uint16_t *a = test_cases[i];
+        uint16_t b[4] = {2, 3, 300, 65535};
+        uint16_t c[1] = {300};
+        uint16_t result[4];
+
+        vect_vmla(a, b, c, 4, result);
+        print_results(result, 4, UINT16);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vmla_n_u16_neon(uint16_t *a, uint16_t *b, uint16_t *c, int size, uint16_t *result) {
+    uint16x4_t x = vld1_u16(a);
+    uint16x4_t y = vld1_u16(b);
+    uint16x4_t r = vmla_n_u16(x, y, c[0]);
+    vst1_u16(result, r);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(vmla_n_u16_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void vmla_n_u16_rvvector(uint16_t *a, uint16_t *b, uint16_t *c, int size, uint16_t *result) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint16x4_t x = __riscv_vle16_v_u16mf2(a, size);
+    #else
+        uint16x4_t x = __riscv_vle16_v_u16m1(a, size);
+    #endif
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint16x4_t y = __riscv_vle16_v_u16mf2(b, size);
+    #else
+        uint16x4_t y = __riscv_vle16_v_u16m1(b, size);
+    #endif
+    uint16x4_t r = vmla_n_u16_rvv(x, y, c[0]);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_u16mf2(result, r, size);
+    #else
+        __riscv_vse16_v_u16m1(result, r, size);
+    #endif
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(vmla_n_u16_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
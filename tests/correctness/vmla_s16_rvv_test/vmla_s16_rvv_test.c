@@ -0,0 +1,93 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Function to run test cases with a given vect_vmla
+void run_test_cases(void (*vect_vmla)(int16_t*, int16_t*, int16_t*, int, int16_t*)) {
+    int16_t test_cases[][4] = {
+        {1, 2, 3, 4},                      // Regular positive numbers
+        {0, 0, 0, 0},                      // All zeros
+        {-1, -2, -3, -4},                  // Negative numbers
+        {32767, 32767, 32767, 32767},      // Maximum int16_t value
+        {-32768, -32768, -32768, -32768},  // Minimum int16_t value
+        {32767, -32768, 32767, -32768},    // Max and Min int16_t values
+        {50, -50, 100, -100},              // Mixed positive and negative numbers
+        {1, 1, 1, 1}                       // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int16_t *a = test_cases[i];
+        int16_t b[4] = {2, -3, 300, 32767};
+        int16_t c[4] = {3, -7, 11, -1};
+        int16_t result[4];
+
+        vect_vmla(a, b, c, 4, result);
+        print_results(result, 4, INT16);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vmla_s16_neon(int16_t *a, int16_t *b, int16_t *c, int size, int16_t *result) {
+    int16x4_t x = vld1_s16(a);
+    int16x4_t y = vld1_s16(b);
+    int16x4_t z = vld1_s16(c);
+    int16x4_t r = vmla_s16(x, y, z);
+    vst1_s16(result, r);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(vmla_s16_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void vmla_s16_rvvector(int16_t *a, int16_t *b, int16_t *c, int size, int16_t *result) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t x = __riscv_vle16_v_i16mf2(a, size);
+    #else
+        int16x4_t x = __riscv_vle16_v_i16m1(a, size);
+    #endif
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t y = __riscv_vle16_v_i16mf2(b, size);
+    #else
+        int16x4_t y = __riscv_vle16_v_i16m1(b, size);
+    #endif
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t z = __riscv_vle16_v_i16mf2(c, size);
+    #else
+        int16x4_t z = __riscv_vle16_v_i16m1(c, size);
+    #endif
+    int16x4_t r = vmla_s16_rvv(x, y, z);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_i16mf2(result, r, size);
+    #else
+        __riscv_vse16_v_i16m1(result, r, size);
+    #endif
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(vmla_s16_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,82 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// The lane is the last lane of v, 1
+// Function to run test cases with a given vect_vmlal
+void run_test_cases(void (*vect_vmlal)(int64_t*, int32_t*, int32_t*, int, int64_t*)) {
+    int64_t test_cases[][2] = {
+        {1, 2},                  // Regular positive numbers
+        {0, 0},                  // All zeros
+        {-1, -2},                // Negative numbers
+        {INT64_MAX, INT64_MAX},  // Maximum int64_t value
+        {INT64_MIN, INT64_MIN},  // Minimum int64_t value
+        {INT64_MAX, INT64_MIN},  // Max and Min int64_t values
+        {50, -50},               // Mixed positive and negative numbers
+        {1, 1}                   // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int64_t *a = test_cases[i];
+        int32_t b[4] = {2147483647, INT32_MIN, INT32_MIN, 2147483647};
+        int32_t v[2] = {3, INT32_MIN};
+        int64_t result[2];
+
+        vect_vmlal(a, b, v, 2, result);
+        print_results(result, 2, INT64);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vmlal_high_lane_s32_neon(int64_t *a, int32_t *b, int32_t *v, int size, int64_t *result) {
+    int64x2_t x = vld1q_s64(a);
+    int32x4_t y = vld1q_s32(b);
+    int32x2_t w = vld1_s32(v);
+    int64x2_t r = vmlal_high_lane_s32(x, y, w, 1);
+    vst1q_s64(result, r);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(vmlal_high_lane_s32_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void vmlal_high_lane_s32_rvvector(int64_t *a, int32_t *b, int32_t *v, int size, int64_t *result) {
+    int64x2_t x = __riscv_vle64_v_i64m1(a, size);
+    int32x4_t y = __riscv_vle32_v_i32m1(b, VLEN_4);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int32x2_t w = __riscv_vle32_v_i32mf2(v, size);
+    #else
+        int32x2_t w = __riscv_vle32_v_i32m1(v, size);
+    #endif
+    int64x2_t r = vmlal_high_lane_s32_rvv(x, y, w, 1);
+    __riscv_vse64_v_i64m1(result, r, size);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(vmlal_high_lane_s32_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
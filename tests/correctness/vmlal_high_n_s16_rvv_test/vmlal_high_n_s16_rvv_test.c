@@ -0,0 +1,75 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Function to run test cases with a given vect_vmlal
+void run_test_cases(void (*vect_vmlal)(int32_t*, int16_t*, int16_t*, int, int32_t*)) {
+    int32_t test_cases[][4] = {
+        {1, 2, 3, 4},                                      // Regular positive numbers
+        {0, 0, 0, 0},                                      // All zeros
+        {-1, -2, -3, -4},                                  // Negative numbers
+        {2147483647, 2147483647, 2147483647, 2147483647},  // Maximum int32_t value
+        {INT32_MIN, INT32_MIN, INT32_MIN, INT32_MIN},      // Minimum int32_t value
+        {2147483647, INT32_MIN, 2147483647, INT32_MIN},    // Max and Min int32_t values
+        {50, -50, 100, -100},                              // Mixed positive and negative numbers
+        {1, 1, 1, 1}                                       // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int32_t *a = test_cases[i];
+        int16_t b[8] = {32767, -32768, 3, -7, -32768, 32767, -1, 9};
+        int16_t c[1] = {-32768};
+        int32_t result[4];
+
+        vect_vmlal(a, b, c, 4, result);
+        print_results(result, 4, INT32);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vmlal_high_n_s16_neon(int32_t *a, int16_t *b, int16_t *c, int size, int32_t *result) {
+    int32x4_t x = vld1q_s32(a);
+    int16x8_t y = vld1q_s16(b);
+    int32x4_t r = vmlal_high_n_s16(x, y, c[0]);
+    vst1q_s32(result, r);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(vmlal_high_n_s16_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void vmlal_high_n_s16_rvvector(int32_t *a, int16_t *b, int16_t *c, int size, int32_t *result) {
+    int32x4_t x = __riscv_vle32_v_i32m1(a, size);
+    int16x8_t y = __riscv_vle16_v_i16m1(b, VLEN_8);
+    int32x4_t r = vmlal_high_n_s16_rvv(x, y, c[0]);
+    __riscv_vse32_v_i32m1(result, r, size);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(vmlal_high_n_s16_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
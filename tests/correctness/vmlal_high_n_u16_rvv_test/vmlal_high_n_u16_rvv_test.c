@@ -0,0 +1,75 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Function to run test cases with a given vect_vmlal
+void run_test_cases(void (*vect_vmlal)(uint32_t*, uint16_t*, uint16_t*, int, uint32_t*)) {
+    uint32_t test_cases[][4] = {
+        {1, 2, 3, 4},                                      // Regular positive numbers
+        {0, 0, 0, 0},                                      // All zeros
+        {4294967295, 4294967294, 4294967293, 4294967292},  // Near maximum uint32_t values
+        {4294967295, 4294967295, 4294967295, 4294967295},  // Maximum uint32_t value
+        {1, 0, 4294967295, 2},                             // Mixed near boundary values
+        {50, 50, 50, 50},                                  // Repeated positive numbers
+        {200, 100, 150, 50},                               // Arbitrary mixed values
+        {1, 1, 1, 1}                                       // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        uint32_t *a = test_cases[i];
+        uint16_t b[8] = {65535, 0, 1, 128, 1, 65535, 200, 3};
+        uint16_t c[1] = {65535};
+        uint32_t result[4];
+
+        vect_vmlal(a, b, c, 4, result);
+        print_results(result, 4, UINT32);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vmlal_high_n_u16_neon(uint32_t *a, uint16_t *b, uint16_t *c, int size, uint32_t *result) {
+    uint32x4_t x = vld1q_u32(a);
+    uint16x8_t y = vld1q_u16(b);
+    uint32x4_t r = vmlal_high_n_u16(x, y, c[0]);
+    vst1q_u32(result, r);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(vmlal_high_n_u16_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void vmlal_high_n_u16_rvvector(uint32_t *a, uint16_t *b, uint16_t *c, int size, uint32_t *result) {
+    uint32x4_t x = __riscv_vle32_v_u32m1(a, size);
+    uint16x8_t y = __riscv_vle16_v_u16m1(b, VLEN_8);
+    uint32x4_t r = vmlal_high_n_u16_rvv(x, y, c[0]);
+    __riscv_vse32_v_u32m1(result, r, size);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(vmlal_high_n_u16_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
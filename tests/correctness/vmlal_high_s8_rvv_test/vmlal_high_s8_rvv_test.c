@@ -0,0 +1,77 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Function to run test cases with a given vect_vmlal
+void run_test_cases(void (*vect_vmlal)(int16_t*, int8_t*, int8_t*, int, int16_t*)) {
+    int16_t test_cases[][8] = {
+        {1, 2, 3, 4, 5, 6, 7, 8},                                          // Regular positive numbers
+        {0, 0, 0, 0, 0, 0, 0, 0},                                          // All zeros
+        {-1, -2, -3, -4, -5, -6, -7, -8},                                  // Negative numbers
+        {32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767},          // Maximum int16_t value
+        {-32768, -32768, -32768, -32768, -32768, -32768, -32768, -32768},  // Minimum int16_t value
+        {32767, -32768, 32767, -32768, 32767, -32768, 32767, -32768},      // Max and Min int16_t values
+        {50, -50, 100, -100, 25, -25, 75, -75},                            // Mixed positive and negative numbers
+        {1, 1, 1, 1, 1, 1, 1, 1}                                           // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int16_t *a = test_cases[i];
+        int8_t b[16] = {127, -128, 3, -7, 50, -50, 100, -100, -128, 127, -1, 9, -64, 25, 1, 0};
+        int8_t c[16] = {127, -128, -128, 5, -3, 2, -1, 7, -128, -128, 11, -6, 4, -9, 127, 1};
+        int16_t result[8];
+
+        vect_vmlal(a, b, c, 8, result);
+        print_results(result, 8, INT16);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vmlal_high_s8_neon(int16_t *a, int8_t *b, int8_t *c, int size, int16_t *result) {
+    int16x8_t x = vld1q_s16(a);
+    int8x16_t y = vld1q_s8(b);
+    int8x16_t z = vld1q_s8(c);
+    int16x8_t r = vmlal_high_s8(x, y, z);
+    vst1q_s16(result, r);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(vmlal_high_s8_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void vmlal_high_s8_rvvector(int16_t *a, int8_t *b, int8_t *c, int size, int16_t *result) {
+    int16x8_t x = __riscv_vle16_v_i16m1(a, size);
+    int8x16_t y = __riscv_vle8_v_i8m1(b, VLEN_16);
+    int8x16_t z = __riscv_vle8_v_i8m1(c, VLEN_16);
+    int16x8_t r = vmlal_high_s8_rvv(x, y, z);
+    __riscv_vse16_v_i16m1(result, r, size);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(vmlal_high_s8_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
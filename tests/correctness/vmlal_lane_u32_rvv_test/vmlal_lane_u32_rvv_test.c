@@ -0,0 +1,86 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// The lane is the last lane of v, 1
+// Function to run test cases with a given vect_vmlal
+void run_test_cases(void (*vect_vmlal)(uint64_t*, uint32_t*, uint32_t*, int, uint64_t*)) {
+    uint64_t test_cases[][2] = {
+        {1, 2},                                              // Regular positive numbers
+        {0, 0},                                              // All zeros
+        {18446744073709551615ULL, 18446744073709551614ULL},  // Near maximum uint64_t values
+        {18446744073709551615ULL, 18446744073709551615ULL},  // Maximum uint64_t value
+        {1, 0},                                              // Mixed near boundary values
+        {50, 50},                                            // Repeated positive numbers
+        {200, 100},                                          // Arbitrary mixed values
+        {1, 1}                                               // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        uint64_t *a = test_cases[i];
+        uint32_t b[2] = {4294967295, 0};
+        uint32_t v[2] = {3, 4294967295};
+        uint64_t result[2];
+
+        vect_vmlal(a, b, v, 2, result);
+        print_results(result, 2, UINT64);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vmlal_lane_u32_neon(uint64_t *a, uint32_t *b, uint32_t *v, int size, uint64_t *result) {
+    uint64x2_t x = vld1q_u64(a);
+    uint32x2_t y = vld1_u32(b);
+    uint32x2_t w = vld1_u32(v);
+    uint64x2_t r = vmlal_lane_u32(x, y, w, 1);
+    vst1q_u64(result, r);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(vmlal_lane_u32_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void vmlal_lane_u32_rvvector(uint64_t *a, uint32_t *b, uint32_t *v, int size, uint64_t *result) {
+    uint64x2_t x = __riscv_vle64_v_u64m1(a, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x2_t y = __riscv_vle32_v_u32mf2(b, size);
+    #else
+        uint32x2_t y = __riscv_vle32_v_u32m1(b, size);
+    #endif
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x2_t w = __riscv_vle32_v_u32mf2(v, size);
+    #else
+        uint32x2_t w = __riscv_vle32_v_u32m1(v, size);
+    #endif
+    uint64x2_t r = vmlal_lane_u32_rvv(x, y, w, 1);
+    __riscv_vse64_v_u64m1(result, r, size);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(vmlal_lane_u32_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
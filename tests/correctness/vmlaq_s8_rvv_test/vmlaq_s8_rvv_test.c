@@ -0,0 +1,77 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Function to run test cases with a given vect_vmla
+void run_test_cases(void (*vect_vmla)(int8_t*, int8_t*, int8_t*, int, int8_t*)) {
+    int8_t test_cases[][16] = {
+        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},                                           // Regular positive numbers
+        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},                                                  // All zeros
+        {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16},                           // Negative numbers
+        {127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127},                  // Maximum int8_t value
+        {-128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128},  // Minimum int8_t value
+        {127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128},          // Max and Min int8_t values
+        {50, -50, 100, -100, 25, -25, 75, -75, 50, -50, 100, -100, 25, -25, 75, -75},                      // Mixed positive and negative numbers
+        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}                                                   // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int8_t *a = test_cases[i];
+        int8_t b[16] = {2, -3, 5, 127, -128, 11, -1, 64, 2, -3, 5, 127, -128, 11, -1, 64};
+        int8_t c[16] = {3, -7, 11, -1, 2, 5, -9, 1, 3, -7, 11, -1, 2, 5, -9, 1};
+        int8_t result[16];
+
+        vect_vmla(a, b, c, 16, result);
+        print_results(result, 16, INT8);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vmlaq_s8_neon(int8_t *a, int8_t *b, int8_t *c, int size, int8_t *result) {
+    int8x16_t x = vld1q_s8(a);
+    int8x16_t y = vld1q_s8(b);
+    int8x16_t z = vld1q_s8(c);
+    int8x16_t r = vmlaq_s8(x, y, z);
+    vst1q_s8(result, r);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(vmlaq_s8_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void vmlaq_s8_rvvector(int8_t *a, int8_t *b, int8_t *c, int size, int8_t *result) {
+    int8x16_t x = __riscv_vle8_v_i8m1(a, size);
+    int8x16_t y = __riscv_vle8_v_i8m1(b, size);
+    int8x16_t z = __riscv_vle8_v_i8m1(c, size);
+    int8x16_t r = vmlaq_s8_rvv(x, y, z);
+    __riscv_vse8_v_i8m1(result, r, size);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(vmlaq_s8_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,94 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// The lane is the last lane of v, 1
+// Function to run test cases with a given vect_vmls
+void run_test_cases(void (*vect_vmls)(int32_t*, int32_t*, int32_t*, int, int32_t*)) {
+    int32_t test_cases[][2] = {
+        {1, 2},                    // Regular positive numbers
+        {0, 0},                    // All zeros
+        {-1, -2},                  // Negative numbers
+        {2147483647, 2147483647},  // Maximum int32_t value
+        {INT32_MIN, INT32_MIN},    // Minimum int32_t value
+        {2147483647, INT32_MIN},   // Max and Min int32_t values
+        {50, -50},                 // Mixed positive and negative numbers
+        {1, 1}                     // All ones
+    };
+
+    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
+
+    for (int i = 0; i < num_tests; i++) {
+        int32_t *a = test_cases[i];
+        int32_t b[2] = {2, -3};
+        int32_t v[2] = {3, -5};
+        int32_t result[2];
+
+        vect_vmls(a, b, v, 2, result);
+        print_results(result, 2, INT32);
+    }
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vmls_lane_s32_neon(int32_t *a, int32_t *b, int32_t *v, int size, int32_t *result) {
+    int32x2_t x = vld1_s32(a);
+    int32x2_t y = vld1_s32(b);
+    int32x2_t w = vld1_s32(v);
+    int32x2_t r = vmls_lane_s32(x, y, w, 1);
+    vst1_s32(result, r);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_test_cases(vmls_lane_s32_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation
+void vmls_lane_s32_rvvector(int32_t *a, int32_t *b, int32_t *v, int size, int32_t *result) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int32x2_t x = __riscv_vle32_v_i32mf2(a, size);
+    #else
+        int32x2_t x = __riscv_vle32_v_i32m1(a, size);
+    #endif
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int32x2_t y = __riscv_vle32_v_i32mf2(b, size);
+    #else
+        int32x2_t y = __riscv_vle32_v_i32m1(b, size);
+    #endif
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int32x2_t w = __riscv_vle32_v_i32mf2(v, VLEN_2);
+    #else
+        int32x2_t w = __riscv_vle32_v_i32m1(v, VLEN_2);
+    #endif
+    int32x2_t r = vmls_lane_s32_rvv(x, y, w, 1);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_i32mf2(result, r, size);
+    #else
+        __riscv_vse32_v_i32m1(result, r, size);
+    #endif
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_test_cases(vmls_lane_s32_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -51,10 +51,19 @@ void run_tests_neon() {
 #elif defined(RISCV_VECTOR)
 // RISC-V Vector-specific implementation
 void vqadd_u8_rvvector(uint8_t *a, uint8_t *b, int size, uint8_t *result) {
-    uint8x8_t x = __riscv_vle8_v_u8m1(a, size);
-    uint8x8_t y = __riscv_vle8_v_u8m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint8x8_t x = __riscv_vle8_v_u8mf2(a, size);
+        uint8x8_t y = __riscv_vle8_v_u8mf2(b, size);
+    #else
+        uint8x8_t x = __riscv_vle8_v_u8m1(a, size);
+        uint8x8_t y = __riscv_vle8_v_u8m1(b, size);
+    #endif
     uint8x8_t z = vqadd_u8_rvv(x, y);
-    __riscv_vse8_v_u8m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse8_v_u8mf2(result, z, size);
+    #else
+        __riscv_vse8_v_u8m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
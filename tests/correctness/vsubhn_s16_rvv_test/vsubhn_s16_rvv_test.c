@@ -54,7 +54,11 @@ void vsubhn_s16_rvvector(int16_t *a, int16_t *b, int size, int8_t *result) {
     int16x8_t x = __riscv_vle16_v_i16m1(a, size);
     int16x8_t y = __riscv_vle16_v_i16m1(b, size);
     int8x8_t z = vsubhn_s16_rvv(x, y);
-    __riscv_vse8_v_i8m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse8_v_i8mf2(result, z, size);
+    #else
+        __riscv_vse8_v_i8m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
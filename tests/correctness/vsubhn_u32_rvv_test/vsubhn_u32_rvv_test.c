@@ -54,7 +54,11 @@ void vsubhn_u32_rvvector(uint32_t *a, uint32_t *b, int size, uint16_t *result) {
     uint32x4_t x = __riscv_vle32_v_u32m1(a, size);
     uint32x4_t y = __riscv_vle32_v_u32m1(b, size);
     uint16x4_t z = vsubhn_u32_rvv(x, y);
-    __riscv_vse16_v_u16m1(result, z, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_u16mf2(result, z, size);
+    #else
+        __riscv_vse16_v_u16m1(result, z, size);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
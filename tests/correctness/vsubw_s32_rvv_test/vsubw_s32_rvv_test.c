@@ -52,7 +52,11 @@ void run_tests_neon() {
 // RISC-V Vector-specific implementation
 void vsubw_s32_rvvector(int64_t *a, int32_t *b, int size, int64_t *result) {
     int64x2_t x = __riscv_vle64_v_i64m1(a, size);
-    int32x2_t y = __riscv_vle32_v_i32m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int32x2_t y = __riscv_vle32_v_i32mf2(b, size);
+    #else
+        int32x2_t y = __riscv_vle32_v_i32m1(b, size);
+    #endif
     int64x2_t z = vsubw_s32_rvv(x, y);
     __riscv_vse64_v_i64m1(result, z, size);
 }
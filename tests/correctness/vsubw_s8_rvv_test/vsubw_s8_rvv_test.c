@@ -52,7 +52,11 @@ void run_tests_neon() {
 // RISC-V Vector-specific implementation
 void vsubw_s8_rvvector(int16_t *a, int8_t *b, int size, int16_t *result) {
     int16x8_t x = __riscv_vle16_v_i16m1(a, size);
-    int8x8_t y = __riscv_vle8_v_i8m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int8x8_t y = __riscv_vle8_v_i8mf2(b, size);
+    #else
+        int8x8_t y = __riscv_vle8_v_i8m1(b, size);
+    #endif
     int16x8_t z = vsubw_s8_rvv(x, y);
     __riscv_vse16_v_i16m1(result, z, size);
 }
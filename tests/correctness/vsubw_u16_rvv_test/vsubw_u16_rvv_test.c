@@ -52,7 +52,11 @@ void run_tests_neon() {
 // RISC-V Vector-specific implementation
 void vsubw_u16_rvvector(uint32_t *a, uint16_t *b, int size, uint32_t *result) {
     uint32x4_t x = __riscv_vle32_v_u32m1(a, size);
-    uint16x4_t y = __riscv_vle16_v_u16m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint16x4_t y = __riscv_vle16_v_u16mf2(b, size);
+    #else
+        uint16x4_t y = __riscv_vle16_v_u16m1(b, size);
+    #endif
     uint32x4_t z = vsubw_u16_rvv(x, y);
     __riscv_vse32_v_u32m1(result, z, size);
 }
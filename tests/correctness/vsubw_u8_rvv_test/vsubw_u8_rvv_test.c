@@ -52,7 +52,11 @@ void run_tests_neon() {
 // RISC-V Vector-specific implementation
 void vsubw_u8_rvvector(uint16_t *a, uint8_t *b, int size, uint16_t *result) {
     uint16x8_t x = __riscv_vle16_v_u16m1(a, size);
-    uint8x8_t y = __riscv_vle8_v_u8m1(b, size);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint8x8_t y = __riscv_vle8_v_u8mf2(b, size);
+    #else
+        uint8x8_t y = __riscv_vle8_v_u8m1(b, size);
+    #endif
     uint16x8_t z = vsubw_u8_rvv(x, y);
     __riscv_vse16_v_u16m1(result, z, size);
 }
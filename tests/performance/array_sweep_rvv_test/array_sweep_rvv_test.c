@@ -0,0 +1,266 @@
+// Copyright 2024 10xEngineers
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Throughput of every add/sub family over buffers from 1 KiB up to 256 MiB, for the
+// vector functions and a scalar C loop, in GB/s (bytes read and written) and elements
+// per cycle. The size is the working set of the operation, both sources and the
+// result. The largest size in KiB can be given as argument, e.g. RUN_ARGS=4096 on
+// a simulator.
+#define SWEEP_MIN_BYTES 1024L
+#define SWEEP_MAX_BYTES (256L << 20)
+
+// The scalar reference stays scalar, so GCC must not vectorize its loop
+#if defined(__GNUC__) && !defined(__clang__)
+    #define SCALAR_ATTR __attribute__((optimize("no-tree-vectorize"), noinline))
+#else
+    #define SCALAR_ATTR __attribute__((noinline))
+#endif
+
+typedef void (*sweep_fn)(const void *a, const void *b, void *r, size_t n);
+
+#define SAT16(v) ((v) > INT16_MAX ? INT16_MAX : ((v) < INT16_MIN ? INT16_MIN : (v)))
+
+// Scalar reference of a family: r[i] = expr, with x = a[i] and y = b[i] as int64_t
+#define SCALAR_KERNEL(name, TA, TB, TR, expr)                                   \
+    SCALAR_ATTR void name##_scalar(const void *pa, const void *pb, void *pr, size_t n) { \
+        const TA *a = pa;                                                       \
+        const TB *b = pb;                                                       \
+        TR *r = pr;                                                             \
+        for (size_t i = 0; i < n; i++) {                                        \
+            int64_t x = a[i], y = b[i];                                         \
+            r[i] = (TR)(expr);                                                  \
+        }                                                                       \
+    }
+
+SCALAR_KERNEL(vaddq_s16, int16_t, int16_t, int16_t, x + y)
+SCALAR_KERNEL(vsubq_s16, int16_t, int16_t, int16_t, x - y)
+SCALAR_KERNEL(vqaddq_s16, int16_t, int16_t, int16_t, SAT16(x + y))
+SCALAR_KERNEL(vqsubq_s16, int16_t, int16_t, int16_t, SAT16(x - y))
+SCALAR_KERNEL(vhaddq_s16, int16_t, int16_t, int16_t, (x + y) >> 1)
+SCALAR_KERNEL(vhsubq_s16, int16_t, int16_t, int16_t, (x - y) >> 1)
+SCALAR_KERNEL(vrhaddq_s16, int16_t, int16_t, int16_t, (x + y + 1) >> 1)
+SCALAR_KERNEL(vaddl_s16, int16_t, int16_t, int32_t, x + y)
+SCALAR_KERNEL(vsubl_s16, int16_t, int16_t, int32_t, x - y)
+SCALAR_KERNEL(vaddw_s16, int32_t, int16_t, int32_t, x + y)
+SCALAR_KERNEL(vsubw_s16, int32_t, int16_t, int32_t, x - y)
+SCALAR_KERNEL(vaddhn_s32, int32_t, int32_t, int16_t, (int32_t)(x + y) >> 16)
+SCALAR_KERNEL(vsubhn_s32, int32_t, int32_t, int16_t, (int32_t)(x - y) >> 16)
+SCALAR_KERNEL(vraddhn_s32, int32_t, int32_t, int16_t, (int32_t)(x + y + 0x8000) >> 16)
+SCALAR_KERNEL(vrsubhn_s32, int32_t, int32_t, int16_t, (int32_t)(x - y + 0x8000) >> 16)
+
+#if defined(ARM_NEON)
+    #define SWEEP_ARCH "ARM-Neon"
+    #define SWEEP_IMPL "neon"
+    #define CALL(fn) fn
+    #define LOAD_Q16(p) vld1q_s16(p)
+    #define LOAD_Q32(p) vld1q_s32(p)
+    #define LOAD_D16(p) vld1_s16(p)
+    #define STORE_Q16(p, v) vst1q_s16(p, v)
+    #define STORE_Q32(p, v) vst1q_s32(p, v)
+    #define STORE_D16(p, v) vst1_s16(p, v)
+#elif defined(RISCV_VECTOR)
+    #define SWEEP_ARCH "RISC-V"
+    #define SWEEP_IMPL "rvv"
+    #define CALL(fn) fn##_rvv
+    #define LOAD_Q16(p) __riscv_vle16_v_i16m1(p, VLEN_8)
+    #define LOAD_Q32(p) __riscv_vle32_v_i32m1(p, VLEN_4)
+    #define STORE_Q16(p, v) __riscv_vse16_v_i16m1(p, v, VLEN_8)
+    #define STORE_Q32(p, v) __riscv_vse32_v_i32m1(p, v, VLEN_4)
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        #define LOAD_D16(p) __riscv_vle16_v_i16mf2(p, VLEN_4)
+        #define STORE_D16(p, v) __riscv_vse16_v_i16mf2(p, v, VLEN_4)
+    #else
+        #define LOAD_D16(p) __riscv_vle16_v_i16m1(p, VLEN_4)
+        #define STORE_D16(p, v) __riscv_vse16_v_i16m1(p, v, VLEN_4)
+    #endif
+#endif
+
+// Vector kernels of a family, one call per vector: int16x8_t (a, b) -> int16x8_t
+#define VECTOR_KERNEL_SAME(name)                                                \
+    void name##_vector(const void *pa, const void *pb, void *pr, size_t n) {   \
+        const int16_t *a = pa;                                                  \
+        const int16_t *b = pb;                                                  \
+        int16_t *r = pr;                                                        \
+        for (size_t i = 0; i < n; i += 8) {                                     \
+            STORE_Q16(r + i, CALL(name)(LOAD_Q16(a + i), LOAD_Q16(b + i)));     \
+        }                                                                       \
+    }
+
+// int16x4_t (a, b) -> int32x4_t
+#define VECTOR_KERNEL_LONG(name)                                                \
+    void name##_vector(const void *pa, const void *pb, void *pr, size_t n) {   \
+        const int16_t *a = pa;                                                  \
+        const int16_t *b = pb;                                                  \
+        int32_t *r = pr;                                                        \
+        for (size_t i = 0; i < n; i += 4) {                                     \
+            STORE_Q32(r + i, CALL(name)(LOAD_D16(a + i), LOAD_D16(b + i)));     \
+        }                                                                       \
+    }
+
+// int32x4_t a, int16x4_t b -> int32x4_t
+#define VECTOR_KERNEL_WIDE(name)                                                \
+    void name##_vector(const void *pa, const void *pb, void *pr, size_t n) {   \
+        const int32_t *a = pa;                                                  \
+        const int16_t *b = pb;                                                  \
+        int32_t *r = pr;                                                        \
+        for (size_t i = 0; i < n; i += 4) {                                     \
+            STORE_Q32(r + i, CALL(name)(LOAD_Q32(a + i), LOAD_D16(b + i)));     \
+        }                                                                       \
+    }
+
+// int32x4_t (a, b) -> int16x4_t
+#define VECTOR_KERNEL_NARROW(name)                                              \
+    void name##_vector(const void *pa, const void *pb, void *pr, size_t n) {   \
+        const int32_t *a = pa;                                                  \
+        const int32_t *b = pb;                                                  \
+        int16_t *r = pr;                                                        \
+        for (size_t i = 0; i < n; i += 4) {                                     \
+            STORE_D16(r + i, CALL(name)(LOAD_Q32(a + i), LOAD_Q32(b + i)));     \
+        }                                                                       \
+    }
+
+VECTOR_KERNEL_SAME(vaddq_s16)
+VECTOR_KERNEL_SAME(vsubq_s16)
+VECTOR_KERNEL_SAME(vqaddq_s16)
+VECTOR_KERNEL_SAME(vqsubq_s16)
+VECTOR_KERNEL_SAME(vhaddq_s16)
+VECTOR_KERNEL_SAME(vhsubq_s16)
+VECTOR_KERNEL_SAME(vrhaddq_s16)
+VECTOR_KERNEL_LONG(vaddl_s16)
+VECTOR_KERNEL_LONG(vsubl_s16)
+VECTOR_KERNEL_WIDE(vaddw_s16)
+VECTOR_KERNEL_WIDE(vsubw_s16)
+VECTOR_KERNEL_NARROW(vaddhn_s32)
+VECTOR_KERNEL_NARROW(vsubhn_s32)
+VECTOR_KERNEL_NARROW(vraddhn_s32)
+VECTOR_KERNEL_NARROW(vrsubhn_s32)
+
+// Element sizes of the sources and the result, and the kernels of a family
+struct sweep_family {
+    const char *name;
+    int a_bytes, b_bytes, r_bytes;
+    sweep_fn scalar;
+    sweep_fn vector;
+};
+
+#define FAMILY(name, a_bytes, b_bytes, r_bytes) {#name, a_bytes, b_bytes, r_bytes, name##_scalar, name##_vector}
+
+static const struct sweep_family families[] = {
+    FAMILY(vaddq_s16, 2, 2, 2),
+    FAMILY(vsubq_s16, 2, 2, 2),
+    FAMILY(vqaddq_s16, 2, 2, 2),
+    FAMILY(vqsubq_s16, 2, 2, 2),
+    FAMILY(vhaddq_s16, 2, 2, 2),
+    FAMILY(vhsubq_s16, 2, 2, 2),
+    FAMILY(vrhaddq_s16, 2, 2, 2),
+    FAMILY(vaddl_s16, 2, 2, 4),
+    FAMILY(vsubl_s16, 2, 2, 4),
+    FAMILY(vaddw_s16, 4, 2, 4),
+    FAMILY(vsubw_s16, 4, 2, 4),
+    FAMILY(vaddhn_s32, 4, 4, 2),
+    FAMILY(vsubhn_s32, 4, 4, 2),
+    FAMILY(vraddhn_s32, 4, 4, 2),
+    FAMILY(vrsubhn_s32, 4, 4, 2),
+};
+
+// Buffer of the largest working set; the sources and the result of the current
+// size follow each other in it
+static uint8_t *sweep_buffer;
+static const void *sweep_a;
+static const void *sweep_b;
+static void *sweep_r;
+static size_t sweep_n;
+static sweep_fn sweep_current;
+
+// Kernel running the current function over the current buffers
+void sweep_kernel(int iterations) {
+    for (int i = 0; i < iterations; i++) {
+        sweep_current(sweep_a, sweep_b, sweep_r, sweep_n);
+    }
+}
+
+// Function to check the vector kernel of a family against the scalar reference
+int check_family(const struct sweep_family *family, size_t n) {
+    uint8_t *a = sweep_buffer;
+    uint8_t *b = a + n * family->a_bytes;
+    uint8_t *expected = b + n * family->b_bytes;
+    uint8_t *actual = expected + n * family->r_bytes;
+
+    family->scalar(a, b, expected, n);
+    family->vector(a, b, actual, n);
+    return memcmp(expected, actual, n * family->r_bytes) == 0;
+}
+
+// Function to sweep one family over every buffer size; a family whose vector kernel does
+// not match the scalar reference is not timed, and 0 is returned
+int sweep_family(const struct sweep_family *family, long max_bytes) {
+    int bytes_per_element = family->a_bytes + family->b_bytes + family->r_bytes;
+
+    if (!check_family(family, 64)) {
+        printf("%s vector function '%s' does not match the scalar reference, not benchmarked\n",
+               SWEEP_ARCH, family->name);
+        return 0;
+    }
+
+    for (long size = SWEEP_MIN_BYTES; size <= max_bytes; size *= 2) {
+        // Whole vectors of 8 elements
+        sweep_n = (size_t)(size / bytes_per_element) & ~(size_t)7;
+        sweep_a = sweep_buffer;
+        sweep_b = sweep_buffer + sweep_n * family->a_bytes;
+        sweep_r = sweep_buffer + sweep_n * (family->a_bytes + family->b_bytes);
+        long bytes = (long)sweep_n * bytes_per_element;
+
+        sweep_current = family->scalar;
+        bench_run_sweep(SWEEP_ARCH, family->name, "scalar", bytes, (long)sweep_n, sweep_kernel);
+        sweep_current = family->vector;
+        bench_run_sweep(SWEEP_ARCH, family->name, SWEEP_IMPL, bytes, (long)sweep_n, sweep_kernel);
+    }
+    return 1;
+}
+
+int main(int argc, char **argv) {
+    long max_bytes = SWEEP_MAX_BYTES;
+    int failures = 0;
+
+    if (argc > 1) {
+        max_bytes = atol(argv[1]) * 1024;
+        if (max_bytes < SWEEP_MIN_BYTES) {
+            printf("Invalid largest size '%s' KiB\n", argv[1]);
+            return 1;
+        }
+    }
+
+    sweep_buffer = malloc(max_bytes);
+    if (sweep_buffer == NULL) {
+        printf("Could not allocate %ld bytes\n", max_bytes);
+        return 1;
+    }
+    // Touch every page before the first measurement
+    for (long i = 0; i < max_bytes; i++) {
+        sweep_buffer[i] = (uint8_t)(i * 37);
+    }
+
+    for (size_t f = 0; f < sizeof(families) / sizeof(families[0]); f++) {
+        failures += !sweep_family(&families[f], max_bytes);
+    }
+
+    free(sweep_buffer);
+    if (failures) {
+        printf("%d function(s) do not match the scalar reference\n", failures);
+        return 1;
+    }
+    return 0;
+}
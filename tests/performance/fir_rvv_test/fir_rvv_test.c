@@ -0,0 +1,160 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Throughput of the widening multiply-accumulate kernels of audio and image filters, per
+// output vector: an 8-tap FIR over Q15 samples with 32-bit accumulators (vmlal_laneq_s16,
+// the taps held in one vector) and a 3-tap [1 2 1] convolution of an 8-bit row with 16-bit
+// accumulators (vmull_u8, vmlal_u8). Every output vector is accumulated in a register and
+// stored once. On RISC-V the kernels are compared with the same kernels storing and
+// reloading the accumulator around every tap, as a port whose accumulator goes through
+// memory would, so the cycles and retired instructions per op show what keeping the
+// accumulator in registers saves. Build with RHAL_INLINE=1 to compare without the call
+// overhead.
+#define NUM_SAMPLES 256
+#define NUM_PIXELS 256
+
+int16_t samples[NUM_SAMPLES + 8];
+int16_t taps[8] = {-1024, 2048, 6144, 9216, 9216, 6144, 2048, -1024};
+int32_t fir_out[NUM_SAMPLES];
+uint8_t pixels[NUM_PIXELS + 8];
+uint8_t weights[3] = {1, 2, 1};
+uint16_t conv_out[NUM_PIXELS];
+
+// The taps of a FIR, with the lane of every tap a constant
+#define FIR_TAPS(TAP) TAP(0) TAP(1) TAP(2) TAP(3) TAP(4) TAP(5) TAP(6) TAP(7)
+
+// Function to fill the buffers, run the benchmarks of one implementation and print the
+// first outputs
+void run_benchmarks(const char *arch, const char *suffix, void (*kernels[2])(int)) {
+    char name[32];
+    for (int i = 0; i < NUM_SAMPLES + 8; i++) {
+        samples[i] = (int16_t)(i * 1031 + ENTROPY);
+    }
+    for (int i = 0; i < NUM_PIXELS + 8; i++) {
+        pixels[i] = (uint8_t)(i * 97 + ENTROPY);
+    }
+
+    snprintf(name, sizeof(name), "fir_s16%s", suffix);
+    bench_run(arch, name, "int32x4_t", 4, "throughput", kernels[0], NUM_SAMPLES / 4);
+    print_results(fir_out, 8, INT32);
+    snprintf(name, sizeof(name), "conv3_u8%s", suffix);
+    bench_run(arch, name, "uint16x8_t", 8, "throughput", kernels[1], NUM_PIXELS / 8);
+    print_results(conv_out, 16, UINT16);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void fir_s16_neon(int iterations) {
+    int16x8_t h = vld1q_s16(taps);
+    for (int i = 0; i < iterations; i++) {
+        for (int n = 0; n < NUM_SAMPLES; n += 4) {
+            int32x4_t acc = vdupq_n_s32(0);
+            #define TAP(k) acc = vmlal_laneq_s16(acc, vld1_s16(samples + n + (k)), h, k);
+            FIR_TAPS(TAP)
+            #undef TAP
+            vst1q_s32(fir_out + n, acc);
+        }
+    }
+}
+void conv3_u8_neon(int iterations) {
+    uint8x8_t w0 = vld1_dup_u8(weights), w1 = vld1_dup_u8(weights + 1), w2 = vld1_dup_u8(weights + 2);
+    for (int i = 0; i < iterations; i++) {
+        for (int n = 0; n < NUM_PIXELS; n += 8) {
+            uint16x8_t acc = vmull_u8(vld1_u8(pixels + n), w0);
+            acc = vmlal_u8(acc, vld1_u8(pixels + n + 1), w1);
+            acc = vmlal_u8(acc, vld1_u8(pixels + n + 2), w2);
+            vst1q_u16(conv_out + n, acc);
+        }
+    }
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    void (*kernels[2])(int) = {fir_s16_neon, conv3_u8_neon};
+    run_benchmarks("ARM-Neon", "", kernels);
+}
+
+#elif defined(RISCV_VECTOR)
+// Makes the compiler store the accumulator and load it again after every tap
+#define memory_barrier() __asm__ __volatile__("" ::: "memory")
+
+// RISC-V Vector-specific implementation, the accumulators in registers
+void fir_s16_register(int iterations) {
+    int16x8_t h = vld1q_s16_rvv(taps);
+    for (int i = 0; i < iterations; i++) {
+        for (int n = 0; n < NUM_SAMPLES; n += 4) {
+            int32x4_t acc = __riscv_vmv_v_x_i32m1(0, VLEN_4);
+            #define TAP(k) acc = vmlal_laneq_s16_rvv(acc, vld1_s16_rvv(samples + n + (k)), h, k);
+            FIR_TAPS(TAP)
+            #undef TAP
+            vst1q_s32_rvv(fir_out + n, acc);
+        }
+    }
+}
+void conv3_u8_register(int iterations) {
+    uint8x8_t w0 = vld1_dup_u8_rvv(weights), w1 = vld1_dup_u8_rvv(weights + 1), w2 = vld1_dup_u8_rvv(weights + 2);
+    for (int i = 0; i < iterations; i++) {
+        for (int n = 0; n < NUM_PIXELS; n += 8) {
+            uint16x8_t acc = vmull_u8_rvv(vld1_u8_rvv(pixels + n), w0);
+            acc = vmlal_u8_rvv(acc, vld1_u8_rvv(pixels + n + 1), w1);
+            acc = vmlal_u8_rvv(acc, vld1_u8_rvv(pixels + n + 2), w2);
+            vst1q_u16_rvv(conv_out + n, acc);
+        }
+    }
+}
+
+// RISC-V Vector-specific implementation, the accumulators stored and loaded around every tap
+void fir_s16_memory(int iterations) {
+    int16x8_t h = vld1q_s16_rvv(taps);
+    for (int i = 0; i < iterations; i++) {
+        for (int n = 0; n < NUM_SAMPLES; n += 4) {
+            vst1q_s32_rvv(fir_out + n, __riscv_vmv_v_x_i32m1(0, VLEN_4));
+            #define TAP(k)                                                                         \
+                memory_barrier();                                                                  \
+                vst1q_s32_rvv(fir_out + n,                                                         \
+                              vmlal_laneq_s16_rvv(vld1q_s32_rvv(fir_out + n), vld1_s16_rvv(samples + n + (k)), h, k));
+            FIR_TAPS(TAP)
+            #undef TAP
+        }
+    }
+}
+void conv3_u8_memory(int iterations) {
+    uint8x8_t w0 = vld1_dup_u8_rvv(weights), w1 = vld1_dup_u8_rvv(weights + 1), w2 = vld1_dup_u8_rvv(weights + 2);
+    for (int i = 0; i < iterations; i++) {
+        for (int n = 0; n < NUM_PIXELS; n += 8) {
+            vst1q_u16_rvv(conv_out + n, vmull_u8_rvv(vld1_u8_rvv(pixels + n), w0));
+            memory_barrier();
+            vst1q_u16_rvv(conv_out + n, vmlal_u8_rvv(vld1q_u16_rvv(conv_out + n), vld1_u8_rvv(pixels + n + 1), w1));
+            memory_barrier();
+            vst1q_u16_rvv(conv_out + n, vmlal_u8_rvv(vld1q_u16_rvv(conv_out + n), vld1_u8_rvv(pixels + n + 2), w2));
+        }
+    }
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    void (*registers[2])(int) = {fir_s16_register, conv3_u8_register};
+    void (*memory[2])(int) = {fir_s16_memory, conv3_u8_memory};
+    run_benchmarks("RISC-V", "", registers);
+    run_benchmarks("RISC-V", "_memory", memory);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,295 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Throughput of the interleaved loads and stores of stereo audio (vld2q_s16, vst2q_s16),
+// RGB (vld3q_u8, vst3q_u8) and RGBA pixels (vld4q_u8, vst4q_u8) over a buffer of
+// NUM_BLOCKS groups, per group. On RISC-V the segment loads and stores of R-Halogen are
+// compared with a naive implementation gathering (vluxei) or scattering (vsuxei) every
+// vector of the group with its own indexed access. The load kernels XOR the vectors of
+// every group into an accumulator, so they are not optimized away. The naive kernels
+// are inlined, so build with RHAL_INLINE=1 to compare without the call overhead.
+#define NUM_BLOCKS 16
+
+int16_t stereo[NUM_BLOCKS * 16];
+uint8_t rgb[NUM_BLOCKS * 48];
+uint8_t rgba[NUM_BLOCKS * 64];
+int16_t result_s16[NUM_BLOCKS * 16];
+uint8_t result_u8[NUM_BLOCKS * 64];
+
+// Function to fill the buffers, run the benchmarks of one implementation and print the
+// accumulated loads and the first stored group
+void run_benchmarks(const char *arch, const char *suffix, void (*kernels[6])(int)) {
+    char name[32];
+    for (int i = 0; i < NUM_BLOCKS * 64; i++) {
+        stereo[i % (NUM_BLOCKS * 16)] = (int16_t)(i * 1031 + ENTROPY);
+        rgb[i % (NUM_BLOCKS * 48)] = (uint8_t)(i * 97 + ENTROPY);
+        rgba[i] = (uint8_t)(i * 31 + ENTROPY);
+    }
+
+    snprintf(name, sizeof(name), "vld2q_s16%s", suffix);
+    bench_run(arch, name, "int16x8x2_t", 16, "throughput", kernels[0], NUM_BLOCKS);
+    print_results(result_s16, 8, INT16);
+    snprintf(name, sizeof(name), "vld3q_u8%s", suffix);
+    bench_run(arch, name, "uint8x16x3_t", 48, "throughput", kernels[1], NUM_BLOCKS);
+    print_results(result_u8, 16, UINT8);
+    snprintf(name, sizeof(name), "vld4q_u8%s", suffix);
+    bench_run(arch, name, "uint8x16x4_t", 64, "throughput", kernels[2], NUM_BLOCKS);
+    print_results(result_u8, 16, UINT8);
+
+    snprintf(name, sizeof(name), "vst2q_s16%s", suffix);
+    bench_run(arch, name, "int16x8x2_t", 16, "throughput", kernels[3], NUM_BLOCKS);
+    print_results(result_s16, 16, INT16);
+    snprintf(name, sizeof(name), "vst3q_u8%s", suffix);
+    bench_run(arch, name, "uint8x16x3_t", 48, "throughput", kernels[4], NUM_BLOCKS);
+    print_results(result_u8, 48, UINT8);
+    snprintf(name, sizeof(name), "vst4q_u8%s", suffix);
+    bench_run(arch, name, "uint8x16x4_t", 64, "throughput", kernels[5], NUM_BLOCKS);
+    print_results(result_u8, 64, UINT8);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation
+void vld2q_s16_neon(int iterations) {
+    int16x8_t acc = vdupq_n_s16(0);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            int16x8x2_t v = vld2q_s16(stereo + 16 * b);
+            acc = veorq_s16(acc, veorq_s16(v.val[0], v.val[1]));
+        }
+    }
+    vst1q_s16(result_s16, acc);
+}
+void vld3q_u8_neon(int iterations) {
+    uint8x16_t acc = vdupq_n_u8(0);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            uint8x16x3_t v = vld3q_u8(rgb + 48 * b);
+            acc = veorq_u8(acc, veorq_u8(v.val[0], veorq_u8(v.val[1], v.val[2])));
+        }
+    }
+    vst1q_u8(result_u8, acc);
+}
+void vld4q_u8_neon(int iterations) {
+    uint8x16_t acc = vdupq_n_u8(0);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            uint8x16x4_t v = vld4q_u8(rgba + 64 * b);
+            acc = veorq_u8(acc, veorq_u8(veorq_u8(v.val[0], v.val[1]), veorq_u8(v.val[2], v.val[3])));
+        }
+    }
+    vst1q_u8(result_u8, acc);
+}
+void vst2q_s16_neon(int iterations) {
+    int16x8x2_t v = vld2q_s16(stereo);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            vst2q_s16(result_s16 + 16 * b, v);
+        }
+    }
+}
+void vst3q_u8_neon(int iterations) {
+    uint8x16x3_t v = vld3q_u8(rgb);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            vst3q_u8(result_u8 + 48 * b, v);
+        }
+    }
+}
+void vst4q_u8_neon(int iterations) {
+    uint8x16x4_t v = vld4q_u8(rgba);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            vst4q_u8(result_u8 + 64 * b, v);
+        }
+    }
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    void (*kernels[6])(int) = {vld2q_s16_neon, vld3q_u8_neon, vld4q_u8_neon,
+                               vst2q_s16_neon, vst3q_u8_neon, vst4q_u8_neon};
+    run_benchmarks("ARM-Neon", "", kernels);
+}
+
+#elif defined(RISCV_VECTOR)
+// Byte offsets of the elements of vector k of a group of n interleaved vectors,
+// (i * n + k) * sizeof(element) for element i
+#define INDEX_U8(n, k) \
+    __riscv_vadd_vx_u8m1(__riscv_vmul_vx_u8m1(__riscv_vid_v_u8m1(VLEN_16), (n), VLEN_16), (k), VLEN_16)
+#define INDEX_U16(n, k) \
+    __riscv_vadd_vx_u16m1(__riscv_vmul_vx_u16m1(__riscv_vid_v_u16m1(VLEN_8), 2 * (n), VLEN_8), 2 * (k), VLEN_8)
+
+// RISC-V Vector-specific implementation with the R-Halogen segment loads and stores
+void vld2q_s16_segment(int iterations) {
+    vint16m1_t acc = __riscv_vmv_v_x_i16m1(0, VLEN_8);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            int16x8x2_t v = vld2q_s16_rvv(stereo + 16 * b);
+            acc = __riscv_vxor_vv_i16m1(acc, __riscv_vxor_vv_i16m1(__riscv_vget_v_i16m1x2_i16m1(v, 0),
+                                                                  __riscv_vget_v_i16m1x2_i16m1(v, 1), VLEN_8), VLEN_8);
+        }
+    }
+    __riscv_vse16_v_i16m1(result_s16, acc, VLEN_8);
+}
+void vld3q_u8_segment(int iterations) {
+    vuint8m1_t acc = __riscv_vmv_v_x_u8m1(0, VLEN_16);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            uint8x16x3_t v = vld3q_u8_rvv(rgb + 48 * b);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vget_v_u8m1x3_u8m1(v, 0), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vget_v_u8m1x3_u8m1(v, 1), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vget_v_u8m1x3_u8m1(v, 2), VLEN_16);
+        }
+    }
+    __riscv_vse8_v_u8m1(result_u8, acc, VLEN_16);
+}
+void vld4q_u8_segment(int iterations) {
+    vuint8m1_t acc = __riscv_vmv_v_x_u8m1(0, VLEN_16);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            uint8x16x4_t v = vld4q_u8_rvv(rgba + 64 * b);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vget_v_u8m1x4_u8m1(v, 0), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vget_v_u8m1x4_u8m1(v, 1), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vget_v_u8m1x4_u8m1(v, 2), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vget_v_u8m1x4_u8m1(v, 3), VLEN_16);
+        }
+    }
+    __riscv_vse8_v_u8m1(result_u8, acc, VLEN_16);
+}
+void vst2q_s16_segment(int iterations) {
+    int16x8x2_t v = vld2q_s16_rvv(stereo);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            vst2q_s16_rvv(result_s16 + 16 * b, v);
+        }
+    }
+}
+void vst3q_u8_segment(int iterations) {
+    uint8x16x3_t v = vld3q_u8_rvv(rgb);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            vst3q_u8_rvv(result_u8 + 48 * b, v);
+        }
+    }
+}
+void vst4q_u8_segment(int iterations) {
+    uint8x16x4_t v = vld4q_u8_rvv(rgba);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            vst4q_u8_rvv(result_u8 + 64 * b, v);
+        }
+    }
+}
+
+// RISC-V Vector-specific naive implementation, one indexed load or store per vector of the
+// group, with the offsets computed once before the loop
+void vld2q_s16_gather(int iterations) {
+    vuint16m1_t index0 = INDEX_U16(2, 0), index1 = INDEX_U16(2, 1);
+    vint16m1_t acc = __riscv_vmv_v_x_i16m1(0, VLEN_8);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            const int16_t *p = stereo + 16 * b;
+            acc = __riscv_vxor_vv_i16m1(acc, __riscv_vxor_vv_i16m1(__riscv_vluxei16_v_i16m1(p, index0, VLEN_8),
+                                                                  __riscv_vluxei16_v_i16m1(p, index1, VLEN_8), VLEN_8), VLEN_8);
+        }
+    }
+    __riscv_vse16_v_i16m1(result_s16, acc, VLEN_8);
+}
+void vld3q_u8_gather(int iterations) {
+    vuint8m1_t index0 = INDEX_U8(3, 0), index1 = INDEX_U8(3, 1), index2 = INDEX_U8(3, 2);
+    vuint8m1_t acc = __riscv_vmv_v_x_u8m1(0, VLEN_16);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            const uint8_t *p = rgb + 48 * b;
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vluxei8_v_u8m1(p, index0, VLEN_16), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vluxei8_v_u8m1(p, index1, VLEN_16), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vluxei8_v_u8m1(p, index2, VLEN_16), VLEN_16);
+        }
+    }
+    __riscv_vse8_v_u8m1(result_u8, acc, VLEN_16);
+}
+void vld4q_u8_gather(int iterations) {
+    vuint8m1_t index0 = INDEX_U8(4, 0), index1 = INDEX_U8(4, 1), index2 = INDEX_U8(4, 2), index3 = INDEX_U8(4, 3);
+    vuint8m1_t acc = __riscv_vmv_v_x_u8m1(0, VLEN_16);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            const uint8_t *p = rgba + 64 * b;
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vluxei8_v_u8m1(p, index0, VLEN_16), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vluxei8_v_u8m1(p, index1, VLEN_16), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vluxei8_v_u8m1(p, index2, VLEN_16), VLEN_16);
+            acc = __riscv_vxor_vv_u8m1(acc, __riscv_vluxei8_v_u8m1(p, index3, VLEN_16), VLEN_16);
+        }
+    }
+    __riscv_vse8_v_u8m1(result_u8, acc, VLEN_16);
+}
+void vst2q_s16_scatter(int iterations) {
+    vuint16m1_t index0 = INDEX_U16(2, 0), index1 = INDEX_U16(2, 1);
+    int16x8x2_t v = vld2q_s16_rvv(stereo);
+    vint16m1_t v0 = __riscv_vget_v_i16m1x2_i16m1(v, 0), v1 = __riscv_vget_v_i16m1x2_i16m1(v, 1);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            int16_t *p = result_s16 + 16 * b;
+            __riscv_vsuxei16_v_i16m1(p, index0, v0, VLEN_8);
+            __riscv_vsuxei16_v_i16m1(p, index1, v1, VLEN_8);
+        }
+    }
+}
+void vst3q_u8_scatter(int iterations) {
+    vuint8m1_t index0 = INDEX_U8(3, 0), index1 = INDEX_U8(3, 1), index2 = INDEX_U8(3, 2);
+    uint8x16x3_t v = vld3q_u8_rvv(rgb);
+    vuint8m1_t v0 = __riscv_vget_v_u8m1x3_u8m1(v, 0), v1 = __riscv_vget_v_u8m1x3_u8m1(v, 1);
+    vuint8m1_t v2 = __riscv_vget_v_u8m1x3_u8m1(v, 2);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            uint8_t *p = result_u8 + 48 * b;
+            __riscv_vsuxei8_v_u8m1(p, index0, v0, VLEN_16);
+            __riscv_vsuxei8_v_u8m1(p, index1, v1, VLEN_16);
+            __riscv_vsuxei8_v_u8m1(p, index2, v2, VLEN_16);
+        }
+    }
+}
+void vst4q_u8_scatter(int iterations) {
+    vuint8m1_t index0 = INDEX_U8(4, 0), index1 = INDEX_U8(4, 1), index2 = INDEX_U8(4, 2), index3 = INDEX_U8(4, 3);
+    uint8x16x4_t v = vld4q_u8_rvv(rgba);
+    vuint8m1_t v0 = __riscv_vget_v_u8m1x4_u8m1(v, 0), v1 = __riscv_vget_v_u8m1x4_u8m1(v, 1);
+    vuint8m1_t v2 = __riscv_vget_v_u8m1x4_u8m1(v, 2), v3 = __riscv_vget_v_u8m1x4_u8m1(v, 3);
+    for (int i = 0; i < iterations; i++) {
+        for (int b = 0; b < NUM_BLOCKS; b++) {
+            uint8_t *p = result_u8 + 64 * b;
+            __riscv_vsuxei8_v_u8m1(p, index0, v0, VLEN_16);
+            __riscv_vsuxei8_v_u8m1(p, index1, v1, VLEN_16);
+            __riscv_vsuxei8_v_u8m1(p, index2, v2, VLEN_16);
+            __riscv_vsuxei8_v_u8m1(p, index3, v3, VLEN_16);
+        }
+    }
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    void (*segment[6])(int) = {vld2q_s16_segment, vld3q_u8_segment, vld4q_u8_segment,
+                               vst2q_s16_segment, vst3q_u8_segment, vst4q_u8_segment};
+    void (*indexed[6])(int) = {vld2q_s16_gather, vld3q_u8_gather, vld4q_u8_gather,
+                               vst2q_s16_scatter, vst3q_u8_scatter, vst4q_u8_scatter};
+    run_benchmarks("RISC-V", "", segment);
+    run_benchmarks("RISC-V", "_indexed", indexed);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
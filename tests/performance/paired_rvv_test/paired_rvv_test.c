@@ -0,0 +1,119 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Per-op cost of vaddq_u8, one 128-bit vector per op against a pair of them per op
+// (vaddq_u8_x2), both reported per 128-bit vector. The paired variant only runs when
+// VLEN >= 256; on spike compare SPIKE_VARCH=vlen:128,elen:64, vlen:256,elen:64 and
+// vlen:512,elen:64.
+
+// Operands and result of the benchmarks, a pair of 128-bit vectors; the kernels load
+// them once and keep the vectors in registers for all iterations
+uint8_t bench_a[32] = {255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0,
+                       1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+uint8_t bench_b[32] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16,
+                       97, 31, 97, 31, 97, 31, 97, 31, 97, 31, 97, 31, 97, 31, 97, 31};
+uint8_t bench_result[32];
+
+// Function to run the latency and throughput benchmarks with the given kernels, each
+// call of which processes the given number of 128-bit vectors
+void run_benchmarks(const char *arch, const char *function, const char *type, int vectors,
+                    void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, function, type, 16 * vectors, "latency", latency, vectors);
+    bench_run(arch, function, type, 16 * vectors, "throughput", throughput, vectors * BENCH_STREAMS);
+    print_results(bench_result, 16 * vectors, UINT8);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vaddq_u8 depends on the previous one
+void vaddq_u8_latency_neon(int iterations) {
+    uint8x16_t x = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_u8(x, y);
+    }
+    vst1q_u8(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddq_u8 per iteration
+void vaddq_u8_throughput_neon(int iterations) {
+    uint8x16_t x0 = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    uint8x16_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_u8(x0, y);
+        x1 = vaddq_u8(x1, y);
+        x2 = vaddq_u8(x2, y);
+        x3 = vaddq_u8(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_u8(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", "vaddq_u8", "uint8x16_t", 1, vaddq_u8_latency_neon, vaddq_u8_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// Latency and throughput kernels of fn on vectors of vl bytes
+#define BENCH_KERNELS(name, fn, type, vl)                                       \
+    void name##_latency_rvvector(int iterations) {                              \
+        type x = __riscv_vle8_v_u8m1(bench_a, vl);                              \
+        type y = __riscv_vle8_v_u8m1(bench_b, vl);                              \
+        for (int i = 0; i < iterations; i++) {                                  \
+            x = fn(x, y);                                                       \
+        }                                                                       \
+        __riscv_vse8_v_u8m1(bench_result, x, vl);                               \
+    }                                                                           \
+    void name##_throughput_rvvector(int iterations) {                           \
+        type x0 = __riscv_vle8_v_u8m1(bench_a, vl);                             \
+        type y = __riscv_vle8_v_u8m1(bench_b, vl);                              \
+        type x1 = x0, x2 = x0, x3 = x0;                                         \
+        for (int i = 0; i < iterations; i++) {                                  \
+            x0 = fn(x0, y);                                                     \
+            x1 = fn(x1, y);                                                     \
+            x2 = fn(x2, y);                                                     \
+            x3 = fn(x3, y);                                                     \
+        }                                                                       \
+        bench_opaque(x1);                                                       \
+        bench_opaque(x2);                                                       \
+        bench_opaque(x3);                                                       \
+        __riscv_vse8_v_u8m1(bench_result, x0, vl);                              \
+    }
+
+// RISC-V Vector-specific implementations, one 128-bit vector and a pair of them per call
+BENCH_KERNELS(vaddq_u8, vaddq_u8_rvv, uint8x16_t, VLEN_16)
+BENCH_KERNELS(vaddq_u8_x2, vaddq_u8_x2_rvv, uint8x32_t, VLEN_32)
+
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", "vaddq_u8", "uint8x16_t", 1, vaddq_u8_latency_rvvector, vaddq_u8_throughput_rvvector);
+    if (rhal_paired_supported()) {
+        run_benchmarks("RISC-V", "vaddq_u8_x2", "uint8x32_t", 2,
+                       vaddq_u8_x2_latency_rvvector, vaddq_u8_x2_throughput_rvvector);
+    } else {
+        bench_unsupported("RISC-V", "vaddq_u8_x2", "uint8x32_t", 32, "VLEN >= 256");
+    }
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,168 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Per-op cost of the cumulative saturation flag. Build once by default and once with
+// RHAL_QC=1: the saturating kernels are the same, the flag is read once after them
+// (lazy, reported with a "_qc" suffix), and the eager variant reading it after every op
+// ("_qc_eager") shows the cost that is avoided.
+
+// Operands and result of the benchmarked vqaddq_s16, which saturate in every op; the
+// kernels load them once and keep the vectors in registers for all iterations
+int16_t bench_a[8] = {32767, -32768, 32767, -32768, 32000, -32000, 1, -1};
+int16_t bench_b[8] = {1, -1, 32767, -32768, 1000, -1000, 2, -2};
+int16_t bench_result[8];
+
+// Number of flag reads that found the flag set, which keeps the reads alive
+int qc_reads;
+
+// Function to run the latency and throughput benchmarks with the given kernels, the flag
+// mode as suffix of the function name
+void run_benchmarks(const char *arch, const char *suffix, void (*latency)(int), void (*throughput)(int)) {
+    char name[32];
+
+    qc_reads = 0;
+    snprintf(name, sizeof(name), "vqaddq_s16%s", suffix);
+    bench_run(arch, name, "int16x8_t", 8, "latency", latency, 1);
+    bench_run(arch, name, "int16x8_t", 8, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 8, INT16);
+    printf("QC set in %d reads\n", qc_reads);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vqaddq_s16 depends on the previous one
+void vqaddq_s16_latency_neon(int iterations) {
+    int16x8_t x = vld1q_s16(bench_a);
+    int16x8_t y = vld1q_s16(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vqaddq_s16(x, y);
+    }
+    vst1q_s16(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vqaddq_s16 per iteration
+void vqaddq_s16_throughput_neon(int iterations) {
+    int16x8_t x0 = vld1q_s16(bench_a);
+    int16x8_t y = vld1q_s16(bench_b);
+    int16x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vqaddq_s16(x0, y);
+        x1 = vqaddq_s16(x1, y);
+        x2 = vqaddq_s16(x2, y);
+        x3 = vqaddq_s16(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_s16(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", "", vqaddq_s16_latency_neon, vqaddq_s16_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, each vqaddq_s16_rvv depends on the previous one,
+// with the flag read once after the loop
+void vqaddq_s16_latency_rvvector(int iterations) {
+    #if defined(RHAL_QC)
+        rhal_clear_qc();
+    #endif
+    int16x8_t x = __riscv_vle16_v_i16m1(bench_a, VLEN_8);
+    int16x8_t y = __riscv_vle16_v_i16m1(bench_b, VLEN_8);
+    for (int i = 0; i < iterations; i++) {
+        x = vqaddq_s16_rvv(x, y);
+    }
+    __riscv_vse16_v_i16m1(bench_result, x, VLEN_8);
+    #if defined(RHAL_QC)
+        qc_reads += rhal_get_qc();
+    #endif
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vqaddq_s16_rvv per
+// iteration, with the flag read once after the loop
+void vqaddq_s16_throughput_rvvector(int iterations) {
+    #if defined(RHAL_QC)
+        rhal_clear_qc();
+    #endif
+    int16x8_t x0 = __riscv_vle16_v_i16m1(bench_a, VLEN_8);
+    int16x8_t y = __riscv_vle16_v_i16m1(bench_b, VLEN_8);
+    int16x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vqaddq_s16_rvv(x0, y);
+        x1 = vqaddq_s16_rvv(x1, y);
+        x2 = vqaddq_s16_rvv(x2, y);
+        x3 = vqaddq_s16_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse16_v_i16m1(bench_result, x0, VLEN_8);
+    #if defined(RHAL_QC)
+        qc_reads += rhal_get_qc();
+    #endif
+}
+#if defined(RHAL_QC)
+// vqaddq_s16_rvv with the flag cleared before it and read after it
+static inline int16x8_t vqaddq_s16_eager(int16x8_t a, int16x8_t b) {
+    rhal_clear_qc();
+    int16x8_t result = vqaddq_s16_rvv(a, b);
+    qc_reads += rhal_get_qc();
+    return result;
+}
+// RISC-V Vector-specific implementation, each vqaddq_s16_rvv depends on the previous one,
+// with the flag read after every op
+void vqaddq_s16_eager_latency_rvvector(int iterations) {
+    int16x8_t x = __riscv_vle16_v_i16m1(bench_a, VLEN_8);
+    int16x8_t y = __riscv_vle16_v_i16m1(bench_b, VLEN_8);
+    for (int i = 0; i < iterations; i++) {
+        x = vqaddq_s16_eager(x, y);
+    }
+    __riscv_vse16_v_i16m1(bench_result, x, VLEN_8);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vqaddq_s16_rvv per
+// iteration, with the flag read after every op
+void vqaddq_s16_eager_throughput_rvvector(int iterations) {
+    int16x8_t x0 = __riscv_vle16_v_i16m1(bench_a, VLEN_8);
+    int16x8_t y = __riscv_vle16_v_i16m1(bench_b, VLEN_8);
+    int16x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vqaddq_s16_eager(x0, y);
+        x1 = vqaddq_s16_eager(x1, y);
+        x2 = vqaddq_s16_eager(x2, y);
+        x3 = vqaddq_s16_eager(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse16_v_i16m1(bench_result, x0, VLEN_8);
+}
+#endif
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    #if defined(RHAL_QC)
+        run_benchmarks("RISC-V", "_qc", vqaddq_s16_latency_rvvector, vqaddq_s16_throughput_rvvector);
+        run_benchmarks("RISC-V", "_qc_eager", vqaddq_s16_eager_latency_rvvector, vqaddq_s16_eager_throughput_rvvector);
+    #else
+        run_benchmarks("RISC-V", "", vqaddq_s16_latency_rvvector, vqaddq_s16_throughput_rvvector);
+    #endif
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,181 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #if defined(RHAL_INLINE)
+        #include "rhal.h"
+    #else
+        #include "rhal_base.h"
+    #endif
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Per-op cost of the library in a hot loop, for a single vaddq_u8 and for a chain of four
+// dependent operations (vaddq_u8, vqaddq_u8, vhaddq_u8, vsubq_u8). Build once with
+// RHAL_INLINE=0 (out-of-line librhal calls) and once with RHAL_INLINE=1 (header-only API,
+// reported with an "_inline" suffix) and compare the results.
+#define OPS_PER_CHAIN 4
+
+// Operands and result of the benchmarks; the kernels load them once and keep the
+// vectors in registers for all iterations
+uint8_t bench_a[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+uint8_t bench_b[16] = {255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240};
+uint8_t bench_result[16];
+
+// Function to run the latency and throughput benchmarks of the single op and of the op
+// chain with the given kernels, the build mode as suffix of the function names
+void run_benchmarks(const char *arch, const char *suffix, void (*kernels[4])(int)) {
+    char name[32];
+
+    snprintf(name, sizeof(name), "vaddq_u8%s", suffix);
+    bench_run(arch, name, "uint8x16_t", 16, "latency", kernels[0], 1);
+    bench_run(arch, name, "uint8x16_t", 16, "throughput", kernels[1], BENCH_STREAMS);
+    print_results(bench_result, 16, UINT8);
+    snprintf(name, sizeof(name), "op_chain%s", suffix);
+    bench_run(arch, name, "uint8x16_t", 16, "latency", kernels[2], OPS_PER_CHAIN);
+    bench_run(arch, name, "uint8x16_t", 16, "throughput", kernels[3], OPS_PER_CHAIN * BENCH_STREAMS);
+    print_results(bench_result, 16, UINT8);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vaddq_u8 depends on the previous one
+void vaddq_u8_latency_neon(int iterations) {
+    uint8x16_t x = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_u8(x, y);
+    }
+    vst1q_u8(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddq_u8 per iteration
+void vaddq_u8_throughput_neon(int iterations) {
+    uint8x16_t x0 = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    uint8x16_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_u8(x0, y);
+        x1 = vaddq_u8(x1, y);
+        x2 = vaddq_u8(x2, y);
+        x3 = vaddq_u8(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_u8(bench_result, x0);
+}
+// One step of the op chain, each op depending on the previous one
+#define OP_CHAIN_NEON(x, a, y) vsubq_u8(vhaddq_u8(vqaddq_u8(vaddq_u8(x, y), y), a), y)
+// ARM Neon-specific implementation, each op chain depends on the previous one
+void op_chain_latency_neon(int iterations) {
+    uint8x16_t a = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    uint8x16_t x = a;
+    for (int i = 0; i < iterations; i++) {
+        x = OP_CHAIN_NEON(x, a, y);
+    }
+    vst1q_u8(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent op chains per iteration
+void op_chain_throughput_neon(int iterations) {
+    uint8x16_t a = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    uint8x16_t x0 = a, x1 = a, x2 = a, x3 = a;
+    for (int i = 0; i < iterations; i++) {
+        x0 = OP_CHAIN_NEON(x0, a, y);
+        x1 = OP_CHAIN_NEON(x1, a, y);
+        x2 = OP_CHAIN_NEON(x2, a, y);
+        x3 = OP_CHAIN_NEON(x3, a, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_u8(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    void (*kernels[4])(int) = {vaddq_u8_latency_neon, vaddq_u8_throughput_neon,
+                               op_chain_latency_neon, op_chain_throughput_neon};
+    run_benchmarks("ARM-Neon", "", kernels);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, each vaddq_u8_rvv depends on the previous one
+void vaddq_u8_latency_rvvector(int iterations) {
+    uint8x16_t x = __riscv_vle8_v_u8m1(bench_a, VLEN_16);
+    uint8x16_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_16);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_u8_rvv(x, y);
+    }
+    __riscv_vse8_v_u8m1(bench_result, x, VLEN_16);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vaddq_u8_rvv per iteration
+void vaddq_u8_throughput_rvvector(int iterations) {
+    uint8x16_t x0 = __riscv_vle8_v_u8m1(bench_a, VLEN_16);
+    uint8x16_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_16);
+    uint8x16_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_u8_rvv(x0, y);
+        x1 = vaddq_u8_rvv(x1, y);
+        x2 = vaddq_u8_rvv(x2, y);
+        x3 = vaddq_u8_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse8_v_u8m1(bench_result, x0, VLEN_16);
+}
+// One step of the op chain, each op depending on the previous one
+#define OP_CHAIN_RVV(x, a, y) vsubq_u8_rvv(vhaddq_u8_rvv(vqaddq_u8_rvv(vaddq_u8_rvv(x, y), y), a), y)
+// RISC-V Vector-specific implementation, each op chain depends on the previous one
+void op_chain_latency_rvvector(int iterations) {
+    uint8x16_t a = __riscv_vle8_v_u8m1(bench_a, VLEN_16);
+    uint8x16_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_16);
+    uint8x16_t x = a;
+    for (int i = 0; i < iterations; i++) {
+        x = OP_CHAIN_RVV(x, a, y);
+    }
+    __riscv_vse8_v_u8m1(bench_result, x, VLEN_16);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent op chains per iteration
+void op_chain_throughput_rvvector(int iterations) {
+    uint8x16_t a = __riscv_vle8_v_u8m1(bench_a, VLEN_16);
+    uint8x16_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_16);
+    uint8x16_t x0 = a, x1 = a, x2 = a, x3 = a;
+    for (int i = 0; i < iterations; i++) {
+        x0 = OP_CHAIN_RVV(x0, a, y);
+        x1 = OP_CHAIN_RVV(x1, a, y);
+        x2 = OP_CHAIN_RVV(x2, a, y);
+        x3 = OP_CHAIN_RVV(x3, a, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse8_v_u8m1(bench_result, x0, VLEN_16);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    void (*kernels[4])(int) = {vaddq_u8_latency_rvvector, vaddq_u8_throughput_rvvector,
+                               op_chain_latency_rvvector, op_chain_throughput_rvvector};
+    #if defined(RHAL_INLINE)
+        run_benchmarks("RISC-V", "_inline", kernels);
+    #else
+        run_benchmarks("RISC-V", "", kernels);
+    #endif
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Per-op cost of the tail policy of a 128-bit operation. The difference only shows when
+// VLEN > 128, e.g. on the bpif3 (VLEN=256) or on spike with SPIKE_VARCH=vlen:256,elen:64.
+
+// Operands and result of the benchmarked vaddq_u8; the kernels load them once and
+// keep the vectors in registers for all iterations
+uint8_t bench_a[16] = {255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0};
+uint8_t bench_b[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+uint8_t bench_result[16];
+
+// Function to run the latency and throughput benchmarks of one variant with the given
+// kernels, the variant as suffix of the function name (e.g. "_tu")
+void run_benchmarks(const char *arch, const char *suffix, void (*latency)(int), void (*throughput)(int)) {
+    char name[32];
+
+    snprintf(name, sizeof(name), "vaddq_u8%s", suffix);
+    bench_run(arch, name, "uint8x16_t", 16, "latency", latency, 1);
+    bench_run(arch, name, "uint8x16_t", 16, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 16, UINT8);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vaddq_u8 depends on the previous one
+void vaddq_u8_latency_neon(int iterations) {
+    uint8x16_t x = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_u8(x, y);
+    }
+    vst1q_u8(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddq_u8 per iteration
+void vaddq_u8_throughput_neon(int iterations) {
+    uint8x16_t x0 = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    uint8x16_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_u8(x0, y);
+        x1 = vaddq_u8(x1, y);
+        x2 = vaddq_u8(x2, y);
+        x3 = vaddq_u8(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_u8(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", "", vaddq_u8_latency_neon, vaddq_u8_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// Tail-undisturbed variant of the library function, kept out-of-line like it
+__attribute__((noinline)) uint8x16_t vaddq_u8_tu(uint8x16_t a, uint8x16_t b) {
+    return __riscv_vadd_vv_u8m1_tu(a, a, b, VLEN_16);
+}
+
+// Latency and throughput kernels of fn on vectors of vl bytes
+#define BENCH_KERNELS(name, fn, type, vl)                                       \
+    void name##_latency_rvvector(int iterations) {                              \
+        type x = __riscv_vle8_v_u8m1(bench_a, vl);                              \
+        type y = __riscv_vle8_v_u8m1(bench_b, vl);                              \
+        for (int i = 0; i < iterations; i++) {                                  \
+            x = fn(x, y);                                                       \
+        }                                                                       \
+        __riscv_vse8_v_u8m1(bench_result, x, vl);                               \
+    }                                                                           \
+    void name##_throughput_rvvector(int iterations) {                           \
+        type x0 = __riscv_vle8_v_u8m1(bench_a, vl);                             \
+        type y = __riscv_vle8_v_u8m1(bench_b, vl);                              \
+        type x1 = x0, x2 = x0, x3 = x0;                                         \
+        for (int i = 0; i < iterations; i++) {                                  \
+            x0 = fn(x0, y);                                                     \
+            x1 = fn(x1, y);                                                     \
+            x2 = fn(x2, y);                                                     \
+            x3 = fn(x3, y);                                                     \
+        }                                                                       \
+        bench_opaque(x1);                                                       \
+        bench_opaque(x2);                                                       \
+        bench_opaque(x3);                                                       \
+        __riscv_vse8_v_u8m1(bench_result, x0, vl);                              \
+    }
+
+// RISC-V Vector-specific implementations, the library function (tail agnostic) and the
+// tail-undisturbed variant
+BENCH_KERNELS(vaddq_u8, vaddq_u8_rvv, uint8x16_t, VLEN_16)
+BENCH_KERNELS(vaddq_u8_tu, vaddq_u8_tu, uint8x16_t, VLEN_16)
+
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", "_tu", vaddq_u8_tu_latency_rvvector, vaddq_u8_tu_throughput_rvvector);
+    run_benchmarks("RISC-V", "", vaddq_u8_latency_rvvector, vaddq_u8_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
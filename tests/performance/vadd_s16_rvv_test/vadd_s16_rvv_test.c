@@ -1,6 +1,9 @@
 // Copyright 2024 10xEngineers
 
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
 #include "common_utilities.h"
+#include "benchmark.h"
 
 #if defined(ARM_NEON)
     #include <arm_neon.h>
@@ -10,71 +13,97 @@
     #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
 #endif
 
-// Function to run test cases with a given vect_add
-void run_test_cases(void (*vect_add)(int16_t*, int16_t*, int, int16_t*)) {
-    int16_t test_cases[][4] = {
-        {1, 2, 3, 4},                    // Regular positive numbers
-        {0, 0, 0, 0},                    // All zeros
-        {-1, -2, -3, -4},                // Negative numbers
-        {32767, 32767, 32767, 32767},    // Maximum int16_t value
-        {-32768, -32768, -32768, -32768},   // Minimum int16_t value
-        {32767, -32768, 32767, -32768},  // Max and Min int16_t values
-        {5000, -5000, 10000, -10000},    // Mixed positive and negative numbers
-        {1, 1, 1, 1}                     // All ones
-    };
-
-    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-
-    for (int i = 0; i < num_tests; i++) {
-        int16_t *a = test_cases[i];
-        int16_t b[4] = {1, 2, 3, 4};
-        int16_t result[4];
+// Operands and result of the benchmarked vadd_s16; the kernels load them once and
+// keep the vectors in registers for all iterations
+int16_t bench_a[4] = {1, 2, 3, 4};
+int16_t bench_b[4] = {1, 2, 3, 4};
+int16_t bench_result[4];
 
-        // Measure the time taken for the vector addition operation
-        struct timespec start, end;
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        vect_add(a, b, 4, result);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-        printf("Test case %d {Vector load, Vector function, Vector store} took %.2f microseconds\n",i + 1, time_taken);
-        // print_results(result, 4, "int16_t");
-    }
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vadd_s16", "int16x4_t", 4, "latency", latency, 1);
+    bench_run(arch, "vadd_s16", "int16x4_t", 4, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 4, INT16);
 }
 
 #if defined(ARM_NEON)
-// ARM Neon-specific implementation
-void vadd_s16_neon(int16_t *a, int16_t *b, int size, int16_t *result) {
-    int16x4_t x = vld1_s16(a);
-    int16x4_t y = vld1_s16(b);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int16x4_t z = vadd_s16(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("ARM-Neon vector function 'vadd_s16' took %.2f microseconds\n", time_taken);
-    vst1_s16(result, z);
+// ARM Neon-specific implementation, each vadd_s16 depends on the previous one
+void vadd_s16_latency_neon(int iterations) {
+    int16x4_t x = vld1_s16(bench_a);
+    int16x4_t y = vld1_s16(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vadd_s16(x, y);
+    }
+    vst1_s16(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vadd_s16 per iteration
+void vadd_s16_throughput_neon(int iterations) {
+    int16x4_t x0 = vld1_s16(bench_a);
+    int16x4_t y = vld1_s16(bench_b);
+    int16x4_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vadd_s16(x0, y);
+        x1 = vadd_s16(x1, y);
+        x2 = vadd_s16(x2, y);
+        x3 = vadd_s16(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1_s16(bench_result, x0);
 }
 // Function to run tests using ARM Neon instructions/intrinsics
 void run_tests_neon() {
-    run_test_cases(vadd_s16_neon);
+    run_benchmarks("ARM-Neon", vadd_s16_latency_neon, vadd_s16_throughput_neon);
 }
 
 #elif defined(RISCV_VECTOR)
-// RISC-V Vector-specific implementation
-void vadd_s16_rvvector(int16_t *a, int16_t *b, int size, int16_t *result) {
-    int16x4_t x = __riscv_vle16_v_i16m1(a, size);
-    int16x4_t y = __riscv_vle16_v_i16m1(b, size);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int16x4_t z = vadd_s16_rvv(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("RISC-V vector function 'vadd_s16_rvv' took %.2f microseconds\n", time_taken);
-    __riscv_vse16_v_i16m1(result, z, size);
+// RISC-V Vector-specific implementation, each vadd_s16_rvv depends on the previous one
+void vadd_s16_latency_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t x = __riscv_vle16_v_i16mf2(bench_a, VLEN_4);
+        int16x4_t y = __riscv_vle16_v_i16mf2(bench_b, VLEN_4);
+    #else
+        int16x4_t x = __riscv_vle16_v_i16m1(bench_a, VLEN_4);
+        int16x4_t y = __riscv_vle16_v_i16m1(bench_b, VLEN_4);
+    #endif
+    for (int i = 0; i < iterations; i++) {
+        x = vadd_s16_rvv(x, y);
+    }
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_i16mf2(bench_result, x, VLEN_4);
+    #else
+        __riscv_vse16_v_i16m1(bench_result, x, VLEN_4);
+    #endif
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vadd_s16_rvv per iteration
+void vadd_s16_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t x0 = __riscv_vle16_v_i16mf2(bench_a, VLEN_4);
+        int16x4_t y = __riscv_vle16_v_i16mf2(bench_b, VLEN_4);
+    #else
+        int16x4_t x0 = __riscv_vle16_v_i16m1(bench_a, VLEN_4);
+        int16x4_t y = __riscv_vle16_v_i16m1(bench_b, VLEN_4);
+    #endif
+    int16x4_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vadd_s16_rvv(x0, y);
+        x1 = vadd_s16_rvv(x1, y);
+        x2 = vadd_s16_rvv(x2, y);
+        x3 = vadd_s16_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_i16mf2(bench_result, x0, VLEN_4);
+    #else
+        __riscv_vse16_v_i16m1(bench_result, x0, VLEN_4);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
-    run_test_cases(vadd_s16_rvvector);
+    run_benchmarks("RISC-V", vadd_s16_latency_rvvector, vadd_s16_throughput_rvvector);
 }
 #endif
 
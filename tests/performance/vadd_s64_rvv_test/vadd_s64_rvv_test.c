@@ -1,6 +1,9 @@
 // Copyright 2024 10xEngineers
 
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
 #include "common_utilities.h"
+#include "benchmark.h"
 
 #if defined(ARM_NEON)
     #include <arm_neon.h>
@@ -10,71 +13,79 @@
     #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
 #endif
 
-// Function to run test cases with a given vect_add
-void run_test_cases(void (*vect_add)(int64_t*, int64_t*, int, int64_t*)) {
-    int64_t test_cases[][1] = {
-        {1},                        // Regular positive numbers
-        {0},                        // All zeros
-        {-1},                       // Negative numbers
-        {9223372036854775807LL},        // Maximum int64_t value
-        {-9223372036854775807LL - 1},   // Minimum int64_t value
-        {5000},                     // Mixed positive number
-        {-5000},                    // Mixed negative number
-        {1}                         // All ones
-    };
-
-    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-
-    for (int i = 0; i < num_tests; i++) {
-        int64_t *a = test_cases[i];
-        int64_t b[1] = {1};
-        int64_t result[1];
+// Operands and result of the benchmarked vadd_s64; the kernels load them once and
+// keep the vectors in registers for all iterations
+int64_t bench_a[1] = {1};
+int64_t bench_b[1] = {1};
+int64_t bench_result[1];
 
-        // Measure the time taken for the vector addition operation
-        struct timespec start, end;
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        vect_add(a, b, 1, result);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-        printf("Test case %d {Vector load, Vector function, Vector store} took %.2f microseconds\n",i + 1, time_taken);
-        // print_results(result, 1, "int64_t");
-    }
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vadd_s64", "int64x1_t", 1, "latency", latency, 1);
+    bench_run(arch, "vadd_s64", "int64x1_t", 1, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 1, INT64);
 }
 
 #if defined(ARM_NEON)
-// ARM Neon-specific implementation
-void vadd_s64_neon(int64_t *a, int64_t *b, int size, int64_t *result) {
-    int64x1_t x = vld1_s64(a);
-    int64x1_t y = vld1_s64(b);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int64x1_t z = vadd_s64(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("ARM-Neon vector function 'vadd_s64' took %.2f microseconds\n", time_taken);
-    vst1_s64(result, z);
+// ARM Neon-specific implementation, each vadd_s64 depends on the previous one
+void vadd_s64_latency_neon(int iterations) {
+    int64x1_t x = vld1_s64(bench_a);
+    int64x1_t y = vld1_s64(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vadd_s64(x, y);
+    }
+    vst1_s64(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vadd_s64 per iteration
+void vadd_s64_throughput_neon(int iterations) {
+    int64x1_t x0 = vld1_s64(bench_a);
+    int64x1_t y = vld1_s64(bench_b);
+    int64x1_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vadd_s64(x0, y);
+        x1 = vadd_s64(x1, y);
+        x2 = vadd_s64(x2, y);
+        x3 = vadd_s64(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1_s64(bench_result, x0);
 }
 // Function to run tests using ARM Neon instructions/intrinsics
 void run_tests_neon() {
-    run_test_cases(vadd_s64_neon);
+    run_benchmarks("ARM-Neon", vadd_s64_latency_neon, vadd_s64_throughput_neon);
 }
 
 #elif defined(RISCV_VECTOR)
-// RISC-V Vector-specific implementation
-void vadd_s64_rvvector(int64_t *a, int64_t *b, int size, int64_t *result) {
-    int64x1_t x = __riscv_vle64_v_i64m1(a, size);
-    int64x1_t y = __riscv_vle64_v_i64m1(b, size);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int64x1_t z = vadd_s64_rvv(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("RISC-V vector function 'vadd_s64_rvv' took %.2f microseconds\n", time_taken);
-    __riscv_vse64_v_i64m1(result, z, size);
+// RISC-V Vector-specific implementation, each vadd_s64_rvv depends on the previous one
+void vadd_s64_latency_rvvector(int iterations) {
+    int64x1_t x = __riscv_vle64_v_i64m1(bench_a, VLEN_1);
+    int64x1_t y = __riscv_vle64_v_i64m1(bench_b, VLEN_1);
+    for (int i = 0; i < iterations; i++) {
+        x = vadd_s64_rvv(x, y);
+    }
+    __riscv_vse64_v_i64m1(bench_result, x, VLEN_1);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vadd_s64_rvv per iteration
+void vadd_s64_throughput_rvvector(int iterations) {
+    int64x1_t x0 = __riscv_vle64_v_i64m1(bench_a, VLEN_1);
+    int64x1_t y = __riscv_vle64_v_i64m1(bench_b, VLEN_1);
+    int64x1_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vadd_s64_rvv(x0, y);
+        x1 = vadd_s64_rvv(x1, y);
+        x2 = vadd_s64_rvv(x2, y);
+        x3 = vadd_s64_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse64_v_i64m1(bench_result, x0, VLEN_1);
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
-    run_test_cases(vadd_s64_rvvector);
+    run_benchmarks("RISC-V", vadd_s64_latency_rvvector, vadd_s64_throughput_rvvector);
 }
 #endif
 
@@ -1,6 +1,9 @@
 // Copyright 2024 10xEngineers
 
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
 #include "common_utilities.h"
+#include "benchmark.h"
 
 #if defined(ARM_NEON)
     #include <arm_neon.h>
@@ -10,71 +13,97 @@
     #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
 #endif
 
-// Function to run test cases with a given vect_add
-void run_test_cases(void (*vect_add)(uint32_t*, uint32_t*, int, uint32_t*)) {
-    uint32_t test_cases[][2] = {
-        {1, 2},                                  // Regular positive numbers
-        {0, 0},                                  // All zeros
-        {4294967295U, 4294967294U},              // Near maximum uint32_t values
-        {4294967295U, 4294967295U},              // Maximum uint32_t value
-        {1, 0},                                  // Mixed near boundary values
-        {500000, 500000},                        // Repeated positive numbers
-        {4000000000U, 1000000000U},              // Arbitrary mixed values
-        {1, 1}                                   // All ones
-    };
-
-    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-
-    for (int i = 0; i < num_tests; i++) {
-        uint32_t *a = test_cases[i];
-        uint32_t b[2] = {1, 2};
-        uint32_t result[2];
+// Operands and result of the benchmarked vadd_u32; the kernels load them once and
+// keep the vectors in registers for all iterations
+uint32_t bench_a[2] = {1, 2};
+uint32_t bench_b[2] = {1, 2};
+uint32_t bench_result[2];
 
-        // Measure the time taken for the vector addition operation
-        struct timespec start, end;
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        vect_add(a, b, 2, result);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-        printf("Test case %d {Vector load, Vector function, Vector store} took %.2f microseconds\n",i + 1, time_taken);
-        // print_results(result, 2, "uint32_t");
-    }
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vadd_u32", "uint32x2_t", 2, "latency", latency, 1);
+    bench_run(arch, "vadd_u32", "uint32x2_t", 2, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 2, UINT32);
 }
 
 #if defined(ARM_NEON)
-// ARM Neon-specific implementation
-void vadd_u32_neon(uint32_t *a, uint32_t *b, int size, uint32_t *result) {
-    uint32x2_t x = vld1_u32(a);
-    uint32x2_t y = vld1_u32(b);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    uint32x2_t z = vadd_u32(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("ARM-Neon vector function 'vadd_u32' took %.2f microseconds\n", time_taken);
-    vst1_u32(result, z);
+// ARM Neon-specific implementation, each vadd_u32 depends on the previous one
+void vadd_u32_latency_neon(int iterations) {
+    uint32x2_t x = vld1_u32(bench_a);
+    uint32x2_t y = vld1_u32(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vadd_u32(x, y);
+    }
+    vst1_u32(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vadd_u32 per iteration
+void vadd_u32_throughput_neon(int iterations) {
+    uint32x2_t x0 = vld1_u32(bench_a);
+    uint32x2_t y = vld1_u32(bench_b);
+    uint32x2_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vadd_u32(x0, y);
+        x1 = vadd_u32(x1, y);
+        x2 = vadd_u32(x2, y);
+        x3 = vadd_u32(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1_u32(bench_result, x0);
 }
 // Function to run tests using ARM Neon instructions/intrinsics
 void run_tests_neon() {
-    run_test_cases(vadd_u32_neon);
+    run_benchmarks("ARM-Neon", vadd_u32_latency_neon, vadd_u32_throughput_neon);
 }
 
 #elif defined(RISCV_VECTOR)
-// RISC-V Vector-specific implementation
-void vadd_u32_rvvector(uint32_t *a, uint32_t *b, int size, uint32_t *result) {
-    uint32x2_t x = __riscv_vle32_v_u32m1(a, size);
-    uint32x2_t y = __riscv_vle32_v_u32m1(b, size);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    uint32x2_t z = vadd_u32_rvv(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("RISC-V vector function 'vadd_u32_rvv' took %.2f microseconds\n", time_taken);
-    __riscv_vse32_v_u32m1(result, z, size);
+// RISC-V Vector-specific implementation, each vadd_u32_rvv depends on the previous one
+void vadd_u32_latency_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x2_t x = __riscv_vle32_v_u32mf2(bench_a, VLEN_2);
+        uint32x2_t y = __riscv_vle32_v_u32mf2(bench_b, VLEN_2);
+    #else
+        uint32x2_t x = __riscv_vle32_v_u32m1(bench_a, VLEN_2);
+        uint32x2_t y = __riscv_vle32_v_u32m1(bench_b, VLEN_2);
+    #endif
+    for (int i = 0; i < iterations; i++) {
+        x = vadd_u32_rvv(x, y);
+    }
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_u32mf2(bench_result, x, VLEN_2);
+    #else
+        __riscv_vse32_v_u32m1(bench_result, x, VLEN_2);
+    #endif
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vadd_u32_rvv per iteration
+void vadd_u32_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x2_t x0 = __riscv_vle32_v_u32mf2(bench_a, VLEN_2);
+        uint32x2_t y = __riscv_vle32_v_u32mf2(bench_b, VLEN_2);
+    #else
+        uint32x2_t x0 = __riscv_vle32_v_u32m1(bench_a, VLEN_2);
+        uint32x2_t y = __riscv_vle32_v_u32m1(bench_b, VLEN_2);
+    #endif
+    uint32x2_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vadd_u32_rvv(x0, y);
+        x1 = vadd_u32_rvv(x1, y);
+        x2 = vadd_u32_rvv(x2, y);
+        x3 = vadd_u32_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_u32mf2(bench_result, x0, VLEN_2);
+    #else
+        __riscv_vse32_v_u32m1(bench_result, x0, VLEN_2);
+    #endif
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
-    run_test_cases(vadd_u32_rvvector);
+    run_benchmarks("RISC-V", vadd_u32_latency_rvvector, vadd_u32_throughput_rvvector);
 }
 #endif
 
@@ -0,0 +1,99 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vaddl_s32; the kernels load them once and
+// keep the vectors in registers for all iterations
+int32_t bench_a[2] = {1, 2};
+int32_t bench_b[2] = {1, 2};
+int64_t bench_result[2];
+
+// Function to run the throughput benchmark with the given kernel
+void run_benchmarks(const char *arch, void (*throughput)(int)) {
+    bench_run(arch, "vaddl_s32", "int64x2_t", 2, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 2, INT64);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddl_s32 per iteration
+void vaddl_s32_throughput_neon(int iterations) {
+    int32x2_t x0 = vld1_s32(bench_a);
+    int32x2_t y = vld1_s32(bench_b);
+    int32x2_t x1 = x0, x2 = x0, x3 = x0;
+    int64x2_t z0, z1, z2, z3;
+    for (int i = 0; i < iterations; i++) {
+        bench_opaque(x0);
+        z0 = vaddl_s32(x0, y);
+        bench_opaque(z0);
+        bench_opaque(x1);
+        z1 = vaddl_s32(x1, y);
+        bench_opaque(z1);
+        bench_opaque(x2);
+        z2 = vaddl_s32(x2, y);
+        bench_opaque(z2);
+        bench_opaque(x3);
+        z3 = vaddl_s32(x3, y);
+        bench_opaque(z3);
+    }
+    vst1q_s64(bench_result, z0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vaddl_s32_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vaddl_s32_rvv per iteration
+void vaddl_s32_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int32x2_t x0 = __riscv_vle32_v_i32mf2(bench_a, VLEN_2);
+        int32x2_t y = __riscv_vle32_v_i32mf2(bench_b, VLEN_2);
+    #else
+        int32x2_t x0 = __riscv_vle32_v_i32m1(bench_a, VLEN_2);
+        int32x2_t y = __riscv_vle32_v_i32m1(bench_b, VLEN_2);
+    #endif
+    int32x2_t x1 = x0, x2 = x0, x3 = x0;
+    int64x2_t z0, z1, z2, z3;
+    for (int i = 0; i < iterations; i++) {
+        bench_opaque(x0);
+        z0 = vaddl_s32_rvv(x0, y);
+        bench_opaque(z0);
+        bench_opaque(x1);
+        z1 = vaddl_s32_rvv(x1, y);
+        bench_opaque(z1);
+        bench_opaque(x2);
+        z2 = vaddl_s32_rvv(x2, y);
+        bench_opaque(z2);
+        bench_opaque(x3);
+        z3 = vaddl_s32_rvv(x3, y);
+        bench_opaque(z3);
+    }
+    __riscv_vse64_v_i64m1(bench_result, z0, VLEN_2);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vaddl_s32_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,99 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vaddl_u8; the kernels load them once and
+// keep the vectors in registers for all iterations
+uint8_t bench_a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint8_t bench_b[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint16_t bench_result[8];
+
+// Function to run the throughput benchmark with the given kernel
+void run_benchmarks(const char *arch, void (*throughput)(int)) {
+    bench_run(arch, "vaddl_u8", "uint16x8_t", 8, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 8, UINT16);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddl_u8 per iteration
+void vaddl_u8_throughput_neon(int iterations) {
+    uint8x8_t x0 = vld1_u8(bench_a);
+    uint8x8_t y = vld1_u8(bench_b);
+    uint8x8_t x1 = x0, x2 = x0, x3 = x0;
+    uint16x8_t z0, z1, z2, z3;
+    for (int i = 0; i < iterations; i++) {
+        bench_opaque(x0);
+        z0 = vaddl_u8(x0, y);
+        bench_opaque(z0);
+        bench_opaque(x1);
+        z1 = vaddl_u8(x1, y);
+        bench_opaque(z1);
+        bench_opaque(x2);
+        z2 = vaddl_u8(x2, y);
+        bench_opaque(z2);
+        bench_opaque(x3);
+        z3 = vaddl_u8(x3, y);
+        bench_opaque(z3);
+    }
+    vst1q_u16(bench_result, z0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vaddl_u8_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vaddl_u8_rvv per iteration
+void vaddl_u8_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint8x8_t x0 = __riscv_vle8_v_u8mf2(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8mf2(bench_b, VLEN_8);
+    #else
+        uint8x8_t x0 = __riscv_vle8_v_u8m1(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_8);
+    #endif
+    uint8x8_t x1 = x0, x2 = x0, x3 = x0;
+    uint16x8_t z0, z1, z2, z3;
+    for (int i = 0; i < iterations; i++) {
+        bench_opaque(x0);
+        z0 = vaddl_u8_rvv(x0, y);
+        bench_opaque(z0);
+        bench_opaque(x1);
+        z1 = vaddl_u8_rvv(x1, y);
+        bench_opaque(z1);
+        bench_opaque(x2);
+        z2 = vaddl_u8_rvv(x2, y);
+        bench_opaque(z2);
+        bench_opaque(x3);
+        z3 = vaddl_u8_rvv(x3, y);
+        bench_opaque(z3);
+    }
+    __riscv_vse16_v_u16m1(bench_result, z0, VLEN_8);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vaddl_u8_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
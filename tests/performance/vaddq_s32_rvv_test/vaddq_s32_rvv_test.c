@@ -1,6 +1,9 @@
 // Copyright 2024 10xEngineers
 
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
 #include "common_utilities.h"
+#include "benchmark.h"
 
 #if defined(ARM_NEON)
     #include <arm_neon.h>
@@ -10,71 +13,79 @@
     #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
 #endif
 
-// Function to run test cases with a given vect_add
-void run_test_cases(void (*vect_add)(int32_t*, int32_t*, int, int32_t*)) {
-    int32_t test_cases[][4] = {
-        {1, 2, 3, 4},                        // Regular positive numbers
-        {0, 0, 0, 0},                        // All zeros
-        {-1, -2, -3, -4},                    // Negative numbers
-        {2147483647, 2147483647, 2147483647, 2147483647},  // Maximum int32_t value
-        {-2147483648, -2147483648, -2147483648, -2147483648},  // Minimum int32_t value
-        {2147483647, -2147483648, 2147483647, -2147483648},  // Max and Min int32_t values
-        {5000, -5000, 10000, -10000},        // Mixed positive and negative numbers
-        {1, 1, 1, 1}                         // All ones
-    };
-
-    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-
-    for (int i = 0; i < num_tests; i++) {
-        int32_t *a = test_cases[i];
-        int32_t b[4] = {1, 2, 3, 4};
-        int32_t result[4];
+// Operands and result of the benchmarked vaddq_s32; the kernels load them once and
+// keep the vectors in registers for all iterations
+int32_t bench_a[4] = {1, 2, 3, 4};
+int32_t bench_b[4] = {1, 2, 3, 4};
+int32_t bench_result[4];
 
-        // Measure the time taken for the vector addition operation
-        struct timespec start, end;
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        vect_add(a, b, 4, result);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-        printf("Test case %d {Vector load, Vector function, Vector store} took %.2f microseconds\n",i + 1, time_taken);
-        // print_results(result, 4, "int32_t");
-    }
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vaddq_s32", "int32x4_t", 4, "latency", latency, 1);
+    bench_run(arch, "vaddq_s32", "int32x4_t", 4, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 4, INT32);
 }
 
 #if defined(ARM_NEON)
-// ARM Neon-specific implementation
-void vaddq_s32_neon(int32_t *a, int32_t *b, int size, int32_t *result) {
-    int32x4_t x = vld1q_s32(a);
-    int32x4_t y = vld1q_s32(b);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int32x4_t z = vaddq_s32(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("ARM-Neon vector function 'vaddq_s32' took %.2f microseconds\n", time_taken);
-    vst1q_s32(result, z);
+// ARM Neon-specific implementation, each vaddq_s32 depends on the previous one
+void vaddq_s32_latency_neon(int iterations) {
+    int32x4_t x = vld1q_s32(bench_a);
+    int32x4_t y = vld1q_s32(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_s32(x, y);
+    }
+    vst1q_s32(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddq_s32 per iteration
+void vaddq_s32_throughput_neon(int iterations) {
+    int32x4_t x0 = vld1q_s32(bench_a);
+    int32x4_t y = vld1q_s32(bench_b);
+    int32x4_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_s32(x0, y);
+        x1 = vaddq_s32(x1, y);
+        x2 = vaddq_s32(x2, y);
+        x3 = vaddq_s32(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_s32(bench_result, x0);
 }
 // Function to run tests using ARM Neon instructions/intrinsics
 void run_tests_neon() {
-    run_test_cases(vaddq_s32_neon);
+    run_benchmarks("ARM-Neon", vaddq_s32_latency_neon, vaddq_s32_throughput_neon);
 }
 
 #elif defined(RISCV_VECTOR)
-// RISC-V Vector-specific implementation
-void vaddq_s32_rvvector(int32_t *a, int32_t *b, int size, int32_t *result) {
-    int32x4_t x = __riscv_vle32_v_i32m1(a, size);
-    int32x4_t y = __riscv_vle32_v_i32m1(b, size);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int32x4_t z = vaddq_s32_rvv(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("RISC-V vector function 'vaddq_s32_rvv' took %.2f microseconds\n", time_taken);
-    __riscv_vse32_v_i32m1(result, z, size);
+// RISC-V Vector-specific implementation, each vaddq_s32_rvv depends on the previous one
+void vaddq_s32_latency_rvvector(int iterations) {
+    int32x4_t x = __riscv_vle32_v_i32m1(bench_a, VLEN_4);
+    int32x4_t y = __riscv_vle32_v_i32m1(bench_b, VLEN_4);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_s32_rvv(x, y);
+    }
+    __riscv_vse32_v_i32m1(bench_result, x, VLEN_4);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vaddq_s32_rvv per iteration
+void vaddq_s32_throughput_rvvector(int iterations) {
+    int32x4_t x0 = __riscv_vle32_v_i32m1(bench_a, VLEN_4);
+    int32x4_t y = __riscv_vle32_v_i32m1(bench_b, VLEN_4);
+    int32x4_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_s32_rvv(x0, y);
+        x1 = vaddq_s32_rvv(x1, y);
+        x2 = vaddq_s32_rvv(x2, y);
+        x3 = vaddq_s32_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse32_v_i32m1(bench_result, x0, VLEN_4);
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
-    run_test_cases(vaddq_s32_rvvector);
+    run_benchmarks("RISC-V", vaddq_s32_latency_rvvector, vaddq_s32_throughput_rvvector);
 }
 #endif
 
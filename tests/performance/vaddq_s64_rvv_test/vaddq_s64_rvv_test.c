@@ -1,6 +1,9 @@
 // Copyright 2024 10xEngineers
 
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
 #include "common_utilities.h"
+#include "benchmark.h"
 
 #if defined(ARM_NEON)
     #include <arm_neon.h>
@@ -10,71 +13,79 @@
     #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
 #endif
 
-// Function to run test cases with a given vect_add
-void run_test_cases(void (*vect_add)(int64_t*, int64_t*, int, int64_t*)) {
-    int64_t test_cases[][2] = {
-        {1, 2},                        // Regular positive numbers
-        {0, 0},                        // All zeros
-        {-1, -2},                      // Negative numbers
-        {9223372036854775807LL, 9223372036854775807LL},  // Maximum int64_t value
-        {-9223372036854775807LL - 1, -9223372036854775807LL - 1},  // Minimum int64_t value
-        {9223372036854775807LL, -9223372036854775807LL - 1},  // Max and Min int64_t values
-        {5000, -10000},                // Mixed positive and negative numbers
-        {1, 1}                         // All ones
-    };
-
-    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-
-    for (int i = 0; i < num_tests; i++) {
-        int64_t *a = test_cases[i];
-        int64_t b[2] = {1, 2};
-        int64_t result[2];
+// Operands and result of the benchmarked vaddq_s64; the kernels load them once and
+// keep the vectors in registers for all iterations
+int64_t bench_a[2] = {1, 2};
+int64_t bench_b[2] = {1, 2};
+int64_t bench_result[2];
 
-        // Measure the time taken for the vector addition operation
-        struct timespec start, end;
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        vect_add(a, b, 2, result);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-        printf("Test case %d {Vector load, Vector function, Vector store} took %.2f microseconds\n",i + 1, time_taken);
-        // print_results(result, 2, "int64_t");
-    }
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vaddq_s64", "int64x2_t", 2, "latency", latency, 1);
+    bench_run(arch, "vaddq_s64", "int64x2_t", 2, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 2, INT64);
 }
 
 #if defined(ARM_NEON)
-// ARM Neon-specific implementation
-void vaddq_s64_neon(int64_t *a, int64_t *b, int size, int64_t *result) {
-    int64x2_t x = vld1q_s64(a);
-    int64x2_t y = vld1q_s64(b);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int64x2_t z = vaddq_s64(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("ARM-Neon vector function 'vaddq_s64' took %.2f microseconds\n", time_taken);
-    vst1q_s64(result, z);
+// ARM Neon-specific implementation, each vaddq_s64 depends on the previous one
+void vaddq_s64_latency_neon(int iterations) {
+    int64x2_t x = vld1q_s64(bench_a);
+    int64x2_t y = vld1q_s64(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_s64(x, y);
+    }
+    vst1q_s64(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddq_s64 per iteration
+void vaddq_s64_throughput_neon(int iterations) {
+    int64x2_t x0 = vld1q_s64(bench_a);
+    int64x2_t y = vld1q_s64(bench_b);
+    int64x2_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_s64(x0, y);
+        x1 = vaddq_s64(x1, y);
+        x2 = vaddq_s64(x2, y);
+        x3 = vaddq_s64(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_s64(bench_result, x0);
 }
 // Function to run tests using ARM Neon instructions/intrinsics
 void run_tests_neon() {
-    run_test_cases(vaddq_s64_neon);
+    run_benchmarks("ARM-Neon", vaddq_s64_latency_neon, vaddq_s64_throughput_neon);
 }
 
 #elif defined(RISCV_VECTOR)
-// RISC-V Vector-specific implementation
-void vaddq_s64_rvvector(int64_t *a, int64_t *b, int size, int64_t *result) {
-    int64x2_t x = __riscv_vle64_v_i64m1(a, size);
-    int64x2_t y = __riscv_vle64_v_i64m1(b, size);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int64x2_t z = vaddq_s64_rvv(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("RISC-V vector function 'vaddq_s64_rvv' took %.2f microseconds\n", time_taken);
-    __riscv_vse64_v_i64m1(result, z, size);
+// RISC-V Vector-specific implementation, each vaddq_s64_rvv depends on the previous one
+void vaddq_s64_latency_rvvector(int iterations) {
+    int64x2_t x = __riscv_vle64_v_i64m1(bench_a, VLEN_2);
+    int64x2_t y = __riscv_vle64_v_i64m1(bench_b, VLEN_2);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_s64_rvv(x, y);
+    }
+    __riscv_vse64_v_i64m1(bench_result, x, VLEN_2);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vaddq_s64_rvv per iteration
+void vaddq_s64_throughput_rvvector(int iterations) {
+    int64x2_t x0 = __riscv_vle64_v_i64m1(bench_a, VLEN_2);
+    int64x2_t y = __riscv_vle64_v_i64m1(bench_b, VLEN_2);
+    int64x2_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_s64_rvv(x0, y);
+        x1 = vaddq_s64_rvv(x1, y);
+        x2 = vaddq_s64_rvv(x2, y);
+        x3 = vaddq_s64_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse64_v_i64m1(bench_result, x0, VLEN_2);
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
-    run_test_cases(vaddq_s64_rvvector);
+    run_benchmarks("RISC-V", vaddq_s64_latency_rvvector, vaddq_s64_throughput_rvvector);
 }
 #endif
 
@@ -1,6 +1,9 @@
 // Copyright 2024 10xEngineers
 
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
 #include "common_utilities.h"
+#include "benchmark.h"
 
 #if defined(ARM_NEON)
     #include <arm_neon.h>
@@ -10,71 +13,79 @@
     #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
 #endif
 
-// Function to run test cases with a given vect_add
-void run_test_cases(void (*vect_add)(int8_t*, int8_t*, int, int8_t*)) {
-    int8_t test_cases[][16] = {
-        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},   // Regular positive numbers
-        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},          // All zeros
-        {-1, -2, -3, -4, -5, -6, -7, -8, -9, -10, -11, -12, -13, -14, -15, -16}, // Negative numbers
-        {127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127, 127}, // Maximum int8_t value
-        {-128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128, -128}, // Minimum int8_t value
-        {127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128, 127, -128}, // Max and Min int8_t values
-        {50, -50, 100, -100, 25, -25, 75, -75, 50, -50, 100, -100, 25, -25, 75, -75}, // Mixed positive and negative numbers
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}            // All ones
-    };
-
-    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-
-    for (int i = 0; i < num_tests; i++) {
-        int8_t *a = test_cases[i];
-        int8_t b[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
-        int8_t result[16];
+// Operands and result of the benchmarked vaddq_s8; the kernels load them once and
+// keep the vectors in registers for all iterations
+int8_t bench_a[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+int8_t bench_b[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+int8_t bench_result[16];
 
-        // Measure the time taken for the vector addition operation
-        struct timespec start, end;
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        vect_add(a, b, 16, result);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-        printf("Test case %d {Vector load, Vector function, Vector store} took %.2f microseconds\n",i + 1, time_taken);
-        // print_results(result, 16, "int8_t");
-    }
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vaddq_s8", "int8x16_t", 16, "latency", latency, 1);
+    bench_run(arch, "vaddq_s8", "int8x16_t", 16, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 16, INT8);
 }
 
 #if defined(ARM_NEON)
-// ARM Neon-specific implementation
-void vaddq_s8_neon(int8_t *a, int8_t *b, int size, int8_t *result) {
-    int8x16_t x = vld1q_s8(a);
-    int8x16_t y = vld1q_s8(b);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int8x16_t z = vaddq_s8(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("ARM-Neon vector function 'vaddq_s8' took %.2f microseconds\n", time_taken);
-    vst1q_s8(result, z);
+// ARM Neon-specific implementation, each vaddq_s8 depends on the previous one
+void vaddq_s8_latency_neon(int iterations) {
+    int8x16_t x = vld1q_s8(bench_a);
+    int8x16_t y = vld1q_s8(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_s8(x, y);
+    }
+    vst1q_s8(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddq_s8 per iteration
+void vaddq_s8_throughput_neon(int iterations) {
+    int8x16_t x0 = vld1q_s8(bench_a);
+    int8x16_t y = vld1q_s8(bench_b);
+    int8x16_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_s8(x0, y);
+        x1 = vaddq_s8(x1, y);
+        x2 = vaddq_s8(x2, y);
+        x3 = vaddq_s8(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_s8(bench_result, x0);
 }
 // Function to run tests using ARM Neon instructions/intrinsics
 void run_tests_neon() {
-    run_test_cases(vaddq_s8_neon);
+    run_benchmarks("ARM-Neon", vaddq_s8_latency_neon, vaddq_s8_throughput_neon);
 }
 
 #elif defined(RISCV_VECTOR)
-// RISC-V Vector-specific implementation
-void vaddq_s8_rvvector(int8_t *a, int8_t *b, int size, int8_t *result) {
-    int8x16_t x = __riscv_vle8_v_i8m1(a, size);
-    int8x16_t y = __riscv_vle8_v_i8m1(b, size);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    int8x16_t z = vaddq_s8_rvv(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("RISC-V vector function 'vaddq_s8_rvv' took %.2f microseconds\n", time_taken);
-    __riscv_vse8_v_i8m1(result, z, size);
+// RISC-V Vector-specific implementation, each vaddq_s8_rvv depends on the previous one
+void vaddq_s8_latency_rvvector(int iterations) {
+    int8x16_t x = __riscv_vle8_v_i8m1(bench_a, VLEN_16);
+    int8x16_t y = __riscv_vle8_v_i8m1(bench_b, VLEN_16);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_s8_rvv(x, y);
+    }
+    __riscv_vse8_v_i8m1(bench_result, x, VLEN_16);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vaddq_s8_rvv per iteration
+void vaddq_s8_throughput_rvvector(int iterations) {
+    int8x16_t x0 = __riscv_vle8_v_i8m1(bench_a, VLEN_16);
+    int8x16_t y = __riscv_vle8_v_i8m1(bench_b, VLEN_16);
+    int8x16_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_s8_rvv(x0, y);
+        x1 = vaddq_s8_rvv(x1, y);
+        x2 = vaddq_s8_rvv(x2, y);
+        x3 = vaddq_s8_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse8_v_i8m1(bench_result, x0, VLEN_16);
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
-    run_test_cases(vaddq_s8_rvvector);
+    run_benchmarks("RISC-V", vaddq_s8_latency_rvvector, vaddq_s8_throughput_rvvector);
 }
 #endif
 
@@ -1,6 +1,9 @@
 // Copyright 2024 10xEngineers
 
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
 #include "common_utilities.h"
+#include "benchmark.h"
 
 #if defined(ARM_NEON)
     #include <arm_neon.h>
@@ -10,76 +13,84 @@
     #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
 #endif
 
-// Function to run test cases with a given vect_add
-void run_test_cases(void (*vect_add)(uint16_t*, uint16_t*, int, uint16_t*)) {
-    uint16_t test_cases[][8] = {
-        {1, 2, 3, 4, 5, 6, 7, 8},                   // Regular positive numbers
-        {0, 0, 0, 0, 0, 0, 0, 0},                   // All zeros
-        {65535, 65534, 65533, 65532, 65531, 65530, 65529, 65528}, // High positive numbers (near max uint16_t)
-        {65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535},   // Maximum uint16_t value
-        {0, 0, 0, 0, 0, 0, 0, 0},                   // Minimum uint16_t value (all zeros)
-        {65535, 0, 65535, 0, 65535, 0, 65535, 0},   // Max and Min uint16_t values
-        {5000, 60535, 10000, 55535, 2500, 63035, 7500, 58035},     // Mixed positive numbers
-        {1, 1, 1, 1, 1, 1, 1, 1}                    // All ones
-    };
-
-    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-
-    for (int i = 0; i < num_tests; i++) {
-        uint16_t *a = test_cases[i];
-        uint16_t b[8] = {1, 2, 3, 4, 5, 6, 7, 8};
-        uint16_t result[8];
+// Operands and result of the benchmarked vaddq_u16; the kernels load them once and
+// keep the vectors in registers for all iterations
+uint16_t bench_a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint16_t bench_b[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint16_t bench_result[8];
 
-        // Measure the time taken for the vector addition operation
-        struct timespec start, end;
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        vect_add(a, b, 8, result);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-        printf("Test case %d {Vector load, Vector function, Vector store} took %.2f microseconds\n",i + 1, time_taken);
-        // print_results(result, 8, UINT16);
-    }
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vaddq_u16", "uint16x8_t", 8, "latency", latency, 1);
+    bench_run(arch, "vaddq_u16", "uint16x8_t", 8, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 8, UINT16);
 }
 
 #if defined(ARM_NEON)
-// ARM Neon-specific implementation
-void vaddq_u16_neon(uint16_t *a, uint16_t *b, int size, uint16_t *result) {
-    uint16x8_t x = vld1q_u16(a);
-    uint16x8_t y = vld1q_u16(b);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    uint16x8_t z = vaddq_u16(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("ARM-Neon vector function 'vaddq_u16' took %.2f microseconds\n", time_taken);
-    vst1q_u16(result, z);
+// ARM Neon-specific implementation, each vaddq_u16 depends on the previous one
+void vaddq_u16_latency_neon(int iterations) {
+    uint16x8_t x = vld1q_u16(bench_a);
+    uint16x8_t y = vld1q_u16(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_u16(x, y);
+    }
+    vst1q_u16(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddq_u16 per iteration
+void vaddq_u16_throughput_neon(int iterations) {
+    uint16x8_t x0 = vld1q_u16(bench_a);
+    uint16x8_t y = vld1q_u16(bench_b);
+    uint16x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_u16(x0, y);
+        x1 = vaddq_u16(x1, y);
+        x2 = vaddq_u16(x2, y);
+        x3 = vaddq_u16(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_u16(bench_result, x0);
 }
 // Function to run tests using ARM Neon instructions/intrinsics
 void run_tests_neon() {
-    run_test_cases(vaddq_u16_neon);
+    run_benchmarks("ARM-Neon", vaddq_u16_latency_neon, vaddq_u16_throughput_neon);
 }
 
 #elif defined(RISCV_VECTOR)
-// RISC-V Vector-specific implementation
-void vaddq_u16_rvvector(uint16_t *a, uint16_t *b, int size, uint16_t *result) {
-    uint16x8_t x = __riscv_vle16_v_u16m1(a, size);
-    uint16x8_t y = __riscv_vle16_v_u16m1(b, size);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    uint16x8_t z = vaddq_u16_rvv(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("RISC-V vector function 'vaddq_u16_rvv' took %.2f microseconds\n", time_taken);
-    __riscv_vse16_v_u16m1(result, z, size);
+// RISC-V Vector-specific implementation, each vaddq_u16_rvv depends on the previous one
+void vaddq_u16_latency_rvvector(int iterations) {
+    uint16x8_t x = __riscv_vle16_v_u16m1(bench_a, VLEN_8);
+    uint16x8_t y = __riscv_vle16_v_u16m1(bench_b, VLEN_8);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_u16_rvv(x, y);
+    }
+    __riscv_vse16_v_u16m1(bench_result, x, VLEN_8);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vaddq_u16_rvv per iteration
+void vaddq_u16_throughput_rvvector(int iterations) {
+    uint16x8_t x0 = __riscv_vle16_v_u16m1(bench_a, VLEN_8);
+    uint16x8_t y = __riscv_vle16_v_u16m1(bench_b, VLEN_8);
+    uint16x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_u16_rvv(x0, y);
+        x1 = vaddq_u16_rvv(x1, y);
+        x2 = vaddq_u16_rvv(x2, y);
+        x3 = vaddq_u16_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse16_v_u16m1(bench_result, x0, VLEN_8);
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
-    run_test_cases(vaddq_u16_rvvector);
+    run_benchmarks("RISC-V", vaddq_u16_latency_rvvector, vaddq_u16_throughput_rvvector);
 }
 #endif
 
 int main() {
-     #if defined(RISCV_VECTOR)
+    #if defined(RISCV_VECTOR)
         run_tests_rvv();
     #elif defined(ARM_NEON)
         run_tests_neon();
@@ -1,6 +1,9 @@
 // Copyright 2024 10xEngineers
 
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
 #include "common_utilities.h"
+#include "benchmark.h"
 
 #if defined(ARM_NEON)
     #include <arm_neon.h>
@@ -10,76 +13,84 @@
     #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
 #endif
 
-// Function to run test cases with a given vect_add
-void run_test_cases(void (*vect_add)(uint8_t*, uint8_t*, int, uint8_t*)) {
-    uint8_t test_cases[][16] = {
-        {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16},          // Regular positive numbers
-        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},                  // All zeros
-        {255, 254, 253, 252, 251, 250, 249, 248, 247, 246, 245, 244, 243, 242, 241, 240}, // High positive numbers (near max uint8_t)
-        {255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255}, // Maximum uint8_t value
-        {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0},                  // Minimum uint8_t value (all zeros)
-        {255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0},  // Max and Min uint8_t values
-        {50, 205, 100, 155, 25, 230, 75, 180, 50, 205, 100, 155, 25, 230, 75, 180}, // Mixed positive numbers
-        {1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1}                    // All ones
-    };
-
-    int num_tests = sizeof(test_cases) / sizeof(test_cases[0]);
-
-    for (int i = 0; i < num_tests; i++) {
-        uint8_t *a = test_cases[i];
-        uint8_t b[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
-        uint8_t result[16];
+// Operands and result of the benchmarked vaddq_u8; the kernels load them once and
+// keep the vectors in registers for all iterations
+uint8_t bench_a[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+uint8_t bench_b[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+uint8_t bench_result[16];
 
-        // Measure the time taken for the vector addition operation
-        struct timespec start, end;
-        clock_gettime(CLOCK_MONOTONIC, &start);
-        vect_add(a, b, 16, result);
-        clock_gettime(CLOCK_MONOTONIC, &end);
-        double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-        printf("Test case %d {Vector load, Vector function, Vector store} took %.2f microseconds\n",i + 1, time_taken);
-        // print_results(result, 16, UINT8);
-    }
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vaddq_u8", "uint8x16_t", 16, "latency", latency, 1);
+    bench_run(arch, "vaddq_u8", "uint8x16_t", 16, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 16, UINT8);
 }
 
 #if defined(ARM_NEON)
-// ARM Neon-specific implementation
-void vaddq_u8_neon(uint8_t *a, uint8_t *b, int size, uint8_t *result) {
-    uint8x16_t x = vld1q_u8(a);
-    uint8x16_t y = vld1q_u8(b);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    uint8x16_t z = vaddq_u8(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("ARM-Neon vector function 'vaddq_u8' took %.2f microseconds\n", time_taken);
-    vst1q_u8(result, z);
+// ARM Neon-specific implementation, each vaddq_u8 depends on the previous one
+void vaddq_u8_latency_neon(int iterations) {
+    uint8x16_t x = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_u8(x, y);
+    }
+    vst1q_u8(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vaddq_u8 per iteration
+void vaddq_u8_throughput_neon(int iterations) {
+    uint8x16_t x0 = vld1q_u8(bench_a);
+    uint8x16_t y = vld1q_u8(bench_b);
+    uint8x16_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_u8(x0, y);
+        x1 = vaddq_u8(x1, y);
+        x2 = vaddq_u8(x2, y);
+        x3 = vaddq_u8(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_u8(bench_result, x0);
 }
 // Function to run tests using ARM Neon instructions/intrinsics
 void run_tests_neon() {
-    run_test_cases(vaddq_u8_neon);
+    run_benchmarks("ARM-Neon", vaddq_u8_latency_neon, vaddq_u8_throughput_neon);
 }
 
 #elif defined(RISCV_VECTOR)
-// RISC-V Vector-specific implementation
-void vaddq_u8_rvvector(uint8_t *a, uint8_t *b, int size, uint8_t *result) {
-    uint8x16_t x = __riscv_vle8_v_u8m1(a, size);
-    uint8x16_t y = __riscv_vle8_v_u8m1(b, size);
-    struct timespec start, end;
-    clock_gettime(CLOCK_MONOTONIC, &start);
-    uint8x16_t z = vaddq_u8_rvv(x, y);
-    clock_gettime(CLOCK_MONOTONIC, &end);
-    double time_taken = (end.tv_sec - start.tv_sec) * 1e6 + (end.tv_nsec - start.tv_nsec) / 1e3; // time in microseconds
-    printf("RISC-V vector function 'vaddq_u8_rvv' took %.2f microseconds\n", time_taken);
-    __riscv_vse8_v_u8m1(result, z, size);
+// RISC-V Vector-specific implementation, each vaddq_u8_rvv depends on the previous one
+void vaddq_u8_latency_rvvector(int iterations) {
+    uint8x16_t x = __riscv_vle8_v_u8m1(bench_a, VLEN_16);
+    uint8x16_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_16);
+    for (int i = 0; i < iterations; i++) {
+        x = vaddq_u8_rvv(x, y);
+    }
+    __riscv_vse8_v_u8m1(bench_result, x, VLEN_16);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vaddq_u8_rvv per iteration
+void vaddq_u8_throughput_rvvector(int iterations) {
+    uint8x16_t x0 = __riscv_vle8_v_u8m1(bench_a, VLEN_16);
+    uint8x16_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_16);
+    uint8x16_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vaddq_u8_rvv(x0, y);
+        x1 = vaddq_u8_rvv(x1, y);
+        x2 = vaddq_u8_rvv(x2, y);
+        x3 = vaddq_u8_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse8_v_u8m1(bench_result, x0, VLEN_16);
 }
 // Function to run tests using RISC-V Vector instructions/intrinsics
 void run_tests_rvv() {
-    run_test_cases(vaddq_u8_rvvector);
+    run_benchmarks("RISC-V", vaddq_u8_latency_rvvector, vaddq_u8_throughput_rvvector);
 }
 #endif
 
 int main() {
-     #if defined(RISCV_VECTOR)
+    #if defined(RISCV_VECTOR)
         run_tests_rvv();
     #elif defined(ARM_NEON)
         run_tests_neon();
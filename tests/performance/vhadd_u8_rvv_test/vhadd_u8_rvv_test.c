@@ -0,0 +1,119 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vhadd_u8; the kernels load them once and
+// keep the vectors in registers for all iterations
+uint8_t bench_a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint8_t bench_b[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint8_t bench_result[8];
+
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vhadd_u8", "uint8x8_t", 8, "latency", latency, 1);
+    bench_run(arch, "vhadd_u8", "uint8x8_t", 8, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 8, UINT8);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vhadd_u8 depends on the previous one
+void vhadd_u8_latency_neon(int iterations) {
+    uint8x8_t x = vld1_u8(bench_a);
+    uint8x8_t y = vld1_u8(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vhadd_u8(x, y);
+    }
+    vst1_u8(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vhadd_u8 per iteration
+void vhadd_u8_throughput_neon(int iterations) {
+    uint8x8_t x0 = vld1_u8(bench_a);
+    uint8x8_t y = vld1_u8(bench_b);
+    uint8x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vhadd_u8(x0, y);
+        x1 = vhadd_u8(x1, y);
+        x2 = vhadd_u8(x2, y);
+        x3 = vhadd_u8(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1_u8(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vhadd_u8_latency_neon, vhadd_u8_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, each vhadd_u8_rvv depends on the previous one
+void vhadd_u8_latency_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint8x8_t x = __riscv_vle8_v_u8mf2(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8mf2(bench_b, VLEN_8);
+    #else
+        uint8x8_t x = __riscv_vle8_v_u8m1(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_8);
+    #endif
+    for (int i = 0; i < iterations; i++) {
+        x = vhadd_u8_rvv(x, y);
+    }
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse8_v_u8mf2(bench_result, x, VLEN_8);
+    #else
+        __riscv_vse8_v_u8m1(bench_result, x, VLEN_8);
+    #endif
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vhadd_u8_rvv per iteration
+void vhadd_u8_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint8x8_t x0 = __riscv_vle8_v_u8mf2(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8mf2(bench_b, VLEN_8);
+    #else
+        uint8x8_t x0 = __riscv_vle8_v_u8m1(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_8);
+    #endif
+    uint8x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vhadd_u8_rvv(x0, y);
+        x1 = vhadd_u8_rvv(x1, y);
+        x2 = vhadd_u8_rvv(x2, y);
+        x3 = vhadd_u8_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse8_v_u8mf2(bench_result, x0, VLEN_8);
+    #else
+        __riscv_vse8_v_u8m1(bench_result, x0, VLEN_8);
+    #endif
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vhadd_u8_latency_rvvector, vhadd_u8_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,162 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Per-op cost of the halving add and subtract. On RISC-V the library functions (single
+// vaadd/vasub instructions with RHAL_VXRM_EXPLICIT) are compared with the previous
+// widen-then-narrow implementations, reported with a "_widening" suffix.
+
+// Operands and results of the benchmarks, with the extremes of both types; the kernels
+// load them once and keep the vectors in registers for all iterations
+uint8_t bench_a_u8[16] = {255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0, 255, 0};
+uint8_t bench_b_u8[16] = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+uint8_t bench_result_u8[16];
+int16_t bench_a_s16[8] = {32767, -32768, 32767, -32768, 32767, -32768, 32767, -32768};
+int16_t bench_b_s16[8] = {-1, 2, -3, 4, -5, 6, -7, 8};
+int16_t bench_result_s16[8];
+
+// Function to run the latency and throughput benchmarks of the halving add and halving
+// subtract with the given kernels, the implementation as suffix of the function names
+void run_benchmarks(const char *arch, const char *suffix, void (*kernels[4])(int)) {
+    char name[32];
+
+    snprintf(name, sizeof(name), "vhaddq_u8%s", suffix);
+    bench_run(arch, name, "uint8x16_t", 16, "latency", kernels[0], 1);
+    bench_run(arch, name, "uint8x16_t", 16, "throughput", kernels[1], BENCH_STREAMS);
+    print_results(bench_result_u8, 16, UINT8);
+    snprintf(name, sizeof(name), "vhsubq_s16%s", suffix);
+    bench_run(arch, name, "int16x8_t", 8, "latency", kernels[2], 1);
+    bench_run(arch, name, "int16x8_t", 8, "throughput", kernels[3], BENCH_STREAMS);
+    print_results(bench_result_s16, 8, INT16);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vhaddq_u8 depends on the previous one
+void vhaddq_u8_latency_neon(int iterations) {
+    uint8x16_t x = vld1q_u8(bench_a_u8);
+    uint8x16_t y = vld1q_u8(bench_b_u8);
+    for (int i = 0; i < iterations; i++) {
+        x = vhaddq_u8(x, y);
+    }
+    vst1q_u8(bench_result_u8, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vhaddq_u8 per iteration
+void vhaddq_u8_throughput_neon(int iterations) {
+    uint8x16_t x0 = vld1q_u8(bench_a_u8);
+    uint8x16_t y = vld1q_u8(bench_b_u8);
+    uint8x16_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vhaddq_u8(x0, y);
+        x1 = vhaddq_u8(x1, y);
+        x2 = vhaddq_u8(x2, y);
+        x3 = vhaddq_u8(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_u8(bench_result_u8, x0);
+}
+// ARM Neon-specific implementation, each vhsubq_s16 depends on the previous one
+void vhsubq_s16_latency_neon(int iterations) {
+    int16x8_t x = vld1q_s16(bench_a_s16);
+    int16x8_t y = vld1q_s16(bench_b_s16);
+    for (int i = 0; i < iterations; i++) {
+        x = vhsubq_s16(x, y);
+    }
+    vst1q_s16(bench_result_s16, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vhsubq_s16 per iteration
+void vhsubq_s16_throughput_neon(int iterations) {
+    int16x8_t x0 = vld1q_s16(bench_a_s16);
+    int16x8_t y = vld1q_s16(bench_b_s16);
+    int16x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vhsubq_s16(x0, y);
+        x1 = vhsubq_s16(x1, y);
+        x2 = vhsubq_s16(x2, y);
+        x3 = vhsubq_s16(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_s16(bench_result_s16, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    void (*kernels[4])(int) = {vhaddq_u8_latency_neon, vhaddq_u8_throughput_neon,
+                               vhsubq_s16_latency_neon, vhsubq_s16_throughput_neon};
+    run_benchmarks("ARM-Neon", "", kernels);
+}
+
+#elif defined(RISCV_VECTOR)
+// Previous widen-then-narrow implementations, kept out-of-line like the library functions
+__attribute__((noinline)) uint8x16_t vhaddq_u8_widening(uint8x16_t a, uint8x16_t b) {
+    return __riscv_vnsrl_wx_u8m1(__riscv_vwaddu_vv_u16m2(a, b, VLEN_16), 1, VLEN_16);
+}
+__attribute__((noinline)) int16x8_t vhsubq_s16_widening(int16x8_t a, int16x8_t b) {
+    return __riscv_vnsra_wx_i16m1(__riscv_vwsub_vv_i32m2(a, b, VLEN_8), 1, VLEN_8);
+}
+
+// Latency and throughput kernels of an implementation fn of a 128-bit operation on
+// bench_a_<t> and bench_b_<t>, with the load and store suffix ls (e.g. 8_v_u8m1)
+#define BENCH_KERNELS(name, fn, type, t, ls, vl)                                \
+    void name##_latency_rvvector(int iterations) {                              \
+        type x = __riscv_vle##ls(bench_a_##t, vl);                              \
+        type y = __riscv_vle##ls(bench_b_##t, vl);                              \
+        for (int i = 0; i < iterations; i++) {                                  \
+            x = fn(x, y);                                                       \
+        }                                                                       \
+        __riscv_vse##ls(bench_result_##t, x, vl);                               \
+    }                                                                           \
+    void name##_throughput_rvvector(int iterations) {                           \
+        type x0 = __riscv_vle##ls(bench_a_##t, vl);                             \
+        type y = __riscv_vle##ls(bench_b_##t, vl);                              \
+        type x1 = x0, x2 = x0, x3 = x0;                                         \
+        for (int i = 0; i < iterations; i++) {                                  \
+            x0 = fn(x0, y);                                                     \
+            x1 = fn(x1, y);                                                     \
+            x2 = fn(x2, y);                                                     \
+            x3 = fn(x3, y);                                                     \
+        }                                                                       \
+        bench_opaque(x1);                                                       \
+        bench_opaque(x2);                                                       \
+        bench_opaque(x3);                                                       \
+        __riscv_vse##ls(bench_result_##t, x0, vl);                              \
+    }
+
+// RISC-V Vector-specific implementations, the library functions and the widen-then-narrow ones
+BENCH_KERNELS(vhaddq_u8, vhaddq_u8_rvv, uint8x16_t, u8, 8_v_u8m1, VLEN_16)
+BENCH_KERNELS(vhsubq_s16, vhsubq_s16_rvv, int16x8_t, s16, 16_v_i16m1, VLEN_8)
+BENCH_KERNELS(vhaddq_u8_widening, vhaddq_u8_widening, uint8x16_t, u8, 8_v_u8m1, VLEN_16)
+BENCH_KERNELS(vhsubq_s16_widening, vhsubq_s16_widening, int16x8_t, s16, 16_v_i16m1, VLEN_8)
+
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    void (*widening[4])(int) = {vhaddq_u8_widening_latency_rvvector, vhaddq_u8_widening_throughput_rvvector,
+                                vhsubq_s16_widening_latency_rvvector, vhsubq_s16_widening_throughput_rvvector};
+    void (*library[4])(int) = {vhaddq_u8_latency_rvvector, vhaddq_u8_throughput_rvvector,
+                               vhsubq_s16_latency_rvvector, vhsubq_s16_throughput_rvvector};
+    run_benchmarks("RISC-V", "_widening", widening);
+    run_benchmarks("RISC-V", "", library);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
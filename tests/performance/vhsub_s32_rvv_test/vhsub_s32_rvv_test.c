@@ -0,0 +1,119 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vhsub_s32; the kernels load them once and
+// keep the vectors in registers for all iterations
+int32_t bench_a[2] = {1, 2};
+int32_t bench_b[2] = {1, 2};
+int32_t bench_result[2];
+
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vhsub_s32", "int32x2_t", 2, "latency", latency, 1);
+    bench_run(arch, "vhsub_s32", "int32x2_t", 2, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 2, INT32);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vhsub_s32 depends on the previous one
+void vhsub_s32_latency_neon(int iterations) {
+    int32x2_t x = vld1_s32(bench_a);
+    int32x2_t y = vld1_s32(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vhsub_s32(x, y);
+    }
+    vst1_s32(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vhsub_s32 per iteration
+void vhsub_s32_throughput_neon(int iterations) {
+    int32x2_t x0 = vld1_s32(bench_a);
+    int32x2_t y = vld1_s32(bench_b);
+    int32x2_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vhsub_s32(x0, y);
+        x1 = vhsub_s32(x1, y);
+        x2 = vhsub_s32(x2, y);
+        x3 = vhsub_s32(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1_s32(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vhsub_s32_latency_neon, vhsub_s32_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, each vhsub_s32_rvv depends on the previous one
+void vhsub_s32_latency_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int32x2_t x = __riscv_vle32_v_i32mf2(bench_a, VLEN_2);
+        int32x2_t y = __riscv_vle32_v_i32mf2(bench_b, VLEN_2);
+    #else
+        int32x2_t x = __riscv_vle32_v_i32m1(bench_a, VLEN_2);
+        int32x2_t y = __riscv_vle32_v_i32m1(bench_b, VLEN_2);
+    #endif
+    for (int i = 0; i < iterations; i++) {
+        x = vhsub_s32_rvv(x, y);
+    }
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_i32mf2(bench_result, x, VLEN_2);
+    #else
+        __riscv_vse32_v_i32m1(bench_result, x, VLEN_2);
+    #endif
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vhsub_s32_rvv per iteration
+void vhsub_s32_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int32x2_t x0 = __riscv_vle32_v_i32mf2(bench_a, VLEN_2);
+        int32x2_t y = __riscv_vle32_v_i32mf2(bench_b, VLEN_2);
+    #else
+        int32x2_t x0 = __riscv_vle32_v_i32m1(bench_a, VLEN_2);
+        int32x2_t y = __riscv_vle32_v_i32m1(bench_b, VLEN_2);
+    #endif
+    int32x2_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vhsub_s32_rvv(x0, y);
+        x1 = vhsub_s32_rvv(x1, y);
+        x2 = vhsub_s32_rvv(x2, y);
+        x3 = vhsub_s32_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse32_v_i32mf2(bench_result, x0, VLEN_2);
+    #else
+        __riscv_vse32_v_i32m1(bench_result, x0, VLEN_2);
+    #endif
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vhsub_s32_latency_rvvector, vhsub_s32_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
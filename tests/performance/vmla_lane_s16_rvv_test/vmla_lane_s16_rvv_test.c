@@ -0,0 +1,126 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vmla_lane_s16; the kernels load them once and
+// keep the vectors in registers for all iterations
+int16_t bench_a[4] = {1, 2, 3, 4};
+int16_t bench_b[4] = {1, 2, 3, 4};
+int16_t bench_v[4] = {1, 2, 3, 4};
+int16_t bench_result[4];
+
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vmla_lane_s16", "int16x4_t", 4, "latency", latency, 1);
+    bench_run(arch, "vmla_lane_s16", "int16x4_t", 4, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 4, INT16);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vmla_lane_s16 depends on the previous one
+void vmla_lane_s16_latency_neon(int iterations) {
+    int16x4_t x = vld1_s16(bench_a);
+    int16x4_t y = vld1_s16(bench_b);
+    int16x4_t z = vld1_s16(bench_v);
+    for (int i = 0; i < iterations; i++) {
+        x = vmla_lane_s16(x, y, z, 3);
+    }
+    vst1_s16(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vmla_lane_s16 per iteration
+void vmla_lane_s16_throughput_neon(int iterations) {
+    int16x4_t x0 = vld1_s16(bench_a);
+    int16x4_t y = vld1_s16(bench_b);
+    int16x4_t z = vld1_s16(bench_v);
+    int16x4_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vmla_lane_s16(x0, y, z, 3);
+        x1 = vmla_lane_s16(x1, y, z, 3);
+        x2 = vmla_lane_s16(x2, y, z, 3);
+        x3 = vmla_lane_s16(x3, y, z, 3);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1_s16(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vmla_lane_s16_latency_neon, vmla_lane_s16_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, each vmla_lane_s16_rvv depends on the previous one
+void vmla_lane_s16_latency_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t x = __riscv_vle16_v_i16mf2(bench_a, VLEN_4);
+        int16x4_t y = __riscv_vle16_v_i16mf2(bench_b, VLEN_4);
+        int16x4_t z = __riscv_vle16_v_i16mf2(bench_v, VLEN_4);
+    #else
+        int16x4_t x = __riscv_vle16_v_i16m1(bench_a, VLEN_4);
+        int16x4_t y = __riscv_vle16_v_i16m1(bench_b, VLEN_4);
+        int16x4_t z = __riscv_vle16_v_i16m1(bench_v, VLEN_4);
+    #endif
+    for (int i = 0; i < iterations; i++) {
+        x = vmla_lane_s16_rvv(x, y, z, 3);
+    }
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_i16mf2(bench_result, x, VLEN_4);
+    #else
+        __riscv_vse16_v_i16m1(bench_result, x, VLEN_4);
+    #endif
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vmla_lane_s16_rvv per iteration
+void vmla_lane_s16_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        int16x4_t x0 = __riscv_vle16_v_i16mf2(bench_a, VLEN_4);
+        int16x4_t y = __riscv_vle16_v_i16mf2(bench_b, VLEN_4);
+        int16x4_t z = __riscv_vle16_v_i16mf2(bench_v, VLEN_4);
+    #else
+        int16x4_t x0 = __riscv_vle16_v_i16m1(bench_a, VLEN_4);
+        int16x4_t y = __riscv_vle16_v_i16m1(bench_b, VLEN_4);
+        int16x4_t z = __riscv_vle16_v_i16m1(bench_v, VLEN_4);
+    #endif
+    int16x4_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vmla_lane_s16_rvv(x0, y, z, 3);
+        x1 = vmla_lane_s16_rvv(x1, y, z, 3);
+        x2 = vmla_lane_s16_rvv(x2, y, z, 3);
+        x3 = vmla_lane_s16_rvv(x3, y, z, 3);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse16_v_i16mf2(bench_result, x0, VLEN_4);
+    #else
+        __riscv_vse16_v_i16m1(bench_result, x0, VLEN_4);
+    #endif
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vmla_lane_s16_latency_rvvector, vmla_lane_s16_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
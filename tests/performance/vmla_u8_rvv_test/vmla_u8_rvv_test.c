@@ -0,0 +1,126 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vmla_u8; the kernels load them once and
+// keep the vectors in registers for all iterations
+uint8_t bench_a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint8_t bench_b[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint8_t bench_c[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint8_t bench_result[8];
+
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vmla_u8", "uint8x8_t", 8, "latency", latency, 1);
+    bench_run(arch, "vmla_u8", "uint8x8_t", 8, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 8, UINT8);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vmla_u8 depends on the previous one
+void vmla_u8_latency_neon(int iterations) {
+    uint8x8_t x = vld1_u8(bench_a);
+    uint8x8_t y = vld1_u8(bench_b);
+    uint8x8_t z = vld1_u8(bench_c);
+    for (int i = 0; i < iterations; i++) {
+        x = vmla_u8(x, y, z);
+    }
+    vst1_u8(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vmla_u8 per iteration
+void vmla_u8_throughput_neon(int iterations) {
+    uint8x8_t x0 = vld1_u8(bench_a);
+    uint8x8_t y = vld1_u8(bench_b);
+    uint8x8_t z = vld1_u8(bench_c);
+    uint8x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vmla_u8(x0, y, z);
+        x1 = vmla_u8(x1, y, z);
+        x2 = vmla_u8(x2, y, z);
+        x3 = vmla_u8(x3, y, z);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1_u8(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vmla_u8_latency_neon, vmla_u8_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, each vmla_u8_rvv depends on the previous one
+void vmla_u8_latency_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint8x8_t x = __riscv_vle8_v_u8mf2(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8mf2(bench_b, VLEN_8);
+        uint8x8_t z = __riscv_vle8_v_u8mf2(bench_c, VLEN_8);
+    #else
+        uint8x8_t x = __riscv_vle8_v_u8m1(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_8);
+        uint8x8_t z = __riscv_vle8_v_u8m1(bench_c, VLEN_8);
+    #endif
+    for (int i = 0; i < iterations; i++) {
+        x = vmla_u8_rvv(x, y, z);
+    }
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse8_v_u8mf2(bench_result, x, VLEN_8);
+    #else
+        __riscv_vse8_v_u8m1(bench_result, x, VLEN_8);
+    #endif
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vmla_u8_rvv per iteration
+void vmla_u8_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint8x8_t x0 = __riscv_vle8_v_u8mf2(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8mf2(bench_b, VLEN_8);
+        uint8x8_t z = __riscv_vle8_v_u8mf2(bench_c, VLEN_8);
+    #else
+        uint8x8_t x0 = __riscv_vle8_v_u8m1(bench_a, VLEN_8);
+        uint8x8_t y = __riscv_vle8_v_u8m1(bench_b, VLEN_8);
+        uint8x8_t z = __riscv_vle8_v_u8m1(bench_c, VLEN_8);
+    #endif
+    uint8x8_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vmla_u8_rvv(x0, y, z);
+        x1 = vmla_u8_rvv(x1, y, z);
+        x2 = vmla_u8_rvv(x2, y, z);
+        x3 = vmla_u8_rvv(x3, y, z);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        __riscv_vse8_v_u8mf2(bench_result, x0, VLEN_8);
+    #else
+        __riscv_vse8_v_u8m1(bench_result, x0, VLEN_8);
+    #endif
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vmla_u8_latency_rvvector, vmla_u8_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,118 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vmlal_laneq_u16; the kernels load them once and
+// keep the vectors in registers for all iterations
+uint32_t bench_a[4] = {1, 2, 3, 4};
+uint16_t bench_b[4] = {1, 2, 3, 4};
+uint16_t bench_v[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint32_t bench_result[4];
+
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vmlal_laneq_u16", "uint32x4_t", 4, "latency", latency, 1);
+    bench_run(arch, "vmlal_laneq_u16", "uint32x4_t", 4, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 4, UINT32);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vmlal_laneq_u16 depends on the previous one
+void vmlal_laneq_u16_latency_neon(int iterations) {
+    uint32x4_t x = vld1q_u32(bench_a);
+    uint16x4_t y = vld1_u16(bench_b);
+    uint16x8_t z = vld1q_u16(bench_v);
+    for (int i = 0; i < iterations; i++) {
+        x = vmlal_laneq_u16(x, y, z, 7);
+    }
+    vst1q_u32(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vmlal_laneq_u16 per iteration
+void vmlal_laneq_u16_throughput_neon(int iterations) {
+    uint32x4_t x0 = vld1q_u32(bench_a);
+    uint16x4_t y = vld1_u16(bench_b);
+    uint16x8_t z = vld1q_u16(bench_v);
+    uint32x4_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vmlal_laneq_u16(x0, y, z, 7);
+        x1 = vmlal_laneq_u16(x1, y, z, 7);
+        x2 = vmlal_laneq_u16(x2, y, z, 7);
+        x3 = vmlal_laneq_u16(x3, y, z, 7);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_u32(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vmlal_laneq_u16_latency_neon, vmlal_laneq_u16_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, each vmlal_laneq_u16_rvv depends on the previous one
+void vmlal_laneq_u16_latency_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x4_t x = __riscv_vle32_v_u32m1(bench_a, VLEN_4);
+        uint16x4_t y = __riscv_vle16_v_u16mf2(bench_b, VLEN_4);
+        uint16x8_t z = __riscv_vle16_v_u16m1(bench_v, VLEN_8);
+    #else
+        uint32x4_t x = __riscv_vle32_v_u32m1(bench_a, VLEN_4);
+        uint16x4_t y = __riscv_vle16_v_u16m1(bench_b, VLEN_4);
+        uint16x8_t z = __riscv_vle16_v_u16m1(bench_v, VLEN_8);
+    #endif
+    for (int i = 0; i < iterations; i++) {
+        x = vmlal_laneq_u16_rvv(x, y, z, 7);
+    }
+    __riscv_vse32_v_u32m1(bench_result, x, VLEN_4);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vmlal_laneq_u16_rvv per iteration
+void vmlal_laneq_u16_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint32x4_t x0 = __riscv_vle32_v_u32m1(bench_a, VLEN_4);
+        uint16x4_t y = __riscv_vle16_v_u16mf2(bench_b, VLEN_4);
+        uint16x8_t z = __riscv_vle16_v_u16m1(bench_v, VLEN_8);
+    #else
+        uint32x4_t x0 = __riscv_vle32_v_u32m1(bench_a, VLEN_4);
+        uint16x4_t y = __riscv_vle16_v_u16m1(bench_b, VLEN_4);
+        uint16x8_t z = __riscv_vle16_v_u16m1(bench_v, VLEN_8);
+    #endif
+    uint32x4_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vmlal_laneq_u16_rvv(x0, y, z, 7);
+        x1 = vmlal_laneq_u16_rvv(x1, y, z, 7);
+        x2 = vmlal_laneq_u16_rvv(x2, y, z, 7);
+        x3 = vmlal_laneq_u16_rvv(x3, y, z, 7);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse32_v_u32m1(bench_result, x0, VLEN_4);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vmlal_laneq_u16_latency_rvvector, vmlal_laneq_u16_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,99 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vmull_high_lane_u16; the kernels load them once and
+// keep the vectors in registers for all iterations
+uint16_t bench_a[8] = {1, 2, 3, 4, 5, 6, 7, 8};
+uint16_t bench_v[4] = {1, 2, 3, 4};
+uint32_t bench_result[4];
+
+// Function to run the throughput benchmark with the given kernel
+void run_benchmarks(const char *arch, void (*throughput)(int)) {
+    bench_run(arch, "vmull_high_lane_u16", "uint32x4_t", 4, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 4, UINT32);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, BENCH_STREAMS independent vmull_high_lane_u16 per iteration
+void vmull_high_lane_u16_throughput_neon(int iterations) {
+    uint16x8_t x0 = vld1q_u16(bench_a);
+    uint16x4_t y = vld1_u16(bench_v);
+    uint16x8_t x1 = x0, x2 = x0, x3 = x0;
+    uint32x4_t z0, z1, z2, z3;
+    for (int i = 0; i < iterations; i++) {
+        bench_opaque(x0);
+        z0 = vmull_high_lane_u16(x0, y, 3);
+        bench_opaque(z0);
+        bench_opaque(x1);
+        z1 = vmull_high_lane_u16(x1, y, 3);
+        bench_opaque(z1);
+        bench_opaque(x2);
+        z2 = vmull_high_lane_u16(x2, y, 3);
+        bench_opaque(z2);
+        bench_opaque(x3);
+        z3 = vmull_high_lane_u16(x3, y, 3);
+        bench_opaque(z3);
+    }
+    vst1q_u32(bench_result, z0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vmull_high_lane_u16_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vmull_high_lane_u16_rvv per iteration
+void vmull_high_lane_u16_throughput_rvvector(int iterations) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        uint16x8_t x0 = __riscv_vle16_v_u16m1(bench_a, VLEN_8);
+        uint16x4_t y = __riscv_vle16_v_u16mf2(bench_v, VLEN_4);
+    #else
+        uint16x8_t x0 = __riscv_vle16_v_u16m1(bench_a, VLEN_8);
+        uint16x4_t y = __riscv_vle16_v_u16m1(bench_v, VLEN_4);
+    #endif
+    uint16x8_t x1 = x0, x2 = x0, x3 = x0;
+    uint32x4_t z0, z1, z2, z3;
+    for (int i = 0; i < iterations; i++) {
+        bench_opaque(x0);
+        z0 = vmull_high_lane_u16_rvv(x0, y, 3);
+        bench_opaque(z0);
+        bench_opaque(x1);
+        z1 = vmull_high_lane_u16_rvv(x1, y, 3);
+        bench_opaque(z1);
+        bench_opaque(x2);
+        z2 = vmull_high_lane_u16_rvv(x2, y, 3);
+        bench_opaque(z2);
+        bench_opaque(x3);
+        z3 = vmull_high_lane_u16_rvv(x3, y, 3);
+        bench_opaque(z3);
+    }
+    __riscv_vse32_v_u32m1(bench_result, z0, VLEN_4);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vmull_high_lane_u16_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
@@ -0,0 +1,101 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vqsub_s64; the kernels load them once and
+// keep the vectors in registers for all iterations
+int64_t bench_a[1] = {1};
+int64_t bench_b[1] = {1};
+int64_t bench_result[1];
+
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vqsub_s64", "int64x1_t", 1, "latency", latency, 1);
+    bench_run(arch, "vqsub_s64", "int64x1_t", 1, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 1, INT64);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vqsub_s64 depends on the previous one
+void vqsub_s64_latency_neon(int iterations) {
+    int64x1_t x = vld1_s64(bench_a);
+    int64x1_t y = vld1_s64(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vqsub_s64(x, y);
+    }
+    vst1_s64(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vqsub_s64 per iteration
+void vqsub_s64_throughput_neon(int iterations) {
+    int64x1_t x0 = vld1_s64(bench_a);
+    int64x1_t y = vld1_s64(bench_b);
+    int64x1_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vqsub_s64(x0, y);
+        x1 = vqsub_s64(x1, y);
+        x2 = vqsub_s64(x2, y);
+        x3 = vqsub_s64(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1_s64(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vqsub_s64_latency_neon, vqsub_s64_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, each vqsub_s64_rvv depends on the previous one
+void vqsub_s64_latency_rvvector(int iterations) {
+    int64x1_t x = __riscv_vle64_v_i64m1(bench_a, VLEN_1);
+    int64x1_t y = __riscv_vle64_v_i64m1(bench_b, VLEN_1);
+    for (int i = 0; i < iterations; i++) {
+        x = vqsub_s64_rvv(x, y);
+    }
+    __riscv_vse64_v_i64m1(bench_result, x, VLEN_1);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vqsub_s64_rvv per iteration
+void vqsub_s64_throughput_rvvector(int iterations) {
+    int64x1_t x0 = __riscv_vle64_v_i64m1(bench_a, VLEN_1);
+    int64x1_t y = __riscv_vle64_v_i64m1(bench_b, VLEN_1);
+    int64x1_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vqsub_s64_rvv(x0, y);
+        x1 = vqsub_s64_rvv(x1, y);
+        x2 = vqsub_s64_rvv(x2, y);
+        x3 = vqsub_s64_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse64_v_i64m1(bench_result, x0, VLEN_1);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vqsub_s64_latency_rvvector, vqsub_s64_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
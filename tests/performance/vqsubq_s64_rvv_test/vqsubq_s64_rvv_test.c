@@ -0,0 +1,101 @@
+// Copyright 2024 10xEngineers
+
+// Generated by scripts/generate_performance_tests.py. Do not edit.
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Operands and result of the benchmarked vqsubq_s64; the kernels load them once and
+// keep the vectors in registers for all iterations
+int64_t bench_a[2] = {1, 2};
+int64_t bench_b[2] = {1, 2};
+int64_t bench_result[2];
+
+// Function to run the latency and throughput benchmarks with the given kernels
+void run_benchmarks(const char *arch, void (*latency)(int), void (*throughput)(int)) {
+    bench_run(arch, "vqsubq_s64", "int64x2_t", 2, "latency", latency, 1);
+    bench_run(arch, "vqsubq_s64", "int64x2_t", 2, "throughput", throughput, BENCH_STREAMS);
+    print_results(bench_result, 2, INT64);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, each vqsubq_s64 depends on the previous one
+void vqsubq_s64_latency_neon(int iterations) {
+    int64x2_t x = vld1q_s64(bench_a);
+    int64x2_t y = vld1q_s64(bench_b);
+    for (int i = 0; i < iterations; i++) {
+        x = vqsubq_s64(x, y);
+    }
+    vst1q_s64(bench_result, x);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vqsubq_s64 per iteration
+void vqsubq_s64_throughput_neon(int iterations) {
+    int64x2_t x0 = vld1q_s64(bench_a);
+    int64x2_t y = vld1q_s64(bench_b);
+    int64x2_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vqsubq_s64(x0, y);
+        x1 = vqsubq_s64(x1, y);
+        x2 = vqsubq_s64(x2, y);
+        x3 = vqsubq_s64(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    vst1q_s64(bench_result, x0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    run_benchmarks("ARM-Neon", vqsubq_s64_latency_neon, vqsubq_s64_throughput_neon);
+}
+
+#elif defined(RISCV_VECTOR)
+// RISC-V Vector-specific implementation, each vqsubq_s64_rvv depends on the previous one
+void vqsubq_s64_latency_rvvector(int iterations) {
+    int64x2_t x = __riscv_vle64_v_i64m1(bench_a, VLEN_2);
+    int64x2_t y = __riscv_vle64_v_i64m1(bench_b, VLEN_2);
+    for (int i = 0; i < iterations; i++) {
+        x = vqsubq_s64_rvv(x, y);
+    }
+    __riscv_vse64_v_i64m1(bench_result, x, VLEN_2);
+}
+// RISC-V Vector-specific implementation, BENCH_STREAMS independent vqsubq_s64_rvv per iteration
+void vqsubq_s64_throughput_rvvector(int iterations) {
+    int64x2_t x0 = __riscv_vle64_v_i64m1(bench_a, VLEN_2);
+    int64x2_t y = __riscv_vle64_v_i64m1(bench_b, VLEN_2);
+    int64x2_t x1 = x0, x2 = x0, x3 = x0;
+    for (int i = 0; i < iterations; i++) {
+        x0 = vqsubq_s64_rvv(x0, y);
+        x1 = vqsubq_s64_rvv(x1, y);
+        x2 = vqsubq_s64_rvv(x2, y);
+        x3 = vqsubq_s64_rvv(x3, y);
+    }
+    bench_opaque(x1);
+    bench_opaque(x2);
+    bench_opaque(x3);
+    __riscv_vse64_v_i64m1(bench_result, x0, VLEN_2);
+}
+// Function to run tests using RISC-V Vector instructions/intrinsics
+void run_tests_rvv() {
+    run_benchmarks("RISC-V", vqsubq_s64_latency_rvvector, vqsubq_s64_throughput_rvvector);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
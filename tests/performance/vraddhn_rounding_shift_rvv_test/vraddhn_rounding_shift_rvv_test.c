@@ -0,0 +1,176 @@
+// Copyright 2024 10xEngineers
+
+#include "common_utilities.h"
+#include "benchmark.h"
+
+#if defined(ARM_NEON)
+    #include <arm_neon.h>
+#elif defined(RISCV_VECTOR)
+    #include "rhal_base.h"
+#else
+    #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+#endif
+
+// Per-op cost of the rounding narrowing operations. On RISC-V the library functions (a
+// rounding scaling shift with RHAL_VXRM_EXPLICIT) are compared with the previous
+// implementations adding the rounding constant, reported with an "_add_constant" suffix;
+// run it on spike for the cycles and retired instructions per op. A narrowing result
+// cannot feed the next call, so only the throughput is measured.
+
+// Operands and results of the benchmarks, including the wrap-around of the rounding
+// constant (0xffff8000 + 0x8000, ...); the kernels load them once and keep the vectors
+// in registers for all iterations
+uint32_t bench_a_u32[4] = {0xffff8000u, 0xffff7fffu, 0x12348000u, 0x0000ffffu};
+uint32_t bench_b_u32[4] = {0x8000, 0x8000, 0x1, 0x7fff};
+uint16_t bench_result_u16[4];
+int16_t bench_a_s16[8] = {32767, -32768, 0x1280, -0x1280, 0x7f80, 0x0080, -1, 0};
+int16_t bench_b_s16[8] = {-32768, 32767, 0x0100, -0x0100, 0, 0x0081, 1, 0x7f};
+int8_t bench_result_s8[8];
+
+// Function to run the throughput benchmarks of the rounding add and rounding subtract
+// narrowing with the given kernels, the implementation as suffix of the function names
+void run_benchmarks(const char *arch, const char *suffix, void (*kernels[2])(int)) {
+    char name[32];
+
+    snprintf(name, sizeof(name), "vraddhn_u32%s", suffix);
+    bench_run(arch, name, "uint16x4_t", 4, "throughput", kernels[0], BENCH_STREAMS);
+    print_results(bench_result_u16, 4, UINT16);
+    snprintf(name, sizeof(name), "vrsubhn_s16%s", suffix);
+    bench_run(arch, name, "int8x8_t", 8, "throughput", kernels[1], BENCH_STREAMS);
+    print_results(bench_result_s8, 8, INT8);
+}
+
+#if defined(ARM_NEON)
+// ARM Neon-specific implementation, BENCH_STREAMS independent vraddhn_u32 per iteration
+void vraddhn_u32_throughput_neon(int iterations) {
+    uint32x4_t x0 = vld1q_u32(bench_a_u32);
+    uint32x4_t y = vld1q_u32(bench_b_u32);
+    uint32x4_t x1 = x0, x2 = x0, x3 = x0;
+    uint16x4_t z0, z1, z2, z3;
+    for (int i = 0; i < iterations; i++) {
+        bench_opaque(x0);
+        z0 = vraddhn_u32(x0, y);
+        bench_opaque(z0);
+        bench_opaque(x1);
+        z1 = vraddhn_u32(x1, y);
+        bench_opaque(z1);
+        bench_opaque(x2);
+        z2 = vraddhn_u32(x2, y);
+        bench_opaque(z2);
+        bench_opaque(x3);
+        z3 = vraddhn_u32(x3, y);
+        bench_opaque(z3);
+    }
+    vst1_u16(bench_result_u16, z0);
+}
+// ARM Neon-specific implementation, BENCH_STREAMS independent vrsubhn_s16 per iteration
+void vrsubhn_s16_throughput_neon(int iterations) {
+    int16x8_t x0 = vld1q_s16(bench_a_s16);
+    int16x8_t y = vld1q_s16(bench_b_s16);
+    int16x8_t x1 = x0, x2 = x0, x3 = x0;
+    int8x8_t z0, z1, z2, z3;
+    for (int i = 0; i < iterations; i++) {
+        bench_opaque(x0);
+        z0 = vrsubhn_s16(x0, y);
+        bench_opaque(z0);
+        bench_opaque(x1);
+        z1 = vrsubhn_s16(x1, y);
+        bench_opaque(z1);
+        bench_opaque(x2);
+        z2 = vrsubhn_s16(x2, y);
+        bench_opaque(z2);
+        bench_opaque(x3);
+        z3 = vrsubhn_s16(x3, y);
+        bench_opaque(z3);
+    }
+    vst1_s8(bench_result_s8, z0);
+}
+// Function to run tests using ARM Neon instructions/intrinsics
+void run_tests_neon() {
+    void (*kernels[2])(int) = {vraddhn_u32_throughput_neon, vrsubhn_s16_throughput_neon};
+    run_benchmarks("ARM-Neon", "", kernels);
+}
+
+#elif defined(RISCV_VECTOR)
+// Previous implementations adding the rounding constant, kept out-of-line like the library functions
+__attribute__((noinline)) uint16x4_t vraddhn_u32_add_constant(uint32x4_t a, uint32x4_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsrl_wx_u16mf2(__riscv_vadd_vx_u32m1(__riscv_vadd_vv_u32m1(a, b, VLEN_4), 1<<15, VLEN_4), 16, VLEN_4);
+    #else
+        return __riscv_vlmul_ext_v_u16mf2_u16m1(__riscv_vnsrl_wx_u16mf2(__riscv_vadd_vx_u32m1(__riscv_vadd_vv_u32m1(a, b, VLEN_4), 1<<15, VLEN_4), 16, VLEN_4));
+    #endif
+}
+__attribute__((noinline)) int8x8_t vrsubhn_s16_add_constant(int16x8_t a, int16x8_t b) {
+    #if defined(RHAL_FRACTIONAL_LMUL)
+        return __riscv_vnsra_wx_i8mf2(__riscv_vadd_vx_i16m1(__riscv_vsub_vv_i16m1(a, b, VLEN_8), 1<<7, VLEN_8), 8, VLEN_8);
+    #else
+        return __riscv_vlmul_ext_v_i8mf2_i8m1(__riscv_vnsra_wx_i8mf2(__riscv_vadd_vx_i16m1(__riscv_vsub_vv_i16m1(a, b, VLEN_8), 1<<7, VLEN_8), 8, VLEN_8));
+    #endif
+}
+
+// Stores of the narrowed 64-bit results
+#if defined(RHAL_FRACTIONAL_LMUL)
+    #define STORE_U16X4(p, v) __riscv_vse16_v_u16mf2(p, v, VLEN_4)
+    #define STORE_S8X8(p, v) __riscv_vse8_v_i8mf2(p, v, VLEN_8)
+#else
+    #define STORE_U16X4(p, v) __riscv_vse16_v_u16m1(p, v, VLEN_4)
+    #define STORE_S8X8(p, v) __riscv_vse8_v_i8m1(p, v, VLEN_8)
+#endif
+
+// Throughput kernel of an implementation fn of a narrowing operation on bench_a_<t> and
+// bench_b_<t>, loaded with the suffix ls (e.g. 32_v_u32m1) and stored with store
+#define BENCH_THROUGHPUT_KERNEL(name, fn, type, ntype, t, ls, vl, store, result)    \
+    void name##_throughput_rvvector(int iterations) {                           \
+        type x0 = __riscv_vle##ls(bench_a_##t, vl);                             \
+        type y = __riscv_vle##ls(bench_b_##t, vl);                              \
+        type x1 = x0, x2 = x0, x3 = x0;                                         \
+        ntype z0, z1, z2, z3;                                                   \
+        for (int i = 0; i < iterations; i++) {                                  \
+            bench_opaque(x0);                                                   \
+            z0 = fn(x0, y);                                                     \
+            bench_opaque(z0);                                                   \
+            bench_opaque(x1);                                                   \
+            z1 = fn(x1, y);                                                     \
+            bench_opaque(z1);                                                   \
+            bench_opaque(x2);                                                   \
+            z2 = fn(x2, y);                                                     \
+            bench_opaque(z2);                                                   \
+            bench_opaque(x3);                                                   \
+            z3 = fn(x3, y);                                                     \
+            bench_opaque(z3);                                                   \
+        }                                                                       \
+        store(result, z0);                                                      \
+    }
+
+// RISC-V Vector-specific implementations, the library functions and the ones adding the
+// rounding constant
+BENCH_THROUGHPUT_KERNEL(vraddhn_u32, vraddhn_u32_rvv, uint32x4_t, uint16x4_t, u32, 32_v_u32m1, VLEN_4,
+                        STORE_U16X4, bench_result_u16)
+BENCH_THROUGHPUT_KERNEL(vrsubhn_s16, vrsubhn_s16_rvv, int16x8_t, int8x8_t, s16, 16_v_i16m1, VLEN_8,
+                        STORE_S8X8, bench_result_s8)
+BENCH_THROUGHPUT_KERNEL(vraddhn_u32_add_constant, vraddhn_u32_add_constant, uint32x4_t, uint16x4_t, u32,
+                        32_v_u32m1, VLEN_4, STORE_U16X4, bench_result_u16)
+BENCH_THROUGHPUT_KERNEL(vrsubhn_s16_add_constant, vrsubhn_s16_add_constant, int16x8_t, int8x8_t, s16,
+                        16_v_i16m1, VLEN_8, STORE_S8X8, bench_result_s8)
+
+// Function to run tests using RISC-V Vector instructions/intrinsics; both implementations
+// must give the same results
+void run_tests_rvv() {
+    void (*add_constant[2])(int) = {vraddhn_u32_add_constant_throughput_rvvector,
+                                    vrsubhn_s16_add_constant_throughput_rvvector};
+    void (*library[2])(int) = {vraddhn_u32_throughput_rvvector, vrsubhn_s16_throughput_rvvector};
+    run_benchmarks("RISC-V", "_add_constant", add_constant);
+    run_benchmarks("RISC-V", "", library);
+}
+#endif
+
+int main() {
+    #if defined(RISCV_VECTOR)
+        run_tests_rvv();
+    #elif defined(ARM_NEON)
+        run_tests_neon();
+    #else
+        #error "Unsupported architecture. Please define either ARM_NEON or RISCV_VECTOR."
+    #endif
+    return 0;
+}
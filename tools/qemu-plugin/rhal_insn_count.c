@@ -0,0 +1,135 @@
+// Copyright 2024 10xEngineers
+
+/*
+ * QEMU TCG plugin counting the instructions executed by a RISC-V program:
+ * all instructions, vector instructions (OP-V arithmetic and vector loads
+ * and stores), vsetvli/vsetivli/vsetvl, and the instructions inside the
+ * R-Halogen functions (*_rvv, found through the ELF symbols). The counts
+ * are decided once per translation block and added up every time it runs,
+ * so they do not depend on the host or on timing.
+ *
+ * Usage: qemu-riscv64 -plugin librhal_insn_count.so,outfile=<csv> <elf>
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <qemu-plugin.h>
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_version = QEMU_PLUGIN_VERSION;
+
+#define OPCODE_LOAD_FP 0x07
+#define OPCODE_STORE_FP 0x27
+#define OPCODE_OP_V 0x57
+
+// Counts of one translation block, or of the whole run
+struct insn_counts {
+    uint64_t instructions;
+    uint64_t vector;
+    uint64_t vset;
+    uint64_t library;
+};
+
+static struct insn_counts totals;
+static char *outfile;
+
+static uint32_t insn_word(struct qemu_plugin_insn *insn) {
+    uint32_t word = 0;
+    size_t size = qemu_plugin_insn_size(insn);
+    if (size > sizeof(word)) {
+        size = sizeof(word);
+    }
+#if QEMU_PLUGIN_VERSION >= 2
+    qemu_plugin_insn_data(insn, &word, size);
+#else
+    memcpy(&word, qemu_plugin_insn_data(insn), size);
+#endif
+    return word;
+}
+
+static int is_vector_memory(uint32_t word) {
+    uint32_t opcode = word & 0x7f;
+    uint32_t width = (word >> 12) & 0x7;
+    // The vector loads and stores share LOAD-FP/STORE-FP with widths 0, 5, 6, 7
+    return (opcode == OPCODE_LOAD_FP || opcode == OPCODE_STORE_FP) &&
+           (width == 0 || width >= 5);
+}
+
+static int is_library_symbol(const char *symbol) {
+    size_t length = symbol ? strlen(symbol) : 0;
+    return length > 4 && strcmp(symbol + length - 4, "_rvv") == 0;
+}
+
+static void tb_exec(unsigned int vcpu_index, void *userdata) {
+    struct insn_counts *tb = userdata;
+    (void)vcpu_index;
+    __atomic_fetch_add(&totals.instructions, tb->instructions, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&totals.vector, tb->vector, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&totals.vset, tb->vset, __ATOMIC_RELAXED);
+    __atomic_fetch_add(&totals.library, tb->library, __ATOMIC_RELAXED);
+}
+
+static void tb_trans(qemu_plugin_id_t id, struct qemu_plugin_tb *tb) {
+    struct insn_counts *counts = calloc(1, sizeof(*counts));
+    size_t n = qemu_plugin_tb_n_insns(tb);
+    (void)id;
+
+    for (size_t i = 0; i < n; i++) {
+        struct qemu_plugin_insn *insn = qemu_plugin_tb_get_insn(tb, i);
+        uint32_t word = insn_word(insn);
+        counts->instructions++;
+        if ((word & 0x7f) == OPCODE_OP_V) {
+            if (((word >> 12) & 0x7) == 0x7) {
+                counts->vset++;
+            } else {
+                counts->vector++;
+            }
+        } else if (is_vector_memory(word)) {
+            counts->vector++;
+        }
+        if (is_library_symbol(qemu_plugin_insn_symbol(insn))) {
+            counts->library++;
+        }
+    }
+
+    // The counts are kept for the lifetime of the translated block
+    qemu_plugin_register_vcpu_tb_exec_cb(tb, tb_exec, QEMU_PLUGIN_CB_NO_REGS, counts);
+}
+
+static void plugin_exit(qemu_plugin_id_t id, void *userdata) {
+    FILE *file = outfile ? fopen(outfile, "w") : stderr;
+    (void)id;
+    (void)userdata;
+    if (file == NULL) {
+        perror(outfile);
+        return;
+    }
+    fprintf(file, "instructions,vector_instructions,vsetvli,library_instructions\n");
+    fprintf(file, "%llu,%llu,%llu,%llu\n",
+            (unsigned long long)totals.instructions, (unsigned long long)totals.vector,
+            (unsigned long long)totals.vset, (unsigned long long)totals.library);
+    if (file != stderr) {
+        fclose(file);
+    }
+}
+
+QEMU_PLUGIN_EXPORT int qemu_plugin_install(qemu_plugin_id_t id, const qemu_info_t *info,
+                                           int argc, char **argv) {
+    if (strcmp(info->target_name, "riscv64") != 0 && strcmp(info->target_name, "riscv32") != 0) {
+        fprintf(stderr, "rhal_insn_count: RISC-V targets only, not %s\n", info->target_name);
+        return -1;
+    }
+    for (int i = 0; i < argc; i++) {
+        if (strncmp(argv[i], "outfile=", 8) == 0) {
+            outfile = strdup(argv[i] + 8);
+        } else {
+            fprintf(stderr, "rhal_insn_count: unknown argument %s\n", argv[i]);
+            return -1;
+        }
+    }
+    qemu_plugin_register_vcpu_tb_trans_cb(id, tb_trans);
+    qemu_plugin_register_atexit_cb(id, plugin_exit, NULL);
+    return 0;
+}